@@ -46,6 +46,36 @@ void export_ActiveSpaceIntegrals(py::module& m) {
         .def("slater_rules", &ActiveSpaceIntegrals::slater_rules,
              "Compute the matrix element of the Hamiltonian between two determinants")
         .def("energy", &ActiveSpaceIntegrals::energy, "Return the energy of a determinant")
+        .def("energies", &ActiveSpaceIntegrals::energies,
+             "Return the energy of a list of determinants")
+        .def("slater_rules_single_alpha", &ActiveSpaceIntegrals::slater_rules_single_alpha,
+             "Compute the matrix element of an alpha single excitation i -> a of a determinant",
+             "det"_a, "i"_a, "a"_a)
+        .def("slater_rules_single_beta", &ActiveSpaceIntegrals::slater_rules_single_beta,
+             "Compute the matrix element of a beta single excitation i -> a of a determinant",
+             "det"_a, "i"_a, "a"_a)
+        .def(
+            "slater_rules_single_alpha_batch",
+            [](const ActiveSpaceIntegrals& as_ints, const std::vector<int>& aocc,
+               const std::vector<int>& bocc) {
+                std::vector<double> elements;
+                as_ints.slater_rules_single_alpha_batch(aocc, bocc, elements);
+                return elements;
+            },
+            "aocc"_a, "bocc"_a,
+            "Compute the unsigned matrix elements of all the alpha single excitations of a "
+            "determinant. Element [k * nmo + a] corresponds to the excitation aocc[k] -> a")
+        .def(
+            "slater_rules_single_beta_batch",
+            [](const ActiveSpaceIntegrals& as_ints, const std::vector<int>& aocc,
+               const std::vector<int>& bocc) {
+                std::vector<double> elements;
+                as_ints.slater_rules_single_beta_batch(aocc, bocc, elements);
+                return elements;
+            },
+            "aocc"_a, "bocc"_a,
+            "Compute the unsigned matrix elements of all the beta single excitations of a "
+            "determinant. Element [k * nmo + a] corresponds to the excitation bocc[k] -> a")
         .def("nuclear_repulsion_energy", &ActiveSpaceIntegrals::nuclear_repulsion_energy,
              "Get the nuclear repulsion energy")
         .def("frozen_core_energy", &ActiveSpaceIntegrals::frozen_core_energy,
@@ -60,6 +90,51 @@ void export_ActiveSpaceIntegrals(py::module& m) {
         .def("tei_aa", &ActiveSpaceIntegrals::tei_aa, "alpha-alpha two-electron integral <pq||rs>")
         .def("tei_ab", &ActiveSpaceIntegrals::tei_ab, "alpha-beta two-electron integral <pq|rs>")
         .def("tei_bb", &ActiveSpaceIntegrals::tei_bb, "beta-beta two-electron integral <pq||rs>")
+        .def("packed_tei", &ActiveSpaceIntegrals::packed_tei,
+             "Are the two-electron integrals stored in packed (restricted) form?")
+        .def("factorized_tei", &ActiveSpaceIntegrals::factorized_tei,
+             "Are the two-electron integrals stored as Cholesky vectors?")
+        .def("num_tei_factors", &ActiveSpaceIntegrals::num_tei_factors,
+             "Return the number of Cholesky vectors used to factorize the two-electron integrals")
+        .def("max_tei_aa", &ActiveSpaceIntegrals::max_tei_aa, "Return max_rs |<pq||rs>|", "p"_a,
+             "q"_a)
+        .def("max_tei_ab", &ActiveSpaceIntegrals::max_tei_ab, "Return max_rs |<pq|rs>|", "p"_a,
+             "q"_a)
+        .def("max_tei_bb", &ActiveSpaceIntegrals::max_tei_bb, "Return max_rs |<pq||rs>|", "p"_a,
+             "q"_a)
+        .def("single_coupling_bound_a", &ActiveSpaceIntegrals::single_coupling_bound_a,
+             "Return an upper bound to the coupling of an alpha single excitation i -> a", "i"_a,
+             "a"_a)
+        .def("single_coupling_bound_b", &ActiveSpaceIntegrals::single_coupling_bound_b,
+             "Return an upper bound to the coupling of a beta single excitation i -> a", "i"_a,
+             "a"_a)
+        .def("max_single_coupling_a", &ActiveSpaceIntegrals::max_single_coupling_a,
+             "Return the largest alpha single coupling bound of orbital i", "i"_a)
+        .def("max_single_coupling_b", &ActiveSpaceIntegrals::max_single_coupling_b,
+             "Return the largest beta single coupling bound of orbital i", "i"_a)
+        .def(
+            "double_excitations",
+            [](const ActiveSpaceIntegrals& as_ints, const std::string& spin, size_t i, size_t j) {
+                auto excitations = spin == "aa"   ? as_ints.double_excitations_aa(i, j)
+                                   : spin == "ab" ? as_ints.double_excitations_ab(i, j)
+                                                  : as_ints.double_excitations_bb(i, j);
+                std::vector<std::tuple<size_t, size_t, double>> result;
+                for (const auto& [a, b, value] : excitations) {
+                    result.emplace_back(a, b, value);
+                }
+                return result;
+            },
+            "spin"_a, "i"_a, "j"_a,
+            "Return the double excitations (ij) -> (ab) as a list of (a, b, integral) sorted by "
+            "decreasing magnitude. spin is one of 'aa', 'ab', or 'bb'")
+        .def("max_double_coupling_aa", &ActiveSpaceIntegrals::max_double_coupling_aa,
+             "Return the largest |<ij||ab>| over the double excitations of (ij)", "i"_a, "j"_a)
+        .def("max_double_coupling_ab", &ActiveSpaceIntegrals::max_double_coupling_ab,
+             "Return the largest |<ij|ab>| over the double excitations of (ij)", "i"_a, "j"_a)
+        .def("max_double_coupling_bb", &ActiveSpaceIntegrals::max_double_coupling_bb,
+             "Return the largest |<ij||ab>| over the double excitations of (ij)", "i"_a, "j"_a)
+        .def("set_screening_threshold", &ActiveSpaceIntegrals::set_screening_threshold,
+             "Set the threshold below which double excitations are not listed", "threshold"_a)
         .def("add", &ActiveSpaceIntegrals::add, "Add another integrals to this one", "as_ints"_a,
              "factor"_a = 1.0)
         .def("print", &ActiveSpaceIntegrals::print, "Print the integrals (alpha-alpha case)");
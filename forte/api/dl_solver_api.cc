@@ -35,6 +35,8 @@
 #include <pybind11/stl.h>
 
 #include "helpers/davidson_liu_solver.h"
+#include "helpers/lanczos_solver.h"
+#include "helpers/lobpcg_solver.h"
 
 namespace py = pybind11;
 using namespace pybind11::literals;
@@ -57,32 +59,64 @@ auto make_sigma_builder(const std::vector<std::vector<double>>& M)
 };
 
 void export_DavidsonLiuSolver(py::module& m) {
-    py::class_<DavidsonLiuSolver, std::shared_ptr<DavidsonLiuSolver>>(
-        m, "DavidsonLiuSolver", "A class to diagonalize hermitian matrices")
-        .def(py::init<size_t, size_t, size_t, size_t>(), "Initialize the solver", "size"_a,
-             "nroots"_a, "collapse_per_root"_a = 1, "subspace_per_root"_a = 5)
-        .def("add_sigma_builder", &DavidsonLiuSolver::add_sigma_builder,
+    py::class_<EigenSolver, std::shared_ptr<EigenSolver>>(
+        m, "EigenSolver", "The base class for iterative solvers of hermitian eigenvalue problems")
+        .def("add_sigma_builder", &EigenSolver::add_sigma_builder,
              "Add a function to build the sigma vector", "sigma_builder"_a)
         .def(
             "add_test_sigma_builder",
-            [](DavidsonLiuSolver& self, const std::vector<std::vector<double>>& M) {
+            [](EigenSolver& self, const std::vector<std::vector<double>>& M) {
                 self.add_sigma_builder(make_sigma_builder(M));
             },
             "Create a sigma builder from a matrix", "M"_a)
-        .def("add_h_diag", &DavidsonLiuSolver::add_h_diag, "Add the diagonal of the Hamiltonian")
-        .def("add_guesses", &DavidsonLiuSolver::add_guesses, "Add the initial guesses")
-        .def("add_project_out_vectors", &DavidsonLiuSolver::add_project_out_vectors,
+        .def("add_h_diag", &EigenSolver::add_h_diag, "Add the diagonal of the Hamiltonian")
+        .def("add_guesses", &EigenSolver::add_guesses, "Add the initial guesses")
+        .def("add_project_out_vectors", &EigenSolver::add_project_out_vectors,
              "Add vectors to project out of the subspace")
-        .def("set_print_level", &DavidsonLiuSolver::set_print_level, "Set the print level")
-        .def("set_e_convergence", &DavidsonLiuSolver::set_e_convergence,
-             "Set the energy convergence")
-        .def("set_r_convergence", &DavidsonLiuSolver::set_r_convergence,
+        .def("set_print_level", &EigenSolver::set_print_level, "Set the print level")
+        .def("set_e_convergence", &EigenSolver::set_e_convergence, "Set the energy convergence")
+        .def("set_r_convergence", &EigenSolver::set_r_convergence,
              "Set the residual convergence")
-        .def("solve", &DavidsonLiuSolver::solve, "The main solver function")
-        .def("reset", &DavidsonLiuSolver::reset, "Function to reset the solver")
-        .def("eigenvalues", &DavidsonLiuSolver::eigenvalues, "Return the eigenvalues")
-        .def("eigenvectors", &DavidsonLiuSolver::eigenvectors, "Return the eigenvectors")
-        .def("eigenvector", &DavidsonLiuSolver::eigenvector, "Return the n-th eigenvector");
+        .def("set_maxiter", &EigenSolver::set_maxiter, "Set the maximum number of iterations")
+        .def("set_sigma_block_size", &EigenSolver::set_sigma_block_size,
+             "Set the maximum number of vectors passed to the sigma builder in one call")
+        .def("solve", &EigenSolver::solve, "The main solver function")
+        .def("reset", &EigenSolver::reset, "Function to reset the solver")
+        .def("name", &EigenSolver::name, "Return the name of the solver")
+        .def("size", &EigenSolver::size, "Return the size of the space")
+        .def("iterations", &EigenSolver::iterations,
+             "Return the number of iterations performed in the last call to solve")
+        .def("num_sigma_vectors", &EigenSolver::num_sigma_vectors,
+             "Return the number of sigma vectors computed in the last call to solve")
+        .def("eigenvalues", &EigenSolver::eigenvalues, "Return the eigenvalues")
+        .def("eigenvectors", &EigenSolver::eigenvectors, "Return the eigenvectors")
+        .def("eigenvector", &EigenSolver::eigenvector, "Return the n-th eigenvector");
+
+    py::class_<DavidsonLiuSolver, EigenSolver, std::shared_ptr<DavidsonLiuSolver>>(
+        m, "DavidsonLiuSolver", "A class to diagonalize hermitian matrices")
+        .def(py::init<size_t, size_t, size_t, size_t>(), "Initialize the solver", "size"_a,
+             "nroots"_a, "collapse_per_root"_a = 1, "subspace_per_root"_a = 5)
+        .def("set_mixed_precision", &DavidsonLiuSolver::set_mixed_precision,
+             "Store the basis and sigma vectors in single precision");
+
+    py::class_<LOBPCGSolver, EigenSolver, std::shared_ptr<LOBPCGSolver>>(
+        m, "LOBPCGSolver", "A LOBPCG solver for hermitian matrices")
+        .def(py::init<size_t, size_t>(), "Initialize the solver", "size"_a, "nroots"_a);
+
+    py::class_<LanczosSolver, EigenSolver, std::shared_ptr<LanczosSolver>>(
+        m, "LanczosSolver", "A thick-restart Lanczos solver for hermitian matrices")
+        .def(py::init<size_t, size_t, size_t, size_t>(), "Initialize the solver", "size"_a,
+             "nroots"_a, "collapse_per_root"_a = 1, "subspace_per_root"_a = 5);
+
+    m.def(
+        "make_eigen_solver",
+        [](const std::string& type, size_t size, size_t nroot, size_t collapse_per_root,
+           size_t subspace_per_root) {
+            return make_eigen_solver(string_to_eigen_solver_type(type), size, nroot,
+                                     collapse_per_root, subspace_per_root);
+        },
+        "Create an eigensolver of a given type (DL, LOBPCG, or LANCZOS)", "type"_a, "size"_a,
+        "nroots"_a, "collapse_per_root"_a = 1, "subspace_per_root"_a = 5);
 }
 
 } // namespace forte
@@ -45,6 +45,7 @@
 #include "base_classes/state_info.h"
 #include "base_classes/scf_info.h"
 
+#include "integrals/fcidump.h"
 #include "integrals/make_integrals.h"
 
 #include "orbital-helpers/aosubspace.h"
@@ -102,6 +103,48 @@ PYBIND11_MODULE(_forte, m) {
     m.def("make_embedding", &make_embedding, "Apply fragment projector to embed");
     m.def("make_custom_ints", &make_custom_forte_integrals,
           "Make a custom Forte integral object from arrays");
+    m.def(
+        "make_custom_ints_packed",
+        [](std::shared_ptr<ForteOptions> options, std::shared_ptr<SCFInfo> scf_info,
+           std::shared_ptr<MOSpaceInfo> mo_space_info, double scalar,
+           const std::vector<double>& oei,
+           py::array_t<double, py::array::c_style | py::array::forcecast> packed_tei) {
+            std::vector<double> tei(packed_tei.data(), packed_tei.data() + packed_tei.size());
+            return make_custom_forte_integrals_packed(options, scf_info, mo_space_info, scalar,
+                                                      oei, std::move(tei));
+        },
+        "options"_a, "scf_info"_a, "mo_space_info"_a, "scalar"_a, "oei"_a, "packed_tei"_a,
+        "Make a custom Forte integral object from packed spin-restricted integrals");
+    m.def(
+        "read_fcidump",
+        [](const std::string& filename) {
+            auto fcidump = read_fcidump(filename);
+            py::dict d;
+            d["norb"] = fcidump.norb;
+            d["nelec"] = fcidump.nelec;
+            d["ms2"] = fcidump.ms2;
+            d["isym"] = fcidump.isym;
+            d["uhf"] = false;
+            d["orbsym"] = fcidump.orbsym;
+            if (not fcidump.pntgrp.empty())
+                d["pntgrp"] = fcidump.pntgrp;
+            d["enuc"] = fcidump.enuc;
+            const size_t norb = fcidump.norb;
+            d["hcore"] = vector_to_np(fcidump.hcore, std::vector<size_t>{norb, norb});
+            if (not fcidump.epsilon.empty())
+                d["epsilon"] = vector_to_np(fcidump.epsilon, std::vector<size_t>{norb});
+            d["eri_packed"] = vector_to_np(fcidump.eri, std::vector<size_t>{fcidump.eri.size()});
+            return d;
+        },
+        "filename"_a,
+        "Read a FCIDUMP file (text or binary). The two-electron integrals are returned in packed "
+        "form under the key eri_packed");
+    m.def(
+        "convert_fcidump_to_binary",
+        [](const std::string& filename, const std::string& binary_filename) {
+            write_fcidump_binary(binary_filename, read_fcidump(filename));
+        },
+        "filename"_a, "binary_filename"_a, "Convert a FCIDUMP file to the binary packed format");
     m.def("make_ints_from_psi4", &make_forte_integrals_from_psi4, "ref_wfn"_a, "options"_a,
           "scf_info"_a, "mo_space_info"_a, "int_type"_a = "",
           "Make a Forte integral object from psi4");
@@ -119,7 +162,9 @@ PYBIND11_MODULE(_forte, m) {
           "states.");
     m.def("make_state_weights_map", &make_state_weights_map,
           "Make a list of target states with their weigth");
-    m.def("make_active_space_ints", &make_active_space_ints,
+    m.def("make_active_space_ints", &make_active_space_ints, "mo_space_info"_a, "ints"_a,
+          "active_space"_a, "core_spaces"_a, "packed_tei"_a = false,
+          "factorized_tei"_a = false, "factorization_threshold"_a = 1.0e-10,
           "Make an object that holds the molecular orbital integrals for the active orbitals");
     m.def("make_dynamic_correlation_solver", &make_dynamic_correlation_solver,
           "Make a dynamical correlation solver");
@@ -121,7 +121,27 @@ void export_RDMs(py::module& m) {
         .def(
             "SF_L3", [](RDMs& rdm) { return ambit_to_np(rdm.SF_L3()); },
             "Return the spin-free (Ms-averaged) 2-cumulant as a numpy array")
+        .def(
+            "cumulant_slice",
+            [](RDMs& rdm, const std::string& block,
+               const std::vector<std::vector<size_t>>& indices) {
+                return ambit_to_np(rdm.cumulant_slice(block, indices));
+            },
+            "block"_a, "indices"_a,
+            "Return a slice of a cumulant block (L2aa, ..., SF_L3) as a numpy array")
+        .def("set_cache_cumulants", &RDMs::set_cache_cumulants, "value"_a,
+             "Enable or disable the caching of density cumulants (disabled by default)")
+        .def("clear_cumulant_cache", &RDMs::clear_cumulant_cache,
+             "Drop the cached density cumulants")
+        .def("scale", &RDMs::scale, "factor"_a, "Scale the RDMs by a factor")
         .def("rotate", &RDMs::rotate, "Ua"_a, "Ub"_a,
-             "Rotate RDMs using the input unitary matrices");
+             "Rotate RDMs using the input unitary matrices")
+        .def("pack", &RDMs::pack, "Store the 2- and 3-body RDMs in packed form")
+        .def("unpack", &RDMs::unpack, "Store the 2- and 3-body RDMs as dense tensors")
+        .def("packed", &RDMs::packed, "Return true if the 2- and 3-body RDMs are packed")
+        .def("dump_to_disk", &RDMs::dump_to_disk, "filename_prefix"_a = "",
+             "Save the RDMs to disk (binary files)")
+        .def_static("build_from_disk", &RDMs::build_from_disk, "max_rdm_level"_a, "type"_a,
+                    "filename_prefix"_a = "", "Read RDMs saved with dump_to_disk");
 }
 } // namespace forte
@@ -88,6 +88,11 @@ void ActiveSpaceMethod::set_dump_trdm(bool dump) { dump_trdm_ = dump; }
 
 void ActiveSpaceMethod::set_wfn_filename(const std::string& name) { wfn_filename_ = name; }
 
+void ActiveSpaceMethod::set_wfn_format(bool binary, bool compress) {
+    binary_wfn_ = binary;
+    compress_wfn_ = compress;
+}
+
 void ActiveSpaceMethod::set_root(int value) { root_ = value; }
 
 void ActiveSpaceMethod::set_print(PrintLevel level) { print_ = level; }
@@ -178,7 +183,9 @@ std::shared_ptr<ActiveSpaceMethod> make_active_space_method(
     auto nactv = mo_space_info->size("ACTIVE");
     std::string prefix = "forte." + lower_string(type) + ".o" + std::to_string(nactv) + ".";
     std::string state_str = method->state().str_short();
-    method->set_wfn_filename(prefix + state_str + ".txt");
+    bool binary = options->get_str("ACTIVE_WFN_FORMAT") == "BINARY";
+    method->set_wfn_format(binary, options->get_bool("ACTIVE_WFN_COMPRESS"));
+    method->set_wfn_filename(prefix + state_str + (binary ? ".bin" : ".txt"));
 
     return method;
 }
@@ -278,6 +278,9 @@ class ActiveSpaceMethod {
     /// Return if we read wave function guess from disk
     bool read_wfn_guess() const { return read_wfn_guess_; }
 
+    /// Return if the wave function is stored in the binary checkpoint format
+    bool binary_wfn() const { return binary_wfn_; }
+
     // ==> Base Class Handles Set Functions <==
 
     /// Set the energy convergence criterion
@@ -308,6 +311,11 @@ class ActiveSpaceMethod {
     /// @param name the wave function file name
     void set_wfn_filename(const std::string& name);
 
+    /// Set the format used to store the wave function on disk
+    /// @param binary use the binary checkpoint format instead of text
+    /// @param compress compress the binary checkpoint
+    void set_wfn_format(bool binary, bool compress);
+
     /// Set the root that will be used to compute the properties
     /// @param the root (root = 0, 1, 2, ...)
     void set_root(int value);
@@ -385,6 +393,10 @@ class ActiveSpaceMethod {
     bool dump_wfn_ = false;
     /// The file name for storing wave function (determinants, CI coefficients)
     std::string wfn_filename_;
+    /// Store the wave function in the binary checkpoint format?
+    bool binary_wfn_ = false;
+    /// Compress the binary checkpoint?
+    bool compress_wfn_ = true;
 };
 
 /**
@@ -875,6 +875,10 @@ std::shared_ptr<RDMs> ActiveSpaceSolver::compute_average_rdms(
     const std::map<StateInfo, std::vector<double>>& state_weights_map, int max_rdm_level,
     RDMsType rdm_type) {
     auto rdms = RDMs::build(max_rdm_level, mo_space_info_->size("ACTIVE"), rdm_type);
+    // accumulate directly into packed storage so that only one dense copy is alive at a time
+    if (options_->get_bool("PACKED_RDMS")) {
+        rdms->pack();
+    }
 
     // Loop through references, add to master ref
     for (const auto& state_nroot : state_nroots_map_) {
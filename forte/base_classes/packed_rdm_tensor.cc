@@ -0,0 +1,432 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp_get_thread_num() 0
+#define omp_get_num_threads() 1
+#endif
+
+#include "base_classes/packed_rdm_tensor.h"
+
+namespace forte {
+
+namespace {
+/// The signature at the beginning of a packed tensor file
+constexpr char packed_file_magic[8] = {'F', 'P', 'R', 'D', 'M', '0', '0', '1'};
+
+/// @return all the permutations of (0, 1, ..., k - 1) in lexicographic order
+std::vector<std::vector<size_t>> permutations(size_t k) {
+    std::vector<std::vector<size_t>> perms;
+    std::vector<size_t> perm(k);
+    std::iota(perm.begin(), perm.end(), 0);
+    do {
+        perms.push_back(perm);
+    } while (std::next_permutation(perm.begin(), perm.end()));
+    return perms;
+}
+} // namespace
+
+PackedRDMTensor::PackedRDMTensor(RDMPacking packing, size_t n, const std::vector<size_t>& groups)
+    : packing_(packing), n_(n), groups_(groups) {
+    if (groups.empty() or std::find(groups.begin(), groups.end(), 0) != groups.end()) {
+        throw std::runtime_error("PackedRDMTensor: index groups must be nonempty");
+    }
+    rank_ = std::accumulate(groups.begin(), groups.end(), size_t(0));
+    if (packing == RDMPacking::pair_symmetric) {
+        rank_ *= 2;
+    }
+    if (rank_ % 2 != 0) {
+        throw std::runtime_error("PackedRDMTensor: the tensor must have an even number of indices");
+    }
+    if (rank_ > max_rank) {
+        throw std::runtime_error("PackedRDMTensor: at most " + std::to_string(max_rank) +
+                                 " indices are supported");
+    }
+
+    // the largest argument of the binomial coefficients used to address the unique elements
+    size_t max_k = *std::max_element(groups.begin(), groups.end());
+    size_t max_a = packing == RDMPacking::antisymmetric ? n : n * n + max_k;
+    binomial_.assign(max_k + 1, std::vector<size_t>(max_a + 1, 0));
+    for (size_t a = 0; a <= max_a; ++a) {
+        binomial_[0][a] = 1;
+        for (size_t k = 1; k <= std::min(a, max_k); ++k) {
+            binomial_[k][a] = binomial_[k - 1][a - 1] + (k < a ? binomial_[k][a - 1] : 0);
+        }
+    }
+
+    size_t packed_size = 1;
+    for (size_t k : groups_) {
+        size_t dim = packing == RDMPacking::antisymmetric ? binomial(n, k)
+                                                            : binomial(n * n + k - 1, k);
+        group_dims_.push_back(dim);
+        packed_size *= dim;
+    }
+    data_.assign(packed_size, 0.0);
+}
+
+PackedRDMTensor PackedRDMTensor::antisymmetric(size_t n, const std::vector<size_t>& groups) {
+    return PackedRDMTensor(RDMPacking::antisymmetric, n, groups);
+}
+
+PackedRDMTensor PackedRDMTensor::pair_symmetric(size_t n, size_t k) {
+    return PackedRDMTensor(RDMPacking::pair_symmetric, n, {k});
+}
+
+size_t PackedRDMTensor::dense_size() const {
+    size_t size = 1;
+    for (size_t i = 0; i < rank_; ++i) {
+        size *= n_;
+    }
+    return rank_ == 0 ? 0 : size;
+}
+
+size_t PackedRDMTensor::combination_index(const size_t* a, size_t k) const {
+    size_t c = 0;
+    for (size_t i = 0; i < k; ++i) {
+        c += binomial(a[i], i + 1);
+    }
+    return c;
+}
+
+void PackedRDMTensor::combination(size_t c, size_t k, size_t max_value, size_t* a) const {
+    size_t x = max_value;
+    for (size_t i = k; i > 0; --i) {
+        // find the largest x < (previous x) such that C(x, i) <= c
+        do {
+            --x;
+        } while (binomial(x, i) > c);
+        a[i - 1] = x;
+        c -= binomial(x, i);
+    }
+}
+
+int PackedRDMTensor::sort_with_parity(size_t* a, size_t k) {
+    int sign = 1;
+    for (size_t i = 1; i < k; ++i) {
+        for (size_t j = i; j > 0 and a[j - 1] > a[j]; --j) {
+            std::swap(a[j - 1], a[j]);
+            sign = -sign;
+        }
+    }
+    return sign;
+}
+
+void PackedRDMTensor::pack(const double* dense) {
+    if (packing_ == RDMPacking::antisymmetric) {
+        pack_unpack_antisymmetric(dense, data_.data(), true);
+    } else {
+        pack_unpack_pair_symmetric(dense, data_.data(), true);
+    }
+}
+
+void PackedRDMTensor::unpack(double* dense) const {
+    if (packing_ == RDMPacking::antisymmetric) {
+        pack_unpack_antisymmetric(data_.data(), dense, false);
+    } else {
+        pack_unpack_pair_symmetric(data_.data(), dense, false);
+    }
+}
+
+void PackedRDMTensor::pack_unpack_antisymmetric(const double* in, double* out, bool pack) const {
+    const size_t ngroups = groups_.size();
+
+    std::vector<size_t> stride(rank_, 1);
+    for (size_t i = rank_ - 1; i > 0; --i) {
+        stride[i - 1] = stride[i] * n_;
+    }
+
+    // For each group and each unique combination, tabulate the dense offsets and signs of all the
+    // permutations of the combination. The identity permutation comes first.
+    std::vector<size_t> nperms(ngroups);
+    std::vector<std::vector<size_t>> offsets(ngroups);
+    std::vector<std::vector<double>> signs(ngroups);
+    for (size_t g = 0, first = 0; g < ngroups; first += groups_[g], ++g) {
+        const size_t k = groups_[g];
+        const auto perms = permutations(k);
+        nperms[g] = perms.size();
+        std::vector<size_t> a(k), b(k);
+        for (size_t c = 0; c < group_dims_[g]; ++c) {
+            combination(c, k, n_, a.data());
+            for (const auto& perm : perms) {
+                size_t offset = 0;
+                for (size_t j = 0; j < k; ++j) {
+                    b[j] = a[perm[j]];
+                    offset += b[j] * stride[first + j];
+                }
+                offsets[g].push_back(offset);
+                signs[g].push_back(sort_with_parity(b.data(), k));
+            }
+        }
+    }
+
+    const size_t packed_size = data_.size();
+
+    if (pack) {
+#pragma omp parallel for schedule(static)
+        for (size_t I = 0; I < packed_size; ++I) {
+            size_t offset = 0;
+            for (size_t g = ngroups, J = I; g > 0; --g) {
+                offset += offsets[g - 1][(J % group_dims_[g - 1]) * nperms[g - 1]];
+                J /= group_dims_[g - 1];
+            }
+            out[I] = in[offset];
+        }
+        return;
+    }
+
+    const size_t size = dense_size();
+#pragma omp parallel
+    {
+        std::vector<size_t> c(ngroups), perm(ngroups);
+
+        // elements with a repeated index within a group are zero
+#pragma omp for schedule(static)
+        for (size_t i = 0; i < size; ++i) {
+            out[i] = 0.0;
+        }
+
+#pragma omp for schedule(static)
+        for (size_t I = 0; I < packed_size; ++I) {
+            for (size_t g = ngroups, J = I; g > 0; --g) {
+                c[g - 1] = (J % group_dims_[g - 1]) * nperms[g - 1];
+                J /= group_dims_[g - 1];
+            }
+            // loop over the direct product of the permutations of each group
+            std::fill(perm.begin(), perm.end(), 0);
+            while (true) {
+                size_t offset = 0;
+                double value = in[I];
+                for (size_t g = 0; g < ngroups; ++g) {
+                    offset += offsets[g][c[g] + perm[g]];
+                    value *= signs[g][c[g] + perm[g]];
+                }
+                out[offset] = value;
+
+                size_t g = ngroups;
+                while (g > 0 and ++perm[g - 1] == nperms[g - 1]) {
+                    perm[g - 1] = 0;
+                    --g;
+                }
+                if (g == 0)
+                    break;
+            }
+        }
+    }
+}
+
+void PackedRDMTensor::pack_unpack_pair_symmetric(const double* in, double* out, bool pack) const {
+    const size_t k = groups_[0];
+    const size_t m = n_ * n_;
+    const size_t packed_size = data_.size();
+
+    std::vector<size_t> stride(rank_, 1);
+    for (size_t i = rank_ - 1; i > 0; --i) {
+        stride[i - 1] = stride[i] * n_;
+    }
+    // the dense offset of the pair index b placed in the j-th (upper, lower) slot
+    auto pair_offset = [&](size_t b, size_t j) {
+        return (b / n_) * stride[j] + (b % n_) * stride[k + j];
+    };
+    const auto perms = permutations(k);
+
+    // Each thread processes a contiguous range of unique elements. The range start is unranked
+    // once and the following elements are generated in colex order.
+#pragma omp parallel
+    {
+        const size_t nthreads = omp_get_num_threads();
+        const size_t thread_id = omp_get_thread_num();
+        const size_t begin = packed_size * thread_id / nthreads;
+        const size_t end = packed_size * (thread_id + 1) / nthreads;
+
+        std::vector<size_t> b(k + 1);
+        if (begin < end) {
+            combination(begin, k, m + k - 1, b.data());
+            for (size_t i = 0; i < k; ++i) {
+                b[i] -= i;
+            }
+        }
+        b[k] = m - 1;
+
+        for (size_t I = begin; I < end; ++I) {
+            if (pack) {
+                size_t offset = 0;
+                for (size_t j = 0; j < k; ++j) {
+                    offset += pair_offset(b[j], j);
+                }
+                out[I] = in[offset];
+            } else {
+                for (const auto& perm : perms) {
+                    size_t offset = 0;
+                    for (size_t j = 0; j < k; ++j) {
+                        offset += pair_offset(b[perm[j]], j);
+                    }
+                    out[offset] = in[I];
+                }
+            }
+            // next nondecreasing sequence in colex order
+            size_t i = 0;
+            while (i < k and b[i] == b[i + 1]) {
+                ++i;
+            }
+            if (i < k) {
+                ++b[i];
+                std::fill(b.begin(), b.begin() + i, 0);
+            }
+        }
+    }
+}
+
+double PackedRDMTensor::get(const size_t* idx) const {
+    size_t a[max_rank];
+    size_t I = 0;
+    double sign = 1.0;
+    if (packing_ == RDMPacking::antisymmetric) {
+        for (size_t g = 0, first = 0; g < groups_.size(); first += groups_[g], ++g) {
+            const size_t k = groups_[g];
+            std::copy(idx + first, idx + first + k, a);
+            sign *= sort_with_parity(a, k);
+            for (size_t j = 1; j < k; ++j) {
+                if (a[j - 1] == a[j])
+                    return 0.0;
+            }
+            I = I * group_dims_[g] + combination_index(a, k);
+        }
+    } else {
+        const size_t k = groups_[0];
+        for (size_t j = 0; j < k; ++j) {
+            a[j] = idx[j] * n_ + idx[k + j];
+        }
+        sort_with_parity(a, k);
+        for (size_t j = 0; j < k; ++j) {
+            a[j] += j;
+        }
+        I = combination_index(a, k);
+    }
+    return sign * data_[I];
+}
+
+void PackedRDMTensor::canonical_indices(size_t I, size_t* idx) const {
+    if (packing_ == RDMPacking::antisymmetric) {
+        for (size_t g = groups_.size(), last = rank_; g > 0; --g) {
+            const size_t k = groups_[g - 1];
+            last -= k;
+            combination(I % group_dims_[g - 1], k, n_, idx + last);
+            I /= group_dims_[g - 1];
+        }
+    } else {
+        const size_t k = groups_[0];
+        size_t b[max_rank];
+        combination(I, k, n_ * n_ + k - 1, b);
+        for (size_t j = 0; j < k; ++j) {
+            b[j] -= j;
+            idx[j] = b[j] / n_;
+            idx[k + j] = b[j] % n_;
+        }
+    }
+}
+
+void PackedRDMTensor::zero() { std::fill(data_.begin(), data_.end(), 0.0); }
+
+void PackedRDMTensor::scale(double factor) {
+    for (auto& x : data_) {
+        x *= factor;
+    }
+}
+
+void PackedRDMTensor::axpy(double a, const PackedRDMTensor& x) {
+    if (packing_ != x.packing_ or n_ != x.n_ or groups_ != x.groups_) {
+        throw std::runtime_error("PackedRDMTensor: inconsistent tensors in axpy");
+    }
+    for (size_t i = 0, size = data_.size(); i < size; ++i) {
+        data_[i] += a * x.data_[i];
+    }
+}
+
+void PackedRDMTensor::save(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary);
+    if (not file) {
+        throw std::runtime_error("PackedRDMTensor: cannot open file " + filename);
+    }
+    std::vector<uint64_t> header{static_cast<uint64_t>(packing_), n_, groups_.size()};
+    header.insert(header.end(), groups_.begin(), groups_.end());
+    header.push_back(data_.size());
+
+    file.write(packed_file_magic, sizeof(packed_file_magic));
+    file.write(reinterpret_cast<const char*>(header.data()), header.size() * sizeof(uint64_t));
+    file.write(reinterpret_cast<const char*>(data_.data()), data_.size() * sizeof(double));
+}
+
+PackedRDMTensor PackedRDMTensor::load(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (not file) {
+        throw std::runtime_error("PackedRDMTensor: cannot open file " + filename);
+    }
+    char magic[sizeof(packed_file_magic)];
+    file.read(magic, sizeof(magic));
+    if (not file or std::memcmp(magic, packed_file_magic, sizeof(magic)) != 0) {
+        throw std::runtime_error("PackedRDMTensor: " + filename + " is not a packed RDM file");
+    }
+
+    auto read_value = [&]() {
+        uint64_t value = 0;
+        file.read(reinterpret_cast<char*>(&value), sizeof(value));
+        return value;
+    };
+    auto packing = static_cast<RDMPacking>(read_value());
+    size_t n = read_value();
+    std::vector<size_t> groups(read_value());
+    for (auto& k : groups) {
+        k = read_value();
+    }
+    size_t size = read_value();
+    if (not file) {
+        throw std::runtime_error("PackedRDMTensor: corrupted header in " + filename);
+    }
+
+    PackedRDMTensor T(packing, n, groups);
+    if (T.size() != size) {
+        throw std::runtime_error("PackedRDMTensor: inconsistent size in " + filename);
+    }
+    file.read(reinterpret_cast<char*>(T.data_.data()), size * sizeof(double));
+    if (not file) {
+        throw std::runtime_error("PackedRDMTensor: unexpected end of file " + filename);
+    }
+    return T;
+}
+
+} // namespace forte
@@ -0,0 +1,163 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace forte {
+
+/// The permutational symmetry exploited by a PackedRDMTensor
+enum class RDMPacking {
+    /// Antisymmetric under transpositions of two indices within the same index group
+    antisymmetric,
+    /// Symmetric under simultaneous permutations of the (upper, lower) index pairs
+    pair_symmetric
+};
+
+/**
+ * @class PackedRDMTensor
+ *
+ * @brief Stores only the symmetry-unique elements of an RDM or density cumulant.
+ *
+ * The dense tensor T has 2k indices of dimension n and is stored in row-major order.
+ *
+ * Antisymmetric packing partitions the indices of T into consecutive groups. T changes sign
+ * under a transposition of two indices that belong to the same group, so only the elements with
+ * strictly increasing indices within each group are stored. For example:
+ *
+ *   g2aa[pqrs]     groups {2, 2}        p < q, r < s          (n(n-1)/2)^2 elements
+ *   g3aab[pqRstU]  groups {2, 1, 2, 1}  p < q, s < t          (n^2(n-1)/2)^2 elements
+ *   g3aaa[pqrstu]  groups {3, 3}        p < q < r, s < t < u  (n(n-1)(n-2)/6)^2 elements
+ *
+ * Pair-symmetric packing applies to spin-free RDMs, which are invariant under simultaneous
+ * permutations of the pairs (p1,q1), ..., (pk,qk) of T[p1,...,pk,q1,...,qk]. Only the elements
+ * with nondecreasing compound pair indices p_i * n + q_i are stored, which saves a factor of
+ * about k! for large n.
+ *
+ * Neither scheme assumes hermiticity, so transition RDMs can be packed as well.
+ *
+ * Within a group, unique elements are addressed with the combinatorial number system (colex
+ * order), and groups are laid out in row-major order.
+ */
+class PackedRDMTensor {
+  public:
+    /// Default constructor (empty tensor)
+    PackedRDMTensor() = default;
+
+    /// Build a zero antisymmetric packed tensor
+    /// @param n the dimension of each index
+    /// @param groups the size of each index group, which must add up to an even number
+    static PackedRDMTensor antisymmetric(size_t n, const std::vector<size_t>& groups);
+
+    /// Build a zero pair-symmetric packed tensor for a k-body quantity (2k indices)
+    static PackedRDMTensor pair_symmetric(size_t n, size_t k);
+
+    /// Load a packed tensor written by save()
+    static PackedRDMTensor load(const std::string& filename);
+
+    /// @return the packing scheme
+    RDMPacking packing() const { return packing_; }
+    /// @return the dimension of each index
+    size_t n() const { return n_; }
+    /// @return the number of indices of the dense tensor
+    size_t rank() const { return rank_; }
+    /// @return the index groups
+    const std::vector<size_t>& groups() const { return groups_; }
+    /// @return the number of unique (stored) elements
+    size_t size() const { return data_.size(); }
+    /// @return the number of elements of the dense tensor
+    size_t dense_size() const;
+    /// @return true if this tensor was default constructed
+    bool empty() const { return rank_ == 0; }
+
+    /// @return the unique elements
+    std::vector<double>& data() { return data_; }
+    /// @return the unique elements
+    const std::vector<double>& data() const { return data_; }
+
+    /// Gather the unique elements from a dense tensor (the other elements are not read)
+    void pack(const double* dense);
+    /// Scatter the unique elements into a dense tensor (all dense_size() elements are written)
+    void unpack(double* dense) const;
+
+    /// @return the element T[idx[0], ..., idx[rank - 1]] of the dense tensor
+    double get(const size_t* idx) const;
+    /// @return the element T[idx] of the dense tensor
+    double get(std::initializer_list<size_t> idx) const { return get(idx.begin()); }
+
+    /// Write the dense indices of the unique element I into idx (ascending within each group)
+    void canonical_indices(size_t I, size_t* idx) const;
+
+    /// Zero all the elements
+    void zero();
+    /// Scale all the elements by a factor
+    void scale(double factor);
+    /// this += a * x (x must have the same packing, dimension, and groups)
+    void axpy(double a, const PackedRDMTensor& x);
+
+    /// Write the packed tensor to a binary file
+    void save(const std::string& filename) const;
+
+  private:
+    /// The maximum number of indices of the dense tensor
+    static constexpr size_t max_rank = 12;
+
+    PackedRDMTensor(RDMPacking packing, size_t n, const std::vector<size_t>& groups);
+
+    /// @return the binomial coefficient C(a, k) from the precomputed table
+    size_t binomial(size_t a, size_t k) const { return binomial_[k][a]; }
+    /// @return the colex index of the strictly increasing sequence a[0] < ... < a[k-1]
+    size_t combination_index(const size_t* a, size_t k) const;
+    /// Write the k elements of the strictly increasing sequence with colex index c into a
+    void combination(size_t c, size_t k, size_t max_value, size_t* a) const;
+    /// Sort the k elements of a in place and return the parity (+1/-1) of the permutation
+    static int sort_with_parity(size_t* a, size_t k);
+
+    void pack_unpack_antisymmetric(const double* in, double* out, bool pack) const;
+    void pack_unpack_pair_symmetric(const double* in, double* out, bool pack) const;
+
+    RDMPacking packing_ = RDMPacking::antisymmetric;
+    /// The dimension of each index
+    size_t n_ = 0;
+    /// The number of indices of the dense tensor
+    size_t rank_ = 0;
+    /// The size of each index group (a single group of k pairs for pair-symmetric packing)
+    std::vector<size_t> groups_;
+    /// The number of unique elements in each group
+    std::vector<size_t> group_dims_;
+    /// The table of binomial coefficients binomial_[k][a] = C(a, k)
+    std::vector<std::vector<size_t>> binomial_;
+    /// The unique elements
+    std::vector<double> data_;
+};
+
+} // namespace forte
@@ -26,6 +26,9 @@
  * @END LICENSE
  */
 
+#include <algorithm>
+#include <filesystem>
+
 #include "psi4/libpsio/psio.h"
 #include "psi4/libpsio/psio.hpp"
 #include "psi4/libpsi4util/PsiOutStream.h"
@@ -38,6 +41,181 @@
 
 namespace forte {
 
+namespace {
+/// Antisymmetric index groups of the packed aa, aaa, aab, and abb blocks
+const std::vector<size_t> groups_aa{2, 2};
+const std::vector<size_t> groups_aaa{3, 3};
+const std::vector<size_t> groups_aab{2, 1, 2, 1};
+const std::vector<size_t> groups_abb{1, 2, 1, 2};
+
+/// Pack a dense tensor into a packed tensor with the given layout
+PackedRDMTensor pack_tensor(const ambit::Tensor& T, PackedRDMTensor packed) {
+    packed.pack(T.data().data());
+    return packed;
+}
+
+/// Pack a dense tensor using the same layout as a given packed tensor
+PackedRDMTensor pack_like(const ambit::Tensor& T, const PackedRDMTensor& layout) {
+    if (layout.packing() == RDMPacking::antisymmetric) {
+        return pack_tensor(T, PackedRDMTensor::antisymmetric(layout.n(), layout.groups()));
+    }
+    return pack_tensor(T, PackedRDMTensor::pair_symmetric(layout.n(), layout.groups()[0]));
+}
+
+/// Unpack a packed tensor into a new dense tensor
+ambit::Tensor unpack_tensor(const PackedRDMTensor& packed, const std::string& name) {
+    auto T = ambit::Tensor::build(ambit::CoreTensor, name,
+                                  std::vector<size_t>(packed.rank(), packed.n()));
+    packed.unpack(T.data().data());
+    return T;
+}
+
+/// Remove the packed files of a previous dump, which build_from_disk would read first
+void remove_packed_files(const std::string& prefix, const std::vector<std::string>& names) {
+    for (const auto& name : names) {
+        std::filesystem::remove(prefix + name + ".packed.bin");
+    }
+}
+
+using ElementGetter = std::function<double(const size_t*)>;
+
+/// @return a function returning the elements of a dense tensor
+ElementGetter dense_element(const ambit::Tensor& T) {
+    const size_t rank = T.dims().size();
+    const size_t n = T.dim(0);
+    return [T, rank, n](const size_t* i) {
+        size_t I = 0;
+        for (size_t k = 0; k < rank; ++k) {
+            I = I * n + i[k];
+        }
+        return T.data()[I];
+    };
+}
+
+/// @return a function of the indices (p, q, ...) that calls an element getter
+auto indexed(ElementGetter getter) {
+    return [getter = std::move(getter)](auto... i) {
+        const size_t idx[] = {static_cast<size_t>(i)...};
+        return getter(idx);
+    };
+}
+
+// The cumulants are the RDMs plus the terms below, written for a single element. They are shared
+// by the packed cumulants and by the cumulant slices and must match the dense expressions of
+// RDMs::make_cumulant_* and RDMs::SF_L*.
+
+template <typename G1>
+double L2aa_disconnected(const G1& g1a, size_t p, size_t q, size_t r, size_t s) {
+    return -g1a(p, r) * g1a(q, s) + g1a(p, s) * g1a(q, r);
+}
+
+template <typename G1a, typename G1b>
+double L2ab_disconnected(const G1a& g1a, const G1b& g1b, size_t p, size_t q, size_t r, size_t s) {
+    return -g1a(p, r) * g1b(q, s);
+}
+
+template <typename G1, typename G2>
+double L3aaa_disconnected(const G1& g1, const G2& g2, size_t p, size_t q, size_t r, size_t s,
+                          size_t t, size_t u) {
+    double value = 0.0;
+
+    value -= g1(p, s) * g2(q, r, t, u);
+    value += g1(p, t) * g2(q, r, s, u);
+    value += g1(p, u) * g2(q, r, t, s);
+
+    value -= g1(q, t) * g2(p, r, s, u);
+    value += g1(q, s) * g2(p, r, t, u);
+    value += g1(q, u) * g2(p, r, s, t);
+
+    value -= g1(r, u) * g2(p, q, s, t);
+    value += g1(r, s) * g2(p, q, u, t);
+    value += g1(r, t) * g2(p, q, s, u);
+
+    value += 2.0 * g1(p, s) * g1(q, t) * g1(r, u);
+    value += 2.0 * g1(p, t) * g1(q, u) * g1(r, s);
+    value += 2.0 * g1(p, u) * g1(q, s) * g1(r, t);
+
+    value -= 2.0 * g1(p, s) * g1(q, u) * g1(r, t);
+    value -= 2.0 * g1(p, u) * g1(q, t) * g1(r, s);
+    value -= 2.0 * g1(p, t) * g1(q, s) * g1(r, u);
+
+    return value;
+}
+
+template <typename G1a, typename G1b, typename G2aa, typename G2ab>
+double L3aab_disconnected(const G1a& g1_a, const G1b& g1_b, const G2aa& g2_aa, const G2ab& g2_ab,
+                          size_t p, size_t q, size_t R, size_t s, size_t t, size_t U) {
+    double value = 0.0;
+
+    value -= g1_b(R, U) * g2_aa(p, q, s, t);
+
+    value -= g1_a(p, s) * g2_ab(q, R, t, U);
+    value += g1_a(p, t) * g2_ab(q, R, s, U);
+
+    value -= g1_a(q, t) * g2_ab(p, R, s, U);
+    value += g1_a(q, s) * g2_ab(p, R, t, U);
+
+    value += 2.0 * g1_a(p, s) * g1_a(q, t) * g1_b(R, U);
+    value -= 2.0 * g1_a(p, t) * g1_a(q, s) * g1_b(R, U);
+
+    return value;
+}
+
+template <typename G1a, typename G1b, typename G2ab, typename G2bb>
+double L3abb_disconnected(const G1a& g1_a, const G1b& g1_b, const G2ab& g2_ab, const G2bb& g2_bb,
+                          size_t p, size_t Q, size_t R, size_t s, size_t T, size_t U) {
+    double value = 0.0;
+
+    value -= g1_a(p, s) * g2_bb(Q, R, T, U);
+
+    value -= g1_b(Q, T) * g2_ab(p, R, s, U);
+    value += g1_b(Q, U) * g2_ab(p, R, s, T);
+
+    value -= g1_b(R, U) * g2_ab(p, Q, s, T);
+    value += g1_b(R, T) * g2_ab(p, Q, s, U);
+
+    value += 2.0 * g1_a(p, s) * g1_b(Q, T) * g1_b(R, U);
+    value -= 2.0 * g1_a(p, s) * g1_b(Q, U) * g1_b(R, T);
+
+    return value;
+}
+
+template <typename G1>
+double SF_L2_disconnected(const G1& G1_, size_t p, size_t q, size_t r, size_t s) {
+    return -G1_(p, r) * G1_(q, s) + 0.5 * G1_(p, s) * G1_(q, r);
+}
+
+template <typename G1, typename G2>
+double SF_L3_disconnected(const G1& G1_, const G2& G2_, size_t p, size_t q, size_t r, size_t s,
+                          size_t t, size_t u) {
+    double value = 0.0;
+
+    value -= G1_(p, s) * G2_(q, r, t, u);
+    value -= G1_(q, t) * G2_(p, r, s, u);
+    value -= G1_(r, u) * G2_(p, q, s, t);
+
+    value += 0.5 * G1_(p, t) * G2_(q, r, s, u);
+    value += 0.5 * G1_(p, u) * G2_(q, r, t, s);
+
+    value += 0.5 * G1_(q, s) * G2_(p, r, t, u);
+    value += 0.5 * G1_(q, u) * G2_(p, r, s, t);
+
+    value += 0.5 * G1_(r, s) * G2_(p, q, u, t);
+    value += 0.5 * G1_(r, t) * G2_(p, q, s, u);
+
+    value += 2.0 * G1_(p, s) * G1_(q, t) * G1_(r, u);
+
+    value -= G1_(p, s) * G1_(q, u) * G1_(r, t);
+    value -= G1_(p, u) * G1_(q, t) * G1_(r, s);
+    value -= G1_(p, t) * G1_(q, s) * G1_(r, u);
+
+    value += 0.5 * G1_(p, t) * G1_(q, u) * G1_(r, s);
+    value += 0.5 * G1_(p, u) * G1_(q, s) * G1_(r, t);
+
+    return value;
+}
+} // namespace
+
 std::shared_ptr<RDMs> RDMs::build(size_t max_rdm_level, size_t n_orbs, RDMsType type) {
     std::vector<size_t> dims1(2, n_orbs);
     std::vector<size_t> dims2(4, n_orbs);
@@ -111,8 +289,27 @@ std::shared_ptr<RDMs> RDMs::build_from_disk(size_t max_rdm_level, RDMsType type,
             g1b = ambit::load_tensor(prefix + "g1b.bin");
         }
         if (max_rdm_level > 1) {
-            g2aa = ambit::load_tensor(prefix + "g2aa.bin");
             g2ab = ambit::load_tensor(prefix + "g2ab.bin");
+        }
+
+        // packed RDMs store the same-spin blocks in packed files
+        if (max_rdm_level > 1 and std::filesystem::exists(prefix + "g2aa.packed.bin")) {
+            auto g2aa_packed = PackedRDMTensor::load(prefix + "g2aa.packed.bin");
+            auto g2bb_packed = PackedRDMTensor::load(prefix + "g2bb.packed.bin");
+            if (max_rdm_level == 2) {
+                return std::make_shared<RDMsSpinDependent>(g1a, g1b, std::move(g2aa_packed), g2ab,
+                                                           std::move(g2bb_packed));
+            }
+            return std::make_shared<RDMsSpinDependent>(
+                g1a, g1b, std::move(g2aa_packed), g2ab, std::move(g2bb_packed),
+                PackedRDMTensor::load(prefix + "g3aaa.packed.bin"),
+                PackedRDMTensor::load(prefix + "g3aab.packed.bin"),
+                PackedRDMTensor::load(prefix + "g3abb.packed.bin"),
+                PackedRDMTensor::load(prefix + "g3bbb.packed.bin"));
+        }
+
+        if (max_rdm_level > 1) {
+            g2aa = ambit::load_tensor(prefix + "g2aa.bin");
             g2bb = ambit::load_tensor(prefix + "g2bb.bin");
         }
         if (max_rdm_level > 2) {
@@ -137,6 +334,16 @@ std::shared_ptr<RDMs> RDMs::build_from_disk(size_t max_rdm_level, RDMsType type,
         if (max_rdm_level > 0) {
             g1 = ambit::load_tensor(prefix + "g1.bin");
         }
+
+        if (max_rdm_level > 1 and std::filesystem::exists(prefix + "g2.packed.bin")) {
+            auto g2_packed = PackedRDMTensor::load(prefix + "g2.packed.bin");
+            if (max_rdm_level == 2) {
+                return std::make_shared<RDMsSpinFree>(g1, std::move(g2_packed));
+            }
+            return std::make_shared<RDMsSpinFree>(g1, std::move(g2_packed),
+                                                  PackedRDMTensor::load(prefix + "g3.packed.bin"));
+        }
+
         if (max_rdm_level > 1) {
             g2 = ambit::load_tensor(prefix + "g2.bin");
         }
@@ -185,49 +392,207 @@ ambit::Tensor RDMs::SF_L1() const {
 
 ambit::Tensor RDMs::SF_L2() const {
     _test_rdm_level(2, "L2");
-    timer t("make_cumulant_L2");
-    auto G1 = SF_G1();
-    auto L2 = SF_G2().clone();
-    L2("pqrs") -= G1("pr") * G1("qs");
-    L2("pqrs") += 0.5 * G1("ps") * G1("qr");
+    auto L2 = _cumulant("SF_L2", [this]() {
+        timer t("make_cumulant_L2");
+        auto G1 = SF_G1();
+        auto L2 = SF_G2().clone();
+        L2("pqrs") -= G1("pr") * G1("qs");
+        L2("pqrs") += 0.5 * G1("ps") * G1("qr");
+        return L2;
+    });
     L2.set_name("SF_L2");
     return L2;
 }
 
 ambit::Tensor RDMs::SF_L3() const {
     _test_rdm_level(3, "SF_L3");
-    timer t("make_cumulant_L3");
-
-    auto G1 = SF_G1();
-    auto G2 = SF_G2();
-    auto L3 = SF_G3().clone();
+    auto L3 = _cumulant("SF_L3", [this]() {
+        timer t("make_cumulant_L3");
 
-    L3("pqrstu") -= G1("ps") * G2("qrtu");
-    L3("pqrstu") -= G1("qt") * G2("prsu");
-    L3("pqrstu") -= G1("ru") * G2("pqst");
+        auto G1 = SF_G1();
+        auto G2 = SF_G2();
+        auto L3 = SF_G3().clone();
 
-    L3("pqrstu") += 0.5 * G1("pt") * G2("qrsu");
-    L3("pqrstu") += 0.5 * G1("pu") * G2("qrts");
+        L3("pqrstu") -= G1("ps") * G2("qrtu");
+        L3("pqrstu") -= G1("qt") * G2("prsu");
+        L3("pqrstu") -= G1("ru") * G2("pqst");
 
-    L3("pqrstu") += 0.5 * G1("qs") * G2("prtu");
-    L3("pqrstu") += 0.5 * G1("qu") * G2("prst");
+        L3("pqrstu") += 0.5 * G1("pt") * G2("qrsu");
+        L3("pqrstu") += 0.5 * G1("pu") * G2("qrts");
 
-    L3("pqrstu") += 0.5 * G1("rs") * G2("pqut");
-    L3("pqrstu") += 0.5 * G1("rt") * G2("pqsu");
+        L3("pqrstu") += 0.5 * G1("qs") * G2("prtu");
+        L3("pqrstu") += 0.5 * G1("qu") * G2("prst");
 
-    L3("pqrstu") += 2.0 * G1("ps") * G1("qt") * G1("ru");
+        L3("pqrstu") += 0.5 * G1("rs") * G2("pqut");
+        L3("pqrstu") += 0.5 * G1("rt") * G2("pqsu");
 
-    L3("pqrstu") -= G1("ps") * G1("qu") * G1("rt");
-    L3("pqrstu") -= G1("pu") * G1("qt") * G1("rs");
-    L3("pqrstu") -= G1("pt") * G1("qs") * G1("ru");
+        L3("pqrstu") += 2.0 * G1("ps") * G1("qt") * G1("ru");
 
-    L3("pqrstu") += 0.5 * G1("pt") * G1("qu") * G1("rs");
-    L3("pqrstu") += 0.5 * G1("pu") * G1("qs") * G1("rt");
+        L3("pqrstu") -= G1("ps") * G1("qu") * G1("rt");
+        L3("pqrstu") -= G1("pu") * G1("qt") * G1("rs");
+        L3("pqrstu") -= G1("pt") * G1("qs") * G1("ru");
 
+        L3("pqrstu") += 0.5 * G1("pt") * G1("qu") * G1("rs");
+        L3("pqrstu") += 0.5 * G1("pu") * G1("qs") * G1("rt");
+        return L3;
+    });
     L3.set_name("SF_L3");
     return L3;
 }
 
+void RDMs::set_cache_cumulants(bool value) {
+    cache_cumulants_ = value;
+    if (not value)
+        clear_cumulant_cache();
+}
+
+void RDMs::clear_cumulant_cache() const {
+    cumulants_.clear();
+    packed_cumulants_.clear();
+}
+
+ambit::Tensor RDMs::_cumulant(const std::string& name,
+                              const std::function<ambit::Tensor()>& compute) const {
+    if (not cache_cumulants_)
+        return compute();
+    // return a copy so that changes to the returned tensor do not modify the cache
+    return cumulants_.get(name, compute)->clone();
+}
+
+ambit::Tensor RDMs::_packed_cumulant(const std::string& name,
+                                     const std::function<PackedRDMTensor()>& compute) const {
+    if (not cache_cumulants_)
+        return unpack_tensor(compute(), name);
+    return unpack_tensor(*packed_cumulants_.get(name, compute), name);
+}
+
+ambit::Tensor RDMs::cumulant_slice(const std::string& block,
+                                   const std::vector<std::vector<size_t>>& indices) const {
+    static const std::map<std::string, size_t> block_levels{
+        {"L2aa", 2},  {"L2ab", 2},  {"L2bb", 2},  {"L3aaa", 3}, {"L3aab", 3},
+        {"L3abb", 3}, {"L3bbb", 3}, {"SF_L2", 2}, {"SF_L3", 3}};
+    auto it = block_levels.find(block);
+    if (it == block_levels.end())
+        throw std::runtime_error("RDMs: invalid cumulant block " + block);
+    const size_t rank = 2 * it->second;
+    _test_rdm_level(it->second, block);
+    if (indices.size() != rank)
+        throw std::runtime_error("RDMs: " + block + " slice requires " + std::to_string(rank) +
+                                 " lists of indices");
+    std::vector<size_t> dims;
+    for (const auto& list : indices) {
+        if (std::any_of(list.begin(), list.end(), [&](size_t i) { return i >= n_orbs_; }))
+            throw std::runtime_error("RDMs: " + block + " slice index out of range");
+        dims.push_back(list.size());
+    }
+
+    timer t("cumulant_slice");
+    auto slice = ambit::Tensor::build(ambit::CoreTensor, block + " slice", dims);
+    auto& slice_data = slice.data();
+    const auto element = _cumulant_element(block);
+
+#pragma omp parallel for schedule(static)
+    for (size_t I = 0; I < slice_data.size(); ++I) {
+        size_t idx[6];
+        for (size_t k = rank, J = I; k-- > 0; J /= dims[k]) {
+            idx[k] = indices[k][J % dims[k]];
+        }
+        slice_data[I] = element(idx);
+    }
+    return slice;
+}
+
+RDMs::ElementGetter RDMs::_cumulant_element(const std::string& block) const {
+    // read the elements of cached blocks
+    if (auto L = cumulants_.find(block))
+        return dense_element(*L);
+    if (auto L = packed_cumulants_.find(block))
+        return [L](const size_t* i) { return L->get(i); };
+
+    if (block == "SF_L2") {
+        auto G1 = indexed(_rdm_element("G1"));
+        auto G2 = _rdm_element("G2");
+        return [G1, G2](const size_t* i) {
+            return G2(i) + SF_L2_disconnected(G1, i[0], i[1], i[2], i[3]);
+        };
+    }
+    if (block == "SF_L3") {
+        auto G1 = indexed(_rdm_element("G1"));
+        auto G2 = indexed(_rdm_element("G2"));
+        auto G3 = _rdm_element("G3");
+        return [G1, G2, G3](const size_t* i) {
+            return G3(i) + SF_L3_disconnected(G1, G2, i[0], i[1], i[2], i[3], i[4], i[5]);
+        };
+    }
+
+    // spin-free RDMs: use the Ms-averaged spin-free cumulants (see sf2_to_sd2aa, ...)
+    if (type_ == RDMsType::spin_free) {
+        if (block == "L2aa" or block == "L2bb" or block == "L2ab") {
+            auto L2 = _cumulant_element("SF_L2");
+            const bool ab = block == "L2ab";
+            return [L2, ab](const size_t* i) {
+                const size_t j[] = {i[0], i[1], i[3], i[2]};
+                return ab ? L2(i) / 3.0 + L2(j) / 6.0 : (L2(i) - L2(j)) / 6.0;
+            };
+        }
+        auto L3 = _cumulant_element("SF_L3");
+        const bool same_spin = block == "L3aaa" or block == "L3bbb";
+        const bool aab = block == "L3aab";
+        return [L3, same_spin, aab](const size_t* i) {
+            const size_t tus[] = {i[0], i[1], i[2], i[4], i[5], i[3]};
+            const size_t ust[] = {i[0], i[1], i[2], i[5], i[3], i[4]};
+            if (same_spin)
+                return (L3(i) + L3(tus) + L3(ust)) / 12.0;
+            const size_t swap[] = {i[0], i[1], i[2], aab ? i[4] : i[3], aab ? i[3] : i[5],
+                                   aab ? i[5] : i[4]};
+            return (L3(i) - L3(tus) - L3(ust) - 2.0 * L3(swap)) / 12.0;
+        };
+    }
+
+    if (block == "L2aa" or block == "L2bb") {
+        const std::string spin = block == "L2aa" ? "a" : "b";
+        auto g1 = indexed(_rdm_element("g1" + spin));
+        auto g2 = _rdm_element("g2" + spin + spin);
+        return [g1, g2](const size_t* i) {
+            return g2(i) + L2aa_disconnected(g1, i[0], i[1], i[2], i[3]);
+        };
+    }
+    if (block == "L2ab") {
+        auto g1a = indexed(_rdm_element("g1a"));
+        auto g1b = indexed(_rdm_element("g1b"));
+        auto g2ab = _rdm_element("g2ab");
+        return [g1a, g1b, g2ab](const size_t* i) {
+            return g2ab(i) + L2ab_disconnected(g1a, g1b, i[0], i[1], i[2], i[3]);
+        };
+    }
+    if (block == "L3aaa" or block == "L3bbb") {
+        const std::string spin = block == "L3aaa" ? "a" : "b";
+        auto g1 = indexed(_rdm_element("g1" + spin));
+        auto g2 = indexed(_rdm_element("g2" + spin + spin));
+        auto g3 = _rdm_element("g3" + spin + spin + spin);
+        return [g1, g2, g3](const size_t* i) {
+            return g3(i) + L3aaa_disconnected(g1, g2, i[0], i[1], i[2], i[3], i[4], i[5]);
+        };
+    }
+    auto g1a = indexed(_rdm_element("g1a"));
+    auto g1b = indexed(_rdm_element("g1b"));
+    auto g2ab = indexed(_rdm_element("g2ab"));
+    if (block == "L3aab") {
+        auto g2aa = indexed(_rdm_element("g2aa"));
+        auto g3aab = _rdm_element("g3aab");
+        return [g1a, g1b, g2aa, g2ab, g3aab](const size_t* i) {
+            return g3aab(i) +
+                   L3aab_disconnected(g1a, g1b, g2aa, g2ab, i[0], i[1], i[2], i[3], i[4], i[5]);
+        };
+    }
+    auto g2bb = indexed(_rdm_element("g2bb"));
+    auto g3abb = _rdm_element("g3abb");
+    return [g1a, g1b, g2ab, g2bb, g3abb](const size_t* i) {
+        return g3abb(i) +
+               L3abb_disconnected(g1a, g1b, g2ab, g2bb, i[0], i[1], i[2], i[3], i[4], i[5]);
+    };
+}
+
 ambit::Tensor RDMs::make_cumulant_L2aa(const ambit::Tensor& g1a, const ambit::Tensor& g2aa) {
     timer t("make_cumulant_L2aa");
     auto L2aa = g2aa.clone();
@@ -313,6 +678,101 @@ ambit::Tensor RDMs::make_cumulant_L3abb(const ambit::Tensor& g1a, const ambit::T
     return L3abb;
 }
 
+// The packed cumulants are evaluated element by element for the unique elements only, using the
+// same expressions as the dense versions above.
+
+PackedRDMTensor RDMs::make_cumulant_L2aa(const ambit::Tensor& g1a, const PackedRDMTensor& g2aa) {
+    timer t("make_cumulant_L2aa");
+    const size_t n = g1a.dim(0);
+    const auto& g1a_data = g1a.data();
+    auto g1 = [&](size_t p, size_t q) { return g1a_data[p * n + q]; };
+    auto L2aa = g2aa;
+    auto& L2 = L2aa.data();
+
+#pragma omp parallel for schedule(static)
+    for (size_t I = 0; I < L2aa.size(); ++I) {
+        size_t idx[4];
+        L2aa.canonical_indices(I, idx);
+        const auto& [p, q, r, s] = idx;
+        L2[I] += L2aa_disconnected(g1, p, q, r, s);
+    }
+    return L2aa;
+}
+
+PackedRDMTensor RDMs::make_cumulant_L3aaa(const ambit::Tensor& g1a, const PackedRDMTensor& g2aa,
+                                          const PackedRDMTensor& g3aaa) {
+    timer timing("make_cumulant_L3aaa");
+    const size_t n = g1a.dim(0);
+    const auto& g1a_data = g1a.data();
+    auto g1 = [&](size_t p, size_t q) { return g1a_data[p * n + q]; };
+    auto g2 = [&](size_t p, size_t q, size_t r, size_t s) { return g2aa.get({p, q, r, s}); };
+    auto L3aaa = g3aaa;
+    auto& L3 = L3aaa.data();
+
+#pragma omp parallel for schedule(static)
+    for (size_t I = 0; I < L3aaa.size(); ++I) {
+        size_t idx[6];
+        L3aaa.canonical_indices(I, idx);
+        const auto& [p, q, r, s, t, u] = idx;
+        L3[I] += L3aaa_disconnected(g1, g2, p, q, r, s, t, u);
+    }
+    return L3aaa;
+}
+
+PackedRDMTensor RDMs::make_cumulant_L3aab(const ambit::Tensor& g1a, const ambit::Tensor& g1b,
+                                          const PackedRDMTensor& g2aa, const ambit::Tensor& g2ab,
+                                          const PackedRDMTensor& g3aab) {
+    timer timing("make_cumulant_L3aab");
+    const size_t n = g1a.dim(0);
+    const auto& g1a_data = g1a.data();
+    const auto& g1b_data = g1b.data();
+    const auto& g2ab_data = g2ab.data();
+    auto g1_a = [&](size_t p, size_t q) { return g1a_data[p * n + q]; };
+    auto g1_b = [&](size_t p, size_t q) { return g1b_data[p * n + q]; };
+    auto g2_aa = [&](size_t p, size_t q, size_t r, size_t s) { return g2aa.get({p, q, r, s}); };
+    auto g2_ab = [&](size_t p, size_t q, size_t r, size_t s) {
+        return g2ab_data[((p * n + q) * n + r) * n + s];
+    };
+    auto L3aab = g3aab;
+    auto& L3 = L3aab.data();
+
+#pragma omp parallel for schedule(static)
+    for (size_t I = 0; I < L3aab.size(); ++I) {
+        size_t idx[6];
+        L3aab.canonical_indices(I, idx);
+        const auto& [p, q, R, s, t, U] = idx;
+        L3[I] += L3aab_disconnected(g1_a, g1_b, g2_aa, g2_ab, p, q, R, s, t, U);
+    }
+    return L3aab;
+}
+
+PackedRDMTensor RDMs::make_cumulant_L3abb(const ambit::Tensor& g1a, const ambit::Tensor& g1b,
+                                          const ambit::Tensor& g2ab, const PackedRDMTensor& g2bb,
+                                          const PackedRDMTensor& g3abb) {
+    timer timing("make_cumulant_L3abb");
+    const size_t n = g1a.dim(0);
+    const auto& g1a_data = g1a.data();
+    const auto& g1b_data = g1b.data();
+    const auto& g2ab_data = g2ab.data();
+    auto g1_a = [&](size_t p, size_t q) { return g1a_data[p * n + q]; };
+    auto g1_b = [&](size_t p, size_t q) { return g1b_data[p * n + q]; };
+    auto g2_ab = [&](size_t p, size_t q, size_t r, size_t s) {
+        return g2ab_data[((p * n + q) * n + r) * n + s];
+    };
+    auto g2_bb = [&](size_t p, size_t q, size_t r, size_t s) { return g2bb.get({p, q, r, s}); };
+    auto L3abb = g3abb;
+    auto& L3 = L3abb.data();
+
+#pragma omp parallel for schedule(static)
+    for (size_t I = 0; I < L3abb.size(); ++I) {
+        size_t idx[6];
+        L3abb.canonical_indices(I, idx);
+        const auto& [p, Q, R, s, T, U] = idx;
+        L3[I] += L3abb_disconnected(g1_a, g1_b, g2_ab, g2_bb, p, Q, R, s, T, U);
+    }
+    return L3abb;
+}
+
 ambit::Tensor RDMs::sf1_to_sd1(const ambit::Tensor& G1) {
     auto g1 = G1.clone();
     g1.scale(0.5);
@@ -362,6 +822,17 @@ void RDMs::_test_rdm_level(const size_t& level, const std::string& name) const {
     }
 }
 
+void RDMs::_test_packed_rdm(const PackedRDMTensor& T, const std::string& name,
+                            RDMPacking packing, const std::vector<size_t>& groups) const {
+    if (T.packing() != packing or T.groups() != groups) {
+        throw std::runtime_error("Invalid packing for " + name);
+    }
+    if (T.n() != n_orbs_) {
+        throw std::runtime_error("Invalid dimensions for " + name + ": " + std::to_string(T.n()) +
+                                 "; Expect: " + std::to_string(n_orbs_));
+    }
+}
+
 void RDMs::_test_rdm_dims(const ambit::Tensor& T, const std::string& name,
                           size_t desired_dim_size) const {
     const auto& dims = T.dims();
@@ -456,6 +927,44 @@ RDMsSpinDependent::RDMsSpinDependent(ambit::Tensor g1a, ambit::Tensor g1b, ambit
     _test_rdm_dims(g3bbb, "g3bbb", 6);
 }
 
+RDMsSpinDependent::RDMsSpinDependent(ambit::Tensor g1a, ambit::Tensor g1b, PackedRDMTensor g2aa,
+                                     ambit::Tensor g2ab, PackedRDMTensor g2bb)
+    : g1a_(g1a), g1b_(g1b), g2ab_(g2ab), g2aa_packed_(std::move(g2aa)),
+      g2bb_packed_(std::move(g2bb)) {
+    max_rdm_ = 2;
+    type_ = RDMsType::spin_dependent;
+    n_orbs_ = g1a.dim(0);
+    packed_ = true;
+    _test_rdm_dims(g1a, "g1a", 2);
+    _test_rdm_dims(g1b, "g1b", 2);
+    _test_packed_rdm(g2aa_packed_, "g2aa", RDMPacking::antisymmetric, groups_aa);
+    _test_rdm_dims(g2ab, "g2ab", 4);
+    _test_packed_rdm(g2bb_packed_, "g2bb", RDMPacking::antisymmetric, groups_aa);
+}
+
+RDMsSpinDependent::RDMsSpinDependent(ambit::Tensor g1a, ambit::Tensor g1b, PackedRDMTensor g2aa,
+                                     ambit::Tensor g2ab, PackedRDMTensor g2bb,
+                                     PackedRDMTensor g3aaa, PackedRDMTensor g3aab,
+                                     PackedRDMTensor g3abb, PackedRDMTensor g3bbb)
+    : g1a_(g1a), g1b_(g1b), g2ab_(g2ab), g2aa_packed_(std::move(g2aa)),
+      g2bb_packed_(std::move(g2bb)), g3aaa_packed_(std::move(g3aaa)),
+      g3aab_packed_(std::move(g3aab)), g3abb_packed_(std::move(g3abb)),
+      g3bbb_packed_(std::move(g3bbb)) {
+    max_rdm_ = 3;
+    type_ = RDMsType::spin_dependent;
+    n_orbs_ = g1a.dim(0);
+    packed_ = true;
+    _test_rdm_dims(g1a, "g1a", 2);
+    _test_rdm_dims(g1b, "g1b", 2);
+    _test_packed_rdm(g2aa_packed_, "g2aa", RDMPacking::antisymmetric, groups_aa);
+    _test_rdm_dims(g2ab, "g2ab", 4);
+    _test_packed_rdm(g2bb_packed_, "g2bb", RDMPacking::antisymmetric, groups_aa);
+    _test_packed_rdm(g3aaa_packed_, "g3aaa", RDMPacking::antisymmetric, groups_aaa);
+    _test_packed_rdm(g3aab_packed_, "g3aab", RDMPacking::antisymmetric, groups_aab);
+    _test_packed_rdm(g3abb_packed_, "g3abb", RDMPacking::antisymmetric, groups_abb);
+    _test_packed_rdm(g3bbb_packed_, "g3bbb", RDMPacking::antisymmetric, groups_aaa);
+}
+
 ambit::Tensor RDMsSpinDependent::g1a() const {
     _test_rdm_level(1, "g1a");
     return g1a_;
@@ -466,7 +975,7 @@ ambit::Tensor RDMsSpinDependent::g1b() const {
 }
 ambit::Tensor RDMsSpinDependent::g2aa() const {
     _test_rdm_level(2, "g2aa");
-    return g2aa_;
+    return packed_ ? unpack_tensor(g2aa_packed_, "g2aa") : g2aa_;
 }
 ambit::Tensor RDMsSpinDependent::g2ab() const {
     _test_rdm_level(2, "g2ab");
@@ -474,23 +983,23 @@ ambit::Tensor RDMsSpinDependent::g2ab() const {
 }
 ambit::Tensor RDMsSpinDependent::g2bb() const {
     _test_rdm_level(2, "g2bb");
-    return g2bb_;
+    return packed_ ? unpack_tensor(g2bb_packed_, "g2bb") : g2bb_;
 }
 ambit::Tensor RDMsSpinDependent::g3aaa() const {
     _test_rdm_level(3, "g3aaa");
-    return g3aaa_;
+    return packed_ ? unpack_tensor(g3aaa_packed_, "g3aaa") : g3aaa_;
 }
 ambit::Tensor RDMsSpinDependent::g3aab() const {
     _test_rdm_level(3, "g3aab");
-    return g3aab_;
+    return packed_ ? unpack_tensor(g3aab_packed_, "g3aab") : g3aab_;
 }
 ambit::Tensor RDMsSpinDependent::g3abb() const {
     _test_rdm_level(3, "g3abb");
-    return g3abb_;
+    return packed_ ? unpack_tensor(g3abb_packed_, "g3abb") : g3abb_;
 }
 ambit::Tensor RDMsSpinDependent::g3bbb() const {
     _test_rdm_level(3, "g3bbb");
-    return g3bbb_;
+    return packed_ ? unpack_tensor(g3bbb_packed_, "g3bbb") : g3bbb_;
 }
 ambit::Tensor RDMsSpinDependent::SF_G1() const {
     _test_rdm_level(1, "SF_G1");
@@ -501,8 +1010,8 @@ ambit::Tensor RDMsSpinDependent::SF_G1() const {
 }
 ambit::Tensor RDMsSpinDependent::SF_G2() const {
     _test_rdm_level(2, "SF_G2");
-    auto G2 = g2aa_.clone();
-    G2("pqrs") += g2bb_("pqrs");
+    auto G2 = packed_ ? g2aa() : g2aa_.clone();
+    G2("pqrs") += g2bb()("pqrs");
     G2("pqrs") += g2ab_("pqrs");
     G2("pqrs") += g2ab_("qpsr");
     G2.set_name("SF_G2");
@@ -510,16 +1019,19 @@ ambit::Tensor RDMsSpinDependent::SF_G2() const {
 }
 ambit::Tensor RDMsSpinDependent::SF_G3() const {
     _test_rdm_level(3, "SF_G3");
-    auto G3 = g3aaa_.clone();
-    G3("pqrstu") += g3bbb_("pqrstu");
+    auto G3 = packed_ ? g3aaa() : g3aaa_.clone();
+    G3("pqrstu") += g3bbb()("pqrstu");
 
-    G3("pqrstu") += g3aab_("pqrstu");
-    G3("pqrstu") += g3aab_("prqsut");
-    G3("pqrstu") += g3aab_("qrptus");
+    // unpack each mixed-spin block only once
+    auto g3aab = this->g3aab();
+    G3("pqrstu") += g3aab("pqrstu");
+    G3("pqrstu") += g3aab("prqsut");
+    G3("pqrstu") += g3aab("qrptus");
 
-    G3("pqrstu") += g3abb_("pqrstu");
-    G3("pqrstu") += g3abb_("qprtsu");
-    G3("pqrstu") += g3abb_("rpqust");
+    auto g3abb = this->g3abb();
+    G3("pqrstu") += g3abb("pqrstu");
+    G3("pqrstu") += g3abb("qprtsu");
+    G3("pqrstu") += g3abb("rpqust");
 
     G3.set_name("SF_G3");
     return G3;
@@ -536,48 +1048,145 @@ ambit::Tensor RDMsSpinDependent::L1b() const {
 }
 ambit::Tensor RDMsSpinDependent::L2aa() const {
     _test_rdm_level(2, "L2aa");
-    auto L2aa = make_cumulant_L2aa(g1a_, g2aa_);
+    auto L2aa =
+        packed_
+            ? _packed_cumulant("L2aa", [this]() { return make_cumulant_L2aa(g1a_, g2aa_packed_); })
+            : _cumulant("L2aa", [this]() { return make_cumulant_L2aa(g1a_, g2aa_); });
     L2aa.set_name("L2aa");
     return L2aa;
 }
 ambit::Tensor RDMsSpinDependent::L2ab() const {
     _test_rdm_level(2, "L2ab");
-    auto L2ab = make_cumulant_L2ab(g1a_, g1b_, g2ab_);
+    auto L2ab = _cumulant("L2ab", [this]() { return make_cumulant_L2ab(g1a_, g1b_, g2ab_); });
     L2ab.set_name("L2ab");
     return L2ab;
 }
 ambit::Tensor RDMsSpinDependent::L2bb() const {
     _test_rdm_level(2, "L2bb");
-    auto L2bb = make_cumulant_L2aa(g1b_, g2bb_);
+    auto L2bb =
+        packed_
+            ? _packed_cumulant("L2bb", [this]() { return make_cumulant_L2aa(g1b_, g2bb_packed_); })
+            : _cumulant("L2bb", [this]() { return make_cumulant_L2aa(g1b_, g2bb_); });
     L2bb.set_name("L2bb");
     return L2bb;
 }
 ambit::Tensor RDMsSpinDependent::L3aaa() const {
     _test_rdm_level(3, "L3aaa");
-    auto L3aaa = make_cumulant_L3aaa(g1a_, g2aa_, g3aaa_);
+    auto L3aaa = packed_ ? _packed_cumulant("L3aaa",
+                                            [this]() {
+                                                return make_cumulant_L3aaa(g1a_, g2aa_packed_,
+                                                                           g3aaa_packed_);
+                                            })
+                         : _cumulant("L3aaa", [this]() {
+                               return make_cumulant_L3aaa(g1a_, g2aa_, g3aaa_);
+                           });
     L3aaa.set_name("L3aaa");
     return L3aaa;
 }
 ambit::Tensor RDMsSpinDependent::L3aab() const {
     _test_rdm_level(3, "L3aab");
-    auto L3aab = make_cumulant_L3aab(g1a_, g1b_, g2aa_, g2ab_, g3aab_);
+    auto L3aab = packed_ ? _packed_cumulant("L3aab",
+                                            [this]() {
+                                                return make_cumulant_L3aab(g1a_, g1b_, g2aa_packed_,
+                                                                           g2ab_, g3aab_packed_);
+                                            })
+                         : _cumulant("L3aab", [this]() {
+                               return make_cumulant_L3aab(g1a_, g1b_, g2aa_, g2ab_, g3aab_);
+                           });
     L3aab.set_name("L3aab");
     return L3aab;
 }
 ambit::Tensor RDMsSpinDependent::L3abb() const {
     _test_rdm_level(3, "L3abb");
-    auto L3abb = make_cumulant_L3abb(g1a_, g1b_, g2ab_, g2bb_, g3abb_);
+    auto L3abb = packed_ ? _packed_cumulant("L3abb",
+                                            [this]() {
+                                                return make_cumulant_L3abb(g1a_, g1b_, g2ab_,
+                                                                           g2bb_packed_,
+                                                                           g3abb_packed_);
+                                            })
+                         : _cumulant("L3abb", [this]() {
+                               return make_cumulant_L3abb(g1a_, g1b_, g2ab_, g2bb_, g3abb_);
+                           });
     L3abb.set_name("L3abb");
     return L3abb;
 }
 ambit::Tensor RDMsSpinDependent::L3bbb() const {
     _test_rdm_level(3, "L3bbb");
-    auto L3bbb = make_cumulant_L3aaa(g1b_, g2bb_, g3bbb_);
+    auto L3bbb = packed_ ? _packed_cumulant("L3bbb",
+                                            [this]() {
+                                                return make_cumulant_L3aaa(g1b_, g2bb_packed_,
+                                                                           g3bbb_packed_);
+                                            })
+                         : _cumulant("L3bbb", [this]() {
+                               return make_cumulant_L3aaa(g1b_, g2bb_, g3bbb_);
+                           });
     L3bbb.set_name("L3bbb");
     return L3bbb;
 }
 
+RDMs::ElementGetter RDMsSpinDependent::_rdm_element(const std::string& name) const {
+    // spin-free RDMs, see SF_G1(), SF_G2(), and SF_G3()
+    if (name == "G1") {
+        auto g1a = _rdm_element("g1a");
+        auto g1b = _rdm_element("g1b");
+        return [g1a, g1b](const size_t* i) { return g1a(i) + g1b(i); };
+    }
+    if (name == "G2") {
+        auto g2aa = _rdm_element("g2aa");
+        auto g2ab = _rdm_element("g2ab");
+        auto g2bb = _rdm_element("g2bb");
+        return [g2aa, g2ab, g2bb](const size_t* i) {
+            const size_t qpsr[] = {i[1], i[0], i[3], i[2]};
+            return g2aa(i) + g2bb(i) + g2ab(i) + g2ab(qpsr);
+        };
+    }
+    if (name == "G3") {
+        auto g3aaa = _rdm_element("g3aaa");
+        auto g3aab = _rdm_element("g3aab");
+        auto g3abb = _rdm_element("g3abb");
+        auto g3bbb = _rdm_element("g3bbb");
+        return [g3aaa, g3aab, g3abb, g3bbb](const size_t* i) {
+            const size_t prqsut[] = {i[0], i[2], i[1], i[3], i[5], i[4]};
+            const size_t qrptus[] = {i[1], i[2], i[0], i[4], i[5], i[3]};
+            const size_t qprtsu[] = {i[1], i[0], i[2], i[4], i[3], i[5]};
+            const size_t rpqust[] = {i[2], i[0], i[1], i[5], i[3], i[4]};
+            return g3aaa(i) + g3bbb(i) + g3aab(i) + g3aab(prqsut) + g3aab(qrptus) + g3abb(i) +
+                   g3abb(qprtsu) + g3abb(rpqust);
+        };
+    }
+
+    if (packed_) {
+        const std::map<std::string, const PackedRDMTensor*> packed_blocks{
+            {"g2aa", &g2aa_packed_},   {"g2bb", &g2bb_packed_},   {"g3aaa", &g3aaa_packed_},
+            {"g3aab", &g3aab_packed_}, {"g3abb", &g3abb_packed_}, {"g3bbb", &g3bbb_packed_}};
+        if (auto it = packed_blocks.find(name); it != packed_blocks.end()) {
+            const auto* T = it->second;
+            return [T](const size_t* i) { return T->get(i); };
+        }
+    }
+    const std::map<std::string, const ambit::Tensor*> blocks{
+        {"g1a", &g1a_},     {"g1b", &g1b_},     {"g2aa", &g2aa_},   {"g2ab", &g2ab_},
+        {"g2bb", &g2bb_},   {"g3aaa", &g3aaa_}, {"g3aab", &g3aab_}, {"g3abb", &g3abb_},
+        {"g3bbb", &g3bbb_}};
+    auto it = blocks.find(name);
+    if (it == blocks.end())
+        throw std::runtime_error("RDMsSpinDependent: invalid RDM block " + name);
+    return dense_element(*it->second);
+}
+
 std::shared_ptr<RDMs> RDMsSpinDependent::clone() {
+    if (packed_) {
+        // the packed blocks are copied by value, the dense ones need a deep copy
+        auto rdms = std::make_shared<RDMsSpinDependent>(*this);
+        if (max_rdm_ > 0) {
+            rdms->g1a_ = g1a_.clone();
+            rdms->g1b_ = g1b_.clone();
+        }
+        if (max_rdm_ > 1)
+            rdms->g2ab_ = g2ab_.clone();
+        return rdms;
+    }
+
     ambit::Tensor g1a, g1b, g2aa, g2ab, g2bb, g3aaa, g3aab, g3abb, g3bbb;
     if (max_rdm_ > 0) {
         g1a = g1a_.clone();
@@ -611,20 +1220,33 @@ std::shared_ptr<RDMs> RDMsSpinDependent::clone() {
 }
 
 void RDMsSpinDependent::scale(double factor) {
+    clear_cumulant_cache();
     if (max_rdm_ > 0) {
         g1a_.scale(factor);
         g1b_.scale(factor);
     }
     if (max_rdm_ > 1) {
-        g2aa_.scale(factor);
         g2ab_.scale(factor);
-        g2bb_.scale(factor);
+        if (packed_) {
+            g2aa_packed_.scale(factor);
+            g2bb_packed_.scale(factor);
+        } else {
+            g2aa_.scale(factor);
+            g2bb_.scale(factor);
+        }
     }
     if (max_rdm_ > 2) {
-        g3aaa_.scale(factor);
-        g3aab_.scale(factor);
-        g3abb_.scale(factor);
-        g3bbb_.scale(factor);
+        if (packed_) {
+            g3aaa_packed_.scale(factor);
+            g3aab_packed_.scale(factor);
+            g3abb_packed_.scale(factor);
+            g3bbb_packed_.scale(factor);
+        } else {
+            g3aaa_.scale(factor);
+            g3aab_.scale(factor);
+            g3abb_.scale(factor);
+            g3bbb_.scale(factor);
+        }
     }
 }
 
@@ -635,11 +1257,43 @@ void RDMsSpinDependent::axpy(std::shared_ptr<RDMs> rhs, double a) {
         throw std::runtime_error("RDMs AXPY Error: Inconsistent RDMs types!");
     if (n_orbs_ != rhs->dim())
         throw std::runtime_error("RDMs AXPY Error: Inconsistent number of orbitals!");
+    clear_cumulant_cache();
 
     if (max_rdm_ > 0) {
         g1a_("pq") += a * rhs->g1a()("pq");
         g1b_("pq") += a * rhs->g1b()("pq");
     }
+
+    if (packed_) {
+        // add the packed blocks of rhs directly when available, otherwise pack its dense blocks
+        auto rhs_sd = std::dynamic_pointer_cast<RDMsSpinDependent>(rhs);
+        bool rhs_packed = rhs_sd and rhs_sd->packed_;
+        if (max_rdm_ > 1) {
+            g2ab_("pqrs") += a * rhs->g2ab()("pqrs");
+            if (rhs_packed) {
+                g2aa_packed_.axpy(a, rhs_sd->g2aa_packed_);
+                g2bb_packed_.axpy(a, rhs_sd->g2bb_packed_);
+            } else {
+                g2aa_packed_.axpy(a, pack_like(rhs->g2aa(), g2aa_packed_));
+                g2bb_packed_.axpy(a, pack_like(rhs->g2bb(), g2bb_packed_));
+            }
+        }
+        if (max_rdm_ > 2) {
+            if (rhs_packed) {
+                g3aaa_packed_.axpy(a, rhs_sd->g3aaa_packed_);
+                g3aab_packed_.axpy(a, rhs_sd->g3aab_packed_);
+                g3abb_packed_.axpy(a, rhs_sd->g3abb_packed_);
+                g3bbb_packed_.axpy(a, rhs_sd->g3bbb_packed_);
+            } else {
+                g3aaa_packed_.axpy(a, pack_like(rhs->g3aaa(), g3aaa_packed_));
+                g3aab_packed_.axpy(a, pack_like(rhs->g3aab(), g3aab_packed_));
+                g3abb_packed_.axpy(a, pack_like(rhs->g3abb(), g3abb_packed_));
+                g3bbb_packed_.axpy(a, pack_like(rhs->g3bbb(), g3bbb_packed_));
+            }
+        }
+        return;
+    }
+
     if (max_rdm_ > 1) {
         g2aa_("pqrs") += a * rhs->g2aa()("pqrs");
         g2ab_("pqrs") += a * rhs->g2ab()("pqrs");
@@ -656,6 +1310,15 @@ void RDMsSpinDependent::axpy(std::shared_ptr<RDMs> rhs, double a) {
 void RDMsSpinDependent::rotate(const ambit::Tensor& Ua, const ambit::Tensor& Ub) {
     if (_bypass_rotate(Ua, Ub))
         return;
+    clear_cumulant_cache();
+
+    if (packed_) {
+        // rotations mix all the elements, so they are done on the dense blocks
+        unpack();
+        rotate(Ua, Ub);
+        pack();
+        return;
+    }
 
     psi::outfile->Printf("\n  Orbital rotations on spin-dependent RDMs ...");
     timer t("Rotate RDMs");
@@ -721,6 +1384,21 @@ void RDMsSpinDependent::dump_to_disk(const std::string& filename_prefix) const {
         ambit::save(g1a_, prefix + "g1a.bin");
         ambit::save(g1b_, prefix + "g1b.bin");
     }
+    if (packed_) {
+        if (max_rdm_ > 1) {
+            g2aa_packed_.save(prefix + "g2aa.packed.bin");
+            ambit::save(g2ab_, prefix + "g2ab.bin");
+            g2bb_packed_.save(prefix + "g2bb.packed.bin");
+        }
+        if (max_rdm_ > 2) {
+            g3aaa_packed_.save(prefix + "g3aaa.packed.bin");
+            g3aab_packed_.save(prefix + "g3aab.packed.bin");
+            g3abb_packed_.save(prefix + "g3abb.packed.bin");
+            g3bbb_packed_.save(prefix + "g3bbb.packed.bin");
+        }
+        return;
+    }
+    remove_packed_files(prefix, {"g2aa", "g2bb", "g3aaa", "g3aab", "g3abb", "g3bbb"});
     if (max_rdm_ > 1) {
         ambit::save(g2aa_, prefix + "g2aa.bin");
         ambit::save(g2ab_, prefix + "g2ab.bin");
@@ -734,6 +1412,52 @@ void RDMsSpinDependent::dump_to_disk(const std::string& filename_prefix) const {
     }
 }
 
+void RDMsSpinDependent::pack() {
+    if (packed_)
+        return;
+    clear_cumulant_cache();
+    if (max_rdm_ > 1) {
+        g2aa_packed_ = pack_tensor(g2aa_, PackedRDMTensor::antisymmetric(n_orbs_, groups_aa));
+        g2bb_packed_ = pack_tensor(g2bb_, PackedRDMTensor::antisymmetric(n_orbs_, groups_aa));
+        g2aa_ = ambit::Tensor();
+        g2bb_ = ambit::Tensor();
+    }
+    if (max_rdm_ > 2) {
+        g3aaa_packed_ = pack_tensor(g3aaa_, PackedRDMTensor::antisymmetric(n_orbs_, groups_aaa));
+        g3aaa_ = ambit::Tensor();
+        g3aab_packed_ = pack_tensor(g3aab_, PackedRDMTensor::antisymmetric(n_orbs_, groups_aab));
+        g3aab_ = ambit::Tensor();
+        g3abb_packed_ = pack_tensor(g3abb_, PackedRDMTensor::antisymmetric(n_orbs_, groups_abb));
+        g3abb_ = ambit::Tensor();
+        g3bbb_packed_ = pack_tensor(g3bbb_, PackedRDMTensor::antisymmetric(n_orbs_, groups_aaa));
+        g3bbb_ = ambit::Tensor();
+    }
+    packed_ = true;
+}
+
+void RDMsSpinDependent::unpack() {
+    if (not packed_)
+        return;
+    clear_cumulant_cache();
+    if (max_rdm_ > 1) {
+        g2aa_ = unpack_tensor(g2aa_packed_, "g2aa");
+        g2bb_ = unpack_tensor(g2bb_packed_, "g2bb");
+        g2aa_packed_ = PackedRDMTensor();
+        g2bb_packed_ = PackedRDMTensor();
+    }
+    if (max_rdm_ > 2) {
+        g3aaa_ = unpack_tensor(g3aaa_packed_, "g3aaa");
+        g3aaa_packed_ = PackedRDMTensor();
+        g3aab_ = unpack_tensor(g3aab_packed_, "g3aab");
+        g3aab_packed_ = PackedRDMTensor();
+        g3abb_ = unpack_tensor(g3abb_packed_, "g3abb");
+        g3abb_packed_ = PackedRDMTensor();
+        g3bbb_ = unpack_tensor(g3bbb_packed_, "g3bbb");
+        g3bbb_packed_ = PackedRDMTensor();
+    }
+    packed_ = false;
+}
+
 RDMsSpinFree::RDMsSpinFree() {
     max_rdm_ = 0;
     type_ = RDMsType::spin_free;
@@ -765,17 +1489,38 @@ RDMsSpinFree::RDMsSpinFree(ambit::Tensor G1, ambit::Tensor G2, ambit::Tensor G3)
     _test_rdm_dims(G3, "G3", 6);
 }
 
+RDMsSpinFree::RDMsSpinFree(ambit::Tensor G1, PackedRDMTensor G2)
+    : SF_G1_(G1), SF_G2_packed_(std::move(G2)) {
+    max_rdm_ = 2;
+    type_ = RDMsType::spin_free;
+    n_orbs_ = G1.dim(0);
+    packed_ = true;
+    _test_rdm_dims(G1, "G1", 2);
+    _test_packed_rdm(SF_G2_packed_, "G2", RDMPacking::pair_symmetric, {2});
+}
+
+RDMsSpinFree::RDMsSpinFree(ambit::Tensor G1, PackedRDMTensor G2, PackedRDMTensor G3)
+    : SF_G1_(G1), SF_G2_packed_(std::move(G2)), SF_G3_packed_(std::move(G3)) {
+    max_rdm_ = 3;
+    type_ = RDMsType::spin_free;
+    n_orbs_ = G1.dim(0);
+    packed_ = true;
+    _test_rdm_dims(G1, "G1", 2);
+    _test_packed_rdm(SF_G2_packed_, "G2", RDMPacking::pair_symmetric, {2});
+    _test_packed_rdm(SF_G3_packed_, "G3", RDMPacking::pair_symmetric, {3});
+}
+
 ambit::Tensor RDMsSpinFree::SF_G1() const {
     _test_rdm_level(1, "SF_G1");
     return SF_G1_;
 }
 ambit::Tensor RDMsSpinFree::SF_G2() const {
     _test_rdm_level(2, "SF_G2");
-    return SF_G2_;
+    return packed_ ? unpack_tensor(SF_G2_packed_, "SF_G2") : SF_G2_;
 }
 ambit::Tensor RDMsSpinFree::SF_G3() const {
     _test_rdm_level(3, "SF_G3");
-    return SF_G3_;
+    return packed_ ? unpack_tensor(SF_G3_packed_, "SF_G3") : SF_G3_;
 }
 ambit::Tensor RDMsSpinFree::g1a() const {
     _test_rdm_level(1, "g1a");
@@ -791,43 +1536,43 @@ ambit::Tensor RDMsSpinFree::g1b() const {
 }
 ambit::Tensor RDMsSpinFree::g2aa() const {
     _test_rdm_level(2, "g2aa");
-    auto g2aa = sf2_to_sd2aa(SF_G2_);
+    auto g2aa = sf2_to_sd2aa(SF_G2());
     g2aa.set_name("g2aa");
     return g2aa;
 }
 ambit::Tensor RDMsSpinFree::g2ab() const {
     _test_rdm_level(2, "g2ab");
-    auto g2ab = sf2_to_sd2ab(SF_G2_);
+    auto g2ab = sf2_to_sd2ab(SF_G2());
     g2ab.set_name("g2ab");
     return g2ab;
 }
 ambit::Tensor RDMsSpinFree::g2bb() const {
     _test_rdm_level(2, "g2bb");
-    auto g2bb = sf2_to_sd2aa(SF_G2_);
+    auto g2bb = sf2_to_sd2aa(SF_G2());
     g2bb.set_name("g2bb");
     return g2bb;
 }
 ambit::Tensor RDMsSpinFree::g3aaa() const {
     _test_rdm_level(3, "g3aaa");
-    auto g3aaa = sf3_to_sd3aaa(SF_G3_);
+    auto g3aaa = sf3_to_sd3aaa(SF_G3());
     g3aaa.set_name("g3aaa");
     return g3aaa;
 }
 ambit::Tensor RDMsSpinFree::g3aab() const {
     _test_rdm_level(3, "g3aab");
-    auto g3aab = sf3_to_sd3aab(SF_G3_);
+    auto g3aab = sf3_to_sd3aab(SF_G3());
     g3aab.set_name("g3aab");
     return g3aab;
 }
 ambit::Tensor RDMsSpinFree::g3abb() const {
     _test_rdm_level(3, "g3abb");
-    auto g3abb = sf3_to_sd3abb(SF_G3_);
+    auto g3abb = sf3_to_sd3abb(SF_G3());
     g3abb.set_name("g3abb");
     return g3abb;
 }
 ambit::Tensor RDMsSpinFree::g3bbb() const {
     _test_rdm_level(3, "g3bbb");
-    auto g3bbb = sf3_to_sd3aaa(SF_G3_);
+    auto g3bbb = sf3_to_sd3aaa(SF_G3());
     g3bbb.set_name("g3bbb");
     return g3bbb;
 }
@@ -845,48 +1590,69 @@ ambit::Tensor RDMsSpinFree::L1b() const {
 }
 ambit::Tensor RDMsSpinFree::L2aa() const {
     _test_rdm_level(2, "L2aa");
-    auto L2aa = sf2_to_sd2aa(SF_L2());
+    auto L2aa = _cumulant("L2aa", [this]() { return sf2_to_sd2aa(SF_L2()); });
     L2aa.set_name("L2aa");
     return L2aa;
 }
 ambit::Tensor RDMsSpinFree::L2ab() const {
     _test_rdm_level(2, "L2ab");
-    auto L2ab = sf2_to_sd2ab(SF_L2());
+    auto L2ab = _cumulant("L2ab", [this]() { return sf2_to_sd2ab(SF_L2()); });
     L2ab.set_name("L2ab");
     return L2ab;
 }
 ambit::Tensor RDMsSpinFree::L2bb() const {
     _test_rdm_level(2, "L2bb");
-    auto L2bb = sf2_to_sd2aa(SF_L2());
+    auto L2bb = _cumulant("L2bb", [this]() { return sf2_to_sd2aa(SF_L2()); });
     L2bb.set_name("L2bb");
     return L2bb;
 }
 ambit::Tensor RDMsSpinFree::L3aaa() const {
     _test_rdm_level(3, "L3aaa");
-    auto L3aaa = sf3_to_sd3aaa(SF_L3());
+    auto L3aaa = _cumulant("L3aaa", [this]() { return sf3_to_sd3aaa(SF_L3()); });
     L3aaa.set_name("L3aaa");
     return L3aaa;
 }
 ambit::Tensor RDMsSpinFree::L3aab() const {
     _test_rdm_level(3, "L3aab");
-    auto L3aab = sf3_to_sd3aab(SF_L3());
+    auto L3aab = _cumulant("L3aab", [this]() { return sf3_to_sd3aab(SF_L3()); });
     L3aab.set_name("L3aab");
     return L3aab;
 }
 ambit::Tensor RDMsSpinFree::L3abb() const {
     _test_rdm_level(3, "L3abb");
-    auto L3abb = sf3_to_sd3abb(SF_L3());
+    auto L3abb = _cumulant("L3abb", [this]() { return sf3_to_sd3abb(SF_L3()); });
     L3abb.set_name("L3abb");
     return L3abb;
 }
 ambit::Tensor RDMsSpinFree::L3bbb() const {
     _test_rdm_level(3, "L3bbb");
-    auto L3bbb = sf3_to_sd3aaa(SF_L3());
+    auto L3bbb = _cumulant("L3bbb", [this]() { return sf3_to_sd3aaa(SF_L3()); });
     L3bbb.set_name("L3bbb");
     return L3bbb;
 }
 
+RDMs::ElementGetter RDMsSpinFree::_rdm_element(const std::string& name) const {
+    if (packed_ and (name == "G2" or name == "G3")) {
+        const auto* T = name == "G2" ? &SF_G2_packed_ : &SF_G3_packed_;
+        return [T](const size_t* i) { return T->get(i); };
+    }
+    if (name == "G1")
+        return dense_element(SF_G1_);
+    if (name == "G2")
+        return dense_element(SF_G2_);
+    if (name == "G3")
+        return dense_element(SF_G3_);
+    throw std::runtime_error("RDMsSpinFree: invalid RDM block " + name);
+}
+
 std::shared_ptr<RDMs> RDMsSpinFree::clone() {
+    if (packed_) {
+        auto rdms = std::make_shared<RDMsSpinFree>(*this);
+        if (max_rdm_ > 0)
+            rdms->SF_G1_ = SF_G1_.clone();
+        return rdms;
+    }
+
     ambit::Tensor g1, g2, g3;
     if (max_rdm_ > 0)
         g1 = SF_G1_.clone();
@@ -910,8 +1676,16 @@ std::shared_ptr<RDMs> RDMsSpinFree::clone() {
 }
 
 void RDMsSpinFree::scale(double factor) {
+    clear_cumulant_cache();
     if (max_rdm_ > 0)
         SF_G1_.scale(factor);
+    if (packed_) {
+        if (max_rdm_ > 1)
+            SF_G2_packed_.scale(factor);
+        if (max_rdm_ > 2)
+            SF_G3_packed_.scale(factor);
+        return;
+    }
     if (max_rdm_ > 1)
         SF_G2_.scale(factor);
     if (max_rdm_ > 2)
@@ -925,9 +1699,31 @@ void RDMsSpinFree::axpy(std::shared_ptr<RDMs> rhs, double a) {
         throw std::runtime_error("RDMs AXPY Error: Inconsistent RDMs types!");
     if (n_orbs_ != rhs->dim())
         throw std::runtime_error("RDMs AXPY Error: Inconsistent number of orbitals!");
+    clear_cumulant_cache();
 
     if (max_rdm_ > 0)
         SF_G1_("pq") += a * rhs->SF_G1()("pq");
+
+    if (packed_) {
+        auto rhs_sf = std::dynamic_pointer_cast<RDMsSpinFree>(rhs);
+        bool rhs_packed = rhs_sf and rhs_sf->packed_;
+        if (max_rdm_ > 1) {
+            if (rhs_packed) {
+                SF_G2_packed_.axpy(a, rhs_sf->SF_G2_packed_);
+            } else {
+                SF_G2_packed_.axpy(a, pack_like(rhs->SF_G2(), SF_G2_packed_));
+            }
+        }
+        if (max_rdm_ > 2) {
+            if (rhs_packed) {
+                SF_G3_packed_.axpy(a, rhs_sf->SF_G3_packed_);
+            } else {
+                SF_G3_packed_.axpy(a, pack_like(rhs->SF_G3(), SF_G3_packed_));
+            }
+        }
+        return;
+    }
+
     if (max_rdm_ > 1)
         SF_G2_("pqrs") += a * rhs->SF_G2()("pqrs");
     if (max_rdm_ > 2)
@@ -937,6 +1733,14 @@ void RDMsSpinFree::axpy(std::shared_ptr<RDMs> rhs, double a) {
 void RDMsSpinFree::rotate(const ambit::Tensor& Ua, const ambit::Tensor& Ub) {
     if (_bypass_rotate(Ua, Ub))
         return;
+    clear_cumulant_cache();
+
+    if (packed_) {
+        unpack();
+        rotate(Ua, Ub);
+        pack();
+        return;
+    }
 
     psi::outfile->Printf("\n  Orbital rotations on spin-free RDMs ...");
 
@@ -978,6 +1782,14 @@ void RDMsSpinFree::dump_to_disk(const std::string& filename_prefix) const {
     if (max_rdm_ > 0) {
         ambit::save(SF_G1_, prefix + "g1.bin");
     }
+    if (packed_) {
+        if (max_rdm_ > 1)
+            SF_G2_packed_.save(prefix + "g2.packed.bin");
+        if (max_rdm_ > 2)
+            SF_G3_packed_.save(prefix + "g3.packed.bin");
+        return;
+    }
+    remove_packed_files(prefix, {"g2", "g3"});
     if (max_rdm_ > 1) {
         ambit::save(SF_G2_, prefix + "g2.bin");
     }
@@ -985,4 +1797,34 @@ void RDMsSpinFree::dump_to_disk(const std::string& filename_prefix) const {
         ambit::save(SF_G3_, prefix + "g3.bin");
     }
 }
+
+void RDMsSpinFree::pack() {
+    if (packed_)
+        return;
+    clear_cumulant_cache();
+    if (max_rdm_ > 1) {
+        SF_G2_packed_ = pack_tensor(SF_G2_, PackedRDMTensor::pair_symmetric(n_orbs_, 2));
+        SF_G2_ = ambit::Tensor();
+    }
+    if (max_rdm_ > 2) {
+        SF_G3_packed_ = pack_tensor(SF_G3_, PackedRDMTensor::pair_symmetric(n_orbs_, 3));
+        SF_G3_ = ambit::Tensor();
+    }
+    packed_ = true;
+}
+
+void RDMsSpinFree::unpack() {
+    if (not packed_)
+        return;
+    clear_cumulant_cache();
+    if (max_rdm_ > 1) {
+        SF_G2_ = unpack_tensor(SF_G2_packed_, "SF_G2");
+        SF_G2_packed_ = PackedRDMTensor();
+    }
+    if (max_rdm_ > 2) {
+        SF_G3_ = unpack_tensor(SF_G3_packed_, "SF_G3");
+        SF_G3_packed_ = PackedRDMTensor();
+    }
+    packed_ = false;
+}
 } // namespace forte
@@ -28,9 +28,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
+#include "base_classes/packed_rdm_tensor.h"
+
 namespace psi {
 class Dimension;
 class Matrix;
@@ -45,6 +52,68 @@ namespace forte {
 class ForteIntegrals;
 class MOSpaceInfo;
 
+/**
+ * @class CumulantCache
+ *
+ * @brief A thread-safe memo of density cumulant blocks.
+ *
+ * Each block is computed once by the first thread that requests it; other threads requesting the
+ * same block wait for it, while different blocks can be computed concurrently. Copying a cache
+ * yields an empty cache. The blocks are returned as shared pointers, so they stay valid after the
+ * cache is cleared.
+ */
+template <typename T> class CumulantCache {
+  public:
+    CumulantCache() = default;
+    CumulantCache(const CumulantCache&) {}
+    CumulantCache& operator=(const CumulantCache&) {
+        clear();
+        return *this;
+    }
+
+    /// @return the block called name, calling compute() to build it if it is not cached
+    std::shared_ptr<const T> get(const std::string& name, const std::function<T()>& compute) {
+        std::shared_ptr<Entry> entry;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto& e = entries_[name];
+            if (not e)
+                e = std::make_shared<Entry>();
+            entry = e;
+        }
+        std::call_once(entry->flag, [&]() {
+            entry->value = compute();
+            entry->ready = true;
+        });
+        // share the ownership of the entry
+        return std::shared_ptr<const T>(entry, &entry->value);
+    }
+
+    /// @return the block called name if it is cached and computed, nullptr otherwise
+    std::shared_ptr<const T> find(const std::string& name) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(name);
+        if (it == entries_.end() or not it->second->ready)
+            return nullptr;
+        return std::shared_ptr<const T>(it->second, &it->second->value);
+    }
+
+    /// Drop all the cached blocks
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+    }
+
+  private:
+    struct Entry {
+        std::once_flag flag;
+        std::atomic<bool> ready{false};
+        T value;
+    };
+    mutable std::mutex mutex_;
+    std::map<std::string, std::shared_ptr<Entry>> entries_;
+};
+
 /**
  * @class RDMs
  *
@@ -111,6 +180,30 @@ class MOSpaceInfo;
  * which tries to read the following files: casci.1a1.g1a.bin, casci.1a1.g1b.bin,
  * casci.1a1.g2aa.bin, casci.1a1.g2ab.bin, and casci.1a1.g2ab.bin.
  * Note that names after the prefix (g1a.bin, g2aa.bin, ...) are hard coded.
+ *
+ * For large active spaces the 2- and 3-body RDMs can be stored in packed form, keeping only the
+ * elements that are unique under permutational symmetry (see PackedRDMTensor)
+ *
+ * >>> rdms->pack();
+ *
+ * The same-spin blocks (g2aa, g3aaa, g3aab, ...) of spin-dependent RDMs are packed using their
+ * antisymmetry, while the spin-free RDMs are packed using the symmetry under permutations of
+ * particle pairs. The g3aaa block then requires ~1/36 of the dense storage. Packed RDMs are
+ * unpacked block by block when accessed, so the accessors (g2aa(), L3aaa(), ...) return a new
+ * dense tensor instead of a handle to the stored data. The cumulants are evaluated from the
+ * packed blocks directly. Packed RDMs are dumped to disk as packed files
+ * (casci.1a1.g2aa.packed.bin, ...), which build_from_disk reads when present.
+ *
+ * The density cumulants can be cached with set_cache_cumulants(true), so that repeated calls to
+ * L2aa(), L3aab(), SF_L3(), ... only pay for a copy of the cached block instead of recomputing it.
+ * Caching is off by default since it keeps a copy of every cumulant block requested. The cache is
+ * thread safe and is cleared by scale(), axpy(), rotate(), pack(), and unpack(). Modifying the
+ * RDM tensors returned by the accessors in place is not tracked: call clear_cumulant_cache() in
+ * that case. Packed RDMs cache packed cumulants. When only a few elements of a cumulant are
+ * needed, a slice can be evaluated without building the full block
+ *
+ * >>> // L3aab[p,q,R,s,t,U] for p,q,s,t in {0,1} and R,U in {2}
+ * >>> auto L3aab_slice = rdms->cumulant_slice("L3aab", {{0, 1}, {0, 1}, {2}, {0, 1}, {0, 1}, {2}});
  */
 
 enum class RDMsType { spin_dependent, spin_free };
@@ -149,9 +242,30 @@ class RDMs {
 
     /// Save the current RDMs to disk (binary files)
     virtual void dump_to_disk(const std::string& filename_prefix = "") const = 0;
+
+    /// Store the 2- and 3-body RDMs in packed form
+    virtual void pack() = 0;
+    /// Store the 2- and 3-body RDMs as dense tensors
+    virtual void unpack() = 0;
+    /// @return true if the 2- and 3-body RDMs are stored in packed form
+    bool packed() const { return packed_; }
+
     /// Save the spin-summed 1-RDMs to disk in human readable form
     void save_SF_G1(const std::string& filename);
 
+    /// Enable or disable the caching of density cumulants (disabled by default)
+    void set_cache_cumulants(bool value);
+    /// Drop the cached density cumulants
+    void clear_cumulant_cache() const;
+    /// @return a slice of a density cumulant block
+    /// @param block the cumulant block (L2aa, L2ab, L2bb, L3aaa, L3aab, L3abb, L3bbb, SF_L2, SF_L3)
+    /// @param indices the list of orbital indices selected for each index of the block
+    ///
+    /// The slice is extracted from the cached block if available, otherwise only the requested
+    /// elements are evaluated.
+    ambit::Tensor cumulant_slice(const std::string& block,
+                                 const std::vector<std::vector<size_t>>& indices) const;
+
     // static methods
 
     /// Make alpha-alpha or beta-beta 2-RDC from 2-RDMs
@@ -171,6 +285,24 @@ class RDMs {
                                              const ambit::Tensor& g2ab, const ambit::Tensor& g2bb,
                                              const ambit::Tensor& g3abb);
 
+    /// Make packed alpha-alpha or beta-beta 2-RDC from packed 2-RDMs
+    static PackedRDMTensor make_cumulant_L2aa(const ambit::Tensor& g1a,
+                                              const PackedRDMTensor& g2aa);
+    /// Make packed alpha-alpha-alpha or beta-beta-beta 3-RDC from packed 3-RDMs
+    static PackedRDMTensor make_cumulant_L3aaa(const ambit::Tensor& g1a,
+                                               const PackedRDMTensor& g2aa,
+                                               const PackedRDMTensor& g3aaa);
+    /// Make packed alpha-alpha-beta 3-RDC from packed 3-RDMs
+    static PackedRDMTensor make_cumulant_L3aab(const ambit::Tensor& g1a, const ambit::Tensor& g1b,
+                                               const PackedRDMTensor& g2aa,
+                                               const ambit::Tensor& g2ab,
+                                               const PackedRDMTensor& g3aab);
+    /// Make packed alpha-beta-beta 3-RDC from packed 3-RDMs
+    static PackedRDMTensor make_cumulant_L3abb(const ambit::Tensor& g1a, const ambit::Tensor& g1b,
+                                               const ambit::Tensor& g2ab,
+                                               const PackedRDMTensor& g2bb,
+                                               const PackedRDMTensor& g3abb);
+
     /// Spin-free 1-body to spin-dependent 1-body subject to Ms averaging
     static ambit::Tensor sf1_to_sd1(const ambit::Tensor& G1);
     /// Spin-free 2-body to spin-dependent 2-body subject to Ms averaging
@@ -258,9 +390,37 @@ class RDMs {
     /// Number of orbitals for each dimension
     size_t n_orbs_ = 0;
 
+    /// Are the 2- and 3-body RDMs stored in packed form?
+    bool packed_ = false;
+
+    /// Are the density cumulants cached?
+    bool cache_cumulants_ = false;
+    /// The cached dense cumulant blocks
+    mutable CumulantCache<ambit::Tensor> cumulants_;
+    /// The cached packed cumulant blocks (used when packed_ is true)
+    mutable CumulantCache<PackedRDMTensor> packed_cumulants_;
+
+    /// A function returning the element of a tensor given an array of indices
+    using ElementGetter = std::function<double(const size_t*)>;
+
+    /// @return a copy of the cumulant block called name, calling compute() if it is not cached
+    ambit::Tensor _cumulant(const std::string& name,
+                            const std::function<ambit::Tensor()>& compute) const;
+    /// @return the unpacked cumulant block called name, calling compute() if it is not cached
+    ambit::Tensor _packed_cumulant(const std::string& name,
+                                   const std::function<PackedRDMTensor()>& compute) const;
+    /// @return a function that evaluates the elements of a cumulant block
+    ElementGetter _cumulant_element(const std::string& block) const;
+    /// @return a function returning the elements of an RDM block without copying it
+    /// @param name g1a, g1b, g2aa, ... (spin-dependent RDMs only) or G1, G2, G3
+    virtual ElementGetter _rdm_element(const std::string& name) const = 0;
+
     /// Test if the RDM dimensions are valid
     void _test_rdm_dims(const ambit::Tensor& T, const std::string& name,
                         size_t desired_dim_size) const;
+    /// Test if a packed RDM has the expected packing and dimensions
+    void _test_packed_rdm(const PackedRDMTensor& T, const std::string& name, RDMPacking packing,
+                          const std::vector<size_t>& groups) const;
     /// Test if a function is asked for the correct level of RDMs
     void _test_rdm_level(const size_t& level, const std::string& name) const;
     /// Test if RDMs rotation can be bypassed (i.e., if Ua and Ub are identity matrices)
@@ -281,6 +441,13 @@ class RDMsSpinDependent : public RDMs {
     RDMsSpinDependent(ambit::Tensor g1a, ambit::Tensor g1b, ambit::Tensor g2aa, ambit::Tensor g2ab,
                       ambit::Tensor g2bb, ambit::Tensor g3aaa, ambit::Tensor g3aab,
                       ambit::Tensor g3abb, ambit::Tensor g3bbb);
+    /// @brief Construct a packed RDMsSpinDependent object with the 1- and 2-rdms
+    RDMsSpinDependent(ambit::Tensor g1a, ambit::Tensor g1b, PackedRDMTensor g2aa,
+                      ambit::Tensor g2ab, PackedRDMTensor g2bb);
+    /// @brief Construct a packed RDMsSpinDependent object with the 1-, 2-, and 3-rdms
+    RDMsSpinDependent(ambit::Tensor g1a, ambit::Tensor g1b, PackedRDMTensor g2aa,
+                      ambit::Tensor g2ab, PackedRDMTensor g2bb, PackedRDMTensor g3aaa,
+                      PackedRDMTensor g3aab, PackedRDMTensor g3abb, PackedRDMTensor g3bbb);
 
     /// @return the alpha 1-RDM
     ambit::Tensor g1a() const override;
@@ -347,6 +514,14 @@ class RDMsSpinDependent : public RDMs {
     /// Save the current RDMs to disk
     void dump_to_disk(const std::string& filename_prefix = "") const override;
 
+    /// Store the same-spin 2- and 3-body blocks in packed form
+    void pack() override;
+    /// Store all the RDMs as dense tensors
+    void unpack() override;
+
+  protected:
+    ElementGetter _rdm_element(const std::string& name) const override;
+
   private:
     /// The alpha 1-RDM
     ambit::Tensor g1a_;
@@ -366,6 +541,22 @@ class RDMsSpinDependent : public RDMs {
     ambit::Tensor g3abb_;
     /// The beta-beta-beta 3-RDM
     ambit::Tensor g3bbb_;
+
+    // Packed blocks (used instead of the dense ones when packed_ is true).
+    // g1a_, g1b_, and g2ab_ have no antisymmetric index groups and are always dense.
+
+    /// The packed alpha-alpha 2-RDM
+    PackedRDMTensor g2aa_packed_;
+    /// The packed beta-beta 2-RDM
+    PackedRDMTensor g2bb_packed_;
+    /// The packed alpha-alpha-alpha 3-RDM
+    PackedRDMTensor g3aaa_packed_;
+    /// The packed alpha-alpha-beta 3-RDM
+    PackedRDMTensor g3aab_packed_;
+    /// The packed alpha-beta-beta 3-RDM
+    PackedRDMTensor g3abb_packed_;
+    /// The packed beta-beta-beta 3-RDM
+    PackedRDMTensor g3bbb_packed_;
 };
 
 class RDMsSpinFree : public RDMs {
@@ -378,6 +569,10 @@ class RDMsSpinFree : public RDMs {
     RDMsSpinFree(ambit::Tensor G1, ambit::Tensor G2);
     /// @brief Construct a RDMsSpinFree object with the 1-, 2-, and 3-rdms
     RDMsSpinFree(ambit::Tensor G1, ambit::Tensor G2, ambit::Tensor G3);
+    /// @brief Construct a packed RDMsSpinFree object with the 1- and 2-rdms
+    RDMsSpinFree(ambit::Tensor G1, PackedRDMTensor G2);
+    /// @brief Construct a packed RDMsSpinFree object with the 1-, 2-, and 3-rdms
+    RDMsSpinFree(ambit::Tensor G1, PackedRDMTensor G2, PackedRDMTensor G3);
 
     /// @return the alpha 1-RDM
     ambit::Tensor g1a() const override;
@@ -444,6 +639,14 @@ class RDMsSpinFree : public RDMs {
     /// Save the current RDMs to disk
     void dump_to_disk(const std::string& filename_prefix = "") const override;
 
+    /// Store the 2- and 3-RDMs in packed form
+    void pack() override;
+    /// Store all the RDMs as dense tensors
+    void unpack() override;
+
+  protected:
+    ElementGetter _rdm_element(const std::string& name) const override;
+
   private:
     /// Spin-free (spin-summed) 1-RDM defined as G1[pq] = g1a[pq] + g1b[pq]
     ambit::Tensor SF_G1_;
@@ -453,5 +656,9 @@ class RDMsSpinFree : public RDMs {
     /// Spin-free (spin-summed) 3-RDMs defined as G3[pqrstu] = g3aaa[pqrstu] + g3aab[pqrstu] +
     /// g3aab[prqsut] + g3aab[qrptus] + g3abb[pqrstu] + g3abb[qprtsu] + g3abb[rpqust]
     ambit::Tensor SF_G3_;
+    /// The packed spin-free 2-RDM (used instead of SF_G2_ when packed_ is true)
+    PackedRDMTensor SF_G2_packed_;
+    /// The packed spin-free 3-RDM (used instead of SF_G3_ when packed_ is true)
+    PackedRDMTensor SF_G3_packed_;
 };
 } // namespace forte
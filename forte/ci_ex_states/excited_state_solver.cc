@@ -40,6 +40,7 @@
 
 #include "sci/sci.h"
 #include "sparse_ci/determinant_substitution_lists.h"
+#include "sparse_ci/wave_function_checkpoint.h"
 #include "helpers/helpers.h"
 #include "helpers/printing.h"
 #include "helpers/timer.h"
@@ -372,6 +373,11 @@ void ExcitedStateSolver::compute_multistate(std::shared_ptr<psi::Vector>& PQ_eva
 }
 
 void ExcitedStateSolver::dump_wave_function(const std::string& filename) {
+    if (binary_wfn_) {
+        write_wave_function_checkpoint(filename, "sCI", state_.str(), nact_, final_wfn_, *evecs_,
+                                       compress_wfn_);
+        return;
+    }
     std::ofstream file(filename);
     file << "# sCI: " << state_.str() << std::endl;
     file << final_wfn_.size() << " " << nroot_ << std::endl;
@@ -388,6 +394,9 @@ void ExcitedStateSolver::dump_wave_function(const std::string& filename) {
 
 std::tuple<size_t, std::vector<Determinant>, std::shared_ptr<psi::Matrix>>
 ExcitedStateSolver::read_wave_function(const std::string& filename) {
+    if (is_wave_function_checkpoint(filename)) {
+        return read_wave_function_checkpoint(filename, "sCI");
+    }
     std::string line;
     std::ifstream file(filename);
 
@@ -26,9 +26,16 @@
  * @END LICENSE
  */
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
 
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp_get_max_threads() 1
+#endif
+
 #include "psi4/libpsi4util/PsiOutStream.h"
 #include "psi4/libpsi4util/process.h"
 
@@ -79,6 +86,9 @@ void CI_RDMS::startup() {
     na_ = det_space_[0].count_alfa();
     nb_ = det_space_[0].count_beta();
 
+    // the thread-local RDM buffers may use up to half of the memory given to psi4
+    rdm_buffer_memory_ = psi::Process::environment.get_memory() / 2;
+
     print_ = false;
 
     one_map_done_ = false;
@@ -93,6 +103,48 @@ void CI_RDMS::startup() {
 
 void CI_RDMS::set_max_rdm(int rdm) { max_rdm_ = rdm; }
 
+void CI_RDMS::parallel_rdm_build(std::vector<double>& rdm,
+                                 const std::vector<RDMBuildTask>& tasks) const {
+    const size_t buffer_size = sizeof(double) * std::max<size_t>(rdm.size(), 1);
+    const size_t max_buffers = std::max<size_t>(rdm_buffer_memory_ / buffer_size, 1);
+    const int nthreads = static_cast<int>(
+        std::min<size_t>(static_cast<size_t>(omp_get_max_threads()), max_buffers));
+
+    // with a single thread there is no need for a private copy
+    if (nthreads <= 1) {
+        for (const auto& [n, func] : tasks) {
+            for (size_t i = 0; i < n; ++i) {
+                func(i, rdm.data());
+            }
+        }
+        return;
+    }
+
+#pragma omp parallel num_threads(nthreads)
+    {
+        std::vector<double> buffer(rdm.size(), 0.0);
+        for (const auto& task : tasks) {
+            const size_t n = task.first;
+            const auto& func = task.second;
+#pragma omp for schedule(dynamic, 16) nowait
+            for (size_t i = 0; i < n; ++i) {
+                func(i, buffer.data());
+            }
+        }
+#pragma omp critical
+        {
+            for (size_t k = 0, size = rdm.size(); k < size; ++k) {
+                rdm[k] += buffer[k];
+            }
+        }
+    }
+}
+
+void CI_RDMS::parallel_rdm_build(std::vector<double>& rdm, size_t n,
+                                 const std::function<void(size_t, double*)>& func) const {
+    parallel_rdm_build(rdm, {RDMBuildTask(n, func)});
+}
+
 double CI_RDMS::get_energy(std::shared_ptr<ActiveSpaceIntegrals> as_ints,
                            std::vector<double>& oprdm_a, std::vector<double>& oprdm_b,
                            std::vector<double>& tprdm_aa, std::vector<double>& tprdm_bb,
@@ -202,7 +254,8 @@ void CI_RDMS::compute_1rdm_op(std::vector<double>& oprdm_a, std::vector<double>&
         }
     }
 
-    for (const auto& coupled_dets : op->a_list_) {
+    parallel_rdm_build(oprdm_a, op->a_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->a_list_[n];
         for (size_t a = 0, coupled_dets_size = coupled_dets.size(); a < coupled_dets_size; ++a) {
             const auto [I, _p] = coupled_dets[a];
             auto p = std::abs(_p) - 1;
@@ -216,12 +269,13 @@ void CI_RDMS::compute_1rdm_op(std::vector<double>& oprdm_a, std::vector<double>&
                 auto q = std::abs(_q) - 1;
                 auto sign = ((_q < 0) == sign_p) ? 1 : -1;
 
-                oprdm_a[p * norb_ + q] += vI1 * evecs_->get(J, root2_) * sign;
-                oprdm_a[q * norb_ + p] += evecs_->get(J, root1_) * vI2 * sign;
+                rdm[p * norb_ + q] += vI1 * evecs_->get(J, root2_) * sign;
+                rdm[q * norb_ + p] += evecs_->get(J, root1_) * vI2 * sign;
             }
         }
-    }
-    for (const auto& coupled_dets : op->b_list_) {
+    });
+    parallel_rdm_build(oprdm_b, op->b_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->b_list_[n];
         for (size_t a = 0, coupled_dets_size = coupled_dets.size(); a < coupled_dets_size; ++a) {
             const auto [I, _p] = coupled_dets[a];
             auto p = std::abs(_p) - 1;
@@ -235,11 +289,11 @@ void CI_RDMS::compute_1rdm_op(std::vector<double>& oprdm_a, std::vector<double>&
                 auto q = std::abs(_q) - 1;
                 auto sign = ((_q < 0) == sign_p) ? 1 : -1;
 
-                oprdm_b[p * norb_ + q] += vI1 * evecs_->get(J, root2_) * sign;
-                oprdm_b[q * norb_ + p] += evecs_->get(J, root1_) * vI2 * sign;
+                rdm[p * norb_ + q] += vI1 * evecs_->get(J, root2_) * sign;
+                rdm[q * norb_ + p] += evecs_->get(J, root1_) * vI2 * sign;
             }
         }
-    }
+    });
 
     if (print_) {
         outfile->Printf("\n  Time spent building 1-rdm: %.3e seconds", build.get());
@@ -384,7 +438,8 @@ void CI_RDMS::compute_2rdm_op(std::vector<double>& tprdm_aa, std::vector<double>
     }
 
     // aaaa
-    for (const auto& coupled_dets : op->aa_list_) {
+    parallel_rdm_build(tprdm_aa, op->aa_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->aa_list_[n];
         for (size_t a = 0, coupled_dets_size = coupled_dets.size(); a < coupled_dets_size; ++a) {
             const auto [J, _p, q] = coupled_dets[a];
             auto p = std::abs(_p) - 1;
@@ -399,22 +454,23 @@ void CI_RDMS::compute_2rdm_op(std::vector<double>& tprdm_aa, std::vector<double>
                 auto sign = ((_r < 0) == sign_pq) ? 1 : -1;
 
                 auto value = vJ1 * evecs_->get(I, root2_) * sign;
-                tprdm_aa[p * norb3_ + q * norb2_ + r * norb_ + s] += value;
-                tprdm_aa[p * norb3_ + q * norb2_ + s * norb_ + r] -= value;
-                tprdm_aa[q * norb3_ + p * norb2_ + r * norb_ + s] -= value;
-                tprdm_aa[q * norb3_ + p * norb2_ + s * norb_ + r] += value;
+                rdm[p * norb3_ + q * norb2_ + r * norb_ + s] += value;
+                rdm[p * norb3_ + q * norb2_ + s * norb_ + r] -= value;
+                rdm[q * norb3_ + p * norb2_ + r * norb_ + s] -= value;
+                rdm[q * norb3_ + p * norb2_ + s * norb_ + r] += value;
 
                 value = evecs_->get(I, root1_) * vJ2 * sign;
-                tprdm_aa[r * norb3_ + s * norb2_ + p * norb_ + q] += value;
-                tprdm_aa[s * norb3_ + r * norb2_ + p * norb_ + q] -= value;
-                tprdm_aa[r * norb3_ + s * norb2_ + q * norb_ + p] -= value;
-                tprdm_aa[s * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[r * norb3_ + s * norb2_ + p * norb_ + q] += value;
+                rdm[s * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[r * norb3_ + s * norb2_ + q * norb_ + p] -= value;
+                rdm[s * norb3_ + r * norb2_ + q * norb_ + p] += value;
             }
         }
-    }
+    });
 
     // bbbb
-    for (const auto& coupled_dets : op->bb_list_) {
+    parallel_rdm_build(tprdm_bb, op->bb_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->bb_list_[n];
         for (size_t a = 0, coupled_dets_size = coupled_dets.size(); a < coupled_dets_size; ++a) {
             const auto [J, _p, q] = coupled_dets[a];
             auto p = std::abs(_p) - 1;
@@ -429,22 +485,23 @@ void CI_RDMS::compute_2rdm_op(std::vector<double>& tprdm_aa, std::vector<double>
                 auto sign = ((_r < 0) == sign_pq) ? 1 : -1;
 
                 auto value = vJ1 * evecs_->get(I, root2_) * sign;
-                tprdm_bb[p * norb3_ + q * norb2_ + r * norb_ + s] += value;
-                tprdm_bb[p * norb3_ + q * norb2_ + s * norb_ + r] -= value;
-                tprdm_bb[q * norb3_ + p * norb2_ + r * norb_ + s] -= value;
-                tprdm_bb[q * norb3_ + p * norb2_ + s * norb_ + r] += value;
+                rdm[p * norb3_ + q * norb2_ + r * norb_ + s] += value;
+                rdm[p * norb3_ + q * norb2_ + s * norb_ + r] -= value;
+                rdm[q * norb3_ + p * norb2_ + r * norb_ + s] -= value;
+                rdm[q * norb3_ + p * norb2_ + s * norb_ + r] += value;
 
                 value = evecs_->get(I, root1_) * vJ2 * sign;
-                tprdm_bb[r * norb3_ + s * norb2_ + p * norb_ + q] += value;
-                tprdm_bb[s * norb3_ + r * norb2_ + p * norb_ + q] -= value;
-                tprdm_bb[r * norb3_ + s * norb2_ + q * norb_ + p] -= value;
-                tprdm_bb[s * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[r * norb3_ + s * norb2_ + p * norb_ + q] += value;
+                rdm[s * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[r * norb3_ + s * norb2_ + q * norb_ + p] -= value;
+                rdm[s * norb3_ + r * norb2_ + q * norb_ + p] += value;
             }
         }
-    }
+    });
 
     // aabb
-    for (const auto& coupled_dets : op->ab_list_) {
+    parallel_rdm_build(tprdm_ab, op->ab_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->ab_list_[n];
         for (size_t a = 0, coupled_dets_size = coupled_dets.size(); a < coupled_dets_size; ++a) {
             const auto [J, _p, q] = coupled_dets[a];
             auto p = std::abs(_p) - 1;
@@ -459,13 +516,13 @@ void CI_RDMS::compute_2rdm_op(std::vector<double>& tprdm_aa, std::vector<double>
                 auto sign = ((_r < 0) == sign_pq) ? 1 : -1;
 
                 double value = vJ1 * evecs_->get(I, root2_) * sign;
-                tprdm_ab[p * norb3_ + q * norb2_ + r * norb_ + s] += value;
+                rdm[p * norb3_ + q * norb2_ + r * norb_ + s] += value;
 
                 value = evecs_->get(I, root1_) * vJ2 * sign;
-                tprdm_ab[r * norb3_ + s * norb2_ + p * norb_ + q] += value;
+                rdm[r * norb3_ + s * norb2_ + p * norb_ + q] += value;
             }
         }
-    }
+    });
 
     if (print_) {
         outfile->Printf("\n  Time spent building 2-rdm: %.3e seconds", build.get());
@@ -966,7 +1023,8 @@ void CI_RDMS::compute_3rdm_op(std::vector<double>& tprdm_aaa, std::vector<double
     }
 
     // aaa aaa
-    for (const auto& coupled_dets : op->aaa_list_) {
+    parallel_rdm_build(tprdm_aaa, op->aaa_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->aaa_list_[n];
         auto coupled_dets_size = coupled_dets.size();
 
         for (size_t a = 0; a < coupled_dets_size; ++a) {
@@ -984,169 +1042,98 @@ void CI_RDMS::compute_3rdm_op(std::vector<double>& tprdm_aaa, std::vector<double
 
                 auto value = vJ1 * evecs_->get(I, root2_) * sign;
 
-                tprdm_aaa[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] +=
-                    value;
-                tprdm_aaa[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] -=
-                    value;
-                tprdm_aaa[p * norb5_ + q * norb4_ + r * norb3_ + u * norb2_ + t * norb_ + s] -=
-                    value;
-                tprdm_aaa[p * norb5_ + q * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] +=
-                    value;
-                tprdm_aaa[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] -=
-                    value;
-                tprdm_aaa[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + u * norb_ + s] +=
-                    value;
-
-                tprdm_aaa[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] -=
-                    value;
-                tprdm_aaa[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] +=
-                    value;
-                tprdm_aaa[p * norb5_ + r * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] +=
-                    value;
-                tprdm_aaa[p * norb5_ + r * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] -=
-                    value;
-                tprdm_aaa[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] +=
-                    value;
-                tprdm_aaa[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] -=
-                    value;
-
-                tprdm_aaa[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] -=
-                    value;
-                tprdm_aaa[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] +=
-                    value;
-                tprdm_aaa[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + t * norb_ + s] +=
-                    value;
-                tprdm_aaa[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] -=
-                    value;
-                tprdm_aaa[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] +=
-                    value;
-                tprdm_aaa[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + u * norb_ + s] -=
-                    value;
-
-                tprdm_aaa[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + t * norb_ + u] +=
-                    value;
-                tprdm_aaa[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] -=
-                    value;
-                tprdm_aaa[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] -=
-                    value;
-                tprdm_aaa[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] +=
-                    value;
-                tprdm_aaa[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + s * norb_ + u] -=
-                    value;
-                tprdm_aaa[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] +=
-                    value;
-
-                tprdm_aaa[r * norb5_ + p * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] +=
-                    value;
-                tprdm_aaa[r * norb5_ + p * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] -=
-                    value;
-                tprdm_aaa[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] -=
-                    value;
-                tprdm_aaa[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] +=
-                    value;
-                tprdm_aaa[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] -=
-                    value;
-                tprdm_aaa[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] +=
-                    value;
-
-                tprdm_aaa[r * norb5_ + q * norb4_ + p * norb3_ + s * norb2_ + t * norb_ + u] -=
-                    value;
-                tprdm_aaa[r * norb5_ + q * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] +=
-                    value;
-                tprdm_aaa[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] +=
-                    value;
-                tprdm_aaa[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] -=
-                    value;
-                tprdm_aaa[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + s * norb_ + u] +=
-                    value;
-                tprdm_aaa[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] -=
-                    value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] += value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] -= value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + u * norb2_ + t * norb_ + s] -= value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] += value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] -= value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + u * norb_ + s] += value;
+
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] -= value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] += value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] += value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] -= value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] += value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] -= value;
+
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] -= value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] += value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + t * norb_ + s] += value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] -= value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] += value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + u * norb_ + s] -= value;
+
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + t * norb_ + u] += value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] -= value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] -= value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] += value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + s * norb_ + u] -= value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] += value;
+
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] += value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] -= value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] -= value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] += value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] -= value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] += value;
+
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + s * norb2_ + t * norb_ + u] -= value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] += value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] += value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] -= value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + s * norb_ + u] += value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] -= value;
 
                 value = evecs_->get(I, root1_) * vJ2 * sign;
 
-                tprdm_aaa[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] +=
-                    value;
-                tprdm_aaa[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] -=
-                    value;
-                tprdm_aaa[u * norb5_ + t * norb4_ + s * norb3_ + p * norb2_ + q * norb_ + r] -=
-                    value;
-                tprdm_aaa[u * norb5_ + s * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] +=
-                    value;
-                tprdm_aaa[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] -=
-                    value;
-                tprdm_aaa[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + q * norb_ + r] +=
-                    value;
-
-                tprdm_aaa[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] -=
-                    value;
-                tprdm_aaa[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] +=
-                    value;
-                tprdm_aaa[u * norb5_ + t * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] +=
-                    value;
-                tprdm_aaa[u * norb5_ + s * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] -=
-                    value;
-                tprdm_aaa[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] +=
-                    value;
-                tprdm_aaa[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] -=
-                    value;
-
-                tprdm_aaa[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] -=
-                    value;
-                tprdm_aaa[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] +=
-                    value;
-                tprdm_aaa[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + p * norb_ + r] +=
-                    value;
-                tprdm_aaa[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] -=
-                    value;
-                tprdm_aaa[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] +=
-                    value;
-                tprdm_aaa[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + p * norb_ + r] -=
-                    value;
-
-                tprdm_aaa[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + r * norb_ + p] +=
-                    value;
-                tprdm_aaa[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] -=
-                    value;
-                tprdm_aaa[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] -=
-                    value;
-                tprdm_aaa[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] +=
-                    value;
-                tprdm_aaa[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + r * norb_ + p] -=
-                    value;
-                tprdm_aaa[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] +=
-                    value;
-
-                tprdm_aaa[s * norb5_ + t * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] +=
-                    value;
-                tprdm_aaa[s * norb5_ + u * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] -=
-                    value;
-                tprdm_aaa[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] -=
-                    value;
-                tprdm_aaa[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] +=
-                    value;
-                tprdm_aaa[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] -=
-                    value;
-                tprdm_aaa[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] +=
-                    value;
-
-                tprdm_aaa[s * norb5_ + t * norb4_ + u * norb3_ + r * norb2_ + q * norb_ + p] -=
-                    value;
-                tprdm_aaa[s * norb5_ + u * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] +=
-                    value;
-                tprdm_aaa[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] +=
-                    value;
-                tprdm_aaa[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] -=
-                    value;
-                tprdm_aaa[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + q * norb_ + p] +=
-                    value;
-                tprdm_aaa[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] -=
-                    value;
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] += value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] -= value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + p * norb2_ + q * norb_ + r] -= value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] += value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] -= value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + q * norb_ + r] += value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] -= value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] += value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] += value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] -= value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] += value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] -= value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] -= value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] += value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + p * norb_ + r] += value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] -= value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] += value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + p * norb_ + r] -= value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + r * norb_ + p] += value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] -= value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] -= value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] += value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + r * norb_ + p] -= value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] += value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] += value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] += value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] += value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + r * norb2_ + q * norb_ + p] -= value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] -= value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] -= value;
             }
         }
-    }
+    });
 
     // aab aab
-    for (const auto& coupled_dets : op->aab_list_) {
+    parallel_rdm_build(tprdm_aab, op->aab_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->aab_list_[n];
         auto coupled_dets_size = coupled_dets.size();
 
         for (size_t a = 0; a < coupled_dets_size; ++a) {
@@ -1163,30 +1150,23 @@ void CI_RDMS::compute_3rdm_op(std::vector<double>& tprdm_aaa, std::vector<double
                 auto sign = ((_s < 0) == sign_pqr) ? 1 : -1;
 
                 auto value = vJ1 * evecs_->get(I, root2_) * sign;
-                tprdm_aab[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] +=
-                    value;
-                tprdm_aab[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] -=
-                    value;
-                tprdm_aab[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] -=
-                    value;
-                tprdm_aab[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] +=
-                    value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] += value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] -= value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] -= value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] += value;
 
                 value = evecs_->get(I, root1_) * vJ2 * sign;
-                tprdm_aab[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] +=
-                    value;
-                tprdm_aab[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] -=
-                    value;
-                tprdm_aab[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] -=
-                    value;
-                tprdm_aab[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] +=
-                    value;
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] += value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] -= value;
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] -= value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] += value;
             }
         }
-    }
+    });
 
     // abb abb
-    for (const auto& coupled_dets : op->abb_list_) {
+    parallel_rdm_build(tprdm_abb, op->abb_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->abb_list_[n];
         auto coupled_dets_size = coupled_dets.size();
 
         for (size_t a = 0; a < coupled_dets_size; ++a) {
@@ -1203,30 +1183,23 @@ void CI_RDMS::compute_3rdm_op(std::vector<double>& tprdm_aaa, std::vector<double
                 auto sign = ((_s < 0) == sign_pqr) ? 1 : -1;
 
                 auto value = vJ1 * evecs_->get(I, root2_) * sign;
-                tprdm_abb[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] +=
-                    value;
-                tprdm_abb[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] -=
-                    value;
-                tprdm_abb[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] -=
-                    value;
-                tprdm_abb[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] +=
-                    value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] += value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] -= value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] -= value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] += value;
 
                 value = evecs_->get(I, root1_) * vJ2 * sign;
-                tprdm_abb[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] +=
-                    value;
-                tprdm_abb[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] -=
-                    value;
-                tprdm_abb[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] -=
-                    value;
-                tprdm_abb[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] +=
-                    value;
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] += value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] -= value;
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] -= value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] += value;
             }
         }
-    }
+    });
 
     // bbb bbb
-    for (const auto& coupled_dets : op->bbb_list_) {
+    parallel_rdm_build(tprdm_bbb, op->bbb_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->bbb_list_[n];
         auto coupled_dets_size = coupled_dets.size();
 
         for (size_t a = 0; a < coupled_dets_size; ++a) {
@@ -1244,166 +1217,94 @@ void CI_RDMS::compute_3rdm_op(std::vector<double>& tprdm_aaa, std::vector<double
 
                 auto value = vJ1 * evecs_->get(I, root2_) * sign;
 
-                tprdm_bbb[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] +=
-                    value;
-                tprdm_bbb[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] -=
-                    value;
-                tprdm_bbb[p * norb5_ + q * norb4_ + r * norb3_ + u * norb2_ + t * norb_ + s] -=
-                    value;
-                tprdm_bbb[p * norb5_ + q * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] +=
-                    value;
-                tprdm_bbb[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] -=
-                    value;
-                tprdm_bbb[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + u * norb_ + s] +=
-                    value;
-
-                tprdm_bbb[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] -=
-                    value;
-                tprdm_bbb[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] +=
-                    value;
-                tprdm_bbb[p * norb5_ + r * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] +=
-                    value;
-                tprdm_bbb[p * norb5_ + r * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] -=
-                    value;
-                tprdm_bbb[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] +=
-                    value;
-                tprdm_bbb[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] -=
-                    value;
-
-                tprdm_bbb[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] -=
-                    value;
-                tprdm_bbb[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] +=
-                    value;
-                tprdm_bbb[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + t * norb_ + s] +=
-                    value;
-                tprdm_bbb[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] -=
-                    value;
-                tprdm_bbb[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] +=
-                    value;
-                tprdm_bbb[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + u * norb_ + s] -=
-                    value;
-
-                tprdm_bbb[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + t * norb_ + u] +=
-                    value;
-                tprdm_bbb[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] -=
-                    value;
-                tprdm_bbb[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] -=
-                    value;
-                tprdm_bbb[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] +=
-                    value;
-                tprdm_bbb[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + s * norb_ + u] -=
-                    value;
-                tprdm_bbb[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] +=
-                    value;
-
-                tprdm_bbb[r * norb5_ + p * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] +=
-                    value;
-                tprdm_bbb[r * norb5_ + p * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] -=
-                    value;
-                tprdm_bbb[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] -=
-                    value;
-                tprdm_bbb[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] +=
-                    value;
-                tprdm_bbb[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] -=
-                    value;
-                tprdm_bbb[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] +=
-                    value;
-
-                tprdm_bbb[r * norb5_ + q * norb4_ + p * norb3_ + s * norb2_ + t * norb_ + u] -=
-                    value;
-                tprdm_bbb[r * norb5_ + q * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] +=
-                    value;
-                tprdm_bbb[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] +=
-                    value;
-                tprdm_bbb[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] -=
-                    value;
-                tprdm_bbb[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + s * norb_ + u] +=
-                    value;
-                tprdm_bbb[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] -=
-                    value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] += value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] -= value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + u * norb2_ + t * norb_ + s] -= value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] += value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] -= value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + u * norb_ + s] += value;
+
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] -= value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] += value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] += value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] -= value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] += value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] -= value;
+
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] -= value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] += value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + t * norb_ + s] += value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] -= value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] += value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + u * norb_ + s] -= value;
+
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + t * norb_ + u] += value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] -= value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] -= value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] += value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + s * norb_ + u] -= value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] += value;
+
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] += value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] -= value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] -= value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] += value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] -= value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] += value;
+
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + s * norb2_ + t * norb_ + u] -= value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] += value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] += value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] -= value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + s * norb_ + u] += value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] -= value;
 
                 value = evecs_->get(I, root1_) * vJ2 * sign;
 
-                tprdm_bbb[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] +=
-                    value;
-                tprdm_bbb[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] -=
-                    value;
-                tprdm_bbb[u * norb5_ + t * norb4_ + s * norb3_ + p * norb2_ + q * norb_ + r] -=
-                    value;
-                tprdm_bbb[u * norb5_ + s * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] +=
-                    value;
-                tprdm_bbb[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] -=
-                    value;
-                tprdm_bbb[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + q * norb_ + r] +=
-                    value;
-
-                tprdm_bbb[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] -=
-                    value;
-                tprdm_bbb[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] +=
-                    value;
-                tprdm_bbb[u * norb5_ + t * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] +=
-                    value;
-                tprdm_bbb[u * norb5_ + s * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] -=
-                    value;
-                tprdm_bbb[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] +=
-                    value;
-                tprdm_bbb[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] -=
-                    value;
-
-                tprdm_bbb[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] -=
-                    value;
-                tprdm_bbb[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] +=
-                    value;
-                tprdm_bbb[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + p * norb_ + r] +=
-                    value;
-                tprdm_bbb[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] -=
-                    value;
-                tprdm_bbb[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] +=
-                    value;
-                tprdm_bbb[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + p * norb_ + r] -=
-                    value;
-
-                tprdm_bbb[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + r * norb_ + p] +=
-                    value;
-                tprdm_bbb[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] -=
-                    value;
-                tprdm_bbb[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] -=
-                    value;
-                tprdm_bbb[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] +=
-                    value;
-                tprdm_bbb[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + r * norb_ + p] -=
-                    value;
-                tprdm_bbb[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] +=
-                    value;
-
-                tprdm_bbb[s * norb5_ + t * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] +=
-                    value;
-                tprdm_bbb[s * norb5_ + u * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] -=
-                    value;
-                tprdm_bbb[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] -=
-                    value;
-                tprdm_bbb[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] +=
-                    value;
-                tprdm_bbb[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] -=
-                    value;
-                tprdm_bbb[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] +=
-                    value;
-
-                tprdm_bbb[s * norb5_ + t * norb4_ + u * norb3_ + r * norb2_ + q * norb_ + p] -=
-                    value;
-                tprdm_bbb[s * norb5_ + u * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] +=
-                    value;
-                tprdm_bbb[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] +=
-                    value;
-                tprdm_bbb[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] -=
-                    value;
-                tprdm_bbb[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + q * norb_ + p] +=
-                    value;
-                tprdm_bbb[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] -=
-                    value;
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] += value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] -= value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + p * norb2_ + q * norb_ + r] -= value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] += value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] -= value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + q * norb_ + r] += value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] -= value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] += value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] += value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] -= value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] += value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] -= value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] -= value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] += value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + p * norb_ + r] += value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] -= value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] += value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + p * norb_ + r] -= value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + r * norb_ + p] += value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] -= value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] -= value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] += value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + r * norb_ + p] -= value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] += value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] += value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] += value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] += value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + r * norb2_ + q * norb_ + p] -= value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] -= value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] -= value;
             }
         }
-    }
+    });
 
     if (print_) {
         outfile->Printf("\n  Time spent building 3-rdm: %.3e seconds", build.get());
@@ -119,6 +119,10 @@ class CI_RDMS {
 
     void set_max_rdm(int rdm);
 
+    /// Set the maximum memory (in bytes) used by the thread-local buffers of the RDM builds
+    /// (default: half of the psi4 memory)
+    void set_rdm_buffer_memory(size_t memory) { rdm_buffer_memory_ = memory; }
+
     // Convert to strings
     void convert_to_string(std::vector<Determinant>& space);
 
@@ -172,6 +176,10 @@ class CI_RDMS {
 
     int max_rdm_;
 
+    // The maximum memory (in bytes) used by the thread-local RDM buffers (half of the psi4
+    // memory, set in startup())
+    size_t rdm_buffer_memory_ = 0;
+
     // The list of a_p |N>
     std::vector<std::vector<std::pair<size_t, short>>> a_ann_list_;
     std::vector<std::vector<std::pair<size_t, short>>> b_ann_list_;
@@ -231,6 +239,20 @@ class CI_RDMS {
     // Generate three-particle map
     void get_three_map();
 
+    //*- Functions for parallel RDM builds -*//
+
+    // A loop over n elements that adds contributions to an RDM buffer: func(i, buffer)
+    using RDMBuildTask = std::pair<size_t, std::function<void(size_t, double*)>>;
+
+    // Run a set of loops in parallel. Each thread accumulates its contributions in a private copy
+    // of rdm and the copies are added to rdm at the end. The number of threads is limited so that
+    // the private copies fit in rdm_buffer_memory_.
+    void parallel_rdm_build(std::vector<double>& rdm, const std::vector<RDMBuildTask>& tasks) const;
+
+    // Run a single loop with parallel_rdm_build
+    void parallel_rdm_build(std::vector<double>& rdm, size_t n,
+                            const std::function<void(size_t, double*)>& func) const;
+
     //*- Functions for Dynamic RDM builds -*//
 
     // Function to fill 3rdm with all (or half of all) permutations of the 6 indices
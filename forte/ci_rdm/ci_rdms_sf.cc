@@ -91,17 +91,19 @@ void CI_RDMS::compute_1rdm_sf_op(std::vector<double>& opdm) {
     timer build("Build SF 1-RDM");
 
     const det_hashvec& dets = wfn_.wfn_hash();
-    for (size_t J = 0; J < dim_space_; ++J) {
+    std::vector<RDMBuildTask> tasks;
+    tasks.emplace_back(dim_space_, [&](size_t J, double* rdm) {
         double cJ_sq = evecs_->get(J, root1_) * evecs_->get(J, root2_);
         for (int pp : dets[J].get_alfa_occ(norb_)) {
-            opdm[pp * norb_ + pp] += cJ_sq;
+            rdm[pp * norb_ + pp] += cJ_sq;
         }
         for (int pp : dets[J].get_beta_occ(norb_)) {
-            opdm[pp * norb_ + pp] += cJ_sq;
+            rdm[pp * norb_ + pp] += cJ_sq;
         }
-    }
+    });
 
-    for (const auto& coupled_dets : op->a_list_) {
+    tasks.emplace_back(op->a_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->a_list_[n];
         for (size_t a = 0, coupled_dets_size = coupled_dets.size(); a < coupled_dets_size; ++a) {
             const auto [I, _p] = coupled_dets[a];
             auto p = std::abs(_p) - 1;
@@ -115,12 +117,13 @@ void CI_RDMS::compute_1rdm_sf_op(std::vector<double>& opdm) {
                 auto q = std::abs(_q) - 1;
                 auto sign = ((_q < 0) == sign_p) ? 1 : -1;
 
-                opdm[p * norb_ + q] += vI1 * evecs_->get(J, root2_) * sign;
-                opdm[q * norb_ + p] += evecs_->get(J, root1_) * vI2 * sign;
+                rdm[p * norb_ + q] += vI1 * evecs_->get(J, root2_) * sign;
+                rdm[q * norb_ + p] += evecs_->get(J, root1_) * vI2 * sign;
             }
         }
-    }
-    for (const auto& coupled_dets : op->b_list_) {
+    });
+    tasks.emplace_back(op->b_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->b_list_[n];
         for (size_t a = 0, coupled_dets_size = coupled_dets.size(); a < coupled_dets_size; ++a) {
             const auto [I, _p] = coupled_dets[a];
             auto p = std::abs(_p) - 1;
@@ -134,11 +137,13 @@ void CI_RDMS::compute_1rdm_sf_op(std::vector<double>& opdm) {
                 auto q = std::abs(_q) - 1;
                 auto sign = ((_q < 0) == sign_p) ? 1 : -1;
 
-                opdm[p * norb_ + q] += vI1 * evecs_->get(J, root2_) * sign;
-                opdm[q * norb_ + p] += evecs_->get(J, root1_) * vI2 * sign;
+                rdm[p * norb_ + q] += vI1 * evecs_->get(J, root2_) * sign;
+                rdm[q * norb_ + p] += evecs_->get(J, root1_) * vI2 * sign;
             }
         }
-    }
+    });
+
+    parallel_rdm_build(opdm, tasks);
 
     auto t_build = build.stop();
     if (print_) {
@@ -234,7 +239,8 @@ void CI_RDMS::compute_2rdm_sf_op(std::vector<double>& tpdm) {
     timer build("Build SF 2-RDM");
 
     const det_hashvec& dets = wfn_.wfn_hash();
-    for (size_t J = 0; J < dim_space_; ++J) {
+    std::vector<RDMBuildTask> tasks;
+    tasks.emplace_back(dim_space_, [&](size_t J, double* rdm) {
         auto cJ_sq = evecs_->get(J, root1_) * evecs_->get(J, root2_);
         auto aocc = dets[J].get_alfa_occ(norb_);
         auto bocc = dets[J].get_beta_occ(norb_);
@@ -247,11 +253,11 @@ void CI_RDMS::compute_2rdm_sf_op(std::vector<double>& tpdm) {
             for (size_t q = p + 1; q < naocc; ++q) {
                 auto qq = aocc[q];
 
-                tpdm[pp * norb3_ + qq * norb2_ + pp * norb_ + qq] += cJ_sq;
-                tpdm[qq * norb3_ + pp * norb2_ + pp * norb_ + qq] -= cJ_sq;
+                rdm[pp * norb3_ + qq * norb2_ + pp * norb_ + qq] += cJ_sq;
+                rdm[qq * norb3_ + pp * norb2_ + pp * norb_ + qq] -= cJ_sq;
 
-                tpdm[qq * norb3_ + pp * norb2_ + qq * norb_ + pp] += cJ_sq;
-                tpdm[pp * norb3_ + qq * norb2_ + qq * norb_ + pp] -= cJ_sq;
+                rdm[qq * norb3_ + pp * norb2_ + qq * norb_ + pp] += cJ_sq;
+                rdm[pp * norb3_ + qq * norb2_ + qq * norb_ + pp] -= cJ_sq;
             }
         }
 
@@ -260,11 +266,11 @@ void CI_RDMS::compute_2rdm_sf_op(std::vector<double>& tpdm) {
             for (size_t q = p + 1; q < nbocc; ++q) {
                 auto qq = bocc[q];
 
-                tpdm[pp * norb3_ + qq * norb2_ + pp * norb_ + qq] += cJ_sq;
-                tpdm[qq * norb3_ + pp * norb2_ + pp * norb_ + qq] -= cJ_sq;
+                rdm[pp * norb3_ + qq * norb2_ + pp * norb_ + qq] += cJ_sq;
+                rdm[qq * norb3_ + pp * norb2_ + pp * norb_ + qq] -= cJ_sq;
 
-                tpdm[qq * norb3_ + pp * norb2_ + qq * norb_ + pp] += cJ_sq;
-                tpdm[pp * norb3_ + qq * norb2_ + qq * norb_ + pp] -= cJ_sq;
+                rdm[qq * norb3_ + pp * norb2_ + qq * norb_ + pp] += cJ_sq;
+                rdm[pp * norb3_ + qq * norb2_ + qq * norb_ + pp] -= cJ_sq;
             }
         }
 
@@ -273,14 +279,15 @@ void CI_RDMS::compute_2rdm_sf_op(std::vector<double>& tpdm) {
             for (size_t q = 0; q < nbocc; ++q) {
                 auto qq = bocc[q];
 
-                tpdm[pp * norb3_ + qq * norb2_ + pp * norb_ + qq] += cJ_sq;
-                tpdm[qq * norb3_ + pp * norb2_ + qq * norb_ + pp] += cJ_sq;
+                rdm[pp * norb3_ + qq * norb2_ + pp * norb_ + qq] += cJ_sq;
+                rdm[qq * norb3_ + pp * norb2_ + qq * norb_ + pp] += cJ_sq;
             }
         }
-    }
+    });
 
     // aaaa
-    for (const auto& coupled_dets : op->aa_list_) {
+    tasks.emplace_back(op->aa_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->aa_list_[n];
         for (size_t a = 0, coupled_dets_size = coupled_dets.size(); a < coupled_dets_size; ++a) {
             const auto [J, _p, q] = coupled_dets[a];
             auto p = std::abs(_p) - 1;
@@ -295,22 +302,23 @@ void CI_RDMS::compute_2rdm_sf_op(std::vector<double>& tpdm) {
                 auto sign = ((_r < 0) == sign_pq) ? 1 : -1;
 
                 auto value = vJ1 * evecs_->get(I, root2_) * sign;
-                tpdm[p * norb3_ + q * norb2_ + r * norb_ + s] += value;
-                tpdm[p * norb3_ + q * norb2_ + s * norb_ + r] -= value;
-                tpdm[q * norb3_ + p * norb2_ + r * norb_ + s] -= value;
-                tpdm[q * norb3_ + p * norb2_ + s * norb_ + r] += value;
+                rdm[p * norb3_ + q * norb2_ + r * norb_ + s] += value;
+                rdm[p * norb3_ + q * norb2_ + s * norb_ + r] -= value;
+                rdm[q * norb3_ + p * norb2_ + r * norb_ + s] -= value;
+                rdm[q * norb3_ + p * norb2_ + s * norb_ + r] += value;
 
                 value = evecs_->get(I, root1_) * vJ2 * sign;
-                tpdm[r * norb3_ + s * norb2_ + p * norb_ + q] += value;
-                tpdm[s * norb3_ + r * norb2_ + p * norb_ + q] -= value;
-                tpdm[r * norb3_ + s * norb2_ + q * norb_ + p] -= value;
-                tpdm[s * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[r * norb3_ + s * norb2_ + p * norb_ + q] += value;
+                rdm[s * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[r * norb3_ + s * norb2_ + q * norb_ + p] -= value;
+                rdm[s * norb3_ + r * norb2_ + q * norb_ + p] += value;
             }
         }
-    }
+    });
 
     // bbbb
-    for (const auto& coupled_dets : op->bb_list_) {
+    tasks.emplace_back(op->bb_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->bb_list_[n];
         for (size_t a = 0, coupled_dets_size = coupled_dets.size(); a < coupled_dets_size; ++a) {
             const auto [J, _p, q] = coupled_dets[a];
             auto p = std::abs(_p) - 1;
@@ -325,22 +333,23 @@ void CI_RDMS::compute_2rdm_sf_op(std::vector<double>& tpdm) {
                 auto sign = ((_r < 0) == sign_pq) ? 1 : -1;
 
                 auto value = vJ1 * evecs_->get(I, root2_) * sign;
-                tpdm[p * norb3_ + q * norb2_ + r * norb_ + s] += value;
-                tpdm[p * norb3_ + q * norb2_ + s * norb_ + r] -= value;
-                tpdm[q * norb3_ + p * norb2_ + r * norb_ + s] -= value;
-                tpdm[q * norb3_ + p * norb2_ + s * norb_ + r] += value;
+                rdm[p * norb3_ + q * norb2_ + r * norb_ + s] += value;
+                rdm[p * norb3_ + q * norb2_ + s * norb_ + r] -= value;
+                rdm[q * norb3_ + p * norb2_ + r * norb_ + s] -= value;
+                rdm[q * norb3_ + p * norb2_ + s * norb_ + r] += value;
 
                 value = evecs_->get(I, root1_) * vJ2 * sign;
-                tpdm[r * norb3_ + s * norb2_ + p * norb_ + q] += value;
-                tpdm[s * norb3_ + r * norb2_ + p * norb_ + q] -= value;
-                tpdm[r * norb3_ + s * norb2_ + q * norb_ + p] -= value;
-                tpdm[s * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[r * norb3_ + s * norb2_ + p * norb_ + q] += value;
+                rdm[s * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[r * norb3_ + s * norb2_ + q * norb_ + p] -= value;
+                rdm[s * norb3_ + r * norb2_ + q * norb_ + p] += value;
             }
         }
-    }
+    });
 
     // aabb
-    for (const auto& coupled_dets : op->ab_list_) {
+    tasks.emplace_back(op->ab_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->ab_list_[n];
         for (size_t a = 0, coupled_dets_size = coupled_dets.size(); a < coupled_dets_size; ++a) {
             const auto [J, _p, q] = coupled_dets[a];
             auto p = std::abs(_p) - 1;
@@ -355,15 +364,17 @@ void CI_RDMS::compute_2rdm_sf_op(std::vector<double>& tpdm) {
                 auto sign = ((_r < 0) == sign_pq) ? 1 : -1;
 
                 double value = vJ1 * evecs_->get(I, root2_) * sign;
-                tpdm[p * norb3_ + q * norb2_ + r * norb_ + s] += value;
-                tpdm[q * norb3_ + p * norb2_ + s * norb_ + r] += value;
+                rdm[p * norb3_ + q * norb2_ + r * norb_ + s] += value;
+                rdm[q * norb3_ + p * norb2_ + s * norb_ + r] += value;
 
                 value = evecs_->get(I, root1_) * vJ2 * sign;
-                tpdm[r * norb3_ + s * norb2_ + p * norb_ + q] += value;
-                tpdm[s * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[r * norb3_ + s * norb2_ + p * norb_ + q] += value;
+                rdm[s * norb3_ + r * norb2_ + q * norb_ + p] += value;
             }
         }
-    }
+    });
+
+    parallel_rdm_build(tpdm, tasks);
 
     auto t_build = build.stop();
     if (print_) {
@@ -576,7 +587,8 @@ void CI_RDMS::compute_3rdm_sf_op(std::vector<double>& tpdm3) {
 
     // Build the diagonal part
     const det_hashvec& dets = wfn_.wfn_hash();
-    for (size_t I = 0; I < dim_space_; ++I) {
+    std::vector<RDMBuildTask> tasks;
+    tasks.emplace_back(dim_space_, [&](size_t I, double* rdm) {
         double cI_sq = evecs_->get(I, root1_) * evecs_->get(I, root2_);
 
         auto aocc = dets[I].get_alfa_occ(norb_);
@@ -591,82 +603,82 @@ void CI_RDMS::compute_3rdm_sf_op(std::vector<double>& tpdm3) {
                 for (size_t r = q + 1; r < na; ++r) {
                     auto rr = aocc[r];
 
-                    tpdm3[pp * norb5_ + qq * norb4_ + rr * norb3_ + pp * norb2_ + qq * norb_ +
+                    rdm[pp * norb5_ + qq * norb4_ + rr * norb3_ + pp * norb2_ + qq * norb_ +
                           rr] += cI_sq;
-                    tpdm3[pp * norb5_ + qq * norb4_ + rr * norb3_ + pp * norb2_ + rr * norb_ +
+                    rdm[pp * norb5_ + qq * norb4_ + rr * norb3_ + pp * norb2_ + rr * norb_ +
                           qq] -= cI_sq;
-                    tpdm3[pp * norb5_ + qq * norb4_ + rr * norb3_ + rr * norb2_ + pp * norb_ +
+                    rdm[pp * norb5_ + qq * norb4_ + rr * norb3_ + rr * norb2_ + pp * norb_ +
                           qq] += cI_sq;
-                    tpdm3[pp * norb5_ + qq * norb4_ + rr * norb3_ + rr * norb2_ + qq * norb_ +
+                    rdm[pp * norb5_ + qq * norb4_ + rr * norb3_ + rr * norb2_ + qq * norb_ +
                           pp] -= cI_sq;
-                    tpdm3[pp * norb5_ + qq * norb4_ + rr * norb3_ + qq * norb2_ + rr * norb_ +
+                    rdm[pp * norb5_ + qq * norb4_ + rr * norb3_ + qq * norb2_ + rr * norb_ +
                           pp] += cI_sq;
-                    tpdm3[pp * norb5_ + qq * norb4_ + rr * norb3_ + qq * norb2_ + pp * norb_ +
+                    rdm[pp * norb5_ + qq * norb4_ + rr * norb3_ + qq * norb2_ + pp * norb_ +
                           rr] -= cI_sq;
 
-                    tpdm3[pp * norb5_ + rr * norb4_ + qq * norb3_ + pp * norb2_ + qq * norb_ +
+                    rdm[pp * norb5_ + rr * norb4_ + qq * norb3_ + pp * norb2_ + qq * norb_ +
                           rr] -= cI_sq;
-                    tpdm3[pp * norb5_ + rr * norb4_ + qq * norb3_ + pp * norb2_ + rr * norb_ +
+                    rdm[pp * norb5_ + rr * norb4_ + qq * norb3_ + pp * norb2_ + rr * norb_ +
                           qq] += cI_sq;
-                    tpdm3[pp * norb5_ + rr * norb4_ + qq * norb3_ + rr * norb2_ + pp * norb_ +
+                    rdm[pp * norb5_ + rr * norb4_ + qq * norb3_ + rr * norb2_ + pp * norb_ +
                           qq] -= cI_sq;
-                    tpdm3[pp * norb5_ + rr * norb4_ + qq * norb3_ + rr * norb2_ + qq * norb_ +
+                    rdm[pp * norb5_ + rr * norb4_ + qq * norb3_ + rr * norb2_ + qq * norb_ +
                           pp] += cI_sq;
-                    tpdm3[pp * norb5_ + rr * norb4_ + qq * norb3_ + qq * norb2_ + rr * norb_ +
+                    rdm[pp * norb5_ + rr * norb4_ + qq * norb3_ + qq * norb2_ + rr * norb_ +
                           pp] -= cI_sq;
-                    tpdm3[pp * norb5_ + rr * norb4_ + qq * norb3_ + qq * norb2_ + pp * norb_ +
+                    rdm[pp * norb5_ + rr * norb4_ + qq * norb3_ + qq * norb2_ + pp * norb_ +
                           rr] += cI_sq;
 
-                    tpdm3[rr * norb5_ + pp * norb4_ + qq * norb3_ + pp * norb2_ + qq * norb_ +
+                    rdm[rr * norb5_ + pp * norb4_ + qq * norb3_ + pp * norb2_ + qq * norb_ +
                           rr] += cI_sq;
-                    tpdm3[rr * norb5_ + pp * norb4_ + qq * norb3_ + pp * norb2_ + rr * norb_ +
+                    rdm[rr * norb5_ + pp * norb4_ + qq * norb3_ + pp * norb2_ + rr * norb_ +
                           qq] -= cI_sq;
-                    tpdm3[rr * norb5_ + pp * norb4_ + qq * norb3_ + rr * norb2_ + pp * norb_ +
+                    rdm[rr * norb5_ + pp * norb4_ + qq * norb3_ + rr * norb2_ + pp * norb_ +
                           qq] += cI_sq;
-                    tpdm3[rr * norb5_ + pp * norb4_ + qq * norb3_ + rr * norb2_ + qq * norb_ +
+                    rdm[rr * norb5_ + pp * norb4_ + qq * norb3_ + rr * norb2_ + qq * norb_ +
                           pp] -= cI_sq;
-                    tpdm3[rr * norb5_ + pp * norb4_ + qq * norb3_ + qq * norb2_ + rr * norb_ +
+                    rdm[rr * norb5_ + pp * norb4_ + qq * norb3_ + qq * norb2_ + rr * norb_ +
                           pp] += cI_sq;
-                    tpdm3[rr * norb5_ + pp * norb4_ + qq * norb3_ + qq * norb2_ + pp * norb_ +
+                    rdm[rr * norb5_ + pp * norb4_ + qq * norb3_ + qq * norb2_ + pp * norb_ +
                           rr] -= cI_sq;
 
-                    tpdm3[rr * norb5_ + qq * norb4_ + pp * norb3_ + pp * norb2_ + qq * norb_ +
+                    rdm[rr * norb5_ + qq * norb4_ + pp * norb3_ + pp * norb2_ + qq * norb_ +
                           rr] -= cI_sq;
-                    tpdm3[rr * norb5_ + qq * norb4_ + pp * norb3_ + pp * norb2_ + rr * norb_ +
+                    rdm[rr * norb5_ + qq * norb4_ + pp * norb3_ + pp * norb2_ + rr * norb_ +
                           qq] += cI_sq;
-                    tpdm3[rr * norb5_ + qq * norb4_ + pp * norb3_ + rr * norb2_ + pp * norb_ +
+                    rdm[rr * norb5_ + qq * norb4_ + pp * norb3_ + rr * norb2_ + pp * norb_ +
                           qq] -= cI_sq;
-                    tpdm3[rr * norb5_ + qq * norb4_ + pp * norb3_ + rr * norb2_ + qq * norb_ +
+                    rdm[rr * norb5_ + qq * norb4_ + pp * norb3_ + rr * norb2_ + qq * norb_ +
                           pp] += cI_sq;
-                    tpdm3[rr * norb5_ + qq * norb4_ + pp * norb3_ + qq * norb2_ + rr * norb_ +
+                    rdm[rr * norb5_ + qq * norb4_ + pp * norb3_ + qq * norb2_ + rr * norb_ +
                           pp] -= cI_sq;
-                    tpdm3[rr * norb5_ + qq * norb4_ + pp * norb3_ + qq * norb2_ + pp * norb_ +
+                    rdm[rr * norb5_ + qq * norb4_ + pp * norb3_ + qq * norb2_ + pp * norb_ +
                           rr] += cI_sq;
 
-                    tpdm3[qq * norb5_ + rr * norb4_ + pp * norb3_ + pp * norb2_ + qq * norb_ +
+                    rdm[qq * norb5_ + rr * norb4_ + pp * norb3_ + pp * norb2_ + qq * norb_ +
                           rr] += cI_sq;
-                    tpdm3[qq * norb5_ + rr * norb4_ + pp * norb3_ + pp * norb2_ + rr * norb_ +
+                    rdm[qq * norb5_ + rr * norb4_ + pp * norb3_ + pp * norb2_ + rr * norb_ +
                           qq] -= cI_sq;
-                    tpdm3[qq * norb5_ + rr * norb4_ + pp * norb3_ + rr * norb2_ + pp * norb_ +
+                    rdm[qq * norb5_ + rr * norb4_ + pp * norb3_ + rr * norb2_ + pp * norb_ +
                           qq] += cI_sq;
-                    tpdm3[qq * norb5_ + rr * norb4_ + pp * norb3_ + rr * norb2_ + qq * norb_ +
+                    rdm[qq * norb5_ + rr * norb4_ + pp * norb3_ + rr * norb2_ + qq * norb_ +
                           pp] -= cI_sq;
-                    tpdm3[qq * norb5_ + rr * norb4_ + pp * norb3_ + qq * norb2_ + rr * norb_ +
+                    rdm[qq * norb5_ + rr * norb4_ + pp * norb3_ + qq * norb2_ + rr * norb_ +
                           pp] += cI_sq;
-                    tpdm3[qq * norb5_ + rr * norb4_ + pp * norb3_ + qq * norb2_ + pp * norb_ +
+                    rdm[qq * norb5_ + rr * norb4_ + pp * norb3_ + qq * norb2_ + pp * norb_ +
                           rr] -= cI_sq;
 
-                    tpdm3[qq * norb5_ + pp * norb4_ + rr * norb3_ + pp * norb2_ + qq * norb_ +
+                    rdm[qq * norb5_ + pp * norb4_ + rr * norb3_ + pp * norb2_ + qq * norb_ +
                           rr] -= cI_sq;
-                    tpdm3[qq * norb5_ + pp * norb4_ + rr * norb3_ + pp * norb2_ + rr * norb_ +
+                    rdm[qq * norb5_ + pp * norb4_ + rr * norb3_ + pp * norb2_ + rr * norb_ +
                           qq] += cI_sq;
-                    tpdm3[qq * norb5_ + pp * norb4_ + rr * norb3_ + rr * norb2_ + pp * norb_ +
+                    rdm[qq * norb5_ + pp * norb4_ + rr * norb3_ + rr * norb2_ + pp * norb_ +
                           qq] -= cI_sq;
-                    tpdm3[qq * norb5_ + pp * norb4_ + rr * norb3_ + rr * norb2_ + qq * norb_ +
+                    rdm[qq * norb5_ + pp * norb4_ + rr * norb3_ + rr * norb2_ + qq * norb_ +
                           pp] += cI_sq;
-                    tpdm3[qq * norb5_ + pp * norb4_ + rr * norb3_ + qq * norb2_ + rr * norb_ +
+                    rdm[qq * norb5_ + pp * norb4_ + rr * norb3_ + qq * norb2_ + rr * norb_ +
                           pp] -= cI_sq;
-                    tpdm3[qq * norb5_ + pp * norb4_ + rr * norb3_ + qq * norb2_ + pp * norb_ +
+                    rdm[qq * norb5_ + pp * norb4_ + rr * norb3_ + qq * norb2_ + pp * norb_ +
                           rr] += cI_sq;
                 }
             }
@@ -679,31 +691,31 @@ void CI_RDMS::compute_3rdm_sf_op(std::vector<double>& tpdm3) {
                 for (size_t r = 0; r < nb; ++r) {
                     auto rr = bocc[r];
 
-                    tpdm3[pp * norb5_ + qq * norb4_ + rr * norb3_ + pp * norb2_ + qq * norb_ +
+                    rdm[pp * norb5_ + qq * norb4_ + rr * norb3_ + pp * norb2_ + qq * norb_ +
                           rr] += cI_sq;
-                    tpdm3[pp * norb5_ + qq * norb4_ + rr * norb3_ + qq * norb2_ + pp * norb_ +
+                    rdm[pp * norb5_ + qq * norb4_ + rr * norb3_ + qq * norb2_ + pp * norb_ +
                           rr] -= cI_sq;
-                    tpdm3[qq * norb5_ + pp * norb4_ + rr * norb3_ + pp * norb2_ + qq * norb_ +
+                    rdm[qq * norb5_ + pp * norb4_ + rr * norb3_ + pp * norb2_ + qq * norb_ +
                           rr] -= cI_sq;
-                    tpdm3[qq * norb5_ + pp * norb4_ + rr * norb3_ + qq * norb2_ + pp * norb_ +
+                    rdm[qq * norb5_ + pp * norb4_ + rr * norb3_ + qq * norb2_ + pp * norb_ +
                           rr] += cI_sq;
 
-                    tpdm3[rr * norb5_ + qq * norb4_ + pp * norb3_ + rr * norb2_ + qq * norb_ +
+                    rdm[rr * norb5_ + qq * norb4_ + pp * norb3_ + rr * norb2_ + qq * norb_ +
                           pp] += cI_sq;
-                    tpdm3[rr * norb5_ + qq * norb4_ + pp * norb3_ + rr * norb2_ + pp * norb_ +
+                    rdm[rr * norb5_ + qq * norb4_ + pp * norb3_ + rr * norb2_ + pp * norb_ +
                           qq] -= cI_sq;
-                    tpdm3[rr * norb5_ + pp * norb4_ + qq * norb3_ + rr * norb2_ + qq * norb_ +
+                    rdm[rr * norb5_ + pp * norb4_ + qq * norb3_ + rr * norb2_ + qq * norb_ +
                           pp] -= cI_sq;
-                    tpdm3[rr * norb5_ + pp * norb4_ + qq * norb3_ + rr * norb2_ + pp * norb_ +
+                    rdm[rr * norb5_ + pp * norb4_ + qq * norb3_ + rr * norb2_ + pp * norb_ +
                           qq] += cI_sq;
 
-                    tpdm3[pp * norb5_ + rr * norb4_ + qq * norb3_ + pp * norb2_ + rr * norb_ +
+                    rdm[pp * norb5_ + rr * norb4_ + qq * norb3_ + pp * norb2_ + rr * norb_ +
                           qq] += cI_sq;
-                    tpdm3[pp * norb5_ + rr * norb4_ + qq * norb3_ + qq * norb2_ + rr * norb_ +
+                    rdm[pp * norb5_ + rr * norb4_ + qq * norb3_ + qq * norb2_ + rr * norb_ +
                           pp] -= cI_sq;
-                    tpdm3[qq * norb5_ + rr * norb4_ + pp * norb3_ + pp * norb2_ + rr * norb_ +
+                    rdm[qq * norb5_ + rr * norb4_ + pp * norb3_ + pp * norb2_ + rr * norb_ +
                           qq] -= cI_sq;
-                    tpdm3[qq * norb5_ + rr * norb4_ + pp * norb3_ + qq * norb2_ + rr * norb_ +
+                    rdm[qq * norb5_ + rr * norb4_ + pp * norb3_ + qq * norb2_ + rr * norb_ +
                           pp] += cI_sq;
                 }
             }
@@ -716,31 +728,31 @@ void CI_RDMS::compute_3rdm_sf_op(std::vector<double>& tpdm3) {
                 for (size_t r = q + 1; r < nb; ++r) {
                     auto rr = bocc[r];
 
-                    tpdm3[pp * norb5_ + qq * norb4_ + rr * norb3_ + pp * norb2_ + qq * norb_ +
+                    rdm[pp * norb5_ + qq * norb4_ + rr * norb3_ + pp * norb2_ + qq * norb_ +
                           rr] += cI_sq;
-                    tpdm3[pp * norb5_ + qq * norb4_ + rr * norb3_ + pp * norb2_ + rr * norb_ +
+                    rdm[pp * norb5_ + qq * norb4_ + rr * norb3_ + pp * norb2_ + rr * norb_ +
                           qq] -= cI_sq;
-                    tpdm3[pp * norb5_ + rr * norb4_ + qq * norb3_ + pp * norb2_ + qq * norb_ +
+                    rdm[pp * norb5_ + rr * norb4_ + qq * norb3_ + pp * norb2_ + qq * norb_ +
                           rr] -= cI_sq;
-                    tpdm3[pp * norb5_ + rr * norb4_ + qq * norb3_ + pp * norb2_ + rr * norb_ +
+                    rdm[pp * norb5_ + rr * norb4_ + qq * norb3_ + pp * norb2_ + rr * norb_ +
                           qq] += cI_sq;
 
-                    tpdm3[qq * norb5_ + pp * norb4_ + rr * norb3_ + qq * norb2_ + pp * norb_ +
+                    rdm[qq * norb5_ + pp * norb4_ + rr * norb3_ + qq * norb2_ + pp * norb_ +
                           rr] += cI_sq;
-                    tpdm3[qq * norb5_ + pp * norb4_ + rr * norb3_ + rr * norb2_ + pp * norb_ +
+                    rdm[qq * norb5_ + pp * norb4_ + rr * norb3_ + rr * norb2_ + pp * norb_ +
                           qq] -= cI_sq;
-                    tpdm3[rr * norb5_ + pp * norb4_ + qq * norb3_ + qq * norb2_ + pp * norb_ +
+                    rdm[rr * norb5_ + pp * norb4_ + qq * norb3_ + qq * norb2_ + pp * norb_ +
                           rr] -= cI_sq;
-                    tpdm3[rr * norb5_ + pp * norb4_ + qq * norb3_ + rr * norb2_ + pp * norb_ +
+                    rdm[rr * norb5_ + pp * norb4_ + qq * norb3_ + rr * norb2_ + pp * norb_ +
                           qq] += cI_sq;
 
-                    tpdm3[rr * norb5_ + qq * norb4_ + pp * norb3_ + rr * norb2_ + qq * norb_ +
+                    rdm[rr * norb5_ + qq * norb4_ + pp * norb3_ + rr * norb2_ + qq * norb_ +
                           pp] += cI_sq;
-                    tpdm3[rr * norb5_ + qq * norb4_ + pp * norb3_ + qq * norb2_ + rr * norb_ +
+                    rdm[rr * norb5_ + qq * norb4_ + pp * norb3_ + qq * norb2_ + rr * norb_ +
                           pp] -= cI_sq;
-                    tpdm3[qq * norb5_ + rr * norb4_ + pp * norb3_ + rr * norb2_ + qq * norb_ +
+                    rdm[qq * norb5_ + rr * norb4_ + pp * norb3_ + rr * norb2_ + qq * norb_ +
                           pp] -= cI_sq;
-                    tpdm3[qq * norb5_ + rr * norb4_ + pp * norb3_ + qq * norb2_ + rr * norb_ +
+                    rdm[qq * norb5_ + rr * norb4_ + pp * norb3_ + qq * norb2_ + rr * norb_ +
                           pp] += cI_sq;
                 }
             }
@@ -753,92 +765,93 @@ void CI_RDMS::compute_3rdm_sf_op(std::vector<double>& tpdm3) {
                 for (size_t r = q + 1; r < nb; ++r) {
                     auto rr = bocc[r];
 
-                    tpdm3[pp * norb5_ + qq * norb4_ + rr * norb3_ + pp * norb2_ + qq * norb_ +
+                    rdm[pp * norb5_ + qq * norb4_ + rr * norb3_ + pp * norb2_ + qq * norb_ +
                           rr] += cI_sq;
-                    tpdm3[pp * norb5_ + qq * norb4_ + rr * norb3_ + pp * norb2_ + rr * norb_ +
+                    rdm[pp * norb5_ + qq * norb4_ + rr * norb3_ + pp * norb2_ + rr * norb_ +
                           qq] -= cI_sq;
-                    tpdm3[pp * norb5_ + qq * norb4_ + rr * norb3_ + rr * norb2_ + pp * norb_ +
+                    rdm[pp * norb5_ + qq * norb4_ + rr * norb3_ + rr * norb2_ + pp * norb_ +
                           qq] += cI_sq;
-                    tpdm3[pp * norb5_ + qq * norb4_ + rr * norb3_ + rr * norb2_ + qq * norb_ +
+                    rdm[pp * norb5_ + qq * norb4_ + rr * norb3_ + rr * norb2_ + qq * norb_ +
                           pp] -= cI_sq;
-                    tpdm3[pp * norb5_ + qq * norb4_ + rr * norb3_ + qq * norb2_ + rr * norb_ +
+                    rdm[pp * norb5_ + qq * norb4_ + rr * norb3_ + qq * norb2_ + rr * norb_ +
                           pp] += cI_sq;
-                    tpdm3[pp * norb5_ + qq * norb4_ + rr * norb3_ + qq * norb2_ + pp * norb_ +
+                    rdm[pp * norb5_ + qq * norb4_ + rr * norb3_ + qq * norb2_ + pp * norb_ +
                           rr] -= cI_sq;
 
-                    tpdm3[pp * norb5_ + rr * norb4_ + qq * norb3_ + pp * norb2_ + qq * norb_ +
+                    rdm[pp * norb5_ + rr * norb4_ + qq * norb3_ + pp * norb2_ + qq * norb_ +
                           rr] -= cI_sq;
-                    tpdm3[pp * norb5_ + rr * norb4_ + qq * norb3_ + pp * norb2_ + rr * norb_ +
+                    rdm[pp * norb5_ + rr * norb4_ + qq * norb3_ + pp * norb2_ + rr * norb_ +
                           qq] += cI_sq;
-                    tpdm3[pp * norb5_ + rr * norb4_ + qq * norb3_ + rr * norb2_ + pp * norb_ +
+                    rdm[pp * norb5_ + rr * norb4_ + qq * norb3_ + rr * norb2_ + pp * norb_ +
                           qq] -= cI_sq;
-                    tpdm3[pp * norb5_ + rr * norb4_ + qq * norb3_ + rr * norb2_ + qq * norb_ +
+                    rdm[pp * norb5_ + rr * norb4_ + qq * norb3_ + rr * norb2_ + qq * norb_ +
                           pp] += cI_sq;
-                    tpdm3[pp * norb5_ + rr * norb4_ + qq * norb3_ + qq * norb2_ + rr * norb_ +
+                    rdm[pp * norb5_ + rr * norb4_ + qq * norb3_ + qq * norb2_ + rr * norb_ +
                           pp] -= cI_sq;
-                    tpdm3[pp * norb5_ + rr * norb4_ + qq * norb3_ + qq * norb2_ + pp * norb_ +
+                    rdm[pp * norb5_ + rr * norb4_ + qq * norb3_ + qq * norb2_ + pp * norb_ +
                           rr] += cI_sq;
 
-                    tpdm3[rr * norb5_ + pp * norb4_ + qq * norb3_ + pp * norb2_ + qq * norb_ +
+                    rdm[rr * norb5_ + pp * norb4_ + qq * norb3_ + pp * norb2_ + qq * norb_ +
                           rr] += cI_sq;
-                    tpdm3[rr * norb5_ + pp * norb4_ + qq * norb3_ + pp * norb2_ + rr * norb_ +
+                    rdm[rr * norb5_ + pp * norb4_ + qq * norb3_ + pp * norb2_ + rr * norb_ +
                           qq] -= cI_sq;
-                    tpdm3[rr * norb5_ + pp * norb4_ + qq * norb3_ + rr * norb2_ + pp * norb_ +
+                    rdm[rr * norb5_ + pp * norb4_ + qq * norb3_ + rr * norb2_ + pp * norb_ +
                           qq] += cI_sq;
-                    tpdm3[rr * norb5_ + pp * norb4_ + qq * norb3_ + rr * norb2_ + qq * norb_ +
+                    rdm[rr * norb5_ + pp * norb4_ + qq * norb3_ + rr * norb2_ + qq * norb_ +
                           pp] -= cI_sq;
-                    tpdm3[rr * norb5_ + pp * norb4_ + qq * norb3_ + qq * norb2_ + rr * norb_ +
+                    rdm[rr * norb5_ + pp * norb4_ + qq * norb3_ + qq * norb2_ + rr * norb_ +
                           pp] += cI_sq;
-                    tpdm3[rr * norb5_ + pp * norb4_ + qq * norb3_ + qq * norb2_ + pp * norb_ +
+                    rdm[rr * norb5_ + pp * norb4_ + qq * norb3_ + qq * norb2_ + pp * norb_ +
                           rr] -= cI_sq;
 
-                    tpdm3[rr * norb5_ + qq * norb4_ + pp * norb3_ + pp * norb2_ + qq * norb_ +
+                    rdm[rr * norb5_ + qq * norb4_ + pp * norb3_ + pp * norb2_ + qq * norb_ +
                           rr] -= cI_sq;
-                    tpdm3[rr * norb5_ + qq * norb4_ + pp * norb3_ + pp * norb2_ + rr * norb_ +
+                    rdm[rr * norb5_ + qq * norb4_ + pp * norb3_ + pp * norb2_ + rr * norb_ +
                           qq] += cI_sq;
-                    tpdm3[rr * norb5_ + qq * norb4_ + pp * norb3_ + rr * norb2_ + pp * norb_ +
+                    rdm[rr * norb5_ + qq * norb4_ + pp * norb3_ + rr * norb2_ + pp * norb_ +
                           qq] -= cI_sq;
-                    tpdm3[rr * norb5_ + qq * norb4_ + pp * norb3_ + rr * norb2_ + qq * norb_ +
+                    rdm[rr * norb5_ + qq * norb4_ + pp * norb3_ + rr * norb2_ + qq * norb_ +
                           pp] += cI_sq;
-                    tpdm3[rr * norb5_ + qq * norb4_ + pp * norb3_ + qq * norb2_ + rr * norb_ +
+                    rdm[rr * norb5_ + qq * norb4_ + pp * norb3_ + qq * norb2_ + rr * norb_ +
                           pp] -= cI_sq;
-                    tpdm3[rr * norb5_ + qq * norb4_ + pp * norb3_ + qq * norb2_ + pp * norb_ +
+                    rdm[rr * norb5_ + qq * norb4_ + pp * norb3_ + qq * norb2_ + pp * norb_ +
                           rr] += cI_sq;
 
-                    tpdm3[qq * norb5_ + rr * norb4_ + pp * norb3_ + pp * norb2_ + qq * norb_ +
+                    rdm[qq * norb5_ + rr * norb4_ + pp * norb3_ + pp * norb2_ + qq * norb_ +
                           rr] += cI_sq;
-                    tpdm3[qq * norb5_ + rr * norb4_ + pp * norb3_ + pp * norb2_ + rr * norb_ +
+                    rdm[qq * norb5_ + rr * norb4_ + pp * norb3_ + pp * norb2_ + rr * norb_ +
                           qq] -= cI_sq;
-                    tpdm3[qq * norb5_ + rr * norb4_ + pp * norb3_ + rr * norb2_ + pp * norb_ +
+                    rdm[qq * norb5_ + rr * norb4_ + pp * norb3_ + rr * norb2_ + pp * norb_ +
                           qq] += cI_sq;
-                    tpdm3[qq * norb5_ + rr * norb4_ + pp * norb3_ + rr * norb2_ + qq * norb_ +
+                    rdm[qq * norb5_ + rr * norb4_ + pp * norb3_ + rr * norb2_ + qq * norb_ +
                           pp] -= cI_sq;
-                    tpdm3[qq * norb5_ + rr * norb4_ + pp * norb3_ + qq * norb2_ + rr * norb_ +
+                    rdm[qq * norb5_ + rr * norb4_ + pp * norb3_ + qq * norb2_ + rr * norb_ +
                           pp] += cI_sq;
-                    tpdm3[qq * norb5_ + rr * norb4_ + pp * norb3_ + qq * norb2_ + pp * norb_ +
+                    rdm[qq * norb5_ + rr * norb4_ + pp * norb3_ + qq * norb2_ + pp * norb_ +
                           rr] -= cI_sq;
 
-                    tpdm3[qq * norb5_ + pp * norb4_ + rr * norb3_ + pp * norb2_ + qq * norb_ +
+                    rdm[qq * norb5_ + pp * norb4_ + rr * norb3_ + pp * norb2_ + qq * norb_ +
                           rr] -= cI_sq;
-                    tpdm3[qq * norb5_ + pp * norb4_ + rr * norb3_ + pp * norb2_ + rr * norb_ +
+                    rdm[qq * norb5_ + pp * norb4_ + rr * norb3_ + pp * norb2_ + rr * norb_ +
                           qq] += cI_sq;
-                    tpdm3[qq * norb5_ + pp * norb4_ + rr * norb3_ + rr * norb2_ + pp * norb_ +
+                    rdm[qq * norb5_ + pp * norb4_ + rr * norb3_ + rr * norb2_ + pp * norb_ +
                           qq] -= cI_sq;
-                    tpdm3[qq * norb5_ + pp * norb4_ + rr * norb3_ + rr * norb2_ + qq * norb_ +
+                    rdm[qq * norb5_ + pp * norb4_ + rr * norb3_ + rr * norb2_ + qq * norb_ +
                           pp] += cI_sq;
-                    tpdm3[qq * norb5_ + pp * norb4_ + rr * norb3_ + qq * norb2_ + rr * norb_ +
+                    rdm[qq * norb5_ + pp * norb4_ + rr * norb3_ + qq * norb2_ + rr * norb_ +
                           pp] -= cI_sq;
-                    tpdm3[qq * norb5_ + pp * norb4_ + rr * norb3_ + qq * norb2_ + pp * norb_ +
+                    rdm[qq * norb5_ + pp * norb4_ + rr * norb3_ + qq * norb2_ + pp * norb_ +
                           rr] += cI_sq;
                 }
             }
         }
-    }
+    });
 
     // Build the off-diagonal part
 
     // aaa aaa
-    for (const auto& coupled_dets : op->aaa_list_) {
+    tasks.emplace_back(op->aaa_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->aaa_list_[n];
         auto coupled_dets_size = coupled_dets.size();
 
         for (size_t a = 0; a < coupled_dets_size; ++a) {
@@ -856,97 +869,98 @@ void CI_RDMS::compute_3rdm_sf_op(std::vector<double>& tpdm3) {
 
                 auto value = vJ1 * evecs_->get(I, root2_) * sign;
 
-                tpdm3[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] += value;
-                tpdm3[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] -= value;
-                tpdm3[p * norb5_ + q * norb4_ + r * norb3_ + u * norb2_ + t * norb_ + s] -= value;
-                tpdm3[p * norb5_ + q * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] += value;
-                tpdm3[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] -= value;
-                tpdm3[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + u * norb_ + s] += value;
-
-                tpdm3[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] -= value;
-                tpdm3[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] += value;
-                tpdm3[p * norb5_ + r * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] += value;
-                tpdm3[p * norb5_ + r * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] -= value;
-                tpdm3[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] += value;
-                tpdm3[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] -= value;
-
-                tpdm3[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] -= value;
-                tpdm3[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] += value;
-                tpdm3[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + t * norb_ + s] += value;
-                tpdm3[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] -= value;
-                tpdm3[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] += value;
-                tpdm3[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + u * norb_ + s] -= value;
-
-                tpdm3[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + t * norb_ + u] += value;
-                tpdm3[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] -= value;
-                tpdm3[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] -= value;
-                tpdm3[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] += value;
-                tpdm3[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + s * norb_ + u] -= value;
-                tpdm3[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] += value;
-
-                tpdm3[r * norb5_ + p * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] += value;
-                tpdm3[r * norb5_ + p * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] -= value;
-                tpdm3[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] -= value;
-                tpdm3[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] += value;
-                tpdm3[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] -= value;
-                tpdm3[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] += value;
-
-                tpdm3[r * norb5_ + q * norb4_ + p * norb3_ + s * norb2_ + t * norb_ + u] -= value;
-                tpdm3[r * norb5_ + q * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] += value;
-                tpdm3[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] += value;
-                tpdm3[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] -= value;
-                tpdm3[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + s * norb_ + u] += value;
-                tpdm3[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] -= value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] += value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] -= value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + u * norb2_ + t * norb_ + s] -= value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] += value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] -= value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + u * norb_ + s] += value;
+
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] -= value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] += value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] += value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] -= value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] += value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] -= value;
+
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] -= value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] += value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + t * norb_ + s] += value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] -= value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] += value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + u * norb_ + s] -= value;
+
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + t * norb_ + u] += value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] -= value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] -= value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] += value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + s * norb_ + u] -= value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] += value;
+
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] += value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] -= value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] -= value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] += value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] -= value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] += value;
+
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + s * norb2_ + t * norb_ + u] -= value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] += value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] += value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] -= value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + s * norb_ + u] += value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] -= value;
 
                 value = evecs_->get(I, root1_) * vJ2 * sign;
 
-                tpdm3[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] += value;
-                tpdm3[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] -= value;
-                tpdm3[u * norb5_ + t * norb4_ + s * norb3_ + p * norb2_ + q * norb_ + r] -= value;
-                tpdm3[u * norb5_ + s * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] += value;
-                tpdm3[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] -= value;
-                tpdm3[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + q * norb_ + r] += value;
-
-                tpdm3[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] -= value;
-                tpdm3[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] += value;
-                tpdm3[u * norb5_ + t * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] += value;
-                tpdm3[u * norb5_ + s * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] -= value;
-                tpdm3[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] += value;
-                tpdm3[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] -= value;
-
-                tpdm3[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] -= value;
-                tpdm3[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] += value;
-                tpdm3[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + p * norb_ + r] += value;
-                tpdm3[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] -= value;
-                tpdm3[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] += value;
-                tpdm3[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + p * norb_ + r] -= value;
-
-                tpdm3[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + r * norb_ + p] += value;
-                tpdm3[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] -= value;
-                tpdm3[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] -= value;
-                tpdm3[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] += value;
-                tpdm3[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + r * norb_ + p] -= value;
-                tpdm3[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] += value;
-
-                tpdm3[s * norb5_ + t * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] += value;
-                tpdm3[s * norb5_ + u * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] -= value;
-                tpdm3[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] -= value;
-                tpdm3[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] += value;
-                tpdm3[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] -= value;
-                tpdm3[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] += value;
-
-                tpdm3[s * norb5_ + t * norb4_ + u * norb3_ + r * norb2_ + q * norb_ + p] -= value;
-                tpdm3[s * norb5_ + u * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] += value;
-                tpdm3[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] += value;
-                tpdm3[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] -= value;
-                tpdm3[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + q * norb_ + p] += value;
-                tpdm3[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] -= value;
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] += value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] -= value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + p * norb2_ + q * norb_ + r] -= value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] += value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] -= value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + q * norb_ + r] += value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] -= value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] += value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] += value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] -= value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] += value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] -= value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] -= value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] += value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + p * norb_ + r] += value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] -= value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] += value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + p * norb_ + r] -= value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + r * norb_ + p] += value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] -= value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] -= value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] += value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + r * norb_ + p] -= value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] += value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] += value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] += value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] += value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + r * norb2_ + q * norb_ + p] -= value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] -= value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] -= value;
             }
         }
-    }
+    });
 
     // aab aab
-    for (const auto& coupled_dets : op->aab_list_) {
+    tasks.emplace_back(op->aab_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->aab_list_[n];
         auto coupled_dets_size = coupled_dets.size();
 
         for (size_t a = 0; a < coupled_dets_size; ++a) {
@@ -963,42 +977,43 @@ void CI_RDMS::compute_3rdm_sf_op(std::vector<double>& tpdm3) {
                 auto sign = ((_s < 0) == sign_pqr) ? 1 : -1;
 
                 auto value = vJ1 * evecs_->get(I, root2_) * sign;
-                tpdm3[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] += value;
-                tpdm3[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] -= value;
-                tpdm3[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] -= value;
-                tpdm3[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] += value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] += value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] -= value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] -= value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] += value;
 
-                tpdm3[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] += value;
-                tpdm3[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] -= value;
-                tpdm3[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] -= value;
-                tpdm3[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] += value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] += value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] -= value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] -= value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] += value;
 
-                tpdm3[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] += value;
-                tpdm3[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] -= value;
-                tpdm3[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] -= value;
-                tpdm3[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] += value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] += value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] -= value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] -= value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] += value;
 
                 value = evecs_->get(I, root1_) * vJ2 * sign;
-                tpdm3[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] += value;
-                tpdm3[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] -= value;
-                tpdm3[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] -= value;
-                tpdm3[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] += value;
-
-                tpdm3[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] += value;
-                tpdm3[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] -= value;
-                tpdm3[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] -= value;
-                tpdm3[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] += value;
-
-                tpdm3[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] += value;
-                tpdm3[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] -= value;
-                tpdm3[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] -= value;
-                tpdm3[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] += value;
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] += value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] -= value;
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] -= value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] += value;
+
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] -= value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] += value;
+
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] += value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] -= value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] -= value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] += value;
             }
         }
-    }
+    });
 
     // abb abb
-    for (const auto& coupled_dets : op->abb_list_) {
+    tasks.emplace_back(op->abb_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->abb_list_[n];
         auto coupled_dets_size = coupled_dets.size();
 
         for (size_t a = 0; a < coupled_dets_size; ++a) {
@@ -1015,42 +1030,43 @@ void CI_RDMS::compute_3rdm_sf_op(std::vector<double>& tpdm3) {
                 auto sign = ((_s < 0) == sign_pqr) ? 1 : -1;
 
                 auto value = vJ1 * evecs_->get(I, root2_) * sign;
-                tpdm3[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] += value;
-                tpdm3[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] -= value;
-                tpdm3[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] -= value;
-                tpdm3[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] += value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] += value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] -= value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] -= value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] += value;
 
-                tpdm3[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] += value;
-                tpdm3[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] -= value;
-                tpdm3[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] -= value;
-                tpdm3[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] += value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] += value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] -= value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] -= value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] += value;
 
-                tpdm3[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] += value;
-                tpdm3[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] -= value;
-                tpdm3[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] -= value;
-                tpdm3[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] += value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] += value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] -= value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] -= value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] += value;
 
                 value = evecs_->get(I, root1_) * vJ2 * sign;
-                tpdm3[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] += value;
-                tpdm3[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] -= value;
-                tpdm3[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] -= value;
-                tpdm3[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] += value;
-
-                tpdm3[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] += value;
-                tpdm3[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] -= value;
-                tpdm3[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] -= value;
-                tpdm3[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] += value;
-
-                tpdm3[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] += value;
-                tpdm3[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] -= value;
-                tpdm3[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] -= value;
-                tpdm3[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] += value;
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] += value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] -= value;
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] -= value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] += value;
+
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] += value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] -= value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] += value;
+
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] -= value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] -= value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] += value;
             }
         }
-    }
+    });
 
     // bbb bbb
-    for (const auto& coupled_dets : op->bbb_list_) {
+    tasks.emplace_back(op->bbb_list_.size(), [&](size_t n, double* rdm) {
+        const auto& coupled_dets = op->bbb_list_[n];
         auto coupled_dets_size = coupled_dets.size();
 
         for (size_t a = 0; a < coupled_dets_size; ++a) {
@@ -1068,94 +1084,96 @@ void CI_RDMS::compute_3rdm_sf_op(std::vector<double>& tpdm3) {
 
                 auto value = vJ1 * evecs_->get(I, root2_) * sign;
 
-                tpdm3[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] += value;
-                tpdm3[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] -= value;
-                tpdm3[p * norb5_ + q * norb4_ + r * norb3_ + u * norb2_ + t * norb_ + s] -= value;
-                tpdm3[p * norb5_ + q * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] += value;
-                tpdm3[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] -= value;
-                tpdm3[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + u * norb_ + s] += value;
-
-                tpdm3[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] -= value;
-                tpdm3[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] += value;
-                tpdm3[p * norb5_ + r * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] += value;
-                tpdm3[p * norb5_ + r * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] -= value;
-                tpdm3[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] += value;
-                tpdm3[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] -= value;
-
-                tpdm3[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] -= value;
-                tpdm3[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] += value;
-                tpdm3[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + t * norb_ + s] += value;
-                tpdm3[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] -= value;
-                tpdm3[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] += value;
-                tpdm3[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + u * norb_ + s] -= value;
-
-                tpdm3[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + t * norb_ + u] += value;
-                tpdm3[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] -= value;
-                tpdm3[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] -= value;
-                tpdm3[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] += value;
-                tpdm3[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + s * norb_ + u] -= value;
-                tpdm3[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] += value;
-
-                tpdm3[r * norb5_ + p * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] += value;
-                tpdm3[r * norb5_ + p * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] -= value;
-                tpdm3[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] -= value;
-                tpdm3[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] += value;
-                tpdm3[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] -= value;
-                tpdm3[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] += value;
-
-                tpdm3[r * norb5_ + q * norb4_ + p * norb3_ + s * norb2_ + t * norb_ + u] -= value;
-                tpdm3[r * norb5_ + q * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] += value;
-                tpdm3[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] += value;
-                tpdm3[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] -= value;
-                tpdm3[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + s * norb_ + u] += value;
-                tpdm3[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] -= value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] += value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] -= value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + u * norb2_ + t * norb_ + s] -= value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] += value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] -= value;
+                rdm[p * norb5_ + q * norb4_ + r * norb3_ + t * norb2_ + u * norb_ + s] += value;
+
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] -= value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] += value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] += value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] -= value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] += value;
+                rdm[p * norb5_ + r * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] -= value;
+
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + t * norb_ + u] -= value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + s * norb2_ + u * norb_ + t] += value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + t * norb_ + s] += value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + u * norb2_ + s * norb_ + t] -= value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + s * norb_ + u] += value;
+                rdm[q * norb5_ + p * norb4_ + r * norb3_ + t * norb2_ + u * norb_ + s] -= value;
+
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + t * norb_ + u] += value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] -= value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] -= value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] += value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + s * norb_ + u] -= value;
+                rdm[q * norb5_ + r * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] += value;
+
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + s * norb2_ + t * norb_ + u] += value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + s * norb2_ + u * norb_ + t] -= value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + t * norb_ + s] -= value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + u * norb2_ + s * norb_ + t] += value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + s * norb_ + u] -= value;
+                rdm[r * norb5_ + p * norb4_ + q * norb3_ + t * norb2_ + u * norb_ + s] += value;
+
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + s * norb2_ + t * norb_ + u] -= value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + s * norb2_ + u * norb_ + t] += value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + t * norb_ + s] += value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + u * norb2_ + s * norb_ + t] -= value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + s * norb_ + u] += value;
+                rdm[r * norb5_ + q * norb4_ + p * norb3_ + t * norb2_ + u * norb_ + s] -= value;
 
                 value = evecs_->get(I, root1_) * vJ2 * sign;
 
-                tpdm3[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] += value;
-                tpdm3[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] -= value;
-                tpdm3[u * norb5_ + t * norb4_ + s * norb3_ + p * norb2_ + q * norb_ + r] -= value;
-                tpdm3[u * norb5_ + s * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] += value;
-                tpdm3[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] -= value;
-                tpdm3[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + q * norb_ + r] += value;
-
-                tpdm3[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] -= value;
-                tpdm3[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] += value;
-                tpdm3[u * norb5_ + t * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] += value;
-                tpdm3[u * norb5_ + s * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] -= value;
-                tpdm3[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] += value;
-                tpdm3[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] -= value;
-
-                tpdm3[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] -= value;
-                tpdm3[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] += value;
-                tpdm3[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + p * norb_ + r] += value;
-                tpdm3[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] -= value;
-                tpdm3[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] += value;
-                tpdm3[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + p * norb_ + r] -= value;
-
-                tpdm3[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + r * norb_ + p] += value;
-                tpdm3[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] -= value;
-                tpdm3[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] -= value;
-                tpdm3[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] += value;
-                tpdm3[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + r * norb_ + p] -= value;
-                tpdm3[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] += value;
-
-                tpdm3[s * norb5_ + t * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] += value;
-                tpdm3[s * norb5_ + u * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] -= value;
-                tpdm3[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] -= value;
-                tpdm3[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] += value;
-                tpdm3[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] -= value;
-                tpdm3[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] += value;
-
-                tpdm3[s * norb5_ + t * norb4_ + u * norb3_ + r * norb2_ + q * norb_ + p] -= value;
-                tpdm3[s * norb5_ + u * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] += value;
-                tpdm3[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] += value;
-                tpdm3[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] -= value;
-                tpdm3[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + q * norb_ + p] += value;
-                tpdm3[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] -= value;
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] += value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] -= value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + p * norb2_ + q * norb_ + r] -= value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + p * norb2_ + q * norb_ + r] += value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + q * norb_ + r] -= value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + q * norb_ + r] += value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] -= value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] += value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] += value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + p * norb2_ + r * norb_ + q] -= value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + p * norb2_ + r * norb_ + q] += value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + p * norb2_ + r * norb_ + q] -= value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] -= value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] += value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + p * norb_ + r] += value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + p * norb_ + r] -= value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + p * norb_ + r] += value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + p * norb_ + r] -= value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + q * norb2_ + r * norb_ + p] += value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] -= value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] -= value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + q * norb2_ + r * norb_ + p] += value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + q * norb2_ + r * norb_ + p] -= value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + q * norb2_ + r * norb_ + p] += value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] += value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + p * norb_ + q] += value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + p * norb_ + q] -= value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + p * norb_ + q] += value;
+
+                rdm[s * norb5_ + t * norb4_ + u * norb3_ + r * norb2_ + q * norb_ + p] -= value;
+                rdm[s * norb5_ + u * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[u * norb5_ + t * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[u * norb5_ + s * norb4_ + t * norb3_ + r * norb2_ + q * norb_ + p] -= value;
+                rdm[t * norb5_ + s * norb4_ + u * norb3_ + r * norb2_ + q * norb_ + p] += value;
+                rdm[t * norb5_ + u * norb4_ + s * norb3_ + r * norb2_ + q * norb_ + p] -= value;
             }
         }
-    }
+    });
+
+    parallel_rdm_build(tpdm3, tasks);
 
     auto t_build = build.stop();
     if (print_) {
@@ -34,7 +34,7 @@
 
 #include "integrals/active_space_integrals.h"
 #include "sparse_ci/ci_spin_adaptation.h"
-#include "helpers/davidson_liu_solver.h"
+#include "helpers/eigen_solver.h"
 
 #include "fci_string_lists.h"
 #include "helpers/printing.h"
@@ -72,6 +72,8 @@ void FCISolver::set_collapse_per_root(int value) { collapse_per_root_ = value; }
 
 void FCISolver::set_subspace_per_root(int value) { subspace_per_root_ = value; }
 
+void FCISolver::set_eigen_solver(const std::string& value) { eigen_solver_ = value; }
+
 void FCISolver::set_spin_adapt(bool value) { spin_adapt_ = value; }
 
 void FCISolver::set_spin_adapt_full_preconditioner(bool value) {
@@ -160,6 +162,8 @@ void FCISolver::set_options(std::shared_ptr<ForteOptions> options) {
     set_spin_adapt(options->get_bool("CI_SPIN_ADAPT"));
     set_spin_adapt_full_preconditioner(options->get_bool("CI_SPIN_ADAPT_FULL_PRECONDITIONER"));
     set_test_rdms(options->get_bool("FCI_TEST_RDMS"));
+    FCIVector::set_rdm_algorithm(options->get_str("FCI_RDM_ALGORITHM"));
+    FCIVector::set_rdm_max_memory(options->get_int("FCI_RDM_MAX_MEMORY"));
 
     set_root(options->get_int("ROOT"));
 
@@ -167,6 +171,7 @@ void FCISolver::set_options(std::shared_ptr<ForteOptions> options) {
     set_ndets_per_guess_state(options->get_int("DL_DETS_PER_GUESS"));
     set_collapse_per_root(options->get_int("DL_COLLAPSE_PER_ROOT"));
     set_subspace_per_root(options->get_int("DL_SUBSPACE_PER_ROOT"));
+    set_eigen_solver(options->get_str("CI_EIGENSOLVER"));
 
     set_print(int_to_print_level(options->get_int("PRINT")));
 }
@@ -204,8 +209,8 @@ double FCISolver::compute_energy() {
     // if not allocate, create the DL solver
     bool first_run = false;
     if (dl_solver_ == nullptr) {
-        dl_solver_ = std::make_shared<DavidsonLiuSolver>(basis_size, nroot_, collapse_per_root_,
-                                                         subspace_per_root_);
+        dl_solver_ = make_eigen_solver(string_to_eigen_solver_type(eigen_solver_), basis_size,
+                                       nroot_, collapse_per_root_, subspace_per_root_);
         first_run = true;
     }
     dl_solver_->set_e_convergence(e_convergence_);
@@ -315,7 +320,7 @@ double FCISolver::compute_energy() {
 
 void FCISolver::print_solutions(size_t sample_size, std::shared_ptr<psi::Vector> b,
                                 std::shared_ptr<psi::Vector> b_basis,
-                                std::shared_ptr<DavidsonLiuSolver> dls) {
+                                std::shared_ptr<EigenSolver> dls) {
     for (size_t r = 0; r < nroot_; ++r) {
         psi::outfile->Printf("\n\n  ==> Root No. %d <==\n", r);
 
@@ -367,7 +372,7 @@ void FCISolver::print_solutions(size_t sample_size, std::shared_ptr<psi::Vector>
 }
 
 void FCISolver::test_rdms(std::shared_ptr<psi::Vector> b, std::shared_ptr<psi::Vector> b_basis,
-                          std::shared_ptr<DavidsonLiuSolver> dls) {
+                          std::shared_ptr<EigenSolver> dls) {
     b_basis = dls->eigenvector(root_);
     if (spin_adapt_) {
         spin_adapter_->csf_C_to_det_C(b_basis, b);
@@ -36,7 +36,7 @@
 namespace forte {
 class FCIVector;
 class SpinAdapter;
-class DavidsonLiuSolver;
+class EigenSolver;
 
 /// @brief The FCISolver class
 /// This class performs Full CI calculations in the active space.
@@ -96,6 +96,9 @@ class FCISolver : public ActiveSpaceMethod {
     /// Set the maximum subspace size for each root
     void set_subspace_per_root(int value);
 
+    /// Set the eigensolver used to diagonalize the Hamiltonian ("DL", "LOBPCG", or "LANCZOS")
+    void set_eigen_solver(const std::string& value);
+
     /// Spin adapt the FCI wave function
     void set_spin_adapt(bool value);
 
@@ -148,8 +151,8 @@ class FCISolver : public ActiveSpaceMethod {
     /// The number of FCI determinants
     size_t nfci_dets_;
 
-    /// The Davidson-Liu-Solver object
-    std::shared_ptr<DavidsonLiuSolver> dl_solver_;
+    /// The eigensolver object (Davidson-Liu, LOBPCG, or Lanczos)
+    std::shared_ptr<EigenSolver> dl_solver_;
 
     /// Eigenvectors
     std::shared_ptr<psi::Matrix> eigen_vecs_;
@@ -168,6 +171,8 @@ class FCISolver : public ActiveSpaceMethod {
     size_t collapse_per_root_ = 2;
     /// The maximum subspace size for each root
     size_t subspace_per_root_ = 4;
+    /// The eigensolver used to diagonalize the Hamiltonian
+    std::string eigen_solver_ = "DL";
     /// The number of determinants selected for each guess vector
     size_t ndets_per_guess_ = 10;
     /// Test the RDMs?
@@ -225,7 +230,7 @@ class FCISolver : public ActiveSpaceMethod {
     /// @brief Print a summary of the FCI calculation
     void print_solutions(size_t sample_size, std::shared_ptr<psi::Vector> b,
                          std::shared_ptr<psi::Vector> b_basis,
-                         std::shared_ptr<DavidsonLiuSolver> dls);
+                         std::shared_ptr<EigenSolver> dls);
 
     /// @brief Compute the RDMs for a given root
     /// @param root_left the left root
@@ -240,7 +245,7 @@ class FCISolver : public ActiveSpaceMethod {
 
     /// @brief Test the RDMs
     void test_rdms(std::shared_ptr<psi::Vector> b, std::shared_ptr<psi::Vector> b_basis,
-                   std::shared_ptr<DavidsonLiuSolver> dls);
+                   std::shared_ptr<EigenSolver> dls);
 
     void copy_state_into_fci_vector(int root, std::shared_ptr<FCIVector> C);
 };
@@ -30,6 +30,7 @@
 
 #include <memory>
 #include <vector>
+#include <string>
 #include <cmath>
 
 #include "psi4/libmints/dimension.h"
@@ -149,6 +150,13 @@ class FCIVector {
     /// Return the temporary matrix CL
     static std::shared_ptr<psi::Matrix> get_CL();
 
+    /// @brief Select the algorithm used to compute the RDMs
+    /// @param algorithm "DGEMM" (batched excitation intermediates) or "LISTS" (string lists)
+    static void set_rdm_algorithm(const std::string& algorithm);
+    /// @brief Set the maximum number of doubles used to store intermediates in the DGEMM RDM
+    /// algorithm
+    static void set_rdm_max_memory(size_t value);
+
   private:
     // ==> Class Data <==
 
@@ -187,6 +195,11 @@ class FCIVector {
     // coefficient vector
     static std::shared_ptr<psi::Matrix> CL;
 
+    /// Use the DGEMM algorithm to compute the RDMs?
+    static bool rdm_dgemm_;
+    /// The maximum number of doubles used to store intermediates in the DGEMM RDM algorithm
+    static size_t rdm_max_memory_;
+
     // Timers
     static double hdiag_timer;
     static double h1_aa_timer;
@@ -264,6 +277,25 @@ class FCIVector {
     /// Compute the matrix elements of the alpha-beta-beta 3-RDM <a^+_{pa} a^+_{qb} a^+_{rb} a_{ub}
     /// a_{tb} a_{sa}>
     static ambit::Tensor compute_3rdm_abb_same_irrep(FCIVector& C_left, FCIVector& C_right);
+
+    // The DGEMM algorithm forms the intermediates D^{pq}_I = <I|E_pq|Psi> and contracts them with
+    // DGEMM. Same- and mixed-spin blocks are selected with the alfa flags of each excitation.
+
+    /// The smallest number of doubles needed by the DGEMM algorithm to compute the RDMs up to a
+    /// given level. The left intermediates D^{pq}_I are stored in full, only the right ones are
+    /// batched to fit in rdm_max_memory_
+    static size_t rdm_dgemm_min_memory(FCIVector& C, int max_rdm_level);
+    /// Compute the 1-RDM <a^+_{p} a_{q}>
+    static ambit::Tensor compute_1rdm_dgemm(FCIVector& C_left, FCIVector& C_right, bool alfa);
+    /// Compute the 2-RDM <a^+_p a^+_r a_s a_q> -> rdm[tei_index(p,r,q,s)] where (p,q) and (r,s)
+    /// have spin alfa1 and alfa2, respectively
+    static ambit::Tensor compute_2rdm_dgemm(FCIVector& C_left, FCIVector& C_right, bool alfa1,
+                                            bool alfa2, ambit::Tensor g1);
+    /// Compute the 3-RDM <a^+_p a^+_r a^+_t a_u a_s a_q> -> rdm[six_index(p,r,t,q,s,u)] where
+    /// (p,q), (r,s), and (t,u) have spin alfa1, alfa2, and alfa3, respectively
+    static ambit::Tensor compute_3rdm_dgemm(FCIVector& C_left, FCIVector& C_right, bool alfa1,
+                                            bool alfa2, bool alfa3, ambit::Tensor g1,
+                                            ambit::Tensor g2_12, ambit::Tensor g2_13);
 };
 
 /// @brief Provide a pointer to the a block of the coefficient matrix in such a way that we can use
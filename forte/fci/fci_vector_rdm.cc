@@ -26,6 +26,7 @@
  * @END LICENSE
  */
 
+#include "psi4/libpsi4util/PsiOutStream.h"
 #include "psi4/libpsi4util/process.h"
 #include "psi4/libmints/matrix.h"
 
@@ -52,52 +53,79 @@ std::shared_ptr<RDMs> FCIVector::compute_rdms(FCIVector& C_left, FCIVector& C_ri
     ambit::Tensor g2aa, g2ab, g2bb;
     ambit::Tensor g3aaa, g3aab, g3abb, g3bbb;
 
+    // fall back to the string lists if the DGEMM intermediates do not fit in memory
+    bool use_dgemm = rdm_dgemm_;
+    if (rdm_dgemm_ and max_rdm_level >= 2) {
+        size_t min_memory = rdm_dgemm_min_memory(C_left, max_rdm_level);
+        if (min_memory > rdm_max_memory_) {
+            psi::outfile->Printf("\n  The DGEMM RDM algorithm needs at least %zu doubles "
+                                 "(FCI_RDM_MAX_MEMORY = %zu). Using the LISTS algorithm.",
+                                 min_memory, rdm_max_memory_);
+            use_dgemm = false;
+        }
+    }
+
     if (max_rdm_level >= 1) {
         local_timer t;
-        g1a = compute_1rdm_same_irrep(C_left, C_right, true);
-        g1b = compute_1rdm_same_irrep(C_left, C_right, false);
+        if (use_dgemm) {
+            g1a = compute_1rdm_dgemm(C_left, C_right, true);
+            g1b = compute_1rdm_dgemm(C_left, C_right, false);
+        } else {
+            g1a = compute_1rdm_same_irrep(C_left, C_right, true);
+            g1b = compute_1rdm_same_irrep(C_left, C_right, false);
+        }
         rdm_timing.push_back(t.get());
     }
 
     if (max_rdm_level >= 2) {
         local_timer t;
-        g2aa = compute_2rdm_aa_same_irrep(C_left, C_right, true);
-        g2bb = compute_2rdm_aa_same_irrep(C_left, C_right, false);
-        g2ab = compute_2rdm_ab_same_irrep(C_left, C_right);
+        if (use_dgemm) {
+            g2aa = compute_2rdm_dgemm(C_left, C_right, true, true, g1a);
+            g2bb = compute_2rdm_dgemm(C_left, C_right, false, false, g1b);
+            g2ab = compute_2rdm_dgemm(C_left, C_right, true, false, g1a);
+        } else {
+            g2aa = compute_2rdm_aa_same_irrep(C_left, C_right, true);
+            g2bb = compute_2rdm_aa_same_irrep(C_left, C_right, false);
+            g2ab = compute_2rdm_ab_same_irrep(C_left, C_right);
+        }
         rdm_timing.push_back(t.get());
     }
 
     if (max_rdm_level >= 3) {
         local_timer t;
-        if (na >= 3) {
-            g3aaa = compute_3rdm_aaa_same_irrep(C_left, C_right, true);
-        } else {
-            g3aaa =
-                ambit::Tensor::build(ambit::CoreTensor, "g3aaa", {nmo, nmo, nmo, nmo, nmo, nmo});
-            g3aaa.zero();
-        }
-        if (nb >= 3) {
-            g3bbb = compute_3rdm_aaa_same_irrep(C_left, C_right, false);
-        } else {
-            g3bbb =
-                ambit::Tensor::build(ambit::CoreTensor, "g3bbb", {nmo, nmo, nmo, nmo, nmo, nmo});
-            g3bbb.zero();
-        }
-
-        if ((na >= 2) and (nb >= 1)) {
-            g3aab = compute_3rdm_aab_same_irrep(C_left, C_right);
-        } else {
-            g3aab =
-                ambit::Tensor::build(ambit::CoreTensor, "g3aab", {nmo, nmo, nmo, nmo, nmo, nmo});
-            g3aab.zero();
-        }
-
-        if ((na >= 1) and (nb >= 2)) {
-            g3abb = compute_3rdm_abb_same_irrep(C_left, C_right);
+        // blocks that require more electrons than available are zero
+        auto build_3rdm = [&](const std::string& label, bool nonzero, auto compute) {
+            if (nonzero)
+                return compute();
+            auto g3 =
+                ambit::Tensor::build(ambit::CoreTensor, label, {nmo, nmo, nmo, nmo, nmo, nmo});
+            g3.zero();
+            return g3;
+        };
+        if (use_dgemm) {
+            g3aaa = build_3rdm("g3aaa", na >= 3, [&]() {
+                return compute_3rdm_dgemm(C_left, C_right, true, true, true, g1a, g2aa, g2aa);
+            });
+            g3bbb = build_3rdm("g3bbb", nb >= 3, [&]() {
+                return compute_3rdm_dgemm(C_left, C_right, false, false, false, g1b, g2bb, g2bb);
+            });
+            g3aab = build_3rdm("g3aab", (na >= 2) and (nb >= 1), [&]() {
+                return compute_3rdm_dgemm(C_left, C_right, true, true, false, g1a, g2aa, g2ab);
+            });
+            g3abb = build_3rdm("g3abb", (na >= 1) and (nb >= 2), [&]() {
+                return compute_3rdm_dgemm(C_left, C_right, true, false, false, g1a, g2ab, g2ab);
+            });
         } else {
-            g3abb =
-                ambit::Tensor::build(ambit::CoreTensor, "g3abb", {nmo, nmo, nmo, nmo, nmo, nmo});
-            g3abb.zero();
+            g3aaa = build_3rdm("g3aaa", na >= 3, [&]() {
+                return compute_3rdm_aaa_same_irrep(C_left, C_right, true);
+            });
+            g3bbb = build_3rdm("g3bbb", nb >= 3, [&]() {
+                return compute_3rdm_aaa_same_irrep(C_left, C_right, false);
+            });
+            g3aab = build_3rdm("g3aab", (na >= 2) and (nb >= 1),
+                               [&]() { return compute_3rdm_aab_same_irrep(C_left, C_right); });
+            g3abb = build_3rdm("g3abb", (na >= 1) and (nb >= 2),
+                               [&]() { return compute_3rdm_abb_same_irrep(C_left, C_right); });
         }
         rdm_timing.push_back(t.get());
     }
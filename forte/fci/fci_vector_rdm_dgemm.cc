@@ -0,0 +1,500 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "psi4/libmints/matrix.h"
+#include "psi4/libqt/qt.h"
+
+#include "fci_string_lists.h"
+#include "fci_string_address.h"
+
+#include "fci_vector.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp_get_max_threads() 1
+#define omp_get_thread_num() 0
+#endif
+
+namespace forte {
+
+bool FCIVector::rdm_dgemm_ = false;
+size_t FCIVector::rdm_max_memory_ = 67108864;
+
+void FCIVector::set_rdm_algorithm(const std::string& algorithm) {
+    if (algorithm == "DGEMM") {
+        rdm_dgemm_ = true;
+    } else if (algorithm == "LISTS") {
+        rdm_dgemm_ = false;
+    } else {
+        throw std::runtime_error("FCIVector: unknown RDM algorithm " + algorithm);
+    }
+}
+
+void FCIVector::set_rdm_max_memory(size_t value) { rdm_max_memory_ = value; }
+
+namespace {
+
+/**
+ * @brief The OneParticleExcitations class
+ *
+ * Applies the spin-orbital excitation operators E_pq = a^+_p a_q to vectors defined in the full
+ * determinant space of a given symmetry. The determinants of symmetry g are stored as the blocks
+ * (ha, hb = ha ^ g) in the same row-major order used by FCIVector.
+ *
+ * This is used to form the intermediates D^{pq}_I = <I|E_pq|Psi> that are contracted with DGEMM
+ * to form the 2- and 3-RDMs.
+ */
+class OneParticleExcitations {
+  public:
+    using Pair = std::pair<size_t, size_t>;
+
+    OneParticleExcitations(FCIVector& C) : nirrep_(C.nirrep()), ncmo_(C.ncmo()) {
+        auto alfa_address = C.alfa_address();
+        auto beta_address = C.beta_address();
+        auto cmopi = C.cmopi();
+        const auto& cmopi_offset = C.cmopi_offset();
+
+        for (int h = 0; h < nirrep_; ++h) {
+            na_.push_back(alfa_address->strpcls(h));
+            nb_.push_back(beta_address->strpcls(h));
+            for (int p = 0; p < cmopi[h]; ++p) {
+                orb_sym_.push_back(h);
+            }
+        }
+
+        // the layout of the determinants of each symmetry
+        offset_.assign(nirrep_, std::vector<size_t>(nirrep_, 0));
+        sector_size_.assign(nirrep_, 0);
+        for (int g = 0; g < nirrep_; ++g) {
+            for (int ha = 0; ha < nirrep_; ++ha) {
+                offset_[g][ha] = sector_size_[g];
+                sector_size_[g] += na_[ha] * nb_[ha ^ g];
+            }
+        }
+
+        // the pairs (p,q) sorted by their symmetry
+        pairs_.resize(nirrep_);
+        for (size_t p = 0; p < ncmo_; ++p) {
+            for (size_t q = 0; q < ncmo_; ++q) {
+                pairs_[orb_sym_[p] ^ orb_sym_[q]].emplace_back(p, q);
+            }
+        }
+
+        // Grab the pointers to the string lists here since the lists are stored in a std::map
+        // that cannot be accessed safely from multiple threads
+        const auto& lists = C.lists();
+        vo_a_.resize(ncmo_ * ncmo_ * nirrep_);
+        vo_b_.resize(ncmo_ * ncmo_ * nirrep_);
+        for (size_t p = 0; p < ncmo_; ++p) {
+            for (size_t q = 0; q < ncmo_; ++q) {
+                for (int h = 0; h < nirrep_; ++h) {
+                    vo_a_[vo_index(p, q, h)] = &lists->get_alfa_vo_list(p, q, h);
+                    vo_b_[vo_index(p, q, h)] = &lists->get_beta_vo_list(p, q, h);
+                }
+            }
+        }
+    }
+
+    /// @return the number of irreps
+    int nirrep() const { return nirrep_; }
+    /// @return the number of determinants of symmetry g
+    size_t sector_size(int g) const { return sector_size_[g]; }
+    /// @return the largest number of determinants of any symmetry
+    size_t max_sector_size() const {
+        return *std::max_element(sector_size_.begin(), sector_size_.end());
+    }
+    /// @return the pairs (p,q) with symmetry h
+    const std::vector<Pair>& pairs(int h) const { return pairs_[h]; }
+    /// @return the largest number of pairs of any symmetry
+    size_t max_pairs() const {
+        size_t n = 0;
+        for (const auto& p : pairs_)
+            n = std::max(n, p.size());
+        return n;
+    }
+
+    /// @brief Copy the coefficients of a FCIVector into a contiguous array
+    std::vector<double> flatten(FCIVector& C) const {
+        int g = C.symmetry();
+        std::vector<double> x(sector_size_[g]);
+        for (int ha = 0; ha < nirrep_; ++ha) {
+            size_t block_size = na_[ha] * nb_[ha ^ g];
+            if (block_size > 0) {
+                double* c = C.C(ha)->pointer()[0];
+                std::copy(c, c + block_size, x.begin() + offset_[g][ha]);
+            }
+        }
+        return x;
+    }
+
+    /// @brief Compute y += E_pq x
+    /// @param alfa the spin of the excitation operator
+    /// @param x a vector of symmetry g
+    /// @param y a vector of symmetry g ^ sym(p) ^ sym(q)
+    void apply(bool alfa, size_t p, size_t q, int g, const double* x, double* y) const {
+        int h_pq = orb_sym_[p] ^ orb_sym_[q];
+        int g_y = g ^ h_pq;
+        for (int ha = 0; ha < nirrep_; ++ha) {
+            int hb = ha ^ g;
+            if (alfa) {
+                // |Ia,Ib> -> |Ja,Ib>
+                size_t ncol = nb_[hb];
+                if (ncol == 0)
+                    continue;
+                const double* x_block = x + offset_[g][ha];
+                double* y_block = y + offset_[g_y][ha ^ h_pq];
+                for (const auto& [sign, I, J] : *vo_a_[vo_index(p, q, ha)]) {
+                    const double* x_I = x_block + I * ncol;
+                    double* y_J = y_block + J * ncol;
+                    for (size_t Ib = 0; Ib < ncol; ++Ib) {
+                        y_J[Ib] += sign * x_I[Ib];
+                    }
+                }
+            } else {
+                // |Ia,Ib> -> |Ia,Jb>
+                const auto& vo = *vo_b_[vo_index(p, q, hb)];
+                if (vo.empty())
+                    continue;
+                size_t ncol_x = nb_[hb];
+                size_t ncol_y = nb_[hb ^ h_pq];
+                const double* x_block = x + offset_[g][ha];
+                double* y_block = y + offset_[g_y][ha];
+                for (size_t Ia = 0; Ia < na_[ha]; ++Ia) {
+                    const double* x_Ia = x_block + Ia * ncol_x;
+                    double* y_Ia = y_block + Ia * ncol_y;
+                    for (const auto& [sign, I, J] : vo) {
+                        y_Ia[J] += sign * x_Ia[I];
+                    }
+                }
+            }
+        }
+    }
+
+    /// @brief Form the intermediates D^{pq}_I = <I|E_pq|x> for the pairs [first, last) of symmetry
+    /// h. Each intermediate is stored as a row of D.
+    /// @param x a vector of symmetry g
+    void build(bool alfa, int h, size_t first, size_t last, int g, const double* x,
+               double* D) const {
+        size_t ncol = sector_size_[g ^ h];
+        std::fill(D, D + (last - first) * ncol, 0.0);
+        for (size_t n = first; n < last; ++n) {
+            const auto& [p, q] = pairs_[h][n];
+            apply(alfa, p, q, g, x, D + (n - first) * ncol);
+        }
+    }
+
+  private:
+    size_t vo_index(size_t p, size_t q, int h) const { return (p * ncmo_ + q) * nirrep_ + h; }
+
+    /// The number of irreps
+    int nirrep_;
+    /// The number of correlated orbitals
+    size_t ncmo_;
+    /// The symmetry of each orbital
+    std::vector<int> orb_sym_;
+    /// The number of alpha strings per irrep
+    std::vector<size_t> na_;
+    /// The number of beta strings per irrep
+    std::vector<size_t> nb_;
+    /// The offset of the block (ha, ha ^ g) in a vector of symmetry g
+    std::vector<std::vector<size_t>> offset_;
+    /// The number of determinants of each symmetry
+    std::vector<size_t> sector_size_;
+    /// The list of pairs (p,q) for each symmetry
+    std::vector<std::vector<Pair>> pairs_;
+    /// Pointers to the alpha/beta string substitution lists
+    std::vector<const std::vector<StringSubstitution>*> vo_a_;
+    std::vector<const std::vector<StringSubstitution>*> vo_b_;
+};
+
+/// @brief Form the left intermediates <I|E_xy|L> for all pairs. They are stored by pair symmetry.
+std::vector<std::vector<double>> build_left_intermediates(const OneParticleExcitations& ex,
+                                                          bool alfa, int symmetry,
+                                                          const std::vector<double>& L) {
+    int nirrep = ex.nirrep();
+    std::vector<std::vector<double>> DL(nirrep);
+    for (int h = 0; h < nirrep; ++h) {
+        size_t npairs = ex.pairs(h).size();
+        size_t ncol = ex.sector_size(symmetry ^ h);
+        DL[h].assign(npairs * ncol, 0.0);
+#pragma omp parallel for schedule(dynamic)
+        for (size_t n = 0; n < npairs; ++n) {
+            ex.build(alfa, h, n, n + 1, symmetry, L.data(), DL[h].data() + n * ncol);
+        }
+    }
+    return DL;
+}
+
+/// @brief Find how many right intermediates can be stored by each thread
+size_t batch_size(const OneParticleExcitations& ex, size_t used_memory, size_t max_memory) {
+    size_t nthreads = omp_get_max_threads();
+    size_t per_intermediate = nthreads * (ex.max_sector_size() + ex.max_pairs());
+    size_t available = max_memory > used_memory ? max_memory - used_memory : 0;
+    return std::clamp(available / std::max(per_intermediate, size_t(1)), size_t(1),
+                      std::max(ex.max_pairs(), size_t(1)));
+}
+
+size_t memory_size(const std::vector<std::vector<double>>& v) {
+    size_t n = 0;
+    for (const auto& x : v)
+        n += x.size();
+    return n;
+}
+} // namespace
+
+size_t FCIVector::rdm_dgemm_min_memory(FCIVector& C, int max_rdm_level) {
+    OneParticleExcitations ex(C);
+    int symmetry = C.symmetry_;
+    size_t nthreads = omp_get_max_threads();
+    // the flattened left and right vectors
+    size_t memory = 2 * ex.sector_size(symmetry);
+    if (max_rdm_level >= 2) {
+        // the left intermediates, stored in full
+        for (int h = 0; h < ex.nirrep(); ++h) {
+            memory += ex.pairs(h).size() * ex.sector_size(symmetry ^ h);
+        }
+        // one right intermediate per thread and the corresponding block of the product
+        memory += nthreads * (ex.max_sector_size() + ex.max_pairs());
+    }
+    if (max_rdm_level >= 3) {
+        // the vector E_tu |R> of each thread
+        memory += nthreads * ex.max_sector_size();
+    }
+    return memory;
+}
+
+/**
+ * Compute the one-particle density matrix <L|a^+_p a_q|R> = sum_I <I|E_qp|L> <I|R>
+ * @param alfa flag for alfa or beta component, true = alfa, false = beta
+ */
+ambit::Tensor FCIVector::compute_1rdm_dgemm(FCIVector& C_left, FCIVector& C_right, bool alfa) {
+    size_t ncmo = C_left.ncmo_;
+    int symmetry = C_left.symmetry_;
+    auto rdm = ambit::Tensor::build(ambit::CoreTensor, alfa ? "1RDM_A" : "1RDM_B", {ncmo, ncmo});
+    rdm.zero();
+
+    OneParticleExcitations ex(C_left);
+    auto L = ex.flatten(C_left);
+    auto R = ex.flatten(C_right);
+
+    auto& rdm_data = rdm.data();
+    const auto& pairs = ex.pairs(0);
+    size_t npairs = pairs.size();
+    size_t ncol = ex.sector_size(symmetry);
+#pragma omp parallel
+    {
+        std::vector<double> D(ncol);
+#pragma omp for schedule(dynamic)
+        for (size_t n = 0; n < npairs; ++n) {
+            ex.build(alfa, 0, n, n + 1, symmetry, L.data(), D.data());
+            const auto& [x, y] = pairs[n];
+            rdm_data[y * ncmo + x] = psi::C_DDOT(ncol, D.data(), 1, R.data(), 1);
+        }
+    }
+    return rdm;
+}
+
+/**
+ * Compute the two-particle density matrix <L|a^+_p a^+_r a_s a_q|R> from the intermediates
+ * D^{pq}_I = <I|E_pq|Psi> via
+ *
+ *   <L|E_pq E_rs|R> = sum_I <I|E_qp|L> <I|E_rs|R> = g2[p,r,q,s] + delta_qr g1[p,s]
+ *
+ * The product is computed with DGEMM in batches of (rs) pairs that fit in memory. Batches are
+ * distributed over threads and each batch writes to a separate set of elements of the RDM.
+ * @param alfa1 the spin of the pq excitation
+ * @param alfa2 the spin of the rs excitation
+ * @param g1 the 1-RDM of the same spin (used only if alfa1 == alfa2)
+ */
+ambit::Tensor FCIVector::compute_2rdm_dgemm(FCIVector& C_left, FCIVector& C_right, bool alfa1,
+                                            bool alfa2, ambit::Tensor g1) {
+    size_t ncmo = C_left.ncmo_;
+    int symmetry = C_left.symmetry_;
+    std::string label = alfa1 ? (alfa2 ? "2RDM_AA" : "2RDM_AB") : "2RDM_BB";
+    auto rdm = ambit::Tensor::build(ambit::CoreTensor, label, {ncmo, ncmo, ncmo, ncmo});
+    rdm.zero();
+
+    OneParticleExcitations ex(C_left);
+    auto L = ex.flatten(C_left);
+    auto R = ex.flatten(C_right);
+    int nirrep = ex.nirrep();
+
+    auto DL = build_left_intermediates(ex, alfa1, symmetry, L);
+    size_t batch = batch_size(ex, memory_size(DL) + L.size() + R.size(), rdm_max_memory_);
+
+    // make a list of batches (h, first, last) of rs pairs
+    std::vector<std::tuple<int, size_t, size_t>> batches;
+    for (int h = 0; h < nirrep; ++h) {
+        size_t npairs = ex.pairs(h).size();
+        for (size_t first = 0; first < npairs; first += batch) {
+            batches.emplace_back(h, first, std::min(first + batch, npairs));
+        }
+    }
+
+    bool same_spin = alfa1 == alfa2;
+    auto& rdm_data = rdm.data();
+    const auto& g1_data = g1.data();
+#pragma omp parallel
+    {
+        std::vector<double> DR(batch * ex.max_sector_size());
+        std::vector<double> G(ex.max_pairs() * batch);
+#pragma omp for schedule(dynamic)
+        for (size_t b = 0; b < batches.size(); ++b) {
+            const auto& [h, first, last] = batches[b];
+            size_t nrs = last - first;
+            size_t nxy = ex.pairs(h).size();
+            size_t ncol = ex.sector_size(symmetry ^ h);
+            if (ncol == 0)
+                continue;
+            ex.build(alfa2, h, first, last, symmetry, R.data(), DR.data());
+            psi::C_DGEMM('N', 'T', nxy, nrs, ncol, 1.0, DL[h].data(), ncol, DR.data(), ncol, 0.0,
+                          G.data(), nrs);
+            for (size_t i = 0; i < nxy; ++i) {
+                const auto& [q, p] = ex.pairs(h)[i];
+                for (size_t j = 0; j < nrs; ++j) {
+                    const auto& [r, s] = ex.pairs(h)[first + j];
+                    double value = G[i * nrs + j];
+                    if (same_spin and q == r)
+                        value -= g1_data[p * ncmo + s];
+                    rdm_data[tei_index(p, r, q, s, ncmo)] = value;
+                }
+            }
+        }
+    }
+    return rdm;
+}
+
+/**
+ * Compute the three-particle density matrix <L|a^+_p a^+_r a^+_t a_u a_s a_q|R> from the
+ * intermediates D^{pq}_I = <I|E_pq|Psi> via
+ *
+ *   <L|E_pq E_rs E_tu|R> = sum_I <I|E_qp|L> <I|E_rs E_tu|R>
+ *                        = g3[p,r,t,q,s,u] + delta_qr g2[p,t,s,u] - delta_qt g2[p,r,s,u]
+ *                          + delta_st g2[p,r,q,u] + delta_qr delta_st g1[p,u]
+ *
+ * where the Kronecker deltas also imply equal spin. The threads work on different (tu) pairs and
+ * the intermediates <I|E_rs E_tu|R> are formed in batches of (rs) pairs that fit in memory.
+ * @param alfa1 the spin of the pq excitation
+ * @param alfa2 the spin of the rs excitation
+ * @param alfa3 the spin of the tu excitation
+ * @param g1 the 1-RDM (used only if all the spins are equal)
+ * @param g2_12 the 2-RDM with spin (alfa1, alfa2)
+ * @param g2_13 the 2-RDM with spin (alfa1, alfa3)
+ */
+ambit::Tensor FCIVector::compute_3rdm_dgemm(FCIVector& C_left, FCIVector& C_right, bool alfa1,
+                                            bool alfa2, bool alfa3, ambit::Tensor g1,
+                                            ambit::Tensor g2_12, ambit::Tensor g2_13) {
+    size_t ncmo = C_left.ncmo_;
+    int symmetry = C_left.symmetry_;
+    std::string label = "3RDM_";
+    for (bool alfa : {alfa1, alfa2, alfa3})
+        label += alfa ? "A" : "B";
+    auto rdm = ambit::Tensor::build(ambit::CoreTensor, label, {ncmo, ncmo, ncmo, ncmo, ncmo, ncmo});
+    rdm.zero();
+
+    OneParticleExcitations ex(C_left);
+    auto L = ex.flatten(C_left);
+    auto R = ex.flatten(C_right);
+    int nirrep = ex.nirrep();
+
+    auto DL = build_left_intermediates(ex, alfa1, symmetry, L);
+    size_t used_memory = memory_size(DL) + L.size() + R.size();
+    used_memory += omp_get_max_threads() * ex.max_sector_size();
+    size_t batch = batch_size(ex, used_memory, rdm_max_memory_);
+
+    // make a list of the (tu) pairs
+    std::vector<std::pair<int, size_t>> tu_list;
+    for (int h = 0; h < nirrep; ++h) {
+        for (size_t n = 0; n < ex.pairs(h).size(); ++n) {
+            tu_list.emplace_back(h, n);
+        }
+    }
+
+    bool delta_12 = alfa1 == alfa2;
+    bool delta_13 = alfa1 == alfa3;
+    bool delta_23 = alfa2 == alfa3;
+    auto& rdm_data = rdm.data();
+    const auto& g1_data = g1.data();
+    const auto& g2_12_data = g2_12.data();
+    const auto& g2_13_data = g2_13.data();
+#pragma omp parallel
+    {
+        std::vector<double> V(ex.max_sector_size());
+        std::vector<double> W(batch * ex.max_sector_size());
+        std::vector<double> G(ex.max_pairs() * batch);
+#pragma omp for schedule(dynamic)
+        for (size_t n_tu = 0; n_tu < tu_list.size(); ++n_tu) {
+            const auto& [h_tu, tu] = tu_list[n_tu];
+            const auto& [t, u] = ex.pairs(h_tu)[tu];
+            // V = E_tu |R>
+            int g_V = symmetry ^ h_tu;
+            std::fill(V.begin(), V.begin() + ex.sector_size(g_V), 0.0);
+            ex.apply(alfa3, t, u, symmetry, R.data(), V.data());
+
+            for (int h_rs = 0; h_rs < nirrep; ++h_rs) {
+                int h_xy = h_rs ^ h_tu;
+                size_t ncol = ex.sector_size(g_V ^ h_rs);
+                size_t nxy = ex.pairs(h_xy).size();
+                size_t npairs = ex.pairs(h_rs).size();
+                if (ncol == 0 or nxy == 0)
+                    continue;
+                for (size_t first = 0; first < npairs; first += batch) {
+                    size_t last = std::min(first + batch, npairs);
+                    size_t nrs = last - first;
+                    // W = E_rs E_tu |R>
+                    ex.build(alfa2, h_rs, first, last, g_V, V.data(), W.data());
+                    psi::C_DGEMM('N', 'T', nxy, nrs, ncol, 1.0, DL[h_xy].data(), ncol, W.data(),
+                                 ncol, 0.0, G.data(), nrs);
+                    for (size_t i = 0; i < nxy; ++i) {
+                        const auto& [q, p] = ex.pairs(h_xy)[i];
+                        for (size_t j = 0; j < nrs; ++j) {
+                            const auto& [r, s] = ex.pairs(h_rs)[first + j];
+                            double value = G[i * nrs + j];
+                            if (delta_12 and q == r)
+                                value -= g2_13_data[tei_index(p, t, s, u, ncmo)];
+                            if (delta_13 and q == t)
+                                value += g2_12_data[tei_index(p, r, s, u, ncmo)];
+                            if (delta_23 and s == t)
+                                value -= g2_12_data[tei_index(p, r, q, u, ncmo)];
+                            if (delta_12 and delta_23 and q == r and s == t)
+                                value -= g1_data[p * ncmo + u];
+                            rdm_data[six_index(p, r, t, q, s, u, ncmo)] = value;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return rdm;
+}
+
+} // namespace forte
@@ -79,7 +79,14 @@ std::pair<int, int> startup() {
     ambit::initialize();
 
 #ifdef HAVE_MPI
-    MPI_Init(NULL, NULL);
+    // MPIDFIntegrals reads the distributed integrals from any thread, one thread at a time
+    int provided = 0;
+    MPI_Init_thread(NULL, NULL, MPI_THREAD_SERIALIZED, &provided);
+    if (provided < MPI_THREAD_SERIALIZED) {
+        psi::outfile->Printf("\n  Warning: the MPI library does not support MPI_THREAD_SERIALIZED."
+                             "\n  The distributed DF integrals can only be read from the main "
+                             "thread.\n");
+    }
 #endif
 
     int my_proc = 0;
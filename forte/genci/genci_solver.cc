@@ -34,7 +34,7 @@
 
 #include "integrals/active_space_integrals.h"
 #include "sparse_ci/ci_spin_adaptation.h"
-#include "helpers/davidson_liu_solver.h"
+#include "helpers/eigen_solver.h"
 
 #include "genci_solver.h"
 #include "genci_string_lists.h"
@@ -74,6 +74,8 @@ void GenCISolver::set_collapse_per_root(int value) { collapse_per_root_ = value;
 
 void GenCISolver::set_subspace_per_root(int value) { subspace_per_root_ = value; }
 
+void GenCISolver::set_eigen_solver(const std::string& value) { eigen_solver_ = value; }
+
 void GenCISolver::set_spin_adapt(bool value) { spin_adapt_ = value; }
 
 void GenCISolver::set_spin_adapt_full_preconditioner(bool value) {
@@ -166,6 +168,7 @@ void GenCISolver::set_options(std::shared_ptr<ForteOptions> options) {
     set_ndets_per_guess_state(options->get_int("DL_DETS_PER_GUESS"));
     set_collapse_per_root(options->get_int("DL_COLLAPSE_PER_ROOT"));
     set_subspace_per_root(options->get_int("DL_SUBSPACE_PER_ROOT"));
+    set_eigen_solver(options->get_str("CI_EIGENSOLVER"));
     set_maxiter_davidson(options->get_int("DL_MAXITER"));
 
     set_print(int_to_print_level(options->get_int("PRINT")));
@@ -204,8 +207,8 @@ double GenCISolver::compute_energy() {
     // if not allocate, create the DL solver
     bool first_run = false;
     if (dl_solver_ == nullptr) {
-        dl_solver_ = std::make_shared<DavidsonLiuSolver>(basis_size, nroot_, collapse_per_root_,
-                                                         subspace_per_root_);
+        dl_solver_ = make_eigen_solver(string_to_eigen_solver_type(eigen_solver_), basis_size,
+                                       nroot_, collapse_per_root_, subspace_per_root_);
         dl_solver_->set_e_convergence(e_convergence_);
         dl_solver_->set_r_convergence(r_convergence_);
         dl_solver_->set_print_level(print_);
@@ -317,7 +320,7 @@ double GenCISolver::compute_energy() {
 
 void GenCISolver::print_solutions(size_t sample_size, std::shared_ptr<psi::Vector> b,
                                   std::shared_ptr<psi::Vector> b_basis,
-                                  std::shared_ptr<DavidsonLiuSolver> dls) {
+                                  std::shared_ptr<EigenSolver> dls) {
     for (size_t r = 0; r < nroot_; ++r) {
         psi::outfile->Printf("\n\n  ==> Root No. %d <==\n", r);
 
@@ -365,7 +368,7 @@ void GenCISolver::print_solutions(size_t sample_size, std::shared_ptr<psi::Vecto
 }
 
 void GenCISolver::test_rdms(std::shared_ptr<psi::Vector> b, std::shared_ptr<psi::Vector> b_basis,
-                            std::shared_ptr<DavidsonLiuSolver> dls) {
+                            std::shared_ptr<EigenSolver> dls) {
     b_basis = dls->eigenvector(root_);
     if (spin_adapt_) {
         spin_adapter_->csf_C_to_det_C(b_basis, b);
@@ -35,7 +35,7 @@
 namespace forte {
 class GenCIVector;
 class SpinAdapter;
-class DavidsonLiuSolver;
+class EigenSolver;
 
 /// @brief The GenCISolver class
 /// This class performs Full CI calculations in the active space.
@@ -98,6 +98,9 @@ class GenCISolver : public ActiveSpaceMethod {
     /// Set the maximum subspace size for each root
     void set_subspace_per_root(int value);
 
+    /// Set the eigensolver used to diagonalize the Hamiltonian ("DL", "LOBPCG", or "LANCZOS")
+    void set_eigen_solver(const std::string& value);
+
     /// Spin adapt the FCI wave function
     void set_spin_adapt(bool value);
 
@@ -150,8 +153,8 @@ class GenCISolver : public ActiveSpaceMethod {
     /// The number of FCI determinants
     size_t nfci_dets_;
 
-    /// The Davidson-Liu-Solver object
-    std::shared_ptr<DavidsonLiuSolver> dl_solver_;
+    /// The eigensolver object (Davidson-Liu, LOBPCG, or Lanczos)
+    std::shared_ptr<EigenSolver> dl_solver_;
 
     /// Eigenvectors
     std::shared_ptr<psi::Matrix> eigen_vecs_;
@@ -170,6 +173,8 @@ class GenCISolver : public ActiveSpaceMethod {
     size_t collapse_per_root_ = 2;
     /// The maximum subspace size for each root
     size_t subspace_per_root_ = 4;
+    /// The eigensolver used to diagonalize the Hamiltonian
+    std::string eigen_solver_ = "DL";
     /// The number of determinants selected for each guess vector
     size_t ndets_per_guess_ = 10;
     /// Iterations for FCI
@@ -229,22 +234,17 @@ class GenCISolver : public ActiveSpaceMethod {
     /// @brief Print a summary of the FCI calculation
     void print_solutions(size_t sample_size, std::shared_ptr<psi::Vector> b,
                          std::shared_ptr<psi::Vector> b_basis,
-                         std::shared_ptr<DavidsonLiuSolver> dls);
-
-    /// @brief Compute the RDMs for a given root
-    /// @param root_left the left root
-    /// @param root_right the right root
-    /// @param max_rdm_level the maximum level of the RDMs to compute
-    std::shared_ptr<RDMs> compute_rdms_root(size_t root_left, size_t root_right, int max_rdm_level,
-                                            RDMsType type);
+                         std::shared_ptr<EigenSolver> dls);
 
-    std::shared_ptr<RDMs> compute_transition_rdms_root(size_t root_left, size_t root_right,
-                                                       std::shared_ptr<ActiveSpaceMethod> method2,
-                                                       int max_rdm_level, RDMsType type);
+    /// @brief Copy a list of roots into GenCIVector objects, copying each root only once
+    /// @param roots the list of roots (may contain repeated entries)
+    /// @return the vectors and, for each entry of roots, the index of the corresponding vector
+    std::pair<std::vector<std::shared_ptr<GenCIVector>>, std::vector<size_t>>
+    copy_states_into_fci_vectors(const std::vector<size_t>& roots);
 
     /// @brief Test the RDMs
     void test_rdms(std::shared_ptr<psi::Vector> b, std::shared_ptr<psi::Vector> b_basis,
-                   std::shared_ptr<DavidsonLiuSolver> dls);
+                   std::shared_ptr<EigenSolver> dls);
 
     void copy_state_into_fci_vector(int root, std::shared_ptr<GenCIVector> C);
 };
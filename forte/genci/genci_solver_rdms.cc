@@ -26,6 +26,8 @@
  * @END LICENSE
  */
 
+#include <map>
+
 #include "psi4/libmints/matrix.h"
 
 #include "helpers/printing.h"
@@ -57,52 +59,68 @@ GenCISolver::rdms(const std::vector<std::pair<size_t, size_t>>& root_list, int m
         }
     }
 
-    std::vector<std::shared_ptr<RDMs>> refs;
-    // loop over all the pairs of states
-    for (const auto& [root1, root2] : root_list) {
-        refs.push_back(compute_rdms_root(root1, root2, max_rdm_level, rdm_type));
+    // make sure the roots are valid
+    for (const auto& [root_left, root_right] : root_list) {
+        if (std::max(root_left, root_right) >= nroot_) {
+            std::string error = "Cannot compute RDMs <" + std::to_string(root_left) + "| ... |" +
+                                std::to_string(root_right) +
+                                "> (0-based) because nroot = " + std::to_string(nroot_);
+            throw std::runtime_error(error);
+        }
     }
-    return refs;
-}
 
-std::shared_ptr<RDMs> GenCISolver::compute_rdms_root(size_t root_left, size_t root_right,
-                                                     int max_rdm_level, RDMsType type) {
-    // make sure the root is valid
-    if (std::max(root_left, root_right) >= nroot_) {
-        std::string error = "Cannot compute RDMs <" + std::to_string(root_left) + "| ... |" +
-                            std::to_string(root_right) +
-                            "> (0-based) because nroot = " + std::to_string(nroot_);
-        throw std::runtime_error(error);
+    // copy each root only once and compute the RDMs of all the pairs in a single sweep
+    std::vector<size_t> roots;
+    for (const auto& [root_left, root_right] : root_list) {
+        roots.push_back(root_left);
+        roots.push_back(root_right);
     }
-
-    // here we will use C_ for the left wave function and T_ for the right wave function
-
-    copy_state_into_fci_vector(root_left, C_);
-    if (root_left != root_right) {
-        copy_state_into_fci_vector(root_right, T_);
-    } else {
-        T_->copy(*C_);
+    const auto [states, state_index] = copy_states_into_fci_vectors(roots);
+    std::vector<std::pair<size_t, size_t>> state_list;
+    for (size_t n = 0; n < root_list.size(); ++n) {
+        state_list.emplace_back(state_index[2 * n], state_index[2 * n + 1]);
     }
 
     if (print_ >= PrintLevel::Verbose) {
-        std::string title_rdm = "Computing RDMs <" + std::to_string(root_left) + " " +
-                                state().str_minimum() + "| ... |" + std::to_string(root_right) +
-                                " " + state().str_minimum() + ">";
+        std::string title_rdm = "Computing RDMs for " + std::to_string(root_list.size()) +
+                                " pairs of " + state().str_minimum() + " states";
         print_h2(title_rdm);
     }
 
-    auto rdms = GenCIVector::compute_rdms(*C_, *T_, max_rdm_level, type);
+    auto refs =
+        GenCIVector::compute_rdms_batched(states, states, state_list, max_rdm_level, rdm_type);
 
-    // Optionally, test the RDMs
-    if (test_rdms_) {
-        C_->test_rdms(*C_, *T_, max_rdm_level, type, rdms);
+    for (size_t n = 0; n < root_list.size(); ++n) {
+        const auto& [left, right] = state_list[n];
+        // Optionally, test the RDMs
+        if (test_rdms_) {
+            GenCIVector::test_rdms(*states[left], *states[right], max_rdm_level, rdm_type,
+                                   refs[n]);
+        }
+
+        // Print the NO if energy converged
+        if (print_no_ || print_ >= PrintLevel::Default) {
+            states[left]->print_natural_orbitals(mo_space_info_, refs[n]);
+        }
     }
+    return refs;
+}
 
-    // Print the NO if energy converged
-    if (print_no_ || print_ >= PrintLevel::Default) {
-        C_->print_natural_orbitals(mo_space_info_, rdms);
+std::pair<std::vector<std::shared_ptr<GenCIVector>>, std::vector<size_t>>
+GenCISolver::copy_states_into_fci_vectors(const std::vector<size_t>& roots) {
+    std::vector<std::shared_ptr<GenCIVector>> states;
+    std::vector<size_t> state_index;
+    std::map<size_t, size_t> root_to_state;
+    for (const auto& root : roots) {
+        if (root_to_state.count(root) == 0) {
+            auto C = std::make_shared<GenCIVector>(lists_);
+            copy_state_into_fci_vector(root, C);
+            root_to_state[root] = states.size();
+            states.push_back(C);
+        }
+        state_index.push_back(root_to_state[root]);
     }
-    return rdms;
+    return {states, state_index};
 }
 
 } // namespace forte
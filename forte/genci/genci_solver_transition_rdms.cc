@@ -59,55 +59,47 @@ GenCISolver::transition_rdms(const std::vector<std::pair<size_t, size_t>>& root_
         }
     }
 
-    std::vector<std::shared_ptr<RDMs>> refs;
-    // loop over all the pairs of states
-    for (const auto& [root1, root2] : root_list) {
-        refs.push_back(
-            compute_transition_rdms_root(root1, root2, method2, max_rdm_level, rdm_type));
+    // cast method2 to GenCISolver
+    auto method2_fcisolver = std::dynamic_pointer_cast<GenCISolver>(method2);
+    if (not method2_fcisolver) {
+        throw std::runtime_error("GenCISolver: transition RDMs require two GenCISolver objects.");
     }
-    return refs;
-}
 
-std::shared_ptr<RDMs>
-GenCISolver::compute_transition_rdms_root(size_t root_left, size_t root_right,
-                                          std::shared_ptr<ActiveSpaceMethod> method2,
-                                          int max_rdm_level, RDMsType type) {
-    // make sure the root is valid
-    if (root_left >= nroot_ or root_right >= method2->nroot()) {
-        std::string error = "Cannot compute RDMs <" + std::to_string(root_left) + "| ... |" +
-                            std::to_string(root_right) +
-                            "> (0-based) because nroot_left = " + std::to_string(nroot_) +
-                            " and nroot_right = " + std::to_string(method2->nroot());
-        throw std::runtime_error(error);
+    // make sure the roots are valid
+    std::vector<size_t> roots_left, roots_right;
+    for (const auto& [root_left, root_right] : root_list) {
+        if (root_left >= nroot_ or root_right >= method2->nroot()) {
+            std::string error = "Cannot compute RDMs <" + std::to_string(root_left) + "| ... |" +
+                                std::to_string(root_right) +
+                                "> (0-based) because nroot_left = " + std::to_string(nroot_) +
+                                " and nroot_right = " + std::to_string(method2->nroot());
+            throw std::runtime_error(error);
+        }
+        roots_left.push_back(root_left);
+        roots_right.push_back(root_right);
     }
 
-    // here we will use C_ for the left wave function and T_ for the right wave function
-
-    this->copy_state_into_fci_vector(root_left, C_);
-    // cast method2 to GenCISolver
-    auto method2_fcisolver = std::dynamic_pointer_cast<GenCISolver>(method2);
-    // copy the right root onto the temporary vector C_
-    method2_fcisolver->copy_state_into_fci_vector(root_right, method2_fcisolver->T_);
-
-    // if (print_) {
-    //     std::string title_rdm = "Computing RDMs <" + std::to_string(root_left) + " " +
-    //                             state().str_minimum() + "| ... |" + std::to_string(root_right) +
-    //                             " " + method2->state().str_minimum() + ">";
-    //     psi::outfile->Printf("\n    %s", title_rdm.c_str());
-    // }
+    // copy each root only once and compute the RDMs of all the pairs in a single sweep
+    const auto [states_left, index_left] = copy_states_into_fci_vectors(roots_left);
+    const auto [states_right, index_right] =
+        method2_fcisolver->copy_states_into_fci_vectors(roots_right);
+    std::vector<std::pair<size_t, size_t>> state_list;
+    for (size_t n = 0; n < root_list.size(); ++n) {
+        state_list.emplace_back(index_left[n], index_right[n]);
+    }
 
-    auto rdms = compute_transition_rdms(*C_, *method2_fcisolver->T_, max_rdm_level, type);
+    auto refs = compute_transition_rdms_batched(states_left, states_right, state_list,
+                                                max_rdm_level, rdm_type);
 
     // Optionally, test the RDMs
     if (test_rdms_) {
-        GenCIVector::test_rdms(*C_, *method2_fcisolver->T_, 1, type, rdms);
+        for (size_t n = 0; n < root_list.size(); ++n) {
+            const auto& [left, right] = state_list[n];
+            GenCIVector::test_rdms(*states_left[left], *states_right[right], 1, rdm_type,
+                                   refs[n]);
+        }
     }
-
-    // // Print the NO if energy converged
-    // if (print_no_ || print_ > 1) {
-    //     C_->print_natural_orbitals(mo_space_info_);
-    // }
-    return rdms;
+    return refs;
 }
 
 } // namespace forte
@@ -149,6 +149,21 @@ class GenCIVector {
     static std::shared_ptr<RDMs> compute_rdms(GenCIVector& C_left, GenCIVector& C_right,
                                               int max_order, RDMsType type);
 
+    /// @brief Compute the RDMs for a list of pairs of states in a single sweep over the string
+    /// lists. The blocks of each state are gathered once and shared by all the pairs, and the work
+    /// is distributed among threads over pairs of determinant blocks.
+    /// @param C_left the left states
+    /// @param C_right the right states (may be the same object as C_left)
+    /// @param root_list the list of pairs (i, j) of indices into C_left and C_right
+    /// @param max_order the maximum RDM level to compute
+    /// @param type the type of RDMs to compute
+    /// @return The RDMs <C_left[i]| ... |C_right[j]> in the order of root_list
+    static std::vector<std::shared_ptr<RDMs>>
+    compute_rdms_batched(const std::vector<std::shared_ptr<GenCIVector>>& C_left,
+                         const std::vector<std::shared_ptr<GenCIVector>>& C_right,
+                         const std::vector<std::pair<size_t, size_t>>& root_list, int max_order,
+                         RDMsType type);
+
     /// Return the temporary matrix CR
     static std::shared_ptr<psi::Matrix> get_CR();
     /// Return the temporary matrix CL
@@ -309,6 +324,16 @@ class GenCIVector {
     /// @param fci_ints The integrals object/
     void H2_aabb(GenCIVector& result, std::shared_ptr<ActiveSpaceIntegrals> fci_ints);
 
+    /// Pointers to the blocks of a set of vectors, indexed as [vector][block]
+    using BlockPointers = std::vector<std::vector<double**>>;
+
+    /// Assemble the RDMs object from the spin components
+    static std::shared_ptr<RDMs> assemble_rdms(int max_rdm_level, RDMsType type, ambit::Tensor g1a,
+                                               ambit::Tensor g1b, ambit::Tensor g2aa,
+                                               ambit::Tensor g2ab, ambit::Tensor g2bb,
+                                               ambit::Tensor g3aaa, ambit::Tensor g3aab,
+                                               ambit::Tensor g3abb, ambit::Tensor g3bbb);
+
     // 1-RDM elements are stored in the format
     // <a^+_{pa} a^+_{qb} a_{sb} a_ra> -> rdm[oei_index(p,q)]
 
@@ -326,6 +351,28 @@ class GenCIVector {
     /// Compute the matrix elements of the alpha-beta 2-RDM <a^+_{pa} a^+_{qb} a_{sb} a_{ra}>
     static ambit::Tensor compute_2rdm_ab_same_irrep(GenCIVector& C_left, GenCIVector& C_right);
 
+    /// Compute the 1-RDMs <a^+_{p} a_{q}> for a list of pairs of states
+    /// @param C a vector that provides the string lists
+    /// @param Cl the gathered blocks of the left states
+    /// @param Cr the gathered blocks of the right states
+    static std::vector<ambit::Tensor>
+    compute_1rdm_same_irrep_batched(GenCIVector& C, const BlockPointers& Cl,
+                                    const BlockPointers& Cr,
+                                    const std::vector<std::pair<size_t, size_t>>& root_list,
+                                    bool alfa);
+    /// Compute the same spin 2-RDMs <a^+_p a^+_q a_s a_r> for a list of pairs of states
+    static std::vector<ambit::Tensor>
+    compute_2rdm_aa_same_irrep_batched(GenCIVector& C, const BlockPointers& Cl,
+                                       const BlockPointers& Cr,
+                                       const std::vector<std::pair<size_t, size_t>>& root_list,
+                                       bool alfa);
+    /// Compute the alpha-beta 2-RDMs <a^+_{pa} a^+_{qb} a_{sb} a_{ra}> for a list of pairs of
+    /// states. Cl and Cr must hold the blocks in the alfa layout.
+    static std::vector<ambit::Tensor>
+    compute_2rdm_ab_same_irrep_batched(GenCIVector& C, const BlockPointers& Cl,
+                                       const BlockPointers& Cr,
+                                       const std::vector<std::pair<size_t, size_t>>& root_list);
+
     // 3-RDM elements are stored in the format
     // <a^+_p a^+_q a^+_r a_u a_t a_s> -> rdm[six_index(p,q,r,s,t,u)]
 
@@ -375,6 +422,19 @@ class GenCIVector {
 std::shared_ptr<RDMs> compute_transition_rdms(GenCIVector& C_left, GenCIVector& C_right,
                                               int max_rdm_level, RDMsType type);
 
+/// @brief Compute the transition RDMs for a list of pairs of states in a single sweep over the
+/// string lists. The string maps between the two spaces are built only once.
+/// @param C_left the left states
+/// @param C_right the right states
+/// @param root_list the list of pairs (i, j) of indices into C_left and C_right
+/// @param max_rdm_level the maximum RDM level to compute (only 1 is implemented)
+/// @param type the type of RDMs to compute
+std::vector<std::shared_ptr<RDMs>>
+compute_transition_rdms_batched(const std::vector<std::shared_ptr<GenCIVector>>& C_left,
+                                const std::vector<std::shared_ptr<GenCIVector>>& C_right,
+                                const std::vector<std::pair<size_t, size_t>>& root_list,
+                                int max_rdm_level, RDMsType type);
+
 /// @brief Compute the one-particle density matrix for a given wave function
 /// @param C_left The left wave function
 /// @param C_right The right wave function
@@ -114,6 +114,16 @@ std::shared_ptr<RDMs> GenCIVector::compute_rdms(GenCIVector& C_left, GenCIVector
     //     psi::outfile->Printf("\n    Timing for %d-RDM: %.3f s", n + 1, rdm_timing[n]);
     // }
 
+    return assemble_rdms(max_rdm_level, type, g1a, g1b, g2aa, g2ab, g2bb, g3aaa, g3aab, g3abb,
+                         g3bbb);
+}
+
+std::shared_ptr<RDMs> GenCIVector::assemble_rdms(int max_rdm_level, RDMsType type,
+                                                 ambit::Tensor g1a, ambit::Tensor g1b,
+                                                 ambit::Tensor g2aa, ambit::Tensor g2ab,
+                                                 ambit::Tensor g2bb, ambit::Tensor g3aaa,
+                                                 ambit::Tensor g3aab, ambit::Tensor g3abb,
+                                                 ambit::Tensor g3bbb) {
     if (type == RDMsType::spin_dependent) {
         if (max_rdm_level == 1) {
             return std::make_shared<RDMsSpinDependent>(g1a, g1b);
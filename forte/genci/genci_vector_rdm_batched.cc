@@ -0,0 +1,543 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "psi4/libpsi4util/process.h"
+#include "psi4/libmints/matrix.h"
+#include "psi4/libqt/qt.h"
+
+#include "helpers/timer.h"
+
+#include "genci_string_lists.h"
+#include "genci_string_address.h"
+
+#include "genci_vector.h"
+
+namespace forte {
+
+namespace {
+
+/// Build a list of zeroed RDM tensors
+std::vector<ambit::Tensor> build_rdm_tensors(size_t n, const std::string& label,
+                                             const std::vector<size_t>& dims) {
+    std::vector<ambit::Tensor> rdms;
+    for (size_t k = 0; k < n; ++k) {
+        rdms.push_back(ambit::Tensor::build(ambit::CoreTensor, label, dims));
+    }
+    return rdms;
+}
+
+/// Return pointers to the data of a list of tensors. These are grabbed before entering a parallel
+/// region so that all the threads can accumulate into the same tensors.
+std::vector<double*> rdm_pointers(std::vector<ambit::Tensor>& rdms) {
+    std::vector<double*> data;
+    for (auto& rdm : rdms) {
+        data.push_back(rdm.data().data());
+    }
+    return data;
+}
+
+/// Check that the indices in root_list are valid
+void check_root_list(const std::vector<std::pair<size_t, size_t>>& root_list, size_t nleft,
+                     size_t nright, const std::string& label) {
+    for (const auto& [left, right] : root_list) {
+        if (left >= nleft or right >= nright) {
+            throw std::runtime_error(label + ": Invalid pair of states (" + std::to_string(left) +
+                                     "," + std::to_string(right) + ").");
+        }
+    }
+}
+
+/// @brief Gather the blocks of a set of vectors so that the strings acted upon by the operators
+/// are stored along the rows. For alfa strings the blocks are used in place, while for beta
+/// strings they are transposed once and kept in storage, so that all the pairs of roots and all
+/// the threads can share them.
+std::vector<std::vector<double**>>
+gather_blocks(const std::vector<std::shared_ptr<GenCIVector>>& C, bool alfa,
+              std::vector<std::shared_ptr<psi::Matrix>>& storage) {
+    std::vector<std::vector<double**>> blocks;
+    for (const auto& c : C) {
+        const auto& lists = c->lists();
+        const auto alfa_address = c->alfa_address();
+        const auto beta_address = c->beta_address();
+        std::vector<double**> c_blocks(lists->determinant_classes().size(), nullptr);
+        for (const auto& [n, class_Ia, class_Ib] : lists->determinant_classes()) {
+            if (lists->detpblk(n) == 0)
+                continue;
+            auto c_n = c->C(n)->pointer();
+            if (alfa) {
+                c_blocks[n] = c_n;
+                continue;
+            }
+            size_t maxIa = alfa_address->strpcls(class_Ia);
+            size_t maxIb = beta_address->strpcls(class_Ib);
+            auto M = std::make_shared<psi::Matrix>("C", maxIb, maxIa);
+            auto m = M->pointer();
+            for (size_t Ia = 0; Ia < maxIa; ++Ia)
+                for (size_t Ib = 0; Ib < maxIb; ++Ib)
+                    m[Ib][Ia] = c_n[Ia][Ib];
+            storage.push_back(M);
+            c_blocks[n] = m;
+        }
+        blocks.push_back(c_blocks);
+    }
+    return blocks;
+}
+
+/// Return the pairs of blocks (nI, nJ) that can be connected by an operator that acts only on the
+/// alfa (beta) strings
+std::vector<std::pair<size_t, size_t>> same_spin_block_pairs(const GenCIStringLists& lists,
+                                                             bool alfa) {
+    std::vector<std::pair<size_t, size_t>> block_pairs;
+    for (const auto& [nI, class_Ia, class_Ib] : lists.determinant_classes()) {
+        if (lists.detpblk(nI) == 0)
+            continue;
+        for (const auto& [nJ, class_Ja, class_Jb] : lists.determinant_classes()) {
+            // The string class on which we don't act must be the same for I and J
+            if ((alfa and (class_Ib != class_Jb)) or (not alfa and (class_Ia != class_Ja)))
+                continue;
+            if (lists.detpblk(nJ) == 0)
+                continue;
+            block_pairs.emplace_back(nI, nJ);
+        }
+    }
+    return block_pairs;
+}
+
+/// Compute the transition 1-RDMs <a^+_{p} a_{q}> for a list of pairs of states
+std::vector<ambit::Tensor>
+compute_1rdm_different_irrep_batched(const std::vector<std::shared_ptr<GenCIVector>>& C_left,
+                                     const std::vector<std::shared_ptr<GenCIVector>>& C_right,
+                                     const std::vector<std::pair<size_t, size_t>>& root_list,
+                                     bool alfa) {
+    size_t ncmo = C_left.front()->ncmo();
+    auto rdms = build_rdm_tensors(root_list.size(), alfa ? "1RDM_A" : "1RDM_B", {ncmo, ncmo});
+
+    auto na = C_left.front()->alfa_address()->nones();
+    auto nb = C_left.front()->beta_address()->nones();
+    if ((alfa and (na < 1)) or ((!alfa) and (nb < 1)))
+        return rdms;
+
+    const auto& lists_left = C_left.front()->lists();
+    const auto& lists_right = C_right.front()->lists();
+
+    // The maps between the strings of the left and right wave functions are built only once and
+    // shared by all the pairs of states
+    auto string_list = find_string_map(*lists_left, *lists_right, alfa);
+    VOListMap vo_list = find_ov_string_map(*lists_left, *lists_right, alfa);
+
+    std::vector<std::shared_ptr<psi::Matrix>> storage;
+    const auto Cl = gather_blocks(C_left, alfa, storage);
+    const auto Cr = gather_blocks(C_right, alfa, storage);
+
+    // Collect the pairs of blocks connected by a^{+}_p a_q and the corresponding lists
+    std::vector<std::tuple<size_t, size_t, const std::vector<std::pair<int, int>>*,
+                           const VOListElement*>>
+        tasks;
+    for (const auto& [nI, class_Ia, class_Ib] : lists_right->determinant_classes()) {
+        if (lists_right->detpblk(nI) == 0)
+            continue;
+        for (const auto& [nJ, class_Ja, class_Jb] : lists_left->determinant_classes()) {
+            if (lists_left->detpblk(nJ) == 0)
+                continue;
+            auto string_it = alfa ? string_list.find(std::make_pair(class_Ib, class_Jb))
+                                  : string_list.find(std::make_pair(class_Ia, class_Ja));
+            if (string_it == string_list.end())
+                continue;
+            auto vo_it = alfa ? vo_list.find(std::make_pair(class_Ia, class_Ja))
+                              : vo_list.find(std::make_pair(class_Ib, class_Jb));
+            if (vo_it == vo_list.end())
+                continue;
+            tasks.emplace_back(nI, nJ, &string_it->second, &vo_it->second);
+        }
+    }
+
+    auto rdm_data = rdm_pointers(rdms);
+    const size_t npairs = root_list.size();
+
+    // <Ja|a^{+}_p a_q|Ia> CL_{Ja,K} CR_{Ia,K}
+#pragma omp parallel for schedule(dynamic)
+    for (size_t n = 0; n < tasks.size(); ++n) {
+        const auto& [nI, nJ, string_list_block, pq_vo_list] = tasks[n];
+        for (const auto& [pq, vo_list] : *pq_vo_list) {
+            const auto& [p, q] = pq;
+            for (size_t k = 0; k < npairs; ++k) {
+                const auto cl = Cl[root_list[k].first][nJ];
+                const auto cr = Cr[root_list[k].second][nI];
+                double rdm_element = 0.0;
+                for (const auto& [sign, I, J] : vo_list) {
+                    for (const auto& [Ip, Jp] : *string_list_block)
+                        rdm_element += sign * cl[J][Jp] * cr[I][Ip];
+                }
+#pragma omp atomic
+                rdm_data[k][p * ncmo + q] += rdm_element;
+            }
+        }
+    }
+    return rdms;
+}
+
+} // namespace
+
+std::vector<std::shared_ptr<RDMs>>
+GenCIVector::compute_rdms_batched(const std::vector<std::shared_ptr<GenCIVector>>& C_left,
+                                  const std::vector<std::shared_ptr<GenCIVector>>& C_right,
+                                  const std::vector<std::pair<size_t, size_t>>& root_list,
+                                  int max_rdm_level, RDMsType type) {
+    check_root_list(root_list, C_left.size(), C_right.size(), "GenCIVector::compute_rdms_batched");
+
+    std::vector<std::shared_ptr<RDMs>> refs;
+    if (root_list.empty())
+        return refs;
+
+    // The 3-RDMs dominate the cost and are computed one pair at a time
+    if (max_rdm_level >= 3) {
+        for (const auto& [left, right] : root_list) {
+            refs.push_back(compute_rdms(*C_left[left], *C_right[right], max_rdm_level, type));
+        }
+        return refs;
+    }
+
+    auto& C = *C_left.front();
+    const size_t npairs = root_list.size();
+    const bool same_states = (&C_left == &C_right);
+
+    std::vector<ambit::Tensor> g1a, g1b, g2aa, g2ab, g2bb;
+
+    // The alfa blocks are used in place and are also needed by the alpha-beta 2-RDM
+    std::vector<std::shared_ptr<psi::Matrix>> storage;
+    const auto Cl_alfa = gather_blocks(C_left, true, storage);
+    const auto Cr_alfa = same_states ? Cl_alfa : gather_blocks(C_right, true, storage);
+
+    if (max_rdm_level >= 1) {
+        local_timer t;
+        g1a = compute_1rdm_same_irrep_batched(C, Cl_alfa, Cr_alfa, root_list, true);
+        if (max_rdm_level >= 2) {
+            g2aa = compute_2rdm_aa_same_irrep_batched(C, Cl_alfa, Cr_alfa, root_list, true);
+            g2ab = compute_2rdm_ab_same_irrep_batched(C, Cl_alfa, Cr_alfa, root_list);
+        }
+        {
+            // the transposed beta blocks are released as soon as they are not needed
+            std::vector<std::shared_ptr<psi::Matrix>> beta_storage;
+            const auto Cl_beta = gather_blocks(C_left, false, beta_storage);
+            const auto Cr_beta = same_states ? Cl_beta : gather_blocks(C_right, false, beta_storage);
+            g1b = compute_1rdm_same_irrep_batched(C, Cl_beta, Cr_beta, root_list, false);
+            if (max_rdm_level >= 2) {
+                g2bb = compute_2rdm_aa_same_irrep_batched(C, Cl_beta, Cr_beta, root_list, false);
+            }
+        }
+        if (C.print_ >= PrintLevel::Debug) {
+            psi::outfile->Printf("\n    Timing for %zu batched RDMs: %.3f s", npairs, t.get());
+        }
+    }
+
+    ambit::Tensor empty;
+    for (size_t k = 0; k < npairs; ++k) {
+        refs.push_back(assemble_rdms(max_rdm_level, type, g1a[k], g1b[k],
+                                     max_rdm_level >= 2 ? g2aa[k] : empty,
+                                     max_rdm_level >= 2 ? g2ab[k] : empty,
+                                     max_rdm_level >= 2 ? g2bb[k] : empty, empty, empty, empty,
+                                     empty));
+    }
+    return refs;
+}
+
+std::vector<ambit::Tensor> GenCIVector::compute_1rdm_same_irrep_batched(
+    GenCIVector& C, const BlockPointers& Cl, const BlockPointers& Cr,
+    const std::vector<std::pair<size_t, size_t>>& root_list, bool alfa) {
+    size_t ncmo = C.ncmo_;
+    const auto& alfa_address = C.alfa_address_;
+    const auto& beta_address = C.beta_address_;
+    const auto& lists = C.lists_;
+
+    auto rdms = build_rdm_tensors(root_list.size(), alfa ? "1RDM_A" : "1RDM_B", {ncmo, ncmo});
+
+    auto na = alfa_address->nones();
+    auto nb = beta_address->nones();
+    if ((alfa and (na < 1)) or ((!alfa) and (nb < 1)))
+        return rdms;
+
+    auto rdm_data = rdm_pointers(rdms);
+    const size_t npairs = root_list.size();
+    const auto block_pairs = same_spin_block_pairs(*lists, alfa);
+    const auto& determinant_classes = lists->determinant_classes();
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t n = 0; n < block_pairs.size(); ++n) {
+        const auto& [nI, nJ] = block_pairs[n];
+        const auto class_Ia = std::get<1>(determinant_classes[nI]);
+        const auto class_Ib = std::get<2>(determinant_classes[nI]);
+        const auto class_Ja = std::get<1>(determinant_classes[nJ]);
+        const auto class_Jb = std::get<2>(determinant_classes[nJ]);
+
+        size_t maxL = alfa ? beta_address->strpcls(class_Ib) : alfa_address->strpcls(class_Ia);
+
+        const auto& pq_vo_list = alfa ? lists->get_alfa_vo_list(class_Ia, class_Ja)
+                                      : lists->get_beta_vo_list(class_Ib, class_Jb);
+
+        for (const auto& [pq, vo_list] : pq_vo_list) {
+            const auto& [p, q] = pq;
+            for (size_t k = 0; k < npairs; ++k) {
+                const auto cl = Cl[root_list[k].first][nJ];
+                const auto cr = Cr[root_list[k].second][nI];
+                double rdm_element = 0.0;
+                for (const auto& [sign, I, J] : vo_list) {
+                    rdm_element += sign * psi::C_DDOT(maxL, cl[J], 1, cr[I], 1);
+                }
+#pragma omp atomic
+                rdm_data[k][p * ncmo + q] += rdm_element;
+            }
+        }
+    }
+    return rdms;
+}
+
+std::vector<ambit::Tensor> GenCIVector::compute_2rdm_aa_same_irrep_batched(
+    GenCIVector& C, const BlockPointers& Cl, const BlockPointers& Cr,
+    const std::vector<std::pair<size_t, size_t>>& root_list, bool alfa) {
+    size_t ncmo = C.ncmo_;
+    const auto& alfa_address = C.alfa_address_;
+    const auto& beta_address = C.beta_address_;
+    const auto& lists = C.lists_;
+
+    auto rdms = build_rdm_tensors(root_list.size(), alfa ? "2RDM_AA" : "2RDM_BB",
+                                  {ncmo, ncmo, ncmo, ncmo});
+
+    auto na = alfa_address->nones();
+    auto nb = beta_address->nones();
+    if ((alfa and (na < 2)) or ((!alfa) and (nb < 2)))
+        return rdms;
+
+    auto rdm_data = rdm_pointers(rdms);
+    const size_t npairs = root_list.size();
+    const auto block_pairs = same_spin_block_pairs(*lists, alfa);
+    const auto& determinant_classes = lists->determinant_classes();
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t n = 0; n < block_pairs.size(); ++n) {
+        const auto& [nI, nJ] = block_pairs[n];
+        const auto class_Ia = std::get<1>(determinant_classes[nI]);
+        const auto class_Ib = std::get<2>(determinant_classes[nI]);
+        const auto class_Ja = std::get<1>(determinant_classes[nJ]);
+        const auto class_Jb = std::get<2>(determinant_classes[nJ]);
+
+        // get the size of the string of spin opposite to the one we are acting on
+        size_t maxL = alfa ? beta_address->strpcls(class_Ib) : alfa_address->strpcls(class_Ia);
+
+        if ((class_Ia == class_Ja) and (class_Ib == class_Jb)) {
+            // OO terms
+            // Loop over (p>q) == (p>q)
+            const auto& pq_oo_list =
+                alfa ? lists->get_alfa_oo_list(class_Ia) : lists->get_beta_oo_list(class_Ib);
+            for (const auto& [pq, oo_list] : pq_oo_list) {
+                const auto& [p, q] = pq;
+                for (size_t k = 0; k < npairs; ++k) {
+                    const auto cl = Cl[root_list[k].first][nJ];
+                    const auto cr = Cr[root_list[k].second][nI];
+                    double rdm_element = 0.0;
+                    for (const auto& I : oo_list) {
+                        rdm_element += psi::C_DDOT(maxL, cl[I], 1, cr[I], 1);
+                    }
+                    auto rdm = rdm_data[k];
+#pragma omp atomic
+                    rdm[tei_index(p, q, p, q, ncmo)] += rdm_element;
+#pragma omp atomic
+                    rdm[tei_index(p, q, q, p, ncmo)] -= rdm_element;
+#pragma omp atomic
+                    rdm[tei_index(q, p, p, q, ncmo)] -= rdm_element;
+#pragma omp atomic
+                    rdm[tei_index(q, p, q, p, ncmo)] += rdm_element;
+                }
+            }
+        }
+
+        // VVOO terms
+        const auto& pqrs_vvoo_list = alfa ? lists->get_alfa_vvoo_list(class_Ia, class_Ja)
+                                          : lists->get_beta_vvoo_list(class_Ib, class_Jb);
+        for (const auto& [pqrs, vvoo_list] : pqrs_vvoo_list) {
+            const auto& [p, q, r, s] = pqrs;
+            for (size_t k = 0; k < npairs; ++k) {
+                const auto cl = Cl[root_list[k].first][nJ];
+                const auto cr = Cr[root_list[k].second][nI];
+                double rdm_element = 0.0;
+                for (const auto& [sign, I, J] : vvoo_list) {
+                    rdm_element += sign * psi::C_DDOT(maxL, cl[J], 1, cr[I], 1);
+                }
+                auto rdm = rdm_data[k];
+#pragma omp atomic
+                rdm[tei_index(p, q, r, s, ncmo)] += rdm_element;
+#pragma omp atomic
+                rdm[tei_index(q, p, r, s, ncmo)] -= rdm_element;
+#pragma omp atomic
+                rdm[tei_index(p, q, s, r, ncmo)] -= rdm_element;
+#pragma omp atomic
+                rdm[tei_index(q, p, s, r, ncmo)] += rdm_element;
+            }
+        }
+    }
+    return rdms;
+}
+
+std::vector<ambit::Tensor> GenCIVector::compute_2rdm_ab_same_irrep_batched(
+    GenCIVector& C, const BlockPointers& Cl, const BlockPointers& Cr,
+    const std::vector<std::pair<size_t, size_t>>& root_list) {
+    size_t ncmo = C.ncmo_;
+    const auto& alfa_address = C.alfa_address_;
+    const auto& beta_address = C.beta_address_;
+    const auto& lists = C.lists_;
+
+    auto rdms = build_rdm_tensors(root_list.size(), "2RDM_AB", {ncmo, ncmo, ncmo, ncmo});
+
+    auto na = alfa_address->nones();
+    auto nb = beta_address->nones();
+    if ((na < 1) or (nb < 1))
+        return rdms;
+
+    auto rdm_data = rdm_pointers(rdms);
+    const size_t npairs = root_list.size();
+    const auto& mo_sym = lists->string_class()->mo_sym();
+    const auto& beta_string_classes = lists->string_class()->beta_string_classes();
+
+    // Both the alfa and beta strings are acted upon, so all the pairs of blocks can contribute
+    std::vector<std::pair<size_t, size_t>> block_pairs;
+    for (const auto& [nI, class_Ia, class_Ib] : lists->determinant_classes()) {
+        if (lists->detpblk(nI) == 0)
+            continue;
+        for (const auto& [nJ, class_Ja, class_Jb] : lists->determinant_classes()) {
+            if (lists->detpblk(nJ) == 0)
+                continue;
+            block_pairs.emplace_back(nI, nJ);
+        }
+    }
+    const auto& determinant_classes = lists->determinant_classes();
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t n = 0; n < block_pairs.size(); ++n) {
+        const auto& [nI, nJ] = block_pairs[n];
+        const auto class_Ia = std::get<1>(determinant_classes[nI]);
+        const auto class_Ib = std::get<2>(determinant_classes[nI]);
+        const auto class_Ja = std::get<1>(determinant_classes[nJ]);
+        const auto class_Jb = std::get<2>(determinant_classes[nJ]);
+
+        auto h_Ib = beta_string_classes[class_Ib].second;
+        auto h_Jb = beta_string_classes[class_Jb].second;
+
+        const auto& pq_vo_alfa = lists->get_alfa_vo_list(class_Ia, class_Ja);
+        const auto& rs_vo_beta = lists->get_beta_vo_list(class_Ib, class_Jb);
+
+        for (const auto& [rs, vo_beta_list] : rs_vo_beta) {
+            if (vo_beta_list.size() == 0)
+                continue;
+
+            const auto& [r, s] = rs;
+            const auto rs_sym = mo_sym[r] ^ mo_sym[s];
+
+            // Make sure that the symmetry of the J beta string is the same as the symmetry of
+            // the I beta string times the symmetry of the rs product
+            if (h_Jb != (h_Ib ^ rs_sym))
+                continue;
+
+            for (const auto& [pq, vo_alfa_list] : pq_vo_alfa) {
+                const auto& [p, q] = pq;
+                const auto pq_sym = mo_sym[p] ^ mo_sym[q];
+                // ensure that the product pqrs is totally symmetric
+                if (pq_sym != rs_sym)
+                    continue;
+
+                for (size_t k = 0; k < npairs; ++k) {
+                    const auto cl = Cl[root_list[k].first][nJ];
+                    const auto cr = Cr[root_list[k].second][nI];
+                    double rdm_element = 0.0;
+                    for (const auto& [sign_a, Ia, Ja] : vo_alfa_list) {
+                        for (const auto& [sign_b, Ib, Jb] : vo_beta_list) {
+                            rdm_element += cl[Ja][Jb] * cr[Ia][Ib] * sign_a * sign_b;
+                        }
+                    }
+#pragma omp atomic
+                    rdm_data[k][tei_index(p, r, q, s, ncmo)] += rdm_element;
+                }
+            }
+        }
+    }
+    return rdms;
+}
+
+std::vector<std::shared_ptr<RDMs>>
+compute_transition_rdms_batched(const std::vector<std::shared_ptr<GenCIVector>>& C_left,
+                                const std::vector<std::shared_ptr<GenCIVector>>& C_right,
+                                const std::vector<std::pair<size_t, size_t>>& root_list,
+                                int max_rdm_level, RDMsType type) {
+    check_root_list(root_list, C_left.size(), C_right.size(), "FCI transition RDMs");
+
+    std::vector<std::shared_ptr<RDMs>> refs;
+    if (root_list.empty())
+        return refs;
+
+    if (C_left.front()->ncmo() != C_right.front()->ncmo()) {
+        throw std::runtime_error(
+            "FCI transition RDMs: The number of MOs must be the same in the two wave functions.");
+    }
+
+    if (C_left.front()->alfa_address()->nones() != C_right.front()->alfa_address()->nones() or
+        C_left.front()->beta_address()->nones() != C_right.front()->beta_address()->nones()) {
+        throw std::runtime_error(
+            "FCI transition RDMs: The number of alfa and beta electrons must be the same in the "
+            "two wave functions.");
+    }
+
+    if (max_rdm_level >= 2) {
+        throw std::runtime_error(
+            "Transition RDMs of order 2 or higher are not implemented in GenCISolver (and "
+            "more generally in Forte).");
+    }
+
+    if (max_rdm_level < 1) {
+        for (size_t k = 0; k < root_list.size(); ++k) {
+            refs.push_back(std::make_shared<RDMsSpinDependent>());
+        }
+        return refs;
+    }
+
+    auto g1a = compute_1rdm_different_irrep_batched(C_left, C_right, root_list, true);
+    auto g1b = compute_1rdm_different_irrep_batched(C_left, C_right, root_list, false);
+
+    for (size_t k = 0; k < root_list.size(); ++k) {
+        if (type == RDMsType::spin_dependent) {
+            refs.push_back(std::make_shared<RDMsSpinDependent>(g1a[k], g1b[k]));
+        } else {
+            g1a[k]("pq") += g1b[k]("pq");
+            refs.push_back(std::make_shared<RDMsSpinFree>(g1a[k]));
+        }
+    }
+    return refs;
+}
+
+} // namespace forte
@@ -0,0 +1,402 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "hash_vector.h"
+
+/**
+ * @brief A hash vector that supports concurrent insertion and lookup
+ *
+ * Like HashVector, this container assigns to each key a stable index equal to its insertion
+ * order, so that values associated to the keys can be stored in a separate std::vector.
+ * Differently from HashVector, add() and find() may be called concurrently from multiple threads.
+ *
+ * Implementation:
+ *  - the keys are stored in segments of geometrically increasing size. Segments are never
+ *    reallocated, so the address of a key (and its index) never changes.
+ *  - the index of a key is found via an open-addressing table of atomic slots. A slot is either
+ *    empty, reserved by a thread that is writing a new key, or stores the key index + 1.
+ *    Insertion claims a slot with a compare-and-swap and does not take any lock.
+ *  - when the load factor exceeds max_load_factor() the table is doubled. This is the only
+ *    step that excludes the other writers: the thread that grows the table waits for the
+ *    pending insertions to complete and rebuilds it from the stored keys. Growth is amortized
+ *    and can be avoided entirely by calling reserve().
+ *
+ * find() can run concurrently with add(). Tables replaced by a growth step are retired and freed
+ * only by the non-concurrent functions (clear(), reserve(), the destructor), so a reader never
+ * accesses freed memory.
+ *
+ * Element access via operator[] and size() are meant to be used after the concurrent phase.
+ * The Key type must be default constructible and copy assignable.
+ */
+template <class Key, class Hash = std::hash<Key>> class ConcurrentHashVector {
+  public:
+    static const size_t npos = SIZE_MAX;
+
+    explicit ConcurrentHashVector(size_t count = 0);
+    ~ConcurrentHashVector();
+
+    ConcurrentHashVector(const ConcurrentHashVector&) = delete;
+    ConcurrentHashVector& operator=(const ConcurrentHashVector&) = delete;
+
+    /*- Element access -*/
+    /// Return the key with a given index
+    const Key& operator[](size_t pos) const { return key_at(pos); }
+    /// Return the index of a key or npos if the key is not present. Thread safe.
+    size_t find(const Key& key) const;
+
+    /*- Capacity -*/
+    /// The number of keys stored
+    size_t size() const { return size_.load(std::memory_order_acquire); }
+    /// The number of slots in the hash table
+    size_t bucket_count() const { return table_.load(std::memory_order_acquire)->capacity; }
+
+    /*- Modifiers -*/
+    /// Add a key and return its index. If the key is already present, return its index. Thread
+    /// safe.
+    size_t add(const Key& key);
+    /// Add a key and return a pair (index, true if the key was inserted). Thread safe.
+    std::pair<size_t, bool> insert(const Key& key);
+    /// Remove all the keys (not thread safe)
+    void clear();
+
+    /*- Operations -*/
+    /// Add all the keys of a HashVector in parallel and return their indices
+    template <class Hash_2> std::vector<size_t> merge(const HashVector<Key, Hash_2>& source);
+    /// Add all the keys of a vector in parallel and return their indices
+    std::vector<size_t> merge(const std::vector<Key>& source);
+
+    /*- Hash policy -*/
+    float load_factor() const { return static_cast<float>(size()) / bucket_count(); }
+    float max_load_factor() const { return max_load_; }
+    /// Set the maximum load factor (not thread safe). Must be in the range (0, 1)
+    void max_load_factor(float ml);
+    /// Reserve space for count keys so that no growth is needed (not thread safe)
+    void reserve(size_t count);
+
+    /*- Convertors -*/
+    std::vector<Key> toVector() const;
+    HashVector<Key, Hash> toHashVector() const;
+
+  private:
+    /// Value of an empty slot
+    static constexpr uint64_t empty_slot = 0;
+    /// Value of a slot claimed by a thread that has not yet published the key index
+    static constexpr uint64_t busy_slot = UINT64_MAX;
+    /// The size of the first storage segment (log2)
+    static constexpr size_t log2_first_segment = 10;
+    /// The maximum number of storage segments
+    static constexpr size_t max_segments = 64 - log2_first_segment;
+    /// The minimum size of the hash table
+    static constexpr size_t min_capacity = 64;
+
+    struct Table {
+        explicit Table(size_t capacity_) : capacity(capacity_), slots(capacity_) {}
+        size_t capacity;
+        std::vector<std::atomic<uint64_t>> slots;
+    };
+
+    /// The current hash table
+    std::atomic<Table*> table_;
+    /// Tables replaced by growth steps, freed by the non-concurrent functions
+    std::vector<std::unique_ptr<Table>> retired_tables_;
+    /// The storage segments. Segment s stores the keys with index in
+    /// [first_segment * (2^s - 1), first_segment * (2^(s+1) - 1))
+    std::atomic<Key*> segments_[max_segments];
+    /// The number of keys
+    std::atomic<size_t> size_{0};
+    /// The number of threads currently inserting keys
+    std::atomic<size_t> active_writers_{0};
+    /// Is a thread growing the table?
+    std::atomic<bool> growing_{false};
+    float max_load_ = 0.5;
+
+    /// Find the segment and the offset of a given index
+    static std::pair<size_t, size_t> segment_offset(size_t index) {
+        const size_t j = (index >> log2_first_segment) + 1;
+        const size_t s = std::bit_width(j) - 1;
+        return {s, index - (((size_t(1) << s) - 1) << log2_first_segment)};
+    }
+    const Key& key_at(size_t index) const {
+        auto [s, offset] = segment_offset(index);
+        return segments_[s].load(std::memory_order_acquire)[offset];
+    }
+    /// Store a key making sure that the segment is allocated
+    void store_key(size_t index, const Key& key);
+    /// Try to insert a key in the table (returns npos as the index if the table is full)
+    std::pair<size_t, bool> try_insert(Table* table, const Key& key);
+    /// Register/unregister an inserting thread
+    void enter_writer();
+    void exit_writer() { active_writers_.fetch_sub(1); }
+    /// Grow the hash table to accommodate count keys
+    void grow(size_t count);
+    /// The table capacity needed to store count keys
+    size_t capacity_for(size_t count) const;
+    /// Free all the storage
+    void release();
+};
+
+template <class Key, class Hash> const size_t ConcurrentHashVector<Key, Hash>::npos;
+
+template <class Key, class Hash>
+ConcurrentHashVector<Key, Hash>::ConcurrentHashVector(size_t count) {
+    for (auto& segment : segments_) {
+        segment.store(nullptr);
+    }
+    table_.store(new Table(capacity_for(count)));
+}
+
+template <class Key, class Hash> ConcurrentHashVector<Key, Hash>::~ConcurrentHashVector() {
+    release();
+}
+
+template <class Key, class Hash> void ConcurrentHashVector<Key, Hash>::release() {
+    delete table_.load();
+    table_.store(nullptr);
+    retired_tables_.clear();
+    for (auto& segment : segments_) {
+        delete[] segment.load();
+        segment.store(nullptr);
+    }
+    size_.store(0);
+}
+
+template <class Key, class Hash> void ConcurrentHashVector<Key, Hash>::clear() {
+    release();
+    table_.store(new Table(capacity_for(0)));
+}
+
+template <class Key, class Hash>
+size_t ConcurrentHashVector<Key, Hash>::capacity_for(size_t count) const {
+    size_t capacity = min_capacity;
+    while (static_cast<double>(count) >= max_load_ * static_cast<double>(capacity)) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+template <class Key, class Hash> void ConcurrentHashVector<Key, Hash>::max_load_factor(float ml) {
+    if (ml <= 0.0 or ml >= 1.0) {
+        throw std::runtime_error("ConcurrentHashVector: the maximum load factor must be in the "
+                                 "range (0, 1)");
+    }
+    max_load_ = ml;
+    reserve(size());
+}
+
+template <class Key, class Hash> void ConcurrentHashVector<Key, Hash>::reserve(size_t count) {
+    grow(std::max(count, size()));
+    retired_tables_.clear();
+}
+
+template <class Key, class Hash>
+size_t ConcurrentHashVector<Key, Hash>::find(const Key& key) const {
+    const Table* table = table_.load(std::memory_order_acquire);
+    const size_t mask = table->capacity - 1;
+    size_t pos = Hash()(key) & mask;
+    for (size_t probe = 0; probe < table->capacity; probe++) {
+        uint64_t v = table->slots[pos].load(std::memory_order_acquire);
+        // wait for a concurrent insertion to publish its key
+        while (v == busy_slot) {
+            std::this_thread::yield();
+            v = table->slots[pos].load(std::memory_order_acquire);
+        }
+        if (v == empty_slot)
+            return npos;
+        if (key_at(v - 1) == key)
+            return v - 1;
+        pos = (pos + 1) & mask;
+    }
+    return npos;
+}
+
+template <class Key, class Hash>
+void ConcurrentHashVector<Key, Hash>::store_key(size_t index, const Key& key) {
+    auto [s, offset] = segment_offset(index);
+    Key* segment = segments_[s].load(std::memory_order_acquire);
+    if (segment == nullptr) {
+        Key* new_segment = new Key[size_t(1) << (s + log2_first_segment)];
+        if (segments_[s].compare_exchange_strong(segment, new_segment)) {
+            segment = new_segment;
+        } else {
+            // another thread allocated this segment first
+            delete[] new_segment;
+        }
+    }
+    segment[offset] = key;
+}
+
+template <class Key, class Hash>
+std::pair<size_t, bool> ConcurrentHashVector<Key, Hash>::try_insert(Table* table,
+                                                                    const Key& key) {
+    const size_t mask = table->capacity - 1;
+    size_t pos = Hash()(key) & mask;
+    for (size_t probe = 0; probe < table->capacity;) {
+        auto& slot = table->slots[pos];
+        uint64_t v = slot.load(std::memory_order_acquire);
+        if (v == empty_slot) {
+            if (slot.compare_exchange_strong(v, busy_slot, std::memory_order_acq_rel)) {
+                const size_t index = size_.fetch_add(1);
+                store_key(index, key);
+                slot.store(index + 1, std::memory_order_release);
+                return {index, true};
+            }
+            // another thread claimed this slot, look at it again
+            continue;
+        }
+        if (v == busy_slot) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (key_at(v - 1) == key)
+            return {v - 1, false};
+        pos = (pos + 1) & mask;
+        probe++;
+    }
+    return {npos, false};
+}
+
+template <class Key, class Hash> void ConcurrentHashVector<Key, Hash>::enter_writer() {
+    while (true) {
+        while (growing_.load()) {
+            std::this_thread::yield();
+        }
+        active_writers_.fetch_add(1);
+        if (not growing_.load())
+            return;
+        active_writers_.fetch_sub(1);
+    }
+}
+
+template <class Key, class Hash>
+std::pair<size_t, bool> ConcurrentHashVector<Key, Hash>::insert(const Key& key) {
+    while (true) {
+        enter_writer();
+        Table* table = table_.load(std::memory_order_acquire);
+        size_t count = size_.load(std::memory_order_relaxed) + 1;
+        if (static_cast<double>(count) < max_load_ * static_cast<double>(table->capacity)) {
+            auto result = try_insert(table, key);
+            exit_writer();
+            if (result.first != npos)
+                return result;
+            // the table is full because of concurrent insertions, make sure it grows
+            count = std::max(count, table->capacity);
+        } else {
+            exit_writer();
+        }
+        grow(count);
+    }
+}
+
+template <class Key, class Hash> size_t ConcurrentHashVector<Key, Hash>::add(const Key& key) {
+    return insert(key).first;
+}
+
+template <class Key, class Hash> void ConcurrentHashVector<Key, Hash>::grow(size_t count) {
+    bool expected = false;
+    if (not growing_.compare_exchange_strong(expected, true)) {
+        // another thread is growing the table, wait for it to finish
+        while (growing_.load()) {
+            std::this_thread::yield();
+        }
+        return;
+    }
+    // wait for the pending insertions to complete
+    while (active_writers_.load() != 0) {
+        std::this_thread::yield();
+    }
+    const size_t new_capacity = capacity_for(count);
+    Table* old_table = table_.load();
+    if (new_capacity > old_table->capacity) {
+        auto new_table = new Table(new_capacity);
+        const size_t mask = new_capacity - 1;
+        const size_t n = size_.load();
+        for (size_t i = 0; i < n; i++) {
+            size_t pos = Hash()(key_at(i)) & mask;
+            while (new_table->slots[pos].load(std::memory_order_relaxed) != empty_slot) {
+                pos = (pos + 1) & mask;
+            }
+            new_table->slots[pos].store(i + 1, std::memory_order_relaxed);
+        }
+        table_.store(new_table, std::memory_order_release);
+        retired_tables_.emplace_back(old_table);
+    }
+    growing_.store(false);
+}
+
+template <class Key, class Hash>
+template <class Hash_2>
+std::vector<size_t>
+ConcurrentHashVector<Key, Hash>::merge(const HashVector<Key, Hash_2>& source) {
+    const size_t merge_size = source.size();
+    std::vector<size_t> cur_index(merge_size);
+    reserve(size() + merge_size);
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < merge_size; ++i) {
+        cur_index[i] = add(source[i]);
+    }
+    return cur_index;
+}
+
+template <class Key, class Hash>
+std::vector<size_t> ConcurrentHashVector<Key, Hash>::merge(const std::vector<Key>& source) {
+    const size_t merge_size = source.size();
+    std::vector<size_t> cur_index(merge_size);
+    reserve(size() + merge_size);
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < merge_size; ++i) {
+        cur_index[i] = add(source[i]);
+    }
+    return cur_index;
+}
+
+template <class Key, class Hash> std::vector<Key> ConcurrentHashVector<Key, Hash>::toVector() const {
+    const size_t n = size();
+    std::vector<Key> result;
+    result.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        result.push_back(key_at(i));
+    }
+    return result;
+}
+
+template <class Key, class Hash>
+HashVector<Key, Hash> ConcurrentHashVector<Key, Hash>::toHashVector() const {
+    // the keys are added in index order so that the indices are preserved
+    return HashVector<Key, Hash>(toVector());
+}
@@ -26,6 +26,7 @@
  * @END LICENSE
  */
 
+#include <limits>
 #include <random>
 
 #include "helpers/davidson_liu_solver.h"
@@ -44,22 +45,16 @@ namespace forte {
 
 DavidsonLiuSolver::DavidsonLiuSolver(size_t size, size_t nroot, size_t collapse_per_root,
                                      size_t subspace_per_root)
-    : size_(size), nroot_(nroot), collapse_per_root_(collapse_per_root),
+    : EigenSolver(size, nroot), collapse_per_root_(collapse_per_root),
       subspace_per_root_(subspace_per_root) {
 
     startup();
 }
 
-size_t DavidsonLiuSolver::size() const { return size_; }
-
 void DavidsonLiuSolver::startup() {
     // sanity checks
     // collapse_per_root_ must greater than or equal to one. This guarantees that we have at least
     // one vector per root after the collapse
-    if (size_ == 0)
-        throw std::runtime_error("DavidsonLiuSolver called with space of dimension zero.");
-    if (nroot_ == 0)
-        throw std::runtime_error("DavidsonLiuSolver called with zero roots.");
     if (collapse_per_root_ < 1) {
         std::string msg =
             "DavidsonLiuSolver: collapse_per_root_ (" + std::to_string(collapse_per_root_) +
@@ -79,14 +74,7 @@ void DavidsonLiuSolver::startup() {
     collapse_size_ = std::min(collapse_per_root_ * nroot_, size_);
     subspace_size_ = std::min(subspace_per_root_ * nroot_, size_);
 
-    basis_size_ = 0; // start with no vectors
-    sigma_size_ = 0; // start with no vectors
-
-    // Vectors (here we store the vectors as row vectors)
-    temp_ = std::make_shared<psi::Matrix>("temp", subspace_size_, size_);
-    b_ = std::make_shared<psi::Matrix>("b", subspace_size_, size_);
-    r_ = std::make_shared<psi::Matrix>("r", subspace_size_, size_);
-    sigma_ = std::make_shared<psi::Matrix>("sigma", subspace_size_, size_);
+    allocate_subspace();
 
     // Subspace matrices/vector
     G_ = std::make_shared<psi::Matrix>("G", subspace_size_, subspace_size_);
@@ -99,6 +87,33 @@ void DavidsonLiuSolver::startup() {
     residual_2norm_.resize(nroot_, 0.0);
 }
 
+void DavidsonLiuSolver::allocate_subspace() {
+    basis_size_ = 0; // start with no vectors
+    sigma_size_ = 0; // start with no vectors
+
+    // Vectors (here we store the vectors as row vectors)
+    if (mixed_precision_) {
+        // The basis and sigma vectors are stored in single precision. Here we keep only the
+        // double precision buffers needed to form the residuals, the final eigenvectors, and to
+        // pass blocks of vectors to the sigma builder (this requires at least two rows in temp_)
+        temp_ = std::make_shared<psi::Matrix>("temp", std::max<size_t>(subspace_size_, 2), size_);
+        b_ = std::make_shared<psi::Matrix>("b", nroot_, size_);
+        r_ = std::make_shared<psi::Matrix>("r", nroot_, size_);
+        sigma_ = nullptr;
+        b_sp_.assign(subspace_size_ * size_, 0.0f);
+        sigma_sp_.assign(subspace_size_ * size_, 0.0f);
+    } else {
+        temp_ = std::make_shared<psi::Matrix>("temp", subspace_size_, size_);
+        b_ = std::make_shared<psi::Matrix>("b", subspace_size_, size_);
+        r_ = std::make_shared<psi::Matrix>("r", subspace_size_, size_);
+        sigma_ = std::make_shared<psi::Matrix>("sigma", subspace_size_, size_);
+        b_sp_.clear();
+        b_sp_.shrink_to_fit();
+        sigma_sp_.clear();
+        sigma_sp_.shrink_to_fit();
+    }
+}
+
 void DavidsonLiuSolver::print_table() {
     if (print_ < PrintLevel::Default)
         return;
@@ -116,53 +131,34 @@ void DavidsonLiuSolver::print_table() {
         {"Maximum number of iterations", max_iter_},
         {"Collapse subspace size", collapse_size_},
         {"Maximum subspace size", subspace_size_},
+        {"Sigma block size", sigma_block_size_},
     });
 
-    printer.add_string_data({{"Print level", to_string(print_)}});
+    printer.add_string_data({{"Print level", to_string(print_)},
+                             {"Subspace precision", mixed_precision_ ? "single" : "double"}});
 
     std::string table = printer.get_table("Davidson-Liu Solver");
     psi::outfile->Printf("%s", table.c_str());
 }
 
-void DavidsonLiuSolver::add_h_diag(std::shared_ptr<psi::Vector> h_diag) {
-    if (static_cast<size_t>(h_diag->dim()) != size_) {
-        std::string msg = "DavidsonLiuSolver: h_diag vector size (" +
-                          std::to_string(h_diag_->dim()) + ") must be equal to space size (" +
-                          std::to_string(size_) + ")";
-        throw std::runtime_error(msg);
-    }
-    if (h_diag_ == nullptr) {
-        h_diag_ = std::make_shared<psi::Vector>("h_diag", size_);
-    }
-    h_diag_->copy(*h_diag);
-}
-
-void DavidsonLiuSolver::add_guesses(const std::vector<sparse_vec>& guesses) { guesses_ = guesses; }
-
-void DavidsonLiuSolver::add_project_out_vectors(
-    const std::vector<sparse_vec>& project_out_vectors) {
-    project_out_vectors_ = project_out_vectors;
-}
-
-void DavidsonLiuSolver::add_sigma_builder(
-    std::function<void(std::span<double>, std::span<double>)> sigma_builder) {
-    sigma_builder_ = sigma_builder;
-}
-
 void DavidsonLiuSolver::reset() {
     basis_size_ = 0;
     sigma_size_ = 0;
     b_->zero();
-    sigma_->zero();
+    if (mixed_precision_) {
+        std::fill(b_sp_.begin(), b_sp_.end(), 0.0f);
+        std::fill(sigma_sp_.begin(), sigma_sp_.end(), 0.0f);
+    } else {
+        sigma_->zero();
+    }
 }
 
-void DavidsonLiuSolver::set_print_level(PrintLevel level) { print_ = level; }
-
-void DavidsonLiuSolver::set_e_convergence(double value) { e_convergence_ = value; }
-
-void DavidsonLiuSolver::set_r_convergence(double value) { r_convergence_ = value; }
-
-void DavidsonLiuSolver::set_maxiter(size_t n) { max_iter_ = n; }
+void DavidsonLiuSolver::set_mixed_precision(bool value) {
+    if (value != mixed_precision_) {
+        mixed_precision_ = value;
+        allocate_subspace();
+    }
+}
 
 std::shared_ptr<psi::Vector> DavidsonLiuSolver::eigenvalues() const { return lambda_; }
 
@@ -178,6 +174,9 @@ std::shared_ptr<psi::Vector> DavidsonLiuSolver::eigenvector(size_t n) const {
 }
 
 bool DavidsonLiuSolver::solve() {
+    iterations_ = 0;
+    num_sigma_vectors_ = 0;
+
     print_table();
 
     setup_guesses();
@@ -187,6 +186,7 @@ bool DavidsonLiuSolver::solve() {
     print_header();
 
     for (size_t iter = 0; iter < max_iter_; iter++) {
+        iterations_ = iter + 1;
         // ensure that the basis is orthonormal
         check_orthonormality();
 
@@ -203,7 +203,7 @@ bool DavidsonLiuSolver::solve() {
         form_correction_vectors();
 
         // 4. Project out undesired roots from the correction vectors
-        project_out_roots(r_);
+        project_out_rows(r_, nroot_);
 
         normalize_vectors(r_, nroot_);
 
@@ -229,7 +229,7 @@ bool DavidsonLiuSolver::solve() {
         // 8. Add the correction vectors to the basis (optionally collapsed) and orthonormalize
         // it. We add one vector per root, up to the subspace size
         auto num_to_add = std::min(nroot_, subspace_size_ - basis_size_);
-        auto added = add_rows_and_orthonormalize(b_, basis_size_, r_, num_to_add);
+        auto added = add_to_basis(basis_size_, r_, num_to_add);
         basis_size_ += added;
         auto missing = num_to_add - added;
 
@@ -239,8 +239,8 @@ bool DavidsonLiuSolver::solve() {
             psi::outfile->Printf(" <- added %d random vector%s", missing, missing > 1 ? "s" : "");
             temp_->zero();
             add_random_vectors(temp_, 0, missing);
-            project_out_roots(temp_);
-            auto random_added = add_rows_and_orthonormalize(b_, basis_size_, temp_, missing);
+            project_out_rows(temp_, nroot_);
+            auto random_added = add_to_basis(basis_size_, temp_, missing);
             basis_size_ += random_added;
             added += random_added;
         }
@@ -301,10 +301,10 @@ void DavidsonLiuSolver::setup_guesses() {
         auto should_be_added = std::max(nroot_, guesses_.size());
 
         // project out the unwanted roots
-        project_out_roots(temp_);
+        project_out_rows(temp_, nroot_);
 
         // orthonormalize what is left
-        auto added = add_rows_and_orthonormalize(b_, 0, temp_, should_be_added);
+        auto added = add_to_basis(0, temp_, should_be_added);
         if (added != should_be_added) {
             std::string msg = "DavidsonLiuSolver: guess vectors are zero or linearly dependent";
             throw std::runtime_error(msg);
@@ -314,6 +314,13 @@ void DavidsonLiuSolver::setup_guesses() {
         psi::outfile->Printf("\n\n  Davidson-Liu solver: restarting from previous calculation.");
         basis_size_ = nroot_; // first nroot_ vectors from the previous calculation
         sigma_size_ = 0;      // trigger computation of all sigma vectors
+        if (mixed_precision_) {
+            // the eigenvectors from the previous calculation are stored in b_
+            for (size_t k = 0; k < nroot_; k++) {
+                const auto b_k = b_->pointer()[k];
+                std::copy(b_k, b_k + size_, b_sp_.begin() + k * size_);
+            }
+        }
     } else {
         std::string msg =
             "DavidsonLiuSolver: number of guess vectors (" + std::to_string(guesses_.size()) +
@@ -322,20 +329,6 @@ void DavidsonLiuSolver::setup_guesses() {
     }
 }
 
-void DavidsonLiuSolver::preiteration_sanity_checks() {
-    // check that the sigma builder has been set
-    if (sigma_builder_ == nullptr) {
-        std::string msg = "DavidsonLiuSolver: sigma builder has not been set";
-        throw std::runtime_error(msg);
-    }
-
-    // ensure that h_diag was set
-    if (h_diag_ == nullptr) {
-        std::string msg = "DavidsonLiuSolver: h_diag has not been set";
-        throw std::runtime_error(msg);
-    }
-}
-
 void DavidsonLiuSolver::print_header() {
     if (print_ < PrintLevel::Default)
         return;
@@ -372,18 +365,66 @@ void DavidsonLiuSolver::print_iteration(size_t iter) {
 }
 
 void DavidsonLiuSolver::compute_sigma() {
-    for (size_t j = sigma_size_; j < basis_size_; j++) {
-        auto bj = b_->pointer()[j];
-        auto sigmaj = sigma_->pointer()[j];
-        sigma_builder_(std::span(bj, size_), std::span(sigmaj, size_));
+    // the basis vectors are passed to the sigma builder in blocks of at most max_block vectors.
+    // In mixed precision mode the vectors are promoted to double precision using the first
+    // max_block rows of temp_ for the basis and the next max_block rows for sigma
+    size_t max_block = sigma_block_size_ > 0 ? sigma_block_size_ : basis_size_;
+    if (mixed_precision_) {
+        max_block = std::max<size_t>(1, std::min<size_t>(max_block, temp_->nrow() / 2));
+    }
+    for (size_t j = sigma_size_; j < basis_size_; j += max_block) {
+        const size_t nvec = std::min(max_block, basis_size_ - j);
+        if (mixed_precision_) {
+            auto b_block = temp_->pointer()[0];
+            auto sigma_block = temp_->pointer()[nvec];
+            std::copy(b_sp_.begin() + j * size_, b_sp_.begin() + (j + nvec) * size_, b_block);
+            block_sigma_builder_(nvec, std::span(b_block, nvec * size_),
+                                 std::span(sigma_block, nvec * size_));
+            std::copy(sigma_block, sigma_block + nvec * size_, sigma_sp_.begin() + j * size_);
+        } else {
+            auto b_block = b_->pointer()[j];
+            auto sigma_block = sigma_->pointer()[j];
+            block_sigma_builder_(nvec, std::span(b_block, nvec * size_),
+                                 std::span(sigma_block, nvec * size_));
+        }
     }
     // update the number of sigma vectors
+    num_sigma_vectors_ += basis_size_ - sigma_size_;
     sigma_size_ = basis_size_;
-    debug([&]() { sigma_->print(); });
+    debug([&]() {
+        if (sigma_)
+            sigma_->print();
+    });
 }
 
 void DavidsonLiuSolver::form_and_diagonalize_effective_hamiltonian() {
-    G_->gemm(false, true, 1.0, b_, sigma_, 0.0);
+    if (mixed_precision_) {
+        // Form G = b sigma^T and S = b b^T accumulating in double precision
+        G_->zero();
+        S_->zero();
+        const auto n = basis_size_;
+        const auto size = size_;
+        auto G_p = G_->pointer();
+        auto S_p = S_->pointer();
+#pragma omp parallel for schedule(dynamic)
+        for (size_t ij = 0; ij < n * n; ij++) {
+            const size_t i = ij / n;
+            const size_t j = ij % n;
+            const float* b_i = b_sp_.data() + i * size;
+            const float* b_j = b_sp_.data() + j * size;
+            const float* sigma_j = sigma_sp_.data() + j * size;
+            double g_ij = 0.0;
+            double s_ij = 0.0;
+            for (size_t I = 0; I < size; I++) {
+                g_ij += static_cast<double>(b_i[I]) * static_cast<double>(sigma_j[I]);
+                s_ij += static_cast<double>(b_i[I]) * static_cast<double>(b_j[I]);
+            }
+            G_p[i][j] = g_ij;
+            S_p[i][j] = s_ij;
+        }
+    } else {
+        G_->gemm(false, true, 1.0, b_, sigma_, 0.0);
+    }
     G_->hermitivitize();
     // Here we need to copy the matrix to a new one because the diagonalize function will
     // otherwise include zero eigenvalues, which we do not want
@@ -396,7 +437,26 @@ void DavidsonLiuSolver::form_and_diagonalize_effective_hamiltonian() {
             Gb_->set(i, j, G_->get(i, j));
         }
     }
-    Gb_->diagonalize(alpha_b_, lambda_b_);
+    if (mixed_precision_) {
+        // The single precision basis is only orthonormal to within rounding errors, so here we
+        // solve the generalized eigenvalue problem G alpha = S alpha lambda via Lowdin
+        // orthogonalization, X = S^(-1/2), G' = X G X, alpha = X alpha'
+        auto X = std::make_shared<psi::Matrix>("X", basis_size_, basis_size_);
+        for (size_t i = 0; i < basis_size_; i++) {
+            for (size_t j = 0; j < basis_size_; j++) {
+                X->set(i, j, 0.5 * (S_->get(i, j) + S_->get(j, i)));
+            }
+        }
+        X->power(-0.5);
+        auto XG = psi::linalg::doublet(X, Gb_, false, false);
+        Gb_->gemm(false, false, 1.0, XG, X, 0.0);
+        Gb_->hermitivitize();
+        auto alpha_prime = std::make_shared<psi::Matrix>("alpha'", basis_size_, basis_size_);
+        Gb_->diagonalize(alpha_prime, lambda_b_);
+        alpha_b_->gemm(false, false, 1.0, X, alpha_prime, 0.0);
+    } else {
+        Gb_->diagonalize(alpha_b_, lambda_b_);
+    }
     alpha_->zero();
     for (size_t i = 0; i < basis_size_; i++) {
         for (size_t j = 0; j < basis_size_; j++) {
@@ -415,8 +475,8 @@ void DavidsonLiuSolver::form_residual_vectors() {
     debug([&]() { h_diag_->print(); });
     debug([&]() { alpha_->print(); });
 
-    r_->gemm(true, false, 1.0, alpha_, sigma_, 0.0);
-    temp_->gemm(true, false, 1.0, alpha_, b_, 0.0);
+    rotate_subspace(r_, nroot_, true);
+    rotate_subspace(temp_, nroot_, false);
 
     for (size_t k = 0; k < nroot_; k++) { // loop over roots
         const auto lambda_k = lambda_->get(k);
@@ -489,7 +549,7 @@ void DavidsonLiuSolver::get_results() {
     // copy the eigenvalues
     lambda_old_->copy(*lambda_);
     // generate final eigenvectors
-    temp_->gemm(true, false, 1.0, alpha_, b_, 0.0);
+    rotate_subspace(temp_, nroot_, false);
     b_->zero();
     auto added = add_rows_and_orthonormalize(b_, 0, temp_, nroot_);
     if (added != nroot_) {
@@ -500,24 +560,6 @@ void DavidsonLiuSolver::get_results() {
     }
 }
 
-void DavidsonLiuSolver::set_vector(std::shared_ptr<psi::Matrix> M,
-                                   const std::vector<sparse_vec>& vecs) {
-    // check that we were passed less vectors than the subspace size
-    if (vecs.size() > static_cast<size_t>(M->nrow())) {
-        std::string msg = "DavidsonLiuSolver: size of vecs (" + std::to_string(vecs.size()) +
-                          ") must be less or equal to matrix size (" + std::to_string(M->nrow()) +
-                          ")";
-        throw std::runtime_error(msg);
-    }
-    M->zero();
-    for (size_t k = 0; const auto& vec : vecs) {
-        for (const auto& [I, CI] : vec) {
-            M->set(k, I, CI);
-        }
-        k++;
-    }
-}
-
 size_t DavidsonLiuSolver::add_random_vectors(std::shared_ptr<psi::Matrix> A, size_t rowsA,
                                              size_t n) {
     std::random_device rd;
@@ -560,18 +602,32 @@ void DavidsonLiuSolver::subspace_collapse() {
         throw std::runtime_error(msg);
     }
     debug([&]() { b_->print(); });
-    debug([&]() { sigma_->print(); });
+    debug([&]() {
+        if (sigma_)
+            sigma_->print();
+    });
 }
 
 size_t DavidsonLiuSolver::collapse_vectors(size_t collapsable_size) {
     // collapse the basis vectors
-    temp_->gemm(true, false, 1.0, alpha_, b_, 0.0);
-    b_->zero();
-    auto added = add_rows_and_orthonormalize(b_, 0, temp_, collapsable_size);
+    rotate_subspace(temp_, collapsable_size, false);
+    if (mixed_precision_) {
+        std::fill(b_sp_.begin(), b_sp_.end(), 0.0f);
+    } else {
+        b_->zero();
+    }
+    auto added = add_to_basis(0, temp_, collapsable_size);
 
     // collapse the sigma vectors
-    temp_->gemm(true, false, 1.0, alpha_, sigma_, 0.0);
-    sigma_->copy(*temp_);
+    rotate_subspace(temp_, collapsable_size, true);
+    if (mixed_precision_) {
+        for (size_t k = 0; k < collapsable_size; k++) {
+            const auto temp_k = temp_->pointer()[k];
+            std::copy(temp_k, temp_k + size_, sigma_sp_.begin() + k * size_);
+        }
+    } else {
+        sigma_->copy(*temp_);
+    }
 
     if (added != collapsable_size) {
         std::string msg = "DavidsonLiuSolver: collapse_vectors generated less vectors (" +
@@ -587,19 +643,83 @@ size_t DavidsonLiuSolver::collapse_vectors(size_t collapsable_size) {
     return added;
 }
 
-void DavidsonLiuSolver::project_out_roots(std::shared_ptr<psi::Matrix> v) {
-    for (size_t k = 0; k < nroot_; k++) {
-        auto v_k = v->pointer()[k];
-        for (auto& bad_root : project_out_vectors_) {
-            double overlap = 0.0;
-            for (const auto& [I, CI] : bad_root) {
-                overlap += v_k[I] * CI;
-            }
-            for (const auto& [I, CI] : bad_root) {
-                v_k[I] -= overlap * CI;
+void DavidsonLiuSolver::rotate_subspace(std::shared_ptr<psi::Matrix> out, size_t n, bool sigma) {
+    if (not mixed_precision_) {
+        out->gemm(true, false, 1.0, alpha_, sigma ? sigma_ : b_, 0.0);
+        return;
+    }
+    const auto& v = sigma ? sigma_sp_ : b_sp_;
+    const auto nbasis = basis_size_;
+    const auto size = size_;
+    auto alpha_p = alpha_->pointer();
+    for (size_t k = 0; k < n; k++) {
+        auto out_k = out->pointer()[k];
+#pragma omp parallel for
+        for (size_t I = 0; I < size; I++) {
+            double value = 0.0;
+            for (size_t i = 0; i < nbasis; i++) {
+                value += alpha_p[i][k] * static_cast<double>(v[i * size + I]);
             }
+            out_k[I] = value;
+        }
+    }
+}
+
+size_t DavidsonLiuSolver::add_to_basis(size_t rows_basis, std::shared_ptr<psi::Matrix> B,
+                                       size_t rowsB) {
+    if (not mixed_precision_) {
+        return add_rows_and_orthonormalize(b_, rows_basis, B, rowsB);
+    }
+    if (rows_basis + rowsB > subspace_size_) {
+        std::string msg = "DavidsonLiuSolver: rows_basis + rowsB (" +
+                          std::to_string(rows_basis + rowsB) +
+                          ") must be less or equal to the subspace size (" +
+                          std::to_string(subspace_size_) + ")";
+        throw std::runtime_error(msg);
+    }
+    size_t added = 0;
+    for (size_t j = 0; j < rowsB; j++) {
+        if (add_row_and_orthonormalize_sp(rows_basis + added, B->pointer()[j])) {
+            added++;
         }
     }
+    return added;
+}
+
+bool DavidsonLiuSolver::add_row_and_orthonormalize_sp(size_t rows_basis, const double* b) {
+    // The orthonormalization is done in double precision against the stored single precision
+    // vectors. Only the final vector is rounded to single precision
+    std::vector<double> v(b, b + size_);
+    int max_orthogonalization_cycles = 10;
+    for (int cycle = 0; cycle < max_orthogonalization_cycles; cycle++) {
+        for (size_t i = 0; i < rows_basis; i++) {
+            const float* b_i = b_sp_.data() + i * size_;
+            double dotval = 0.0;
+            for (size_t I = 0; I < size_; I++)
+                dotval += static_cast<double>(b_i[I]) * v[I];
+            for (size_t I = 0; I < size_; I++)
+                v[I] -= dotval * static_cast<double>(b_i[I]);
+        }
+        const auto normval = std::sqrt(psi::C_DDOT(size_, v.data(), 1, v.data(), 1));
+        if (normval < schmidt_discard_threshold_)
+            return false;
+        for (size_t I = 0; I < size_; I++)
+            v[I] *= 1. / normval;
+
+        double max_overlap = 0.0;
+        for (size_t i = 0; i < rows_basis; i++) {
+            const float* b_i = b_sp_.data() + i * size_;
+            double dotval = 0.0;
+            for (size_t I = 0; I < size_; I++)
+                dotval += static_cast<double>(b_i[I]) * v[I];
+            max_overlap = std::max(max_overlap, std::fabs(dotval));
+        }
+        if (max_overlap < schmidt_orthogonality_threshold_) {
+            std::copy(v.begin(), v.end(), b_sp_.begin() + rows_basis * size_);
+            return true;
+        }
+    }
+    return false;
 }
 
 size_t DavidsonLiuSolver::add_rows_and_orthonormalize(std::shared_ptr<psi::Matrix> A, size_t rowsA,
@@ -691,7 +811,25 @@ void DavidsonLiuSolver::check_orthonormality() {
     double orthogonality_threshold = schmidt_orthogonality_threshold_ * 3.0;
 
     // Compute the overlap matrix
-    S_->gemm(false, true, 1.0, b_, b_, 0.0);
+    if (mixed_precision_) {
+        // rounding the basis to single precision introduces errors of the order of the float
+        // machine epsilon, which are accounted for in the Rayleigh-Ritz step
+        orthogonality_threshold = 1000.0 * std::numeric_limits<float>::epsilon();
+        S_->zero();
+        for (size_t i = 0; i < basis_size_; ++i) {
+            for (size_t j = 0; j <= i; ++j) {
+                const float* b_i = b_sp_.data() + i * size_;
+                const float* b_j = b_sp_.data() + j * size_;
+                double s_ij = 0.0;
+                for (size_t I = 0; I < size_; I++)
+                    s_ij += static_cast<double>(b_i[I]) * static_cast<double>(b_j[I]);
+                S_->set(i, j, s_ij);
+                S_->set(j, i, s_ij);
+            }
+        }
+    } else {
+        S_->gemm(false, true, 1.0, b_, b_, 0.0);
+    }
 
     // Check for normalization
     double maxdiag = 0.0;
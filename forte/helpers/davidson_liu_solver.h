@@ -37,6 +37,7 @@
 #include "psi4/libmints/vector.h"
 #include "psi4/libmints/matrix.h"
 
+#include "helpers/eigen_solver.h"
 #include "helpers/printing.h"
 
 namespace psi {
@@ -49,80 +50,44 @@ namespace forte {
 /// @brief A class to solve the symmetric eigenvalue problem using the Davidson-Liu algorithm
 /// @details This class implements the Davidson-Liu algorithm to solve the symmetric eigenvalue
 /// problem.
-class DavidsonLiuSolver {
-    using sparse_vec = std::vector<std::pair<size_t, double>>;
-
+class DavidsonLiuSolver : public EigenSolver {
   public:
     DavidsonLiuSolver(size_t size, size_t nroot, size_t set_collapse_per_root = 1,
                       size_t set_subspace_per_root = 5);
 
-    /// Setup the solver
-    void add_sigma_builder(std::function<void(std::span<double>, std::span<double>)> sigma_builder);
-    void add_h_diag(std::shared_ptr<psi::Vector> h_diag);
-    void add_guesses(const std::vector<sparse_vec>& guesses);
-    void add_project_out_vectors(const std::vector<sparse_vec>& project_out_vectors);
-
-    /// Set the print level
-    void set_print_level(PrintLevel level);
-    /// Set the energy convergence
-    void set_e_convergence(double value);
-    /// Set the residual convergence
-    void set_r_convergence(double value);
-    /// Set the maximum number of iterations
-    void set_maxiter(size_t value);
+    /// Store the basis and sigma vectors in single precision. The Rayleigh-Ritz step and the
+    /// residuals are still computed in double precision. Changing this option resets the solver.
+    void set_mixed_precision(bool value);
 
     /// Function to reset the solver
-    void reset();
+    void reset() override;
 
     /// @brief The main solver function
     /// @return true if the solver converged
-    bool solve();
+    bool solve() override;
 
-    size_t size() const;
+    /// The name of the algorithm
+    std::string name() const override { return "DavidsonLiuSolver"; }
 
     /// Return the eigenvalues
-    std::shared_ptr<psi::Vector> eigenvalues() const;
+    std::shared_ptr<psi::Vector> eigenvalues() const override;
     /// Return the eigenvectors
-    std::shared_ptr<psi::Matrix> eigenvectors() const;
+    std::shared_ptr<psi::Matrix> eigenvectors() const override;
     /// Return the n-th eigenvector
-    std::shared_ptr<psi::Vector> eigenvector(size_t n) const;
+    std::shared_ptr<psi::Vector> eigenvector(size_t n) const override;
 
   private:
     // ==> Class Private Data <==
 
     // Passed in by the user at construction
 
-    /// The dimension of the vectors
-    const size_t size_;
-    /// The number of roots requested
-    const size_t nroot_;
     /// The number of collapse vectors for each root
     const size_t collapse_per_root_;
     /// The maximum subspace size for each root
     const size_t subspace_per_root_;
 
-    // Passed in by the user at setup
-    /// The sigma builder function
-    std::function<void(std::span<double>, std::span<double>)> sigma_builder_;
-    /// Diagonal elements of the Hamiltonian
-    std::shared_ptr<psi::Vector> h_diag_;
-    /// The initial guess
-    std::vector<sparse_vec> guesses_;
-    /// The vectors to project out
-    std::vector<sparse_vec> project_out_vectors_;
-
-    /// The print level
-    PrintLevel print_ = PrintLevel::Default;
-    /// The maximum number of iterations
-    size_t max_iter_ = 50;
-    /// Eigenvalue convergence threshold
-    double e_convergence_ = 1.0e-12;
-    /// Residual convergence threshold
-    double r_convergence_ = 1.0e-6;
-    /// The threshold used to discard correction vectors
-    double schmidt_discard_threshold_ = 1.0e-7;
-    /// The threshold used to guarantee orthogonality among the roots
-    double schmidt_orthogonality_threshold_ = 1.0e-12;
+    /// Store the basis and sigma vectors in single precision?
+    bool mixed_precision_ = false;
     /// The number of vectors to retain after collapse
     size_t collapse_size_;
     /// The maximum subspace size
@@ -134,8 +99,13 @@ class DavidsonLiuSolver {
 
     /// A matrix to store temporary results
     std::shared_ptr<psi::Matrix> temp_;
-    /// Current set of basis vectors stored by row
+    /// Current set of basis vectors stored by row. In mixed precision mode this matrix only holds
+    /// the final eigenvectors (nroot rows) and the basis is stored in b_sp_
     std::shared_ptr<psi::Matrix> b_;
+    /// Basis vectors stored by row in single precision (mixed precision mode only)
+    std::vector<float> b_sp_;
+    /// Sigma vectors stored by row in single precision (mixed precision mode only)
+    std::vector<float> sigma_sp_;
     /// Residual eigenvectors, stored by row
     std::shared_ptr<psi::Matrix> r_;
     /// Sigma vectors, stored by row
@@ -156,15 +126,15 @@ class DavidsonLiuSolver {
     /// Allocate memory for the solver
     void startup();
 
+    /// Allocate the memory used to store the basis and sigma vectors
+    void allocate_subspace();
+
     /// Print the solver variables
     void print_table();
 
     /// Set the initial guesses
     void setup_guesses();
 
-    /// Run sanity checks before the iteration starts
-    void preiteration_sanity_checks();
-
     /// Print the header of the iteration table
     void print_header();
     /// Print the current iteration
@@ -205,6 +175,26 @@ class DavidsonLiuSolver {
     /// Perform the actual collapse
     size_t collapse_vectors(size_t collapsable_size);
 
+    /// @brief Form the first n linear combinations of the basis (or sigma) vectors defined by the
+    /// columns of alpha_, out_k = sum_i alpha_ik v_i
+    /// @param out the matrix where the vectors are stored
+    /// @param n the number of vectors to form
+    /// @param sigma if true rotate the sigma vectors, otherwise the basis vectors
+    void rotate_subspace(std::shared_ptr<psi::Matrix> out, size_t n, bool sigma);
+
+    /// @brief Add rows to the basis and orthonormalize them
+    /// @param rows_basis the number of basis vectors (assumed to be orthonormal)
+    /// @param B the matrix containing the rows to add
+    /// @param rowsB the number of rows in B to add
+    /// @return the number of rows added to the basis
+    size_t add_to_basis(size_t rows_basis, std::shared_ptr<psi::Matrix> B, size_t rowsB);
+
+    /// @brief Add one row to the single precision basis and orthonormalize it
+    /// @param rows_basis the number of basis vectors (assumed to be orthonormal)
+    /// @param b a pointer to the vector to add
+    /// @return true if the vector was added to the basis
+    bool add_row_and_orthonormalize_sp(size_t rows_basis, const double* b);
+
     /// Add random rows to a matrix
     /// @param A the matrix to add the rows to
     /// @param rowsA the rows of A where we can add the new rows
@@ -214,9 +204,6 @@ class DavidsonLiuSolver {
     /// Check that the eigenvectors are orthonormal. Here we throw if the check fails
     void check_orthonormality();
 
-    /// Project out undesired roots from a matrix
-    void project_out_roots(std::shared_ptr<psi::Matrix> v);
-
     /// @brief Add rows to a matrix and orthonormalize them
     /// @param A the matrix to add the rows to
     /// @param rowsA the number of rows in A (assumed to be orthonormal)
@@ -234,9 +221,6 @@ class DavidsonLiuSolver {
     /// @return the if this row was added to A
     bool add_row_and_orthonormalize(std::shared_ptr<psi::Matrix> A, size_t rowsA,
                                     std::shared_ptr<psi::Matrix> B, size_t rowB);
-
-    /// Set a dense matrix from a vector of sparse vectors
-    void set_vector(std::shared_ptr<psi::Matrix> M, const std::vector<sparse_vec>& vecs);
 };
 
 } // namespace forte
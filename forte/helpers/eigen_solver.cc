@@ -0,0 +1,292 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+#include "psi4/libqt/qt.h"
+#include "psi4/libmints/vector.h"
+#include "psi4/libmints/matrix.h"
+
+#include "helpers/davidson_liu_solver.h"
+#include "helpers/lanczos_solver.h"
+#include "helpers/lobpcg_solver.h"
+
+#include "helpers/eigen_solver.h"
+
+namespace forte {
+
+EigenSolver::EigenSolver(size_t size, size_t nroot) : size_(size), nroot_(nroot) {
+    if (size_ == 0)
+        throw std::runtime_error("EigenSolver called with space of dimension zero.");
+    if (nroot_ == 0)
+        throw std::runtime_error("EigenSolver called with zero roots.");
+}
+
+size_t EigenSolver::size() const { return size_; }
+
+size_t EigenSolver::iterations() const { return iterations_; }
+
+size_t EigenSolver::num_sigma_vectors() const { return num_sigma_vectors_; }
+
+void EigenSolver::add_h_diag(std::shared_ptr<psi::Vector> h_diag) {
+    if (static_cast<size_t>(h_diag->dim()) != size_) {
+        std::string msg = name() + ": h_diag vector size (" + std::to_string(h_diag->dim()) +
+                          ") must be equal to space size (" + std::to_string(size_) + ")";
+        throw std::runtime_error(msg);
+    }
+    if (h_diag_ == nullptr) {
+        h_diag_ = std::make_shared<psi::Vector>("h_diag", size_);
+    }
+    h_diag_->copy(*h_diag);
+}
+
+void EigenSolver::add_guesses(const std::vector<sparse_vec>& guesses) { guesses_ = guesses; }
+
+void EigenSolver::add_project_out_vectors(const std::vector<sparse_vec>& project_out_vectors) {
+    project_out_vectors_ = project_out_vectors;
+}
+
+void EigenSolver::add_sigma_builder(
+    std::function<void(std::span<double>, std::span<double>)> sigma_builder) {
+    // wrap the single-vector sigma builder into a block sigma builder
+    auto size = size_;
+    block_sigma_builder_ = [sigma_builder, size](size_t nvec, std::span<double> b,
+                                                 std::span<double> sigma) {
+        for (size_t k = 0; k < nvec; k++) {
+            sigma_builder(b.subspan(k * size, size), sigma.subspan(k * size, size));
+        }
+    };
+}
+
+void EigenSolver::add_block_sigma_builder(block_sigma_builder_t block_sigma_builder) {
+    block_sigma_builder_ = block_sigma_builder;
+}
+
+void EigenSolver::set_print_level(PrintLevel level) { print_ = level; }
+
+void EigenSolver::set_e_convergence(double value) { e_convergence_ = value; }
+
+void EigenSolver::set_r_convergence(double value) { r_convergence_ = value; }
+
+void EigenSolver::set_maxiter(size_t n) { max_iter_ = n; }
+
+void EigenSolver::set_sigma_block_size(size_t n) { sigma_block_size_ = n; }
+
+std::shared_ptr<psi::Vector> EigenSolver::eigenvector(size_t n) const {
+    const auto v_n = eigenvectors()->pointer()[n];
+    auto evec = std::make_shared<psi::Vector>("V", size_);
+    for (size_t I = 0; I < size_; I++) {
+        evec->set(I, v_n[I]);
+    }
+    return evec;
+}
+
+void EigenSolver::preiteration_sanity_checks() {
+    // check that the sigma builder has been set
+    if (block_sigma_builder_ == nullptr) {
+        std::string msg = name() + ": sigma builder has not been set";
+        throw std::runtime_error(msg);
+    }
+
+    // ensure that h_diag was set
+    if (h_diag_ == nullptr) {
+        std::string msg = name() + ": h_diag has not been set";
+        throw std::runtime_error(msg);
+    }
+}
+
+void EigenSolver::compute_sigma_rows(std::shared_ptr<psi::Matrix> b,
+                                     std::shared_ptr<psi::Matrix> sigma, size_t first,
+                                     size_t last) {
+    const size_t max_block = sigma_block_size_ > 0 ? sigma_block_size_ : last - first;
+    for (size_t j = first; j < last; j += max_block) {
+        const size_t nvec = std::min(max_block, last - j);
+        block_sigma_builder_(nvec, std::span(b->pointer()[j], nvec * size_),
+                             std::span(sigma->pointer()[j], nvec * size_));
+    }
+    num_sigma_vectors_ += last - first;
+}
+
+void EigenSolver::set_vector(std::shared_ptr<psi::Matrix> M, const std::vector<sparse_vec>& vecs) {
+    // check that we were passed less vectors than the subspace size
+    if (vecs.size() > static_cast<size_t>(M->nrow())) {
+        std::string msg = name() + ": size of vecs (" + std::to_string(vecs.size()) +
+                          ") must be less or equal to matrix size (" + std::to_string(M->nrow()) +
+                          ")";
+        throw std::runtime_error(msg);
+    }
+    M->zero();
+    for (size_t k = 0; const auto& vec : vecs) {
+        for (const auto& [I, CI] : vec) {
+            M->set(k, I, CI);
+        }
+        k++;
+    }
+}
+
+void EigenSolver::project_out_rows(std::shared_ptr<psi::Matrix> v, size_t n, size_t first) {
+    for (size_t k = first; k < first + n; k++) {
+        auto v_k = v->pointer()[k];
+        for (auto& bad_root : project_out_vectors_) {
+            double overlap = 0.0;
+            for (const auto& [I, CI] : bad_root) {
+                overlap += v_k[I] * CI;
+            }
+            for (const auto& [I, CI] : bad_root) {
+                v_k[I] -= overlap * CI;
+            }
+        }
+    }
+}
+
+void EigenSolver::random_rows(std::shared_ptr<psi::Matrix> M, size_t n) {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<> dist(-1.0, 1.0);
+    for (size_t j = 0; j < n; j++) {
+        auto v = M->pointer()[j];
+        for (size_t I = 0; I < size_; I++) {
+            v[I] = dist(gen); // Random number between -1 and 1
+        }
+    }
+}
+
+bool EigenSolver::orthonormalize(std::shared_ptr<psi::Matrix> A, size_t rowsA, double* v,
+                                 std::shared_ptr<psi::Matrix> sigma_A, double* sigma_v) const {
+    const size_t ncols = size_;
+    const bool track_sigma = (sigma_A != nullptr) and (sigma_v != nullptr);
+    // here we do the schmidt orthogonalization several times. Often, one step is enough
+    // but sometimes it takes more than one step to guarantee orthogonality to within
+    // a tight tolerance. The option that controls this is schmidt_orthogonality_threshold_
+    int max_orthogonalization_cycles = 10;
+    for (int cycle = 0; cycle < max_orthogonalization_cycles; cycle++) {
+        for (size_t i = 0; i < rowsA; i++) {
+            auto Ai = A->pointer()[i];
+            const auto dotval = psi::C_DDOT(ncols, Ai, 1, v, 1);
+            for (size_t I = 0; I < ncols; I++)
+                v[I] -= dotval * Ai[I];
+            if (track_sigma) {
+                auto sigma_Ai = sigma_A->pointer()[i];
+                for (size_t I = 0; I < ncols; I++)
+                    sigma_v[I] -= dotval * sigma_Ai[I];
+            }
+        }
+        // compute the norm of the vector
+        const auto normval = std::sqrt(psi::C_DDOT(ncols, v, 1, v, 1));
+
+        // if the norm is small, discard the vector
+        if (normval < schmidt_discard_threshold_)
+            return false;
+        // normalize the vector
+        for (size_t I = 0; I < ncols; I++)
+            v[I] *= 1. / normval;
+        if (track_sigma) {
+            for (size_t I = 0; I < ncols; I++)
+                sigma_v[I] *= 1. / normval;
+        }
+
+        // check the overlap with the previous vectors
+        double max_overlap = 0.0;
+        for (size_t i = 0; i < rowsA; i++) {
+            auto Ai = A->pointer()[i];
+            max_overlap = std::max(max_overlap, std::fabs(psi::C_DDOT(ncols, Ai, 1, v, 1)));
+        }
+        if (max_overlap < schmidt_orthogonality_threshold_) {
+            return true;
+        }
+    }
+    // if we did not converge, return false
+    return false;
+}
+
+std::pair<std::shared_ptr<psi::Vector>, std::shared_ptr<psi::Matrix>>
+EigenSolver::rayleigh_ritz(std::shared_ptr<psi::Matrix> Q, std::shared_ptr<psi::Matrix> sigma_Q,
+                           size_t n) {
+    auto G = std::make_shared<psi::Matrix>("G", n, n);
+    auto alpha = std::make_shared<psi::Matrix>("alpha", n, n);
+    auto lambda = std::make_shared<psi::Vector>("lambda", n);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j <= i; j++) {
+            const double g_ij =
+                0.5 * (psi::C_DDOT(size_, Q->pointer()[i], 1, sigma_Q->pointer()[j], 1) +
+                       psi::C_DDOT(size_, Q->pointer()[j], 1, sigma_Q->pointer()[i], 1));
+            G->set(i, j, g_ij);
+            G->set(j, i, g_ij);
+        }
+    }
+    G->diagonalize(alpha, lambda);
+    return std::make_pair(lambda, alpha);
+}
+
+void EigenSolver::linear_combination(std::shared_ptr<psi::Matrix> Q,
+                                     std::shared_ptr<psi::Matrix> C, size_t first, size_t last,
+                                     size_t m, std::shared_ptr<psi::Matrix> out) {
+    auto C_p = C->pointer();
+    for (size_t k = 0; k < m; k++) {
+        auto out_k = out->pointer()[k];
+        std::fill(out_k, out_k + size_, 0.0);
+        for (size_t j = first; j < last; j++) {
+            const double c_jk = C_p[j][k];
+            const auto Q_j = Q->pointer()[j];
+            for (size_t I = 0; I < size_; I++) {
+                out_k[I] += c_jk * Q_j[I];
+            }
+        }
+    }
+}
+
+EigenSolverType string_to_eigen_solver_type(std::string type) {
+    if (type == "DL") {
+        return EigenSolverType::DavidsonLiu;
+    } else if (type == "LOBPCG") {
+        return EigenSolverType::LOBPCG;
+    } else if (type == "LANCZOS") {
+        return EigenSolverType::Lanczos;
+    }
+    throw std::runtime_error("string_to_eigen_solver_type() called with incorrect type: " + type);
+    return EigenSolverType::DavidsonLiu;
+}
+
+std::shared_ptr<EigenSolver> make_eigen_solver(EigenSolverType type, size_t size, size_t nroot,
+                                               size_t collapse_per_root,
+                                               size_t subspace_per_root) {
+    std::shared_ptr<EigenSolver> solver;
+    if (type == EigenSolverType::DavidsonLiu) {
+        solver = std::make_shared<DavidsonLiuSolver>(size, nroot, collapse_per_root,
+                                                     subspace_per_root);
+    } else if (type == EigenSolverType::LOBPCG) {
+        solver = std::make_shared<LOBPCGSolver>(size, nroot);
+    } else if (type == EigenSolverType::Lanczos) {
+        solver = std::make_shared<LanczosSolver>(size, nroot, collapse_per_root, subspace_per_root);
+    }
+    return solver;
+}
+
+} // namespace forte
@@ -0,0 +1,213 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "helpers/printing.h"
+
+namespace psi {
+class Vector;
+class Matrix;
+} // namespace psi
+
+namespace forte {
+
+enum class EigenSolverType { DavidsonLiu, LOBPCG, Lanczos };
+
+/// @brief Base class for the iterative solvers of the symmetric eigenvalue problem
+/// @details This class holds the setup shared by all the solvers (sigma builder, diagonal of the
+/// Hamiltonian, guesses, vectors to project out, and convergence parameters). Derived classes
+/// implement the iterative procedure.
+class EigenSolver {
+  public:
+    using sparse_vec = std::vector<std::pair<size_t, double>>;
+    /// The type of a function that computes sigma vectors for a block of nvec basis vectors.
+    /// The basis vectors (b) and the sigma vectors (sigma) are stored contiguously by row, that
+    /// is, the k-th vector occupies the elements [k * size, (k + 1) * size) of each span.
+    using block_sigma_builder_t =
+        std::function<void(size_t nvec, std::span<double> b, std::span<double> sigma)>;
+
+    EigenSolver(size_t size, size_t nroot);
+
+    /// Virtual destructor to enable deletion of a Derived* through a Base*
+    virtual ~EigenSolver() = default;
+
+    /// Setup the solver
+    void add_sigma_builder(std::function<void(std::span<double>, std::span<double>)> sigma_builder);
+    /// Add a function that computes the sigma vectors for a block of basis vectors
+    void add_block_sigma_builder(block_sigma_builder_t block_sigma_builder);
+    void add_h_diag(std::shared_ptr<psi::Vector> h_diag);
+    void add_guesses(const std::vector<sparse_vec>& guesses);
+    void add_project_out_vectors(const std::vector<sparse_vec>& project_out_vectors);
+
+    /// Set the print level
+    void set_print_level(PrintLevel level);
+    /// Set the energy convergence
+    void set_e_convergence(double value);
+    /// Set the residual convergence
+    void set_r_convergence(double value);
+    /// Set the maximum number of iterations
+    void set_maxiter(size_t value);
+    /// Set the maximum number of vectors passed to the sigma builder in one call (0 = no limit)
+    void set_sigma_block_size(size_t value);
+
+    /// Function to reset the solver
+    virtual void reset() = 0;
+
+    /// @brief The main solver function
+    /// @return true if the solver converged
+    virtual bool solve() = 0;
+
+    /// The name of the algorithm
+    virtual std::string name() const = 0;
+
+    size_t size() const;
+
+    /// Return the number of iterations performed in the last call to solve()
+    size_t iterations() const;
+    /// Return the number of sigma vectors computed in the last call to solve()
+    size_t num_sigma_vectors() const;
+
+    /// Return the eigenvalues
+    virtual std::shared_ptr<psi::Vector> eigenvalues() const = 0;
+    /// Return the eigenvectors
+    virtual std::shared_ptr<psi::Matrix> eigenvectors() const = 0;
+    /// Return the n-th eigenvector
+    virtual std::shared_ptr<psi::Vector> eigenvector(size_t n) const;
+
+  protected:
+    // ==> Class Protected Data <==
+
+    // Passed in by the user at construction
+
+    /// The dimension of the vectors
+    const size_t size_;
+    /// The number of roots requested
+    const size_t nroot_;
+
+    // Passed in by the user at setup
+    /// The block sigma builder function
+    block_sigma_builder_t block_sigma_builder_;
+    /// Diagonal elements of the Hamiltonian
+    std::shared_ptr<psi::Vector> h_diag_;
+    /// The initial guess
+    std::vector<sparse_vec> guesses_;
+    /// The vectors to project out
+    std::vector<sparse_vec> project_out_vectors_;
+
+    /// The print level
+    PrintLevel print_ = PrintLevel::Default;
+    /// The maximum number of iterations
+    size_t max_iter_ = 50;
+    /// The maximum number of vectors passed to the sigma builder in one call (0 = no limit)
+    size_t sigma_block_size_ = 0;
+    /// Eigenvalue convergence threshold
+    double e_convergence_ = 1.0e-12;
+    /// Residual convergence threshold
+    double r_convergence_ = 1.0e-6;
+    /// The number of iterations performed in the last call to solve()
+    size_t iterations_ = 0;
+    /// The number of sigma vectors computed in the last call to solve()
+    size_t num_sigma_vectors_ = 0;
+
+    /// Check that the sigma builder and the diagonal of the Hamiltonian have been set
+    void preiteration_sanity_checks();
+
+    /// @brief Compute the sigma vectors for the rows [first, last) of b and store them in the
+    /// same rows of sigma. The vectors are passed to the sigma builder in blocks of at most
+    /// sigma_block_size_ vectors
+    void compute_sigma_rows(std::shared_ptr<psi::Matrix> b, std::shared_ptr<psi::Matrix> sigma,
+                            size_t first, size_t last);
+
+    /// Set a dense matrix from a vector of sparse vectors
+    void set_vector(std::shared_ptr<psi::Matrix> M, const std::vector<sparse_vec>& vecs);
+
+    /// Project out undesired roots from the rows [first, first + n) of a matrix
+    void project_out_rows(std::shared_ptr<psi::Matrix> v, size_t n, size_t first = 0);
+
+    /// Fill the first n rows of a matrix with random numbers between -1 and 1
+    void random_rows(std::shared_ptr<psi::Matrix> M, size_t n);
+
+    /// @brief Orthonormalize a vector against the first rowsA rows of A (assumed orthonormal)
+    /// using repeated Gram-Schmidt steps and optionally apply the same linear transformation to a
+    /// second vector (e.g., the corresponding sigma vector)
+    /// @param A the orthonormal rows
+    /// @param rowsA the number of rows in A
+    /// @param v the vector to orthonormalize (in place)
+    /// @param sigma_A the rows transformed together with A (may be nullptr)
+    /// @param sigma_v the vector transformed together with v (may be nullptr)
+    /// @return true if the vector was not discarded due to linear dependence
+    bool orthonormalize(std::shared_ptr<psi::Matrix> A, size_t rowsA, double* v,
+                        std::shared_ptr<psi::Matrix> sigma_A = nullptr,
+                        double* sigma_v = nullptr) const;
+
+    /// @brief Rayleigh-Ritz step in the space spanned by the first n rows of Q (assumed
+    /// orthonormal). Forms G = Q (sigma_Q)^T, and diagonalizes it
+    /// @param Q the basis vectors stored by row
+    /// @param sigma_Q the corresponding sigma vectors stored by row
+    /// @param n the number of basis vectors
+    /// @return a pair (eigenvalues, eigenvectors) of the n x n subspace Hamiltonian. The
+    /// eigenvectors are stored by column and sorted in ascending order of the eigenvalues
+    std::pair<std::shared_ptr<psi::Vector>, std::shared_ptr<psi::Matrix>>
+    rayleigh_ritz(std::shared_ptr<psi::Matrix> Q, std::shared_ptr<psi::Matrix> sigma_Q, size_t n);
+
+    /// @brief Form the first m linear combinations out_k = sum_{j = first}^{last - 1} C_jk Q_j
+    /// @param Q the vectors stored by row
+    /// @param C the coefficients stored by column
+    /// @param first the first row of Q included in the sum
+    /// @param last one past the last row of Q included in the sum
+    /// @param m the number of vectors to form
+    /// @param out the matrix that stores the result (first m rows)
+    void linear_combination(std::shared_ptr<psi::Matrix> Q, std::shared_ptr<psi::Matrix> C,
+                            size_t first, size_t last, size_t m, std::shared_ptr<psi::Matrix> out);
+
+    /// The threshold used to discard vectors in the Gram-Schmidt procedure
+    double schmidt_discard_threshold_ = 1.0e-7;
+    /// The threshold used to guarantee orthogonality among the vectors
+    double schmidt_orthogonality_threshold_ = 1.0e-12;
+};
+
+EigenSolverType string_to_eigen_solver_type(std::string type);
+
+/// @brief Make an iterative eigensolver
+/// @param type the algorithm
+/// @param size the dimension of the vectors
+/// @param nroot the number of roots requested
+/// @param collapse_per_root the number of vectors per root retained after a restart
+/// @param subspace_per_root the maximum subspace size per root
+std::shared_ptr<EigenSolver> make_eigen_solver(EigenSolverType type, size_t size, size_t nroot,
+                                               size_t collapse_per_root = 1,
+                                               size_t subspace_per_root = 5);
+
+} // namespace forte
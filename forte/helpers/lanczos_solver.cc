@@ -0,0 +1,323 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+#include <algorithm>
+#include <cmath>
+
+#include "psi4/libqt/qt.h"
+#include "psi4/libmints/vector.h"
+#include "psi4/libmints/matrix.h"
+
+#include "helpers/lanczos_solver.h"
+
+namespace forte {
+
+LanczosSolver::LanczosSolver(size_t size, size_t nroot, size_t collapse_per_root,
+                             size_t subspace_per_root)
+    : EigenSolver(size, nroot) {
+    if (collapse_per_root < 1) {
+        std::string msg = "LanczosSolver: collapse_per_root (" +
+                          std::to_string(collapse_per_root) + ") must be greater or equal to one";
+        throw std::runtime_error(msg);
+    }
+    if (subspace_per_root < collapse_per_root + 1) {
+        std::string msg = "LanczosSolver: subspace_per_root (" +
+                          std::to_string(subspace_per_root) +
+                          ") must be greater or equal to collapse_per_root + 1 (" +
+                          std::to_string(collapse_per_root + 1) + ")";
+        throw std::runtime_error(msg);
+    }
+    collapse_size_ = std::min(collapse_per_root * nroot_, size_);
+    subspace_size_ = std::min(subspace_per_root * nroot_, size_);
+    block_size_ = std::min(nroot_, size_);
+
+    // Vectors (here we store the vectors as row vectors). The extra rows are used to store the
+    // next Lanczos block when the basis is full
+    v_ = std::make_shared<psi::Matrix>("V", subspace_size_ + block_size_, size_);
+    sigma_v_ = std::make_shared<psi::Matrix>("sigma V", subspace_size_ + block_size_, size_);
+    temp_ = std::make_shared<psi::Matrix>("temp", subspace_size_, size_);
+    x_ = std::make_shared<psi::Matrix>("X", nroot_, size_);
+
+    lambda_ = std::make_shared<psi::Vector>("lambda", nroot_);
+    lambda_old_ = std::make_shared<psi::Vector>("lambda_old", nroot_);
+    residual_2norm_.resize(nroot_, 0.0);
+}
+
+void LanczosSolver::reset() {
+    has_solution_ = false;
+    x_->zero();
+}
+
+std::shared_ptr<psi::Vector> LanczosSolver::eigenvalues() const { return lambda_; }
+
+std::shared_ptr<psi::Matrix> LanczosSolver::eigenvectors() const { return x_; }
+
+void LanczosSolver::print_table() {
+    if (print_ < PrintLevel::Default)
+        return;
+
+    table_printer printer;
+    printer.add_double_data({{"Energy convergence threshold", e_convergence_},
+                             {"Residual convergence threshold", r_convergence_},
+                             {"Schmidt orthogonality threshold", schmidt_orthogonality_threshold_},
+                             {"Schmidt discard threshold", schmidt_discard_threshold_}});
+    printer.add_int_data({{"Size of the space", size_},
+                          {"Number of roots", nroot_},
+                          {"Maximum number of iterations", max_iter_},
+                          {"Lanczos block size", block_size_},
+                          {"Thick-restart subspace size", collapse_size_},
+                          {"Maximum subspace size", subspace_size_}});
+    printer.add_string_data({{"Print level", to_string(print_)}});
+
+    std::string table = printer.get_table("Thick-Restart Block Lanczos Solver");
+    psi::outfile->Printf("%s", table.c_str());
+}
+
+size_t LanczosSolver::setup_guesses() {
+    size_t n = 0;
+    if (has_solution_) {
+        // thick start from the eigenvectors of the previous calculation
+        psi::outfile->Printf("\n\n  Lanczos solver: restarting from previous calculation.");
+        for (size_t k = 0; k < nroot_; k++) {
+            auto v = v_->pointer()[n];
+            std::copy(x_->pointer()[k], x_->pointer()[k] + size_, v);
+            project_out_rows(v_, 1, n);
+            if (orthonormalize(v_, n, v)) {
+                n++;
+            }
+        }
+    } else {
+        // the Krylov sequence is started from a block of guess vectors completed with random
+        // vectors, so that degenerate roots can be resolved
+        for (const auto& guess : guesses_) {
+            if (n == block_size_) {
+                break;
+            }
+            auto v = v_->pointer()[n];
+            std::fill(v, v + size_, 0.0);
+            for (const auto& [I, CI] : guess) {
+                v[I] = CI;
+            }
+            project_out_rows(v_, 1, n);
+            if (orthonormalize(v_, n, v)) {
+                n++;
+            }
+        }
+        const size_t nguess = n;
+        auto random = std::make_shared<psi::Matrix>("random", 1, size_);
+        for (size_t attempt = 0; n < block_size_ and attempt < 10 * block_size_; attempt++) {
+            random_rows(random, 1);
+            auto v = v_->pointer()[n];
+            std::copy(random->pointer()[0], random->pointer()[0] + size_, v);
+            project_out_rows(v_, 1, n);
+            if (orthonormalize(v_, n, v)) {
+                n++;
+            }
+        }
+        if (print_ >= PrintLevel::Default) {
+            psi::outfile->Printf("\n\n  Lanczos solver: starting from %zu guess and %zu random "
+                                 "vectors",
+                                 nguess, n - nguess);
+        }
+    }
+    if (n == 0) {
+        std::string msg = "LanczosSolver: guess vectors are zero or linearly dependent";
+        throw std::runtime_error(msg);
+    }
+    return n;
+}
+
+void LanczosSolver::compute_residual_norms(std::shared_ptr<psi::Matrix> C, size_t n) {
+    std::vector<double> r(size_);
+    auto C_p = C->pointer();
+    for (size_t k = 0; k < std::min(nroot_, n); k++) {
+        const auto theta_k = lambda_->get(k);
+        std::fill(r.begin(), r.end(), 0.0);
+        for (size_t j = 0; j < n; j++) {
+            const auto c_jk = C_p[j][k];
+            const auto v_j = v_->pointer()[j];
+            const auto sigma_v_j = sigma_v_->pointer()[j];
+            for (size_t I = 0; I < size_; I++) {
+                r[I] += c_jk * (sigma_v_j[I] - theta_k * v_j[I]);
+            }
+        }
+        residual_2norm_[k] = std::sqrt(psi::C_DDOT(size_, r.data(), 1, r.data(), 1));
+    }
+}
+
+size_t LanczosSolver::next_lanczos_block(size_t first, size_t n) {
+    // the next Krylov block is formed by the sigma vectors of the last block orthogonalized
+    // against the basis (full reorthogonalization)
+    size_t added = 0;
+    for (size_t j = first; j < n; j++) {
+        auto v = v_->pointer()[n + added];
+        std::copy(sigma_v_->pointer()[j], sigma_v_->pointer()[j] + size_, v);
+        project_out_rows(v_, 1, n + added);
+        if (orthonormalize(v_, n + added, v)) {
+            added++;
+        }
+    }
+    if (added > 0) {
+        return added;
+    }
+    // the Krylov space is invariant, try to get unstuck with a random vector
+    auto v = v_->pointer()[n];
+    auto random = std::make_shared<psi::Matrix>("random", 1, size_);
+    random_rows(random, 1);
+    std::copy(random->pointer()[0], random->pointer()[0] + size_, v);
+    project_out_rows(v_, 1, n);
+    if (orthonormalize(v_, n, v)) {
+        psi::outfile->Printf(" <- added a random vector");
+        return 1;
+    }
+    return 0;
+}
+
+bool LanczosSolver::solve() {
+    iterations_ = 0;
+    num_sigma_vectors_ = 0;
+
+    print_table();
+
+    preiteration_sanity_checks();
+
+    lambda_old_->zero();
+    for (auto& r : residual_2norm_) {
+        r = 1.0;
+    }
+
+    auto n = setup_guesses();
+    compute_sigma_rows(v_, sigma_v_, 0, n);
+    // the first vector of the last Lanczos block
+    size_t block_begin = 0;
+
+    if (print_ >= PrintLevel::Default) {
+        psi::outfile->Printf("\n  Iteration     Average Energy            max(∆E)            "
+                             "max(Residual)  Vectors");
+        psi::outfile->Printf("\n  --------------------------------------------------------------"
+                             "-------------------");
+    }
+
+    bool converged = false;
+    for (size_t iter = 0; iter < max_iter_; iter++) {
+        iterations_ = iter + 1;
+
+        // 1. Rayleigh-Ritz step in the Lanczos basis
+        auto [theta, C] = rayleigh_ritz(v_, sigma_v_, n);
+        const size_t nritz = std::min(nroot_, n);
+        for (size_t k = 0; k < nritz; k++) {
+            lambda_->set(k, theta->get(k));
+        }
+        compute_residual_norms(C, n);
+
+        // 2. Print iteration summary and check for convergence
+        double average_energy = 0.0;
+        double max_residual = 0.0;
+        double max_e_diff = 0.0;
+        for (size_t k = 0; k < nroot_; k++) {
+            max_residual = std::max(max_residual, residual_2norm_[k]);
+            max_e_diff = std::max(max_e_diff, std::fabs(lambda_->get(k) - lambda_old_->get(k)));
+            average_energy += lambda_->get(k) / static_cast<double>(nroot_);
+        }
+        if (print_ >= PrintLevel::Default) {
+            psi::outfile->Printf("\n  %6zu  %20.12f  %20.12f  %20.12f %6zu", iter, average_energy,
+                                 max_e_diff, max_residual, n);
+        }
+        // Edge case: if the basis spans the full space, we are done
+        if ((nritz == nroot_ and max_e_diff < e_convergence_ and max_residual < r_convergence_) or
+            (n == size_)) {
+            converged = true;
+            break;
+        }
+        lambda_old_->copy(*lambda_);
+
+        // 3. Form the next Lanczos block
+        const auto added = next_lanczos_block(block_begin, n);
+        if (added == 0) {
+            converged = (nritz == nroot_ and max_residual < r_convergence_);
+            break;
+        }
+
+        // 4. Thick restart: collapse the basis onto the lowest Ritz vectors and move the next
+        // Lanczos block after them. In exact arithmetic the residuals of all the Ritz vectors lie
+        // in the span of this block, so the Krylov structure is preserved
+        if (n + added > subspace_size_) {
+            const auto k = std::min(collapse_size_, n);
+            linear_combination(v_, C, 0, n, k, temp_);
+            for (size_t j = 0; j < k; j++) {
+                std::copy(temp_->pointer()[j], temp_->pointer()[j] + size_, v_->pointer()[j]);
+            }
+            linear_combination(sigma_v_, C, 0, n, k, temp_);
+            for (size_t j = 0; j < k; j++) {
+                std::copy(temp_->pointer()[j], temp_->pointer()[j] + size_,
+                          sigma_v_->pointer()[j]);
+            }
+            size_t kept = 0;
+            for (size_t j = 0; j < added; j++) {
+                std::copy(v_->pointer()[n + j], v_->pointer()[n + j] + size_,
+                          v_->pointer()[k + kept]);
+                if (orthonormalize(v_, k + kept, v_->pointer()[k + kept])) {
+                    kept++;
+                }
+            }
+            n = k;
+            if (kept == 0) {
+                converged = (nritz == nroot_ and max_residual < r_convergence_);
+                break;
+            }
+            compute_sigma_rows(v_, sigma_v_, n, n + kept);
+            block_begin = n;
+            n += kept;
+            continue;
+        }
+
+        // 5. Compute the sigma vectors of the new Lanczos block
+        compute_sigma_rows(v_, sigma_v_, n, n + added);
+        block_begin = n;
+        n += added;
+    }
+
+    if (print_ >= PrintLevel::Default) {
+        psi::outfile->Printf("\n  --------------------------------------------------------------"
+                             "-------------------");
+        if (not converged) {
+            psi::outfile->Printf("\n\n  Lanczos solver: did not converge.");
+        }
+    }
+
+    // Form the final eigenvectors
+    auto [theta, C] = rayleigh_ritz(v_, sigma_v_, n);
+    const size_t nritz = std::min(nroot_, n);
+    for (size_t k = 0; k < nritz; k++) {
+        lambda_->set(k, theta->get(k));
+    }
+    linear_combination(v_, C, 0, n, nritz, x_);
+    has_solution_ = true;
+    return converged;
+}
+
+} // namespace forte
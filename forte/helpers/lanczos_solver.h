@@ -0,0 +1,109 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "helpers/eigen_solver.h"
+
+namespace forte {
+
+/// @brief A class to solve the symmetric eigenvalue problem using the thick-restart block
+/// Lanczos algorithm
+/// @details The Krylov basis is built one block of nroot vectors at a time from the sigma vectors
+/// of the last block, with full reorthogonalization. When the basis reaches the maximum subspace
+/// size, it is collapsed onto the lowest Ritz vectors and the recursion is continued from the
+/// next Krylov block (thick restart). The algorithm does not use the diagonal preconditioner, so
+/// it is well suited for problems where the diagonal of the Hamiltonian is a poor approximation.
+/// A block of nroot independent starting vectors (the guesses, completed with random vectors)
+/// lets the solver resolve up to nroot degenerate roots, which a single Krylov sequence cannot.
+class LanczosSolver : public EigenSolver {
+  public:
+    LanczosSolver(size_t size, size_t nroot, size_t collapse_per_root = 1,
+                  size_t subspace_per_root = 5);
+
+    /// Function to reset the solver
+    void reset() override;
+
+    /// @brief The main solver function
+    /// @return true if the solver converged
+    bool solve() override;
+
+    /// The name of the algorithm
+    std::string name() const override { return "LanczosSolver"; }
+
+    /// Return the eigenvalues
+    std::shared_ptr<psi::Vector> eigenvalues() const override;
+    /// Return the eigenvectors
+    std::shared_ptr<psi::Matrix> eigenvectors() const override;
+
+  private:
+    /// The number of Ritz vectors retained after a restart
+    size_t collapse_size_;
+    /// The maximum subspace size
+    size_t subspace_size_;
+    /// The number of vectors in a Lanczos block
+    size_t block_size_;
+    /// Do we have eigenvectors from a previous call to solve()?
+    bool has_solution_ = false;
+
+    /// The Lanczos basis vectors and their sigma vectors, stored by row
+    std::shared_ptr<psi::Matrix> v_;
+    std::shared_ptr<psi::Matrix> sigma_v_;
+    /// A matrix to store temporary results
+    std::shared_ptr<psi::Matrix> temp_;
+    /// The converged eigenvectors, stored by row
+    std::shared_ptr<psi::Matrix> x_;
+    /// The Ritz values
+    std::shared_ptr<psi::Vector> lambda_;
+    /// The Ritz values at the previous iteration
+    std::shared_ptr<psi::Vector> lambda_old_;
+    /// 2-Norm of the residuals
+    std::vector<double> residual_2norm_;
+
+    /// Print a summary of the options
+    void print_table();
+
+    /// @brief Form the starting block from the guesses (or the previous solution)
+    /// @return the number of starting vectors
+    size_t setup_guesses();
+
+    /// @brief Compute the residual norms of the first nroot Ritz vectors
+    /// @param C the Ritz vectors in the Lanczos basis stored by column
+    /// @param n the number of Lanczos vectors
+    void compute_residual_norms(std::shared_ptr<psi::Matrix> C, size_t n);
+
+    /// @brief Form the next Lanczos block from the sigma vectors of the rows [first, n) of v_
+    /// and store it starting from the row n of v_
+    /// @return the number of vectors added
+    size_t next_lanczos_block(size_t first, size_t n);
+};
+
+} // namespace forte
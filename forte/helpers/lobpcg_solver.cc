@@ -0,0 +1,271 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+#include <algorithm>
+#include <cmath>
+
+#include "psi4/libqt/qt.h"
+#include "psi4/libmints/vector.h"
+#include "psi4/libmints/matrix.h"
+
+#include "helpers/lobpcg_solver.h"
+
+namespace forte {
+
+LOBPCGSolver::LOBPCGSolver(size_t size, size_t nroot) : EigenSolver(size, nroot) {
+    max_subspace_size_ = 3 * nroot_;
+
+    // Vectors (here we store the vectors as row vectors)
+    x_ = std::make_shared<psi::Matrix>("X", nroot_, size_);
+    sigma_x_ = std::make_shared<psi::Matrix>("sigma X", nroot_, size_);
+    p_ = std::make_shared<psi::Matrix>("P", nroot_, size_);
+    sigma_p_ = std::make_shared<psi::Matrix>("sigma P", nroot_, size_);
+    w_ = std::make_shared<psi::Matrix>("W", nroot_, size_);
+    q_ = std::make_shared<psi::Matrix>("Q", max_subspace_size_, size_);
+    sigma_q_ = std::make_shared<psi::Matrix>("sigma Q", max_subspace_size_, size_);
+
+    lambda_ = std::make_shared<psi::Vector>("lambda", nroot_);
+    lambda_old_ = std::make_shared<psi::Vector>("lambda_old", nroot_);
+    residual_2norm_.resize(nroot_, 0.0);
+}
+
+void LOBPCGSolver::reset() {
+    has_solution_ = false;
+    x_->zero();
+    p_->zero();
+}
+
+std::shared_ptr<psi::Vector> LOBPCGSolver::eigenvalues() const { return lambda_; }
+
+std::shared_ptr<psi::Matrix> LOBPCGSolver::eigenvectors() const { return x_; }
+
+void LOBPCGSolver::print_table() {
+    if (print_ < PrintLevel::Default)
+        return;
+
+    table_printer printer;
+    printer.add_double_data({{"Energy convergence threshold", e_convergence_},
+                             {"Residual convergence threshold", r_convergence_}});
+    printer.add_int_data({{"Size of the space", size_},
+                          {"Number of roots", nroot_},
+                          {"Maximum number of iterations", max_iter_},
+                          {"Maximum subspace size", max_subspace_size_}});
+    printer.add_string_data({{"Print level", to_string(print_)}});
+
+    std::string table = printer.get_table("LOBPCG Solver");
+    psi::outfile->Printf("%s", table.c_str());
+}
+
+void LOBPCGSolver::setup_guesses() {
+    // Collect the starting vectors in g: the previous solution, the user guesses, or random
+    // vectors. Extra guesses (beyond nroot) are used only in the first Rayleigh-Ritz step
+    std::shared_ptr<psi::Matrix> g;
+    size_t ng = 0;
+    if (has_solution_) {
+        psi::outfile->Printf("\n\n  LOBPCG solver: restarting from previous calculation.");
+        ng = nroot_;
+        g = std::make_shared<psi::Matrix>("guess", ng, size_);
+        g->copy(*x_);
+    } else if (guesses_.size() >= nroot_) {
+        ng = guesses_.size();
+        g = std::make_shared<psi::Matrix>("guess", ng, size_);
+        set_vector(g, guesses_);
+        if (print_ >= PrintLevel::Default) {
+            psi::outfile->Printf("\n\n  LOBPCG solver: adding %zu guess vectors", ng);
+        }
+    } else if (guesses_.size() == 0) {
+        ng = nroot_;
+        g = std::make_shared<psi::Matrix>("guess", ng, size_);
+        random_rows(g, ng);
+        if (print_ >= PrintLevel::Default) {
+            psi::outfile->Printf("\n\n  LOBPCG solver: adding %zu random vectors", ng);
+        }
+    } else {
+        std::string msg = "LOBPCGSolver: number of guess vectors (" +
+                          std::to_string(guesses_.size()) +
+                          ") must be zero or greater or equal to the number of roots (" +
+                          std::to_string(nroot_) + ")";
+        throw std::runtime_error(msg);
+    }
+    project_out_rows(g, ng);
+
+    // orthonormalize the guesses
+    auto gq = std::make_shared<psi::Matrix>("guess basis", ng, size_);
+    auto sigma_gq = std::make_shared<psi::Matrix>("guess sigma", ng, size_);
+    size_t n = 0;
+    for (size_t j = 0; j < ng; j++) {
+        auto v = gq->pointer()[n];
+        std::copy(g->pointer()[j], g->pointer()[j] + size_, v);
+        if (orthonormalize(gq, n, v)) {
+            n++;
+        }
+    }
+    if (n < nroot_) {
+        std::string msg = "LOBPCGSolver: guess vectors are zero or linearly dependent";
+        throw std::runtime_error(msg);
+    }
+
+    // Rayleigh-Ritz step in the space of the guesses
+    compute_sigma_rows(gq, sigma_gq, 0, n);
+    auto [theta, C] = rayleigh_ritz(gq, sigma_gq, n);
+    linear_combination(gq, C, 0, n, nroot_, x_);
+    linear_combination(sigma_gq, C, 0, n, nroot_, sigma_x_);
+    for (size_t k = 0; k < nroot_; k++) {
+        lambda_->set(k, theta->get(k));
+    }
+}
+
+size_t LOBPCGSolver::form_correction_vectors() {
+    size_t nw = 0;
+    std::vector<double> r(size_);
+    for (size_t k = 0; k < nroot_; k++) {
+        const auto lambda_k = lambda_->get(k);
+        const auto x_k = x_->pointer()[k];
+        const auto sigma_x_k = sigma_x_->pointer()[k];
+        for (size_t I = 0; I < size_; I++) {
+            r[I] = sigma_x_k[I] - lambda_k * x_k[I];
+        }
+        residual_2norm_[k] = std::sqrt(psi::C_DDOT(size_, r.data(), 1, r.data(), 1));
+        // soft locking: skip the roots that are already converged
+        if (residual_2norm_[k] < r_convergence_)
+            continue;
+        // LOBPCG requires a positive definite preconditioner, so the Davidson denominators
+        // (H_II - lambda) are bounded from below
+        auto w = w_->pointer()[nw];
+        for (size_t I = 0; I < size_; I++) {
+            double denom = std::max(h_diag_->get(I) - lambda_k, 1.0e-2);
+            w[I] = r[I] / denom;
+        }
+        nw++;
+    }
+    project_out_rows(w_, nw);
+    return nw;
+}
+
+size_t LOBPCGSolver::add_to_basis(std::shared_ptr<psi::Matrix> M,
+                                  std::shared_ptr<psi::Matrix> sigma_M, size_t n, size_t nq) {
+    size_t added = 0;
+    for (size_t j = 0; (j < n) and (nq + added < max_subspace_size_); j++) {
+        auto v = q_->pointer()[nq + added];
+        std::copy(M->pointer()[j], M->pointer()[j] + size_, v);
+        double* sigma_v = nullptr;
+        if (sigma_M) {
+            sigma_v = sigma_q_->pointer()[nq + added];
+            std::copy(sigma_M->pointer()[j], sigma_M->pointer()[j] + size_, sigma_v);
+        }
+        if (orthonormalize(q_, nq + added, v, sigma_M ? sigma_q_ : nullptr, sigma_v)) {
+            added++;
+        }
+    }
+    return added;
+}
+
+bool LOBPCGSolver::solve() {
+    iterations_ = 0;
+    num_sigma_vectors_ = 0;
+
+    print_table();
+
+    preiteration_sanity_checks();
+
+    lambda_old_->zero();
+
+    setup_guesses();
+
+    if (print_ >= PrintLevel::Default) {
+        psi::outfile->Printf("\n  Iteration     Average Energy            max(∆E)            "
+                             "max(Residual)  Vectors");
+        psi::outfile->Printf("\n  --------------------------------------------------------------"
+                             "-------------------");
+    }
+
+    bool converged = false;
+    size_t np = 0;
+    for (size_t iter = 0; iter < max_iter_; iter++) {
+        iterations_ = iter + 1;
+
+        // 1. Form the residuals and the preconditioned correction vectors
+        auto nw = form_correction_vectors();
+
+        // 2. Print iteration summary and check for convergence
+        double average_energy = 0.0;
+        double max_residual = 0.0;
+        double max_e_diff = 0.0;
+        for (size_t k = 0; k < nroot_; k++) {
+            max_residual = std::max(max_residual, residual_2norm_[k]);
+            max_e_diff = std::max(max_e_diff, std::fabs(lambda_->get(k) - lambda_old_->get(k)));
+            average_energy += lambda_->get(k) / static_cast<double>(nroot_);
+        }
+        if (print_ >= PrintLevel::Default) {
+            psi::outfile->Printf("\n  %6zu  %20.12f  %20.12f  %20.12f %6zu", iter, average_energy,
+                                 max_e_diff, max_residual, nw);
+        }
+        bool is_residual_converged = (max_residual < r_convergence_);
+        if ((max_e_diff < e_convergence_) and is_residual_converged) {
+            converged = true;
+            break;
+        }
+
+        // 3. Form an orthonormal basis for the space [X, P, W] and the sigma vectors of W
+        auto nx = add_to_basis(x_, sigma_x_, nroot_, 0);
+        auto nq = nx + add_to_basis(p_, sigma_p_, np, nx);
+        auto nq_xp = nq;
+        nq += add_to_basis(w_, nullptr, nw, nq);
+        compute_sigma_rows(q_, sigma_q_, nq_xp, nq);
+
+        // if the space did not grow we cannot improve the solution
+        if (nq == nx) {
+            converged = is_residual_converged;
+            break;
+        }
+
+        // 4. Rayleigh-Ritz step. The new search directions are the components of the Ritz
+        // vectors outside the space of X
+        lambda_old_->copy(*lambda_);
+        auto [theta, C] = rayleigh_ritz(q_, sigma_q_, nq);
+        linear_combination(q_, C, 0, nq, nroot_, x_);
+        linear_combination(sigma_q_, C, 0, nq, nroot_, sigma_x_);
+        linear_combination(q_, C, nx, nq, nroot_, p_);
+        linear_combination(sigma_q_, C, nx, nq, nroot_, sigma_p_);
+        np = nroot_;
+        for (size_t k = 0; k < nroot_; k++) {
+            lambda_->set(k, theta->get(k));
+        }
+    }
+
+    if (print_ >= PrintLevel::Default) {
+        psi::outfile->Printf("\n  --------------------------------------------------------------"
+                             "-------------------");
+        if (not converged) {
+            psi::outfile->Printf("\n\n  LOBPCG solver: did not converge.");
+        }
+    }
+    has_solution_ = true;
+    return converged;
+}
+
+} // namespace forte
@@ -0,0 +1,108 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "helpers/eigen_solver.h"
+
+namespace forte {
+
+/// @brief A class to solve the symmetric eigenvalue problem using the locally optimal block
+/// preconditioned conjugate gradient (LOBPCG) algorithm
+/// @details At each iteration the Rayleigh-Ritz problem is solved in the space spanned by the
+/// current Ritz vectors (X), the preconditioned residuals (W), and the previous search directions
+/// (P). Only the residuals of the roots that are not converged are added to the subspace (soft
+/// locking), so each iteration requires at most one sigma vector per unconverged root.
+class LOBPCGSolver : public EigenSolver {
+  public:
+    LOBPCGSolver(size_t size, size_t nroot);
+
+    /// Function to reset the solver
+    void reset() override;
+
+    /// @brief The main solver function
+    /// @return true if the solver converged
+    bool solve() override;
+
+    /// The name of the algorithm
+    std::string name() const override { return "LOBPCGSolver"; }
+
+    /// Return the eigenvalues
+    std::shared_ptr<psi::Vector> eigenvalues() const override;
+    /// Return the eigenvectors
+    std::shared_ptr<psi::Matrix> eigenvectors() const override;
+
+  private:
+    /// The number of vectors allocated for the subspace [X, P, W]
+    size_t max_subspace_size_;
+    /// Do we have eigenvectors from a previous call to solve()?
+    bool has_solution_ = false;
+
+    /// The Ritz vectors (X) and their sigma vectors, stored by row
+    std::shared_ptr<psi::Matrix> x_;
+    std::shared_ptr<psi::Matrix> sigma_x_;
+    /// The search directions (P) and their sigma vectors, stored by row
+    std::shared_ptr<psi::Matrix> p_;
+    std::shared_ptr<psi::Matrix> sigma_p_;
+    /// The preconditioned residuals (W), stored by row
+    std::shared_ptr<psi::Matrix> w_;
+    /// The orthonormal basis of the subspace [X, P, W] and its sigma vectors, stored by row
+    std::shared_ptr<psi::Matrix> q_;
+    std::shared_ptr<psi::Matrix> sigma_q_;
+    /// The Ritz values
+    std::shared_ptr<psi::Vector> lambda_;
+    /// The Ritz values at the previous iteration
+    std::shared_ptr<psi::Vector> lambda_old_;
+    /// 2-Norm of the residuals
+    std::vector<double> residual_2norm_;
+
+    /// Print a summary of the options
+    void print_table();
+
+    /// Form the initial Ritz vectors from the guesses (or the previous solution)
+    void setup_guesses();
+
+    /// @brief Form the residuals and the preconditioned correction vectors (W) of the roots that
+    /// are not converged
+    /// @return the number of rows of W
+    size_t form_correction_vectors();
+
+    /// @brief Add the first n rows of M to the basis q_ and orthonormalize them
+    /// @param M the vectors to add
+    /// @param sigma_M the corresponding sigma vectors (if nullptr, only the basis is updated)
+    /// @param n the number of rows to add
+    /// @param nq the number of vectors in the basis
+    /// @return the number of vectors added
+    size_t add_to_basis(std::shared_ptr<psi::Matrix> M, std::shared_ptr<psi::Matrix> sigma_M,
+                        size_t n, size_t nq);
+};
+
+} // namespace forte
@@ -0,0 +1,63 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace forte {
+
+/**
+ * @brief The MappedFile class
+ * A read-only memory map of a file, released when the object goes out of scope. The kernel is
+ * advised that the file is read sequentially.
+ */
+class MappedFile {
+  public:
+    /// @brief Map a file
+    /// @param filename the name of the file
+    /// @param caller the name used as a prefix in the error messages
+    /// @throw std::runtime_error if the file cannot be opened or mapped
+    MappedFile(const std::string& filename, const std::string& caller);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// @return a pointer to the content of the file (nullptr if the file is empty)
+    const char* data() const { return data_; }
+    /// @return the size of the file in bytes
+    size_t size() const { return size_; }
+
+  private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+} // namespace forte
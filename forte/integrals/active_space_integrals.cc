@@ -26,10 +26,13 @@
  * @END LICENSE
  */
 
+#include <algorithm>
 #include <cmath>
 
 #include "psi4/psi4-dec.h"
 #include "psi4/libpsi4util/PsiOutStream.h"
+#include "psi4/libmints/dimension.h"
+#include "psi4/libmints/matrix.h"
 
 #include "base_classes/mo_space_info.h"
 #include "integrals/active_space_integrals.h"
@@ -38,6 +41,29 @@
 
 namespace forte {
 
+namespace {
+/// Add a row of integrals to a row of matrix elements
+inline void add_row(double* dst, const double* src, size_t n) {
+#pragma omp simd
+    for (size_t a = 0; a < n; ++a) {
+        dst[a] += src[a];
+    }
+}
+
+/// Fill a list with the occupied orbitals of a string
+inline void occupied_list(String I, std::vector<int>& occ) {
+    occ.clear();
+    for (int n = I.count(); n > 0; --n) {
+        occ.push_back(I.find_and_clear_first_one());
+    }
+}
+
+/// Order double excitations by decreasing magnitude of the integral
+bool by_decreasing_magnitude(const DoubleExcitation& x, const DoubleExcitation& y) {
+    return std::fabs(x.value) > std::fabs(y.value);
+}
+} // namespace
+
 ActiveSpaceIntegrals::ActiveSpaceIntegrals(std::shared_ptr<ForteIntegrals> ints,
                                            const std::vector<size_t>& active_mo,
                                            const std::vector<int>& active_mo_symmetry,
@@ -48,6 +74,11 @@ ActiveSpaceIntegrals::ActiveSpaceIntegrals(std::shared_ptr<ForteIntegrals> ints,
 }
 
 void ActiveSpaceIntegrals::compute_restricted_one_body_operator() {
+    release_screening_tables();
+    if (ints_->active_integrals_only()) {
+        compute_restricted_one_body_operator_from_fock();
+        return;
+    }
     std::vector<size_t> fomo_to_mo(restricted_docc_mo_);
     std::vector<size_t> cmo_to_mo(active_mo_);
     size_t nfomo1 = fomo_to_mo.size();
@@ -164,6 +195,50 @@ void ActiveSpaceIntegrals::compute_restricted_one_body_operator() {
     }
 }
 
+void ActiveSpaceIntegrals::compute_restricted_one_body_operator_from_fock() {
+    // Find the irrep and the index within the irrep (frozen orbitals included) of a correlated MO
+    const int nirrep = ints_->nirrep();
+    const auto& frzcpi = ints_->frzcpi();
+    const auto& ncmopi = ints_->ncmopi();
+    auto irrep_and_index = [&](size_t p) {
+        int h = 0;
+        while (p >= static_cast<size_t>(ncmopi[h])) {
+            p -= ncmopi[h];
+            ++h;
+        }
+        return std::make_pair(h, static_cast<int>(p) + frzcpi[h]);
+    };
+
+    // The restricted_docc orbitals must follow the frozen orbitals in each irrep
+    psi::Dimension ncorepi(nirrep);
+    for (size_t i : restricted_docc_mo_) {
+        ncorepi[irrep_and_index(i).first] += 1;
+    }
+    for (size_t i : restricted_docc_mo_) {
+        auto [h, idx] = irrep_and_index(i);
+        if (idx >= frzcpi[h] + ncorepi[h]) {
+            throw std::runtime_error(
+                "ActiveSpaceIntegrals: with only the active-space integrals available, the "
+                "restricted_docc orbitals must be the lowest correlated orbitals of each irrep");
+        }
+    }
+
+    // F^{closed} and the energy of all the doubly occupied (frozen + restricted_docc) orbitals.
+    // The frozen-core energy is already accounted for by frozen_core_energy_.
+    auto [Fa, Fb, e_closed] = ints_->make_fock_inactive(psi::Dimension(nirrep), frzcpi + ncorepi);
+    scalar_energy_ = ints_->scalar() + e_closed - ints_->frozen_core_energy();
+
+    for (size_t p = 0; p < nmo_; ++p) {
+        auto [hp, pp] = irrep_and_index(active_mo_[p]);
+        for (size_t q = 0; q < nmo_; ++q) {
+            auto [hq, qq] = irrep_and_index(active_mo_[q]);
+            size_t idx = nmo_ * p + q;
+            oei_a_[idx] = (hp == hq) ? Fa->get(hp, pp, qq) : 0.0;
+            oei_b_[idx] = (hp == hq) ? Fb->get(hp, pp, qq) : 0.0;
+        }
+    }
+}
+
 void ActiveSpaceIntegrals::startup() {
 
     nmo2_ = nmo_ * nmo_;
@@ -181,22 +256,477 @@ void ActiveSpaceIntegrals::startup() {
 void ActiveSpaceIntegrals::set_active_integrals(const ambit::Tensor& act_aa,
                                                 const ambit::Tensor& act_ab,
                                                 const ambit::Tensor& act_bb) {
+    clear_tei();
     tei_aa_ = act_aa.data();
     tei_ab_ = act_ab.data();
     tei_bb_ = act_bb.data();
+    tei_storage_ = TEIStorage::Dense;
+}
+
+void ActiveSpaceIntegrals::clear_tei() {
+    std::vector<double>().swap(tei_aa_);
+    std::vector<double>().swap(tei_ab_);
+    std::vector<double>().swap(tei_bb_);
+    std::vector<double>().swap(tei_packed_);
+    std::vector<double>().swap(tei_factors_);
+    std::vector<double>().swap(tei_diag_J_);
+    std::vector<double>().swap(tei_diag_K_);
+    nfactors_ = 0;
+    release_dense_tei();
+    release_element_tables();
+    release_screening_tables();
+}
+
+void ActiveSpaceIntegrals::set_restricted_active_integrals(const ambit::Tensor& act_ab) {
+    // release the dense integrals before packing
+    clear_tei();
+
+    const size_t npair = nmo_ * (nmo_ + 1) / 2;
+    tei_packed_.assign(npair * (npair + 1) / 2, 0.0);
+    const auto& data = act_ab.data();
+
+    // (pq|rs) = <pr|qs>
+#pragma omp parallel for schedule(dynamic)
+    for (size_t p = 0; p < nmo_; ++p) {
+        for (size_t q = 0; q <= p; ++q) {
+            const size_t pq = pair_index(p, q);
+            for (size_t r = 0; r <= p; ++r) {
+                for (size_t s = 0; s <= r; ++s) {
+                    const size_t rs = pair_index(r, s);
+                    if (rs > pq)
+                        break;
+                    tei_packed_[pair_index(pq, rs)] = data[tei_index(p, r, q, s)];
+                }
+            }
+        }
+    }
+    tei_storage_ = TEIStorage::Packed;
+}
+
+void ActiveSpaceIntegrals::set_factorized_active_integrals(double threshold) {
+    if (ints_->spin_restriction() != IntegralSpinRestriction::Restricted) {
+        throw std::runtime_error(
+            "ActiveSpaceIntegrals: factorized integrals require restricted orbitals");
+    }
+    clear_tei();
+
+    const size_t npair = nmo_ * (nmo_ + 1) / 2;
+
+    // the diagonal of the matrix (pq|pq) is updated as the vectors are computed
+    std::vector<std::array<size_t, 4>> diag_indices(npair);
+    for (size_t p = 0; p < nmo_; ++p) {
+        for (size_t q = 0; q <= p; ++q) {
+            diag_indices[pair_index(p, q)] = {active_mo_[p], active_mo_[p], active_mo_[q],
+                                              active_mo_[q]};
+        }
+    }
+    std::vector<double> diag = ints_->aptei_ab_elements(diag_indices);
+
+    // pivoted Cholesky decomposition of (pq|rs). Each pivot pair rs requires only the column
+    // (pq|rs) = <pr|qs>, so the four-index integrals are never formed
+    std::vector<std::vector<double>> vecs;
+    while (vecs.size() < npair) {
+        const auto max_it = std::max_element(diag.begin(), diag.end());
+        if (*max_it < threshold or *max_it <= 0.0)
+            break;
+        const size_t rs = std::distance(diag.begin(), max_it);
+        size_t r = 0;
+        while ((r + 1) * (r + 2) / 2 <= rs)
+            ++r;
+        const size_t s = rs - r * (r + 1) / 2;
+
+        auto col_block =
+            ints_->aptei_ab_block(active_mo_, {active_mo_[r]}, active_mo_, {active_mo_[s]});
+        const auto& col_data = col_block.data();
+        std::vector<double> L(npair);
+        for (size_t p = 0; p < nmo_; ++p) {
+            for (size_t q = 0; q <= p; ++q) {
+                L[pair_index(p, q)] = col_data[p * nmo_ + q];
+            }
+        }
+        for (const auto& v : vecs) {
+            const double vrs = v[rs];
+            for (size_t pq = 0; pq < npair; ++pq) {
+                L[pq] -= v[pq] * vrs;
+            }
+        }
+        const double norm = std::sqrt(*max_it);
+        for (size_t pq = 0; pq < npair; ++pq) {
+            L[pq] /= norm;
+            diag[pq] -= L[pq] * L[pq];
+        }
+        // guard against small negative values due to round-off
+        diag[rs] = 0.0;
+        vecs.push_back(std::move(L));
+    }
+
+    // store the vectors as [pq][L] so that the sum over L is contiguous
+    nfactors_ = vecs.size();
+    tei_factors_.assign(npair * nfactors_, 0.0);
+    for (size_t L = 0; L < nfactors_; ++L) {
+        for (size_t pq = 0; pq < npair; ++pq) {
+            tei_factors_[pq * nfactors_ + L] = vecs[L][pq];
+        }
+    }
+    tei_storage_ = TEIStorage::Factorized;
+
+    // cache the Coulomb and exchange integrals used to compute diagonal matrix elements
+    tei_diag_J_.resize(nmo2_);
+    tei_diag_K_.resize(nmo2_);
+    for (size_t p = 0; p < nmo_; ++p) {
+        for (size_t q = 0; q < nmo_; ++q) {
+            tei_diag_J_[p * nmo_ + q] = factorized_eri(p, p, q, q);
+            tei_diag_K_[p * nmo_ + q] = factorized_eri(p, q, q, p);
+        }
+    }
+
+    if (ints_->print_level() > 1) {
+        psi::outfile->Printf("\n  Factorized the active-space two-electron integrals with %zu "
+                             "Cholesky vectors (threshold = %.1e, %zu pairs)",
+                             nfactors_, threshold, npair);
+    }
+}
+
+const std::vector<double>& ActiveSpaceIntegrals::tei_aa_vector() const {
+    if (tei_storage_ == TEIStorage::Dense)
+        return tei_aa_;
+    build_dense_tei();
+    return tei_aa_view_;
+}
+
+const std::vector<double>& ActiveSpaceIntegrals::tei_ab_vector() const {
+    if (tei_storage_ == TEIStorage::Dense)
+        return tei_ab_;
+    build_dense_tei();
+    return tei_ab_view_;
+}
+
+const std::vector<double>& ActiveSpaceIntegrals::tei_bb_vector() const {
+    if (tei_storage_ == TEIStorage::Dense)
+        return tei_bb_;
+    // for restricted orbitals the beta-beta integrals are identical to the alpha-alpha ones
+    build_dense_tei();
+    return tei_aa_view_;
+}
+
+void ActiveSpaceIntegrals::build_dense_tei() const {
+    std::lock_guard<std::mutex> lock(view_mutex_);
+    if (not tei_ab_view_.empty())
+        return;
+    std::vector<double> aa(nmo4_), ab(nmo4_);
+#pragma omp parallel for
+    for (size_t p = 0; p < nmo_; ++p) {
+        for (size_t q = 0; q < nmo_; ++q) {
+            for (size_t r = 0; r < nmo_; ++r) {
+                for (size_t s = 0; s < nmo_; ++s) {
+                    const size_t idx = tei_index(p, q, r, s);
+                    ab[idx] = tei_ab(p, q, r, s);
+                    aa[idx] = tei_aa(p, q, r, s);
+                }
+            }
+        }
+    }
+    tei_aa_view_ = std::move(aa);
+    tei_ab_view_ = std::move(ab);
+}
+
+void ActiveSpaceIntegrals::release_dense_tei() const {
+    std::lock_guard<std::mutex> lock(view_mutex_);
+    std::vector<double>().swap(tei_aa_view_);
+    std::vector<double>().swap(tei_ab_view_);
 }
 
 void ActiveSpaceIntegrals::set_active_integrals_and_restricted_docc() {
-    ambit::Tensor act_aa = ints_->aptei_aa_block(active_mo_, active_mo_, active_mo_, active_mo_);
     ambit::Tensor act_ab = ints_->aptei_ab_block(active_mo_, active_mo_, active_mo_, active_mo_);
-    ambit::Tensor act_bb = ints_->aptei_bb_block(active_mo_, active_mo_, active_mo_, active_mo_);
-
-    tei_aa_ = act_aa.data();
-    tei_ab_ = act_ab.data();
-    tei_bb_ = act_bb.data();
+    if (ints_->spin_restriction() == IntegralSpinRestriction::Restricted) {
+        // for restricted orbitals <pq||rs> = <pq|rs> - <pq|sr> in both same-spin blocks, so they
+        // are obtained from the alpha-beta block without requesting more integrals
+        ambit::Tensor act_aa = act_ab.clone();
+        act_aa("pqrs") -= act_ab("pqsr");
+        set_active_integrals(act_aa, act_ab, act_aa);
+    } else {
+        ambit::Tensor act_aa =
+            ints_->aptei_aa_block(active_mo_, active_mo_, active_mo_, active_mo_);
+        ambit::Tensor act_bb =
+            ints_->aptei_bb_block(active_mo_, active_mo_, active_mo_, active_mo_);
+        set_active_integrals(act_aa, act_ab, act_bb);
+    }
     compute_restricted_one_body_operator();
 }
 
+void ActiveSpaceIntegrals::build_element_tables() const {
+    if (tables_ready_.load(std::memory_order_acquire))
+        return;
+    std::lock_guard<std::mutex> lock(view_mutex_);
+    if (tables_ready_.load(std::memory_order_relaxed))
+        return;
+    std::vector<double> aa(nmo3_), ab(nmo3_), ba(nmo3_), bb(nmo3_);
+#pragma omp parallel for
+    for (size_t p = 0; p < nmo_; ++p) {
+        for (size_t i = 0; i < nmo_; ++i) {
+            for (size_t a = 0; a < nmo_; ++a) {
+                const size_t idx = p * nmo2_ + i * nmo_ + a;
+                aa[idx] = tei_aa(i, p, a, p);
+                ab[idx] = tei_ab(i, p, a, p);
+                ba[idx] = tei_ab(p, i, p, a);
+                bb[idx] = tei_bb(i, p, a, p);
+            }
+        }
+    }
+    std::vector<double> daa(nmo2_), dab(nmo2_), dbb(nmo2_);
+    for (size_t p = 0; p < nmo_; ++p) {
+        for (size_t q = 0; q < nmo_; ++q) {
+            daa[p * nmo_ + q] = diag_tei_aa(p, q);
+            dab[p * nmo_ + q] = diag_tei_ab(p, q);
+            dbb[p * nmo_ + q] = diag_tei_bb(p, q);
+        }
+    }
+    single_aa_table_ = std::move(aa);
+    single_ab_table_ = std::move(ab);
+    single_ba_table_ = std::move(ba);
+    single_bb_table_ = std::move(bb);
+    diag_aa_table_ = std::move(daa);
+    diag_ab_table_ = std::move(dab);
+    diag_bb_table_ = std::move(dbb);
+    tables_ready_.store(true, std::memory_order_release);
+}
+
+void ActiveSpaceIntegrals::release_element_tables() const {
+    std::lock_guard<std::mutex> lock(view_mutex_);
+    tables_ready_.store(false, std::memory_order_release);
+    for (auto* table : {&single_aa_table_, &single_ab_table_, &single_ba_table_,
+                        &single_bb_table_, &diag_aa_table_, &diag_ab_table_, &diag_bb_table_}) {
+        std::vector<double>().swap(*table);
+    }
+}
+
+void ActiveSpaceIntegrals::build_screening_tables() const {
+    if (screening_ready_.load(std::memory_order_acquire))
+        return;
+    std::lock_guard<std::mutex> lock(view_mutex_);
+    if (screening_ready_.load(std::memory_order_relaxed))
+        return;
+    const auto& sym = active_mo_symmetry_;
+
+    // max_rs |<pq|rs>| for each pair pq
+    std::vector<double> max_aa(nmo2_, 0.0), max_ab(nmo2_, 0.0), max_bb(nmo2_, 0.0);
+#pragma omp parallel for
+    for (size_t pq = 0; pq < nmo2_; ++pq) {
+        const size_t p = pq / nmo_, q = pq % nmo_;
+        for (size_t r = 0; r < nmo_; ++r) {
+            for (size_t s = 0; s < nmo_; ++s) {
+                max_aa[pq] = std::max(max_aa[pq], std::fabs(tei_aa(p, q, r, s)));
+                max_ab[pq] = std::max(max_ab[pq], std::fabs(tei_ab(p, q, r, s)));
+                max_bb[pq] = std::max(max_bb[pq], std::fabs(tei_bb(p, q, r, s)));
+            }
+        }
+    }
+
+    // bounds to the single excitation couplings valid for any occupation
+    std::vector<double> single_a(nmo2_, 0.0), single_b(nmo2_, 0.0);
+    std::vector<double> max_single_a(nmo_, 0.0), max_single_b(nmo_, 0.0);
+#pragma omp parallel for
+    for (size_t i = 0; i < nmo_; ++i) {
+        for (size_t a = 0; a < nmo_; ++a) {
+            if (a == i or sym[i] != sym[a])
+                continue;
+            double fa = std::fabs(oei_a_[i * nmo_ + a]);
+            double fb = std::fabs(oei_b_[i * nmo_ + a]);
+            for (size_t p = 0; p < nmo_; ++p) {
+                fa += std::fabs(tei_aa(i, p, a, p)) + std::fabs(tei_ab(i, p, a, p));
+                fb += std::fabs(tei_ab(p, i, p, a)) + std::fabs(tei_bb(i, p, a, p));
+            }
+            single_a[i * nmo_ + a] = fa;
+            single_b[i * nmo_ + a] = fb;
+            max_single_a[i] = std::max(max_single_a[i], fa);
+            max_single_b[i] = std::max(max_single_b[i], fb);
+        }
+    }
+
+    // the largest double excitation couplings of each pair ij
+    std::vector<double> max_double_aa(nmo2_, 0.0), max_double_ab(nmo2_, 0.0),
+        max_double_bb(nmo2_, 0.0);
+#pragma omp parallel for schedule(dynamic)
+    for (size_t ij = 0; ij < nmo2_; ++ij) {
+        const size_t i = ij / nmo_, j = ij % nmo_;
+        for (size_t a = 0; a < nmo_; ++a) {
+            if (a == i)
+                continue;
+            for (size_t b = 0; b < nmo_; ++b) {
+                if (b == j or (sym[i] ^ sym[j] ^ sym[a] ^ sym[b]) != 0)
+                    continue;
+                max_double_ab[ij] = std::max(max_double_ab[ij], std::fabs(tei_ab(i, j, a, b)));
+                // |<ij||ab>| is invariant to swapping i, j or a, b, so the bound is stored for
+                // both orderings of each pair
+                if (i != j and a != b and a != j and b != i) {
+                    max_double_aa[ij] =
+                        std::max(max_double_aa[ij], std::fabs(tei_aa(i, j, a, b)));
+                    max_double_bb[ij] =
+                        std::max(max_double_bb[ij], std::fabs(tei_bb(i, j, a, b)));
+                }
+            }
+        }
+    }
+
+    max_tei_aa_ = std::move(max_aa);
+    max_tei_ab_ = std::move(max_ab);
+    max_tei_bb_ = std::move(max_bb);
+    single_bound_a_ = std::move(single_a);
+    single_bound_b_ = std::move(single_b);
+    max_single_a_ = std::move(max_single_a);
+    max_single_b_ = std::move(max_single_b);
+    max_double_aa_ = std::move(max_double_aa);
+    max_double_ab_ = std::move(max_double_ab);
+    max_double_bb_ = std::move(max_double_bb);
+    screening_ready_.store(true, std::memory_order_release);
+}
+
+void ActiveSpaceIntegrals::release_screening_tables() const {
+    std::lock_guard<std::mutex> lock(view_mutex_);
+    screening_ready_.store(false, std::memory_order_release);
+    for (auto* table :
+         {&max_tei_aa_, &max_tei_ab_, &max_tei_bb_, &single_bound_a_, &single_bound_b_,
+          &max_single_a_, &max_single_b_, &max_double_aa_, &max_double_ab_, &max_double_bb_}) {
+        std::vector<double>().swap(*table);
+    }
+}
+
+double ActiveSpaceIntegrals::screening_threshold() const {
+    std::lock_guard<std::mutex> lock(view_mutex_);
+    return screening_threshold_;
+}
+
+void ActiveSpaceIntegrals::set_screening_threshold(double threshold) {
+    std::lock_guard<std::mutex> lock(view_mutex_);
+    screening_threshold_ = threshold;
+}
+
+double ActiveSpaceIntegrals::max_tei_aa(size_t p, size_t q) const {
+    build_screening_tables();
+    return max_tei_aa_[p * nmo_ + q];
+}
+
+double ActiveSpaceIntegrals::max_tei_ab(size_t p, size_t q) const {
+    build_screening_tables();
+    return max_tei_ab_[p * nmo_ + q];
+}
+
+double ActiveSpaceIntegrals::max_tei_bb(size_t p, size_t q) const {
+    build_screening_tables();
+    return max_tei_bb_[p * nmo_ + q];
+}
+
+double ActiveSpaceIntegrals::single_coupling_bound_a(size_t i, size_t a) const {
+    build_screening_tables();
+    return single_bound_a_[i * nmo_ + a];
+}
+
+double ActiveSpaceIntegrals::single_coupling_bound_b(size_t i, size_t a) const {
+    build_screening_tables();
+    return single_bound_b_[i * nmo_ + a];
+}
+
+double ActiveSpaceIntegrals::max_single_coupling_a(size_t i) const {
+    build_screening_tables();
+    return max_single_a_[i];
+}
+
+double ActiveSpaceIntegrals::max_single_coupling_b(size_t i) const {
+    build_screening_tables();
+    return max_single_b_[i];
+}
+
+std::vector<DoubleExcitation> ActiveSpaceIntegrals::double_excitations_aa(size_t i, size_t j,
+                                                                           double threshold) const {
+    std::vector<DoubleExcitation> excitations;
+    if (i >= j)
+        return excitations;
+    const auto& sym = active_mo_symmetry_;
+    for (size_t a = 0; a < nmo_; ++a) {
+        if (a == i or a == j)
+            continue;
+        for (size_t b = a + 1; b < nmo_; ++b) {
+            if (b == i or b == j or (sym[i] ^ sym[j] ^ sym[a] ^ sym[b]) != 0)
+                continue;
+            double value = tei_aa(i, j, a, b);
+            if (std::fabs(value) >= threshold)
+                excitations.push_back({static_cast<uint32_t>(a), static_cast<uint32_t>(b), value});
+        }
+    }
+    std::sort(excitations.begin(), excitations.end(), by_decreasing_magnitude);
+    return excitations;
+}
+
+std::vector<DoubleExcitation> ActiveSpaceIntegrals::double_excitations_ab(size_t i, size_t j,
+                                                                           double threshold) const {
+    std::vector<DoubleExcitation> excitations;
+    const auto& sym = active_mo_symmetry_;
+    for (size_t a = 0; a < nmo_; ++a) {
+        if (a == i)
+            continue;
+        for (size_t b = 0; b < nmo_; ++b) {
+            if (b == j or (sym[i] ^ sym[j] ^ sym[a] ^ sym[b]) != 0)
+                continue;
+            double value = tei_ab(i, j, a, b);
+            if (std::fabs(value) >= threshold)
+                excitations.push_back({static_cast<uint32_t>(a), static_cast<uint32_t>(b), value});
+        }
+    }
+    std::sort(excitations.begin(), excitations.end(), by_decreasing_magnitude);
+    return excitations;
+}
+
+std::vector<DoubleExcitation> ActiveSpaceIntegrals::double_excitations_bb(size_t i, size_t j,
+                                                                           double threshold) const {
+    std::vector<DoubleExcitation> excitations;
+    if (i >= j)
+        return excitations;
+    const auto& sym = active_mo_symmetry_;
+    for (size_t a = 0; a < nmo_; ++a) {
+        if (a == i or a == j)
+            continue;
+        for (size_t b = a + 1; b < nmo_; ++b) {
+            if (b == i or b == j or (sym[i] ^ sym[j] ^ sym[a] ^ sym[b]) != 0)
+                continue;
+            double value = tei_bb(i, j, a, b);
+            if (std::fabs(value) >= threshold)
+                excitations.push_back({static_cast<uint32_t>(a), static_cast<uint32_t>(b), value});
+        }
+    }
+    std::sort(excitations.begin(), excitations.end(), by_decreasing_magnitude);
+    return excitations;
+}
+
+std::vector<DoubleExcitation> ActiveSpaceIntegrals::double_excitations_aa(size_t i,
+                                                                           size_t j) const {
+    return double_excitations_aa(i, j, screening_threshold());
+}
+
+std::vector<DoubleExcitation> ActiveSpaceIntegrals::double_excitations_ab(size_t i,
+                                                                           size_t j) const {
+    return double_excitations_ab(i, j, screening_threshold());
+}
+
+std::vector<DoubleExcitation> ActiveSpaceIntegrals::double_excitations_bb(size_t i,
+                                                                           size_t j) const {
+    return double_excitations_bb(i, j, screening_threshold());
+}
+
+double ActiveSpaceIntegrals::max_double_coupling_aa(size_t i, size_t j) const {
+    build_screening_tables();
+    return max_double_aa_[i * nmo_ + j];
+}
+
+double ActiveSpaceIntegrals::max_double_coupling_ab(size_t i, size_t j) const {
+    build_screening_tables();
+    return max_double_ab_[i * nmo_ + j];
+}
+
+double ActiveSpaceIntegrals::max_double_coupling_bb(size_t i, size_t j) const {
+    build_screening_tables();
+    return max_double_bb_[i * nmo_ + j];
+}
+
 std::vector<size_t> ActiveSpaceIntegrals::active_mo() const { return active_mo_; }
 
 std::vector<int> ActiveSpaceIntegrals::active_mo_symmetry() const { return active_mo_symmetry_; }
@@ -221,13 +751,13 @@ double ActiveSpaceIntegrals::energy(const Determinant& det) const {
         Iac = Ia;
         for (int AA = A + 1; AA < naocc; ++AA) {
             int q = Iac.find_and_clear_first_one();
-            energy += tei_aa_[p * nmo3_ + q * nmo2_ + p * nmo_ + q];
+            energy += diag_tei_aa(p, q);
         }
 
         Ibc = Ib;
         for (int B = 0; B < nbocc; ++B) {
             int q = Ibc.find_and_clear_first_one();
-            energy += tei_ab_[p * nmo3_ + q * nmo2_ + p * nmo_ + q];
+            energy += diag_tei_ab(p, q);
         }
     }
 
@@ -237,13 +767,56 @@ double ActiveSpaceIntegrals::energy(const Determinant& det) const {
         Ibc = Ib;
         for (int BB = B + 1; BB < nbocc; ++BB) {
             int q = Ibc.find_and_clear_first_one();
-            energy += tei_bb_[p * nmo3_ + q * nmo2_ + p * nmo_ + q];
+            energy += diag_tei_bb(p, q);
         }
     }
 
     return energy;
 }
 
+std::vector<double> ActiveSpaceIntegrals::energies(const std::vector<Determinant>& dets) const {
+    build_element_tables();
+    std::vector<double> result(dets.size());
+    const size_t ndets = dets.size();
+#pragma omp parallel
+    {
+        std::vector<int> aocc, bocc;
+#pragma omp for schedule(static)
+        for (size_t I = 0; I < ndets; ++I) {
+            occupied_list(dets[I].get_alfa_bits(), aocc);
+            occupied_list(dets[I].get_beta_bits(), bocc);
+            const size_t naocc = aocc.size();
+            const size_t nbocc = bocc.size();
+            double energy = frozen_core_energy_;
+            for (size_t A = 0; A < naocc; ++A) {
+                const size_t p = aocc[A];
+                const double* row_aa = diag_aa_table_.data() + p * nmo_;
+                const double* row_ab = diag_ab_table_.data() + p * nmo_;
+                energy += oei_a_[p * nmo_ + p];
+#pragma omp simd reduction(+ : energy)
+                for (size_t AA = A + 1; AA < naocc; ++AA) {
+                    energy += row_aa[aocc[AA]];
+                }
+#pragma omp simd reduction(+ : energy)
+                for (size_t B = 0; B < nbocc; ++B) {
+                    energy += row_ab[bocc[B]];
+                }
+            }
+            for (size_t B = 0; B < nbocc; ++B) {
+                const size_t p = bocc[B];
+                const double* row_bb = diag_bb_table_.data() + p * nmo_;
+                energy += oei_b_[p * nmo_ + p];
+#pragma omp simd reduction(+ : energy)
+                for (size_t BB = B + 1; BB < nbocc; ++BB) {
+                    energy += row_bb[bocc[BB]];
+                }
+            }
+            result[I] = energy;
+        }
+    }
+    return result;
+}
+
 double ActiveSpaceIntegrals::slater_rules(const Determinant& lhs, const Determinant& rhs) const {
     // we first check that the two determinants have equal Ms
     if ((lhs.count_alfa() != rhs.count_alfa()) or (lhs.count_beta() != rhs.count_beta()))
@@ -277,11 +850,11 @@ double ActiveSpaceIntegrals::slater_rules(const Determinant& lhs, const Determin
                 matrix_element += oei_b_[p * nmo_ + p];
             for (size_t q = 0; q < nmo_; ++q) {
                 if (lhs.get_alfa_bit(p) and lhs.get_alfa_bit(q))
-                    matrix_element += 0.5 * tei_aa_[p * nmo3_ + q * nmo2_ + p * nmo_ + q];
+                    matrix_element += 0.5 * diag_tei_aa(p, q);
                 if (lhs.get_beta_bit(p) and lhs.get_beta_bit(q))
-                    matrix_element += 0.5 * tei_bb_[p * nmo3_ + q * nmo2_ + p * nmo_ + q];
+                    matrix_element += 0.5 * diag_tei_bb(p, q);
                 if (lhs.get_alfa_bit(p) and lhs.get_beta_bit(q))
-                    matrix_element += tei_ab_[p * nmo3_ + q * nmo2_ + p * nmo_ + q];
+                    matrix_element += diag_tei_ab(p, q);
             }
         }
     }
@@ -302,10 +875,10 @@ double ActiveSpaceIntegrals::slater_rules(const Determinant& lhs, const Determin
         matrix_element = sign * oei_a_[i * nmo_ + j];
         for (size_t p = 0; p < nmo_; ++p) {
             if (lhs.get_alfa_bit(p) and rhs.get_alfa_bit(p)) {
-                matrix_element += sign * tei_aa_[i * nmo3_ + p * nmo2_ + j * nmo_ + p];
+                matrix_element += sign * tei_aa(i, p, j, p);
             }
             if (lhs.get_beta_bit(p) and rhs.get_beta_bit(p)) {
-                matrix_element += sign * tei_ab_[i * nmo3_ + p * nmo2_ + j * nmo_ + p];
+                matrix_element += sign * tei_ab(i, p, j, p);
             }
         }
     }
@@ -325,10 +898,10 @@ double ActiveSpaceIntegrals::slater_rules(const Determinant& lhs, const Determin
         matrix_element = sign * oei_b_[i * nmo_ + j];
         for (size_t p = 0; p < nmo_; ++p) {
             if (lhs.get_alfa_bit(p) and rhs.get_alfa_bit(p)) {
-                matrix_element += sign * tei_ab_[p * nmo3_ + i * nmo2_ + p * nmo_ + j];
+                matrix_element += sign * tei_ab(p, i, p, j);
             }
             if (lhs.get_beta_bit(p) and rhs.get_beta_bit(p)) {
-                matrix_element += sign * tei_bb_[i * nmo3_ + p * nmo2_ + j * nmo_ + p];
+                matrix_element += sign * tei_bb(i, p, j, p);
             }
         }
     }
@@ -357,7 +930,7 @@ double ActiveSpaceIntegrals::slater_rules(const Determinant& lhs, const Determin
             }
         }
         double sign = lhs.slater_sign_aaaa(i, j, k, l);
-        matrix_element = sign * tei_aa_[i * nmo3_ + j * nmo2_ + k * nmo_ + l];
+        matrix_element = sign * tei_aa(i, j, k, l);
     }
 
     // Slater rule 3 PhiI = k_a^+ l_a^+ j_a i_a PhiJ
@@ -385,7 +958,7 @@ double ActiveSpaceIntegrals::slater_rules(const Determinant& lhs, const Determin
             }
         }
         double sign = lhs.slater_sign_bbbb(i, j, k, l);
-        matrix_element = sign * tei_bb_[i * nmo3_ + j * nmo2_ + k * nmo_ + l];
+        matrix_element = sign * tei_bb(i, j, k, l);
     }
 
     // Slater rule 3 PhiI = j_a^+ i_a PhiJ
@@ -404,7 +977,7 @@ double ActiveSpaceIntegrals::slater_rules(const Determinant& lhs, const Determin
                 l = p;
         }
         double sign = lhs.slater_sign_aa(i, k) * lhs.slater_sign_bb(j, l);
-        matrix_element = sign * tei_ab_[i * nmo3_ + j * nmo2_ + k * nmo_ + l];
+        matrix_element = sign * tei_ab(i, j, k, l);
     }
 #endif
     return (matrix_element);
@@ -416,10 +989,10 @@ double ActiveSpaceIntegrals::slater_rules_single_alpha(const Determinant& det, i
     double matrix_element = oei_a_[i * nmo_ + a];
     for (size_t p = 0; p < nmo_; ++p) {
         if (det.get_alfa_bit(p)) {
-            matrix_element += tei_aa_[i * nmo3_ + p * nmo2_ + a * nmo_ + p];
+            matrix_element += tei_aa(i, p, a, p);
         }
         if (det.get_beta_bit(p)) {
-            matrix_element += tei_ab_[i * nmo3_ + p * nmo2_ + a * nmo_ + p];
+            matrix_element += tei_ab(i, p, a, p);
         }
     }
     return sign * matrix_element;
@@ -431,10 +1004,10 @@ double ActiveSpaceIntegrals::slater_rules_single_alpha_abs(const Determinant& de
     double matrix_element = oei_a_[i * nmo_ + a];
     for (size_t p = 0; p < nmo_; ++p) {
         if (det.get_alfa_bit(p)) {
-            matrix_element += tei_aa_[i * nmo3_ + p * nmo2_ + a * nmo_ + p];
+            matrix_element += tei_aa(i, p, a, p);
         }
         if (det.get_beta_bit(p)) {
-            matrix_element += tei_ab_[i * nmo3_ + p * nmo2_ + a * nmo_ + p];
+            matrix_element += tei_ab(i, p, a, p);
         }
     }
     return matrix_element;
@@ -446,10 +1019,10 @@ double ActiveSpaceIntegrals::slater_rules_single_beta(const Determinant& det, in
     double matrix_element = oei_b_[i * nmo_ + a];
     for (size_t p = 0; p < nmo_; ++p) {
         if (det.get_alfa_bit(p)) {
-            matrix_element += tei_ab_[p * nmo3_ + i * nmo2_ + p * nmo_ + a];
+            matrix_element += tei_ab(p, i, p, a);
         }
         if (det.get_beta_bit(p)) {
-            matrix_element += tei_bb_[i * nmo3_ + p * nmo2_ + a * nmo_ + p];
+            matrix_element += tei_bb(i, p, a, p);
         }
     }
     return sign * matrix_element;
@@ -461,28 +1034,94 @@ double ActiveSpaceIntegrals::slater_rules_single_beta_abs(const Determinant& det
     double matrix_element = oei_b_[i * nmo_ + a];
     for (size_t p = 0; p < nmo_; ++p) {
         if (det.get_alfa_bit(p)) {
-            matrix_element += tei_ab_[p * nmo3_ + i * nmo2_ + p * nmo_ + a];
+            matrix_element += tei_ab(p, i, p, a);
         }
         if (det.get_beta_bit(p)) {
-            matrix_element += tei_bb_[i * nmo3_ + p * nmo2_ + a * nmo_ + p];
+            matrix_element += tei_bb(i, p, a, p);
         }
     }
     return matrix_element;
 }
 
+void ActiveSpaceIntegrals::slater_rules_single_alpha_batch(const std::vector<int>& aocc,
+                                                           const std::vector<int>& bocc,
+                                                           std::vector<double>& elements) const {
+    build_element_tables();
+    elements.resize(aocc.size() * nmo_);
+    for (size_t k = 0, nocc = aocc.size(); k < nocc; ++k) {
+        const size_t i = aocc[k];
+        double* row = elements.data() + k * nmo_;
+        std::copy_n(oei_a_.data() + i * nmo_, nmo_, row);
+        for (int p : aocc) {
+            add_row(row, single_aa_table_.data() + p * nmo2_ + i * nmo_, nmo_);
+        }
+        for (int p : bocc) {
+            add_row(row, single_ab_table_.data() + p * nmo2_ + i * nmo_, nmo_);
+        }
+    }
+}
+
+void ActiveSpaceIntegrals::slater_rules_single_beta_batch(const std::vector<int>& aocc,
+                                                          const std::vector<int>& bocc,
+                                                          std::vector<double>& elements) const {
+    build_element_tables();
+    elements.resize(bocc.size() * nmo_);
+    for (size_t k = 0, nocc = bocc.size(); k < nocc; ++k) {
+        const size_t i = bocc[k];
+        double* row = elements.data() + k * nmo_;
+        std::copy_n(oei_b_.data() + i * nmo_, nmo_, row);
+        for (int p : aocc) {
+            add_row(row, single_ba_table_.data() + p * nmo2_ + i * nmo_, nmo_);
+        }
+        for (int p : bocc) {
+            add_row(row, single_bb_table_.data() + p * nmo2_ + i * nmo_, nmo_);
+        }
+    }
+}
+
 void ActiveSpaceIntegrals::add(std::shared_ptr<ActiveSpaceIntegrals> as_ints, const double factor) {
     if (as_ints->active_mo_symmetry() != active_mo_symmetry_)
         throw std::runtime_error("Inconsistent active orbitals cannot be added!");
+    if (tei_storage_ == TEIStorage::Factorized) {
+        throw std::runtime_error(
+            "ActiveSpaceIntegrals: cannot add integrals to factorized two-electron integrals");
+    }
 
     scalar_energy_ += factor * as_ints->scalar_energy();
 
     auto add_op = [&factor](double lhs, double rhs) { return lhs + factor * rhs; };
 
+    release_element_tables();
+    release_screening_tables();
+
     std::transform(oei_a_.begin(), oei_a_.end(), as_ints->oei_a_vector().begin(), oei_a_.begin(),
                    add_op);
     std::transform(oei_b_.begin(), oei_b_.end(), as_ints->oei_b_vector().begin(), oei_b_.begin(),
                    add_op);
 
+    if (tei_storage_ == TEIStorage::Packed) {
+        // only the alpha-beta integrals are stored, so as_ints must also be restricted
+        if (as_ints->tei_storage_ == TEIStorage::Packed) {
+            std::transform(tei_packed_.begin(), tei_packed_.end(), as_ints->tei_packed_.begin(),
+                           tei_packed_.begin(), add_op);
+        } else {
+#pragma omp parallel for schedule(dynamic)
+            for (size_t p = 0; p < nmo_; ++p) {
+                for (size_t q = 0; q <= p; ++q) {
+                    const size_t pq = pair_index(p, q);
+                    for (size_t r = 0; r <= p; ++r) {
+                        for (size_t s = 0; s <= r and pair_index(r, s) <= pq; ++s) {
+                            tei_packed_[pair_index(pq, pair_index(r, s))] +=
+                                factor * as_ints->tei_ab(p, r, q, s);
+                        }
+                    }
+                }
+            }
+        }
+        release_dense_tei();
+        return;
+    }
+
     std::transform(tei_aa_.begin(), tei_aa_.end(), as_ints->tei_aa_vector().begin(),
                    tei_aa_.begin(), add_op);
     std::transform(tei_ab_.begin(), tei_ab_.end(), as_ints->tei_ab_vector().begin(),
@@ -553,7 +1192,8 @@ void ActiveSpaceIntegrals::print() {
 std::shared_ptr<ActiveSpaceIntegrals>
 make_active_space_ints(std::shared_ptr<MOSpaceInfo> mo_space_info,
                        std::shared_ptr<ForteIntegrals> ints, const std::string& active_space,
-                       const std::vector<std::string>& core_spaces) {
+                       const std::vector<std::string>& core_spaces, bool packed_tei,
+                       bool factorized_tei, double factorization_threshold) {
 
     bool updated_ints = ints->update_ints_if_needed();
     if (updated_ints) {
@@ -576,7 +1216,17 @@ make_active_space_ints(std::shared_ptr<MOSpaceInfo> mo_space_info,
 
     // grab the integrals from the ForteIntegrals object
     if (ints->spin_restriction() == IntegralSpinRestriction::Restricted) {
+        if (factorized_tei) {
+            as_ints->set_factorized_active_integrals(factorization_threshold);
+            as_ints->compute_restricted_one_body_operator();
+            return as_ints;
+        }
         auto tei_active_ab = ints->aptei_ab_block(active_mo, active_mo, active_mo, active_mo);
+        if (packed_tei) {
+            as_ints->set_restricted_active_integrals(tei_active_ab);
+            as_ints->compute_restricted_one_body_operator();
+            return as_ints;
+        }
         auto tei_active_aa = tei_active_ab.clone();
         tei_active_aa("pqrs") = tei_active_ab("pqrs") - tei_active_ab("pqsr");
         tei_active_aa.set_name("tei_active_aa");
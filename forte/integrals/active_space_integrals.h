@@ -28,6 +28,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
 #include "integrals/integrals.h"
 #include "sparse_ci/determinant.h"
 
@@ -35,8 +39,25 @@ class Dimension;
 
 namespace forte {
 
+/// A double excitation (ij) -> (ab) returned by ActiveSpaceIntegrals::double_excitations_aa(), ...
+struct DoubleExcitation {
+    /// The first orbital created
+    uint32_t a;
+    /// The second orbital created
+    uint32_t b;
+    /// The integral <ij||ab> (same spin) or <ij|ab> (opposite spin)
+    double value;
+};
+
 /**
  * @brief The ActiveSpaceIntegrals class stores integrals necessary for active space solvers
+ *
+ * The two-electron integrals are stored either as three dense nmo^4 arrays (alpha-alpha,
+ * alpha-beta, beta-beta) or, for restricted orbitals, as a single array of the unique integrals
+ * (pq|rs) (see set_restricted_active_integrals()), or as a set of Cholesky vectors B^L_pq such
+ * that (pq|rs) ~ sum_L B^L_pq B^L_rs (see set_factorized_active_integrals()). The accessors
+ * tei_aa(), tei_ab(), and tei_bb() work in all cases, while the dense arrays returned by
+ * tei_aa_vector(), ... are built on request for packed and factorized integrals.
  */
 class ActiveSpaceIntegrals {
   public:
@@ -82,6 +103,10 @@ class ActiveSpaceIntegrals {
 
     /// Compute a determinant's energy
     double energy(const Determinant& det) const;
+    /// Compute the energy of a list of determinants
+    /// Equivalent to calling energy() for each determinant, but uses the occupied orbital lists of
+    /// each determinant and contiguous tables of the diagonal integrals
+    std::vector<double> energies(const std::vector<Determinant>& dets) const;
 
     /// Compute the matrix element of the Hamiltonian between this determinant
     /// and a given one
@@ -98,6 +123,78 @@ class ActiveSpaceIntegrals {
     /// Compute the matrix element of the Hamiltonian between this determinant
     /// and a given one
     double slater_rules_single_beta_abs(const Determinant& det, int i, int a) const;
+    /// Compute the matrix elements of all the alpha single excitations of a determinant
+    /// @param aocc the occupied alpha orbitals of the determinant
+    /// @param bocc the occupied beta orbitals of the determinant
+    /// @param elements on return elements[k * nmo + a] is equal to
+    ///        slater_rules_single_alpha_abs(det, aocc[k], a) (only meaningful for a unoccupied)
+    ///
+    /// The elements h_ia + sum_p <ip||ap> + sum_p <ip|ap> are accumulated for all a at once from
+    /// rows of integrals that are contiguous in a, which is much faster than calling
+    /// slater_rules_single_alpha() for each pair (i,a).
+    void slater_rules_single_alpha_batch(const std::vector<int>& aocc, const std::vector<int>& bocc,
+                                         std::vector<double>& elements) const;
+    /// Compute the matrix elements of all the beta single excitations of a determinant
+    /// @param aocc the occupied alpha orbitals of the determinant
+    /// @param bocc the occupied beta orbitals of the determinant
+    /// @param elements on return elements[k * nmo + a] is equal to
+    ///        slater_rules_single_beta_abs(det, bocc[k], a) (only meaningful for a unoccupied)
+    void slater_rules_single_beta_batch(const std::vector<int>& aocc, const std::vector<int>& bocc,
+                                        std::vector<double>& elements) const;
+
+    // ==> Screening Metadata <==
+    // These bounds (nmo^2 numbers each) are built from the integrals on first use and shared by
+    // all the solvers that use this object. They are rebuilt after the integrals change. The lists
+    // of double excitations are not stored, since they can hold up to nmo^4 entries.
+
+    /// Return max_rs |<pq||rs>| over the alpha-alpha integrals
+    double max_tei_aa(size_t p, size_t q) const;
+    /// Return max_rs |<pq|rs>| over the alpha-beta integrals
+    double max_tei_ab(size_t p, size_t q) const;
+    /// Return max_rs |<pq||rs>| over the beta-beta integrals
+    double max_tei_bb(size_t p, size_t q) const;
+    /// Return an upper bound to the coupling of any determinant with its alpha single excitation
+    /// i -> a, |h_ia| + sum_p |<ip||ap>| + sum_p |<ip|ap>|
+    double single_coupling_bound_a(size_t i, size_t a) const;
+    /// Return an upper bound to the coupling of any determinant with its beta single excitation
+    /// i -> a, |h_ia| + sum_p |<pi|pa>| + sum_p |<ip||ap>|
+    double single_coupling_bound_b(size_t i, size_t a) const;
+    /// Return the largest single_coupling_bound_a(i, a) over all the orbitals a
+    double max_single_coupling_a(size_t i) const;
+    /// Return the largest single_coupling_bound_b(i, a) over all the orbitals a
+    double max_single_coupling_b(size_t i) const;
+    /// Return the alpha-alpha double excitations (ij) -> (ab) sorted by decreasing |<ij||ab>|
+    /// Only the symmetry-allowed excitations with i < j, a < b, a and b not in {i, j}, and
+    /// |<ij||ab>| >= threshold are listed. The list is computed on each call and not stored.
+    std::vector<DoubleExcitation> double_excitations_aa(size_t i, size_t j,
+                                                        double threshold) const;
+    /// Return the alpha-beta double excitations (ij) -> (ab) sorted by decreasing |<ij|ab>|
+    /// Only the symmetry-allowed excitations with a != i, b != j, and |<ij|ab>| >= threshold are
+    /// listed. The list is computed on each call and not stored.
+    std::vector<DoubleExcitation> double_excitations_ab(size_t i, size_t j,
+                                                        double threshold) const;
+    /// Return the beta-beta double excitations (ij) -> (ab) sorted by decreasing |<ij||ab>|
+    /// (see double_excitations_aa())
+    std::vector<DoubleExcitation> double_excitations_bb(size_t i, size_t j,
+                                                        double threshold) const;
+    /// Return double_excitations_aa(i, j, screening_threshold())
+    std::vector<DoubleExcitation> double_excitations_aa(size_t i, size_t j) const;
+    /// Return double_excitations_ab(i, j, screening_threshold())
+    std::vector<DoubleExcitation> double_excitations_ab(size_t i, size_t j) const;
+    /// Return double_excitations_bb(i, j, screening_threshold())
+    std::vector<DoubleExcitation> double_excitations_bb(size_t i, size_t j) const;
+    /// Return the largest |<ij||ab>| over the alpha-alpha double excitations of (ij)
+    /// (symmetric in i and j)
+    double max_double_coupling_aa(size_t i, size_t j) const;
+    /// Return the largest |<ij|ab>| over the alpha-beta double excitations of (ij)
+    double max_double_coupling_ab(size_t i, size_t j) const;
+    /// Return the largest |<ij||ab>| over the beta-beta double excitations of (ij)
+    /// (symmetric in i and j)
+    double max_double_coupling_bb(size_t i, size_t j) const;
+    /// Return the default threshold of the double excitation lists
+    double screening_threshold() const;
+    /// Set the default threshold of the double excitation lists (default 1.0e-12)
+    void set_screening_threshold(double threshold);
 
     /// Return the alpha effective one-electron integral
     double oei_a(size_t p, size_t q) const { return oei_a_[p * nmo_ + q]; }
@@ -108,40 +205,87 @@ class ActiveSpaceIntegrals {
 
     /// Return the alpha-alpha antisymmetrized two-electron integral <pq||rs>
     double tei_aa(size_t p, size_t q, size_t r, size_t s) const {
+        if (tei_storage_ == TEIStorage::Packed)
+            return tei_packed_[packed_tei_index(p, r, q, s)] -
+                   tei_packed_[packed_tei_index(p, s, q, r)];
+        if (tei_storage_ == TEIStorage::Factorized)
+            return factorized_eri(p, r, q, s) - factorized_eri(p, s, q, r);
         return tei_aa_[nmo3_ * p + nmo2_ * q + nmo_ * r + s];
     }
     /// Return the alpha-beta two-electron integral <pq|rs>
     double tei_ab(size_t p, size_t q, size_t r, size_t s) const {
+        if (tei_storage_ == TEIStorage::Packed)
+            return tei_packed_[packed_tei_index(p, r, q, s)];
+        if (tei_storage_ == TEIStorage::Factorized)
+            return factorized_eri(p, r, q, s);
         return tei_ab_[nmo3_ * p + nmo2_ * q + nmo_ * r + s];
     }
     /// Return the beta-beta antisymmetrized two-electron integral <pq||rs>
     double tei_bb(size_t p, size_t q, size_t r, size_t s) const {
+        if (tei_storage_ != TEIStorage::Dense)
+            return tei_aa(p, q, r, s);
         return tei_bb_[nmo3_ * p + nmo2_ * q + nmo_ * r + s];
     }
 
     /// Return a vector of alpha-alpha antisymmetrized two-electron integrals
-    const std::vector<double>& tei_aa_vector() const { return tei_aa_; }
+    /// When the integrals are not dense, the dense integrals are built on the first call and kept
+    const std::vector<double>& tei_aa_vector() const;
     /// Return a vector of alpha-beta antisymmetrized two-electron integrals
-    const std::vector<double>& tei_ab_vector() const { return tei_ab_; }
+    /// When the integrals are not dense, the dense integrals are built on the first call and kept
+    const std::vector<double>& tei_ab_vector() const;
     /// Return a vector of beta-beta antisymmetrized two-electron integrals
-    const std::vector<double>& tei_bb_vector() const { return tei_bb_; }
+    /// When the integrals are not dense, the dense integrals are built on the first call and kept
+    const std::vector<double>& tei_bb_vector() const;
 
     /// Return the alpha-alpha antisymmetrized two-electron integral <pq||pq>
     double diag_tei_aa(size_t p, size_t q) const {
-        return tei_aa_[p * nmo3_ + q * nmo2_ + p * nmo_ + q];
+        if (tei_storage_ == TEIStorage::Factorized)
+            return tei_diag_J_[p * nmo_ + q] - tei_diag_K_[p * nmo_ + q];
+        return tei_aa(p, q, p, q);
     }
     /// Return the alpha-beta two-electron integral <pq|rs>
     double diag_tei_ab(size_t p, size_t q) const {
-        return tei_ab_[p * nmo3_ + q * nmo2_ + p * nmo_ + q];
+        if (tei_storage_ == TEIStorage::Factorized)
+            return tei_diag_J_[p * nmo_ + q];
+        return tei_ab(p, q, p, q);
     }
     /// Return the beta-beta antisymmetrized two-electron integral <pq||rs>
     double diag_tei_bb(size_t p, size_t q) const {
-        return tei_bb_[p * nmo3_ + q * nmo2_ + p * nmo_ + q];
+        if (tei_storage_ == TEIStorage::Factorized)
+            return diag_tei_aa(p, q);
+        return tei_bb(p, q, p, q);
     }
+
+    /// Are the two-electron integrals stored in packed (restricted) form?
+    bool packed_tei() const { return tei_storage_ == TEIStorage::Packed; }
+    /// Are the two-electron integrals stored as Cholesky vectors?
+    bool factorized_tei() const { return tei_storage_ == TEIStorage::Factorized; }
+    /// Return the number of Cholesky vectors used to factorize the two-electron integrals
+    size_t num_tei_factors() const { return nfactors_; }
+    /// Drop the dense integrals built by tei_aa_vector(), tei_ab_vector(), or tei_bb_vector()
+    /// when the integrals are packed or factorized
+    void release_dense_tei() const;
+
     IntegralType get_integral_type() { return integral_type_; }
     /// Set the active integrals
     void set_active_integrals(const ambit::Tensor& tei_aa, const ambit::Tensor& tei_ab,
                               const ambit::Tensor& tei_bb);
+    /// Set the active integrals for restricted orbitals and store them in packed form
+    /// @param tei_ab the alpha-beta integrals <pq|rs>, which must have the 8-fold permutational
+    ///        symmetry of real restricted orbitals. The alpha-alpha and beta-beta integrals are
+    ///        computed from them on the fly.
+    ///
+    /// Only the unique integrals (pq|rs) with p >= q, r >= s, and pq >= rs are stored, reducing
+    /// the storage from 3 nmo^4 to ~nmo^4/8 elements.
+    void set_restricted_active_integrals(const ambit::Tensor& tei_ab);
+    /// Set the active integrals for restricted orbitals as a low-rank factorization
+    /// @param threshold the pivoted Cholesky decomposition of the matrix (pq|rs) stops when the
+    ///        largest residual diagonal element is smaller than this value
+    ///
+    /// The integrals (pq|rs) ~ sum_L B^L_pq B^L_rs are computed on the fly from the nmo^2 N_L / 2
+    /// Cholesky vectors, so the four-index integrals are never formed. A larger threshold yields
+    /// fewer vectors and cheaper integrals at the cost of accuracy.
+    void set_factorized_active_integrals(double threshold);
     /// Compute the restricted_docc operator
     /// F^{closed}_{uv} = h_{uv} + \sum_{i = frozen_core}^{restricted_core} 2(uv|ii) - (ui|vi)
     void compute_restricted_one_body_operator();
@@ -150,6 +294,7 @@ class ActiveSpaceIntegrals {
                                           const std::vector<double>& oei_b) {
         oei_a_ = oei_a;
         oei_b_ = oei_b;
+        release_screening_tables();
     }
 
     /// Streamline the process of setting up active integrals and
@@ -196,6 +341,56 @@ class ActiveSpaceIntegrals {
     /// The beta-beta antisymmetrized two-electron integrals in physicist
     /// notation
     std::vector<double> tei_bb_;
+    /// The storage schemes for the two-electron integrals
+    enum class TEIStorage { Dense, Packed, Factorized };
+    /// How the two-electron integrals are stored
+    TEIStorage tei_storage_ = TEIStorage::Dense;
+    /// The unique two-electron integrals (pq|rs) in chemist notation (used when packed)
+    std::vector<double> tei_packed_;
+    /// The Cholesky vectors B^L_pq stored as [pair_index(p,q)][L] (used when factorized)
+    std::vector<double> tei_factors_;
+    /// The number of Cholesky vectors
+    size_t nfactors_ = 0;
+    /// The Coulomb integrals (pp|qq) (used when factorized)
+    std::vector<double> tei_diag_J_;
+    /// The exchange integrals (pq|qp) (used when factorized)
+    std::vector<double> tei_diag_K_;
+    /// The dense alpha-alpha integrals built from the packed or factorized integrals on request
+    mutable std::vector<double> tei_aa_view_;
+    /// The dense alpha-beta integrals built from the packed or factorized integrals on request
+    mutable std::vector<double> tei_ab_view_;
+    /// Guards the construction of the dense integrals, of the element tables, and of the
+    /// screening tables
+    mutable std::mutex view_mutex_;
+    /// Have the tables used by the batched matrix element functions been built?
+    mutable std::atomic<bool> tables_ready_{false};
+    /// The integrals <ip||ap> stored as [p][i][a] (alpha excitation, alpha spectator p)
+    mutable std::vector<double> single_aa_table_;
+    /// The integrals <ip|ap> stored as [p][i][a] (alpha excitation, beta spectator p)
+    mutable std::vector<double> single_ab_table_;
+    /// The integrals <pi|pa> stored as [p][i][a] (beta excitation, alpha spectator p)
+    mutable std::vector<double> single_ba_table_;
+    /// The integrals <ip||ap> stored as [p][i][a] (beta excitation, beta spectator p)
+    mutable std::vector<double> single_bb_table_;
+    /// The diagonal integrals diag_tei_aa(p,q) stored as [p][q]
+    mutable std::vector<double> diag_aa_table_;
+    /// The diagonal integrals diag_tei_ab(p,q) stored as [p][q]
+    mutable std::vector<double> diag_ab_table_;
+    /// The diagonal integrals diag_tei_bb(p,q) stored as [p][q]
+    mutable std::vector<double> diag_bb_table_;
+    /// Have the screening tables been built?
+    mutable std::atomic<bool> screening_ready_{false};
+    /// The default threshold of the double excitation lists (guarded by view_mutex_)
+    double screening_threshold_ = 1.0e-12;
+    /// The bounds max_rs |<pq||rs>| (alpha-alpha), |<pq|rs>| (alpha-beta), and |<pq||rs>|
+    /// (beta-beta) stored as [p][q]
+    mutable std::vector<double> max_tei_aa_, max_tei_ab_, max_tei_bb_;
+    /// The alpha and beta single coupling bounds stored as [i][a]
+    mutable std::vector<double> single_bound_a_, single_bound_b_;
+    /// The largest alpha and beta single coupling bounds of each orbital
+    mutable std::vector<double> max_single_a_, max_single_b_;
+    /// The largest alpha-alpha, alpha-beta, and beta-beta double couplings stored as [i][j]
+    mutable std::vector<double> max_double_aa_, max_double_ab_, max_double_bb_;
     /// A vector of indices for the active molecular orbitals
     std::vector<size_t> active_mo_;
     /// A vector of the symmetry of the active molecular orbitals
@@ -209,12 +404,45 @@ class ActiveSpaceIntegrals {
         return nmo3_ * p + nmo2_ * q + nmo_ * r + s;
     }
 
+    /// Return the index of the pair (p,q) in a lower-triangular packed array
+    static size_t pair_index(size_t p, size_t q) {
+        return p >= q ? p * (p + 1) / 2 + q : q * (q + 1) / 2 + p;
+    }
+    /// Return the index of the integral (pq|rs) in tei_packed_
+    static size_t packed_tei_index(size_t p, size_t q, size_t r, size_t s) {
+        return pair_index(pair_index(p, q), pair_index(r, s));
+    }
+    /// Return (pq|rs) from the Cholesky vectors
+    double factorized_eri(size_t p, size_t q, size_t r, size_t s) const {
+        const double* Bpq = tei_factors_.data() + pair_index(p, q) * nfactors_;
+        const double* Brs = tei_factors_.data() + pair_index(r, s) * nfactors_;
+        double value = 0.0;
+        for (size_t L = 0; L < nfactors_; ++L)
+            value += Bpq[L] * Brs[L];
+        return value;
+    }
+    /// Build the dense integrals from the packed or factorized integrals
+    void build_dense_tei() const;
+    /// Release all the two-electron integrals
+    void clear_tei();
+    /// Build the integral tables used by the batched matrix element functions
+    void build_element_tables() const;
+    /// Drop the integral tables used by the batched matrix element functions
+    void release_element_tables() const;
+    /// Build the screening tables
+    void build_screening_tables() const;
+    /// Drop the screening tables
+    void release_screening_tables() const;
+    /// Compute the restricted_docc operator from the inactive Fock matrix built by ints_
+    void compute_restricted_one_body_operator_from_fock();
+
     void startup();
 };
 
 std::shared_ptr<ActiveSpaceIntegrals>
 make_active_space_ints(std::shared_ptr<forte::MOSpaceInfo> mo_space_info,
                        std::shared_ptr<ForteIntegrals> ints, const std::string& active_space,
-                       const std::vector<std::string>& core_spaces);
+                       const std::vector<std::string>& core_spaces, bool packed_tei = false,
+                       bool factorized_tei = false, double factorization_threshold = 1.0e-10);
 
 } // namespace forte
@@ -0,0 +1,152 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "blocked_df_store.h"
+
+namespace forte {
+
+BlockedDFStore::BlockedDFStore(const std::string& filename, size_t naux, size_t nmo,
+                               size_t tile_rows)
+    : filename_(filename), naux_(naux), nmo_(nmo), tile_rows_(std::max<size_t>(tile_rows, 1)) {}
+
+BlockedDFStore::~BlockedDFStore() {
+    unmap();
+    std::remove(filename_.c_str());
+}
+
+void BlockedDFStore::unmap() {
+    if (data_ != nullptr) {
+        munmap(const_cast<double*>(data_), size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+}
+
+void BlockedDFStore::write(
+    const std::function<void(size_t p_begin, size_t p_end, double* buffer)>& fill_tile) {
+    unmap();
+
+    std::ofstream file(filename_, std::ios::binary | std::ios::trunc);
+    if (not file.is_open()) {
+        throw std::runtime_error("BlockedDFStore: cannot open " + filename_);
+    }
+    std::vector<double> buffer(naux_ * tile_rows_ * nmo_);
+    for (size_t p_begin = 0; p_begin < nmo_; p_begin += tile_rows_) {
+        size_t p_end = std::min(p_begin + tile_rows_, nmo_);
+        size_t tile_size = naux_ * (p_end - p_begin) * nmo_;
+        fill_tile(p_begin, p_end, buffer.data());
+        file.write(reinterpret_cast<const char*>(buffer.data()), tile_size * sizeof(double));
+    }
+    file.close();
+    if (file.fail()) {
+        throw std::runtime_error("BlockedDFStore: failed to write " + filename_);
+    }
+
+    size_ = naux_ * nmo_ * nmo_ * sizeof(double);
+    if (size_ == 0) {
+        return;
+    }
+    int fd = open(filename_.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("BlockedDFStore: cannot open " + filename_);
+    }
+    void* addr = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        size_ = 0;
+        throw std::runtime_error("BlockedDFStore: cannot map " + filename_);
+    }
+    data_ = static_cast<const double*>(addr);
+}
+
+void BlockedDFStore::read(size_t Q_begin, size_t Q_end, const std::vector<size_t>& p,
+                          const std::vector<size_t>& q, bool pqQ, double* out) const {
+    if (Q_begin > Q_end or Q_end > naux_) {
+        throw std::runtime_error("BlockedDFStore: auxiliary indices out of range");
+    }
+    if (std::any_of(p.begin(), p.end(), [&](size_t x) { return x >= nmo_; }) or
+        std::any_of(q.begin(), q.end(), [&](size_t x) { return x >= nmo_; })) {
+        throw std::runtime_error("BlockedDFStore: orbital indices out of range");
+    }
+    const size_t nQ = Q_end - Q_begin;
+    const size_t np = p.size();
+    const size_t nq = q.size();
+    if (nQ * np * nq == 0) {
+        return;
+    }
+    if (data_ == nullptr) {
+        throw std::runtime_error("BlockedDFStore: the integrals have not been written");
+    }
+
+    bool q_contiguous = true;
+    for (size_t iq = 1; iq < nq; ++iq) {
+        if (q[iq] != q[0] + iq) {
+            q_contiguous = false;
+            break;
+        }
+    }
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t ip = 0; ip < np; ++ip) {
+        const size_t tile = p[ip] / tile_rows_;
+        const size_t row = p[ip] % tile_rows_;
+        const size_t rows = std::min(tile_rows_, nmo_ - tile * tile_rows_);
+        const double* tile_data = data_ + tile * tile_rows_ * naux_ * nmo_;
+        for (size_t iQ = 0; iQ < nQ; ++iQ) {
+            const double* B = tile_data + ((Q_begin + iQ) * rows + row) * nmo_;
+            if (pqQ) {
+                double* dst = out + ip * nq * nQ + iQ;
+                for (size_t iq = 0; iq < nq; ++iq) {
+                    dst[iq * nQ] = B[q[iq]];
+                }
+            } else {
+                double* dst = out + (iQ * np + ip) * nq;
+                if (q_contiguous) {
+                    std::memcpy(dst, B + q[0], nq * sizeof(double));
+                } else {
+                    for (size_t iq = 0; iq < nq; ++iq) {
+                        dst[iq] = B[q[iq]];
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace forte
@@ -0,0 +1,105 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace forte {
+
+/**
+ * @brief The BlockedDFStore class
+ * Stores the three-index integrals B(Q|pq) in a file owned by Forte and reads them back through a
+ * memory map.
+ *
+ * The first orbital index is split into tiles of tile_rows orbitals. Each tile stores the slab
+ * B(Q|pq) for all Q, the orbitals p in the tile, and all q (in this order), and the tiles are
+ * stored one after the other. Reading the integrals for a given p touches a single tile, so the
+ * data needed by both the Qpq and the pqQ orderings is contiguous on disk. With tile_rows = 1 the
+ * file is p-major and each p slab is a contiguous (Q, q) matrix.
+ */
+class BlockedDFStore {
+  public:
+    /// @brief Create a store
+    /// @param filename the file used to store the integrals (deleted when the store is destroyed)
+    /// @param naux the number of auxiliary functions
+    /// @param nmo the number of orbitals
+    /// @param tile_rows the number of orbitals p in each tile
+    BlockedDFStore(const std::string& filename, size_t naux, size_t nmo, size_t tile_rows);
+
+    /// Unmap and delete the file
+    ~BlockedDFStore();
+
+    BlockedDFStore(const BlockedDFStore&) = delete;
+    BlockedDFStore& operator=(const BlockedDFStore&) = delete;
+
+    /// @brief Write the integrals to disk one tile at a time and map the file in memory
+    /// @param fill_tile a function that, given a range of orbitals [p_begin, p_end), fills a
+    ///        buffer with B(Q|pq) stored in the order Q, p, q
+    void write(const std::function<void(size_t p_begin, size_t p_end, double* buffer)>& fill_tile);
+
+    /// @brief Copy a block of integrals
+    /// @param Q_begin the first auxiliary index
+    /// @param Q_end one past the last auxiliary index
+    /// @param p the orbital indices p
+    /// @param q the orbital indices q
+    /// @param pqQ if true the output is stored in the order p, q, Q, otherwise Q, p, q
+    /// @param out the output buffer ((Q_end - Q_begin) * p.size() * q.size() elements)
+    void read(size_t Q_begin, size_t Q_end, const std::vector<size_t>& p,
+              const std::vector<size_t>& q, bool pqQ, double* out) const;
+
+    /// @return the number of auxiliary functions
+    size_t naux() const { return naux_; }
+    /// @return the number of orbitals
+    size_t nmo() const { return nmo_; }
+    /// @return the number of orbitals in each tile
+    size_t tile_rows() const { return tile_rows_; }
+    /// @return the number of tiles
+    size_t ntiles() const { return (nmo_ + tile_rows_ - 1) / tile_rows_; }
+
+  private:
+    /// The file name
+    std::string filename_;
+    /// The number of auxiliary functions
+    size_t naux_;
+    /// The number of orbitals
+    size_t nmo_;
+    /// The number of orbitals in each tile
+    size_t tile_rows_;
+    /// The memory-mapped file (nullptr before write is called)
+    const double* data_ = nullptr;
+    /// The size of the mapped file in bytes
+    size_t size_ = 0;
+
+    /// Unmap the file
+    void unmap();
+};
+
+} // namespace forte
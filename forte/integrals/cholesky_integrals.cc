@@ -27,8 +27,16 @@
  */
 
 #include <cmath>
+#include <algorithm>
 #include <cstring>
 
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp_get_max_threads() 1
+#define omp_get_thread_num() 0
+#endif
+
 #include "psi4/libpsi4util/process.h"
 #include "psi4/libmints/basisset.h"
 #include "psi4/libmints/wavefunction.h"
@@ -45,6 +53,7 @@
 
 #include "base_classes/forte_options.h"
 
+#include "shared_integral_store.h"
 #include "cholesky_integrals.h"
 
 using namespace ambit;
@@ -65,8 +74,7 @@ void CholeskyIntegrals::initialize() {
 
     if (not skip_build_) {
         local_timer int_timer;
-        gather_integrals();
-        freeze_core_orbitals();
+        build_two_electron_integrals();
         print_timing("computing Cholesky integrals", int_timer.get());
     }
 }
@@ -74,27 +82,27 @@ void CholeskyIntegrals::initialize() {
 double CholeskyIntegrals::aptei_aa(size_t p, size_t q, size_t r, size_t s) const {
     double vpqrsalphaC = 0.0;
     double vpqrsalphaE = 0.0;
-    vpqrsalphaC = C_DDOT(nthree_, &(ThreeIntegral_->pointer()[p * aptei_idx_ + r][0]), 1,
-                         &(ThreeIntegral_->pointer()[q * aptei_idx_ + s][0]), 1);
-    vpqrsalphaE = C_DDOT(nthree_, &(ThreeIntegral_->pointer()[p * aptei_idx_ + s][0]), 1,
-                         &(ThreeIntegral_->pointer()[q * aptei_idx_ + r][0]), 1);
+    vpqrsalphaC = C_DDOT(nthree_, &(three_rows()[p * aptei_idx_ + r][0]), 1,
+                         &(three_rows()[q * aptei_idx_ + s][0]), 1);
+    vpqrsalphaE = C_DDOT(nthree_, &(three_rows()[p * aptei_idx_ + s][0]), 1,
+                         &(three_rows()[q * aptei_idx_ + r][0]), 1);
 
     return (vpqrsalphaC - vpqrsalphaE);
 }
 
 double CholeskyIntegrals::aptei_ab(size_t p, size_t q, size_t r, size_t s) const {
     double vpqrsalphaC = 0.0;
-    vpqrsalphaC = C_DDOT(nthree_, &(ThreeIntegral_->pointer()[p * aptei_idx_ + r][0]), 1,
-                         &(ThreeIntegral_->pointer()[q * aptei_idx_ + s][0]), 1);
+    vpqrsalphaC = C_DDOT(nthree_, &(three_rows()[p * aptei_idx_ + r][0]), 1,
+                         &(three_rows()[q * aptei_idx_ + s][0]), 1);
     return (vpqrsalphaC);
 }
 
 double CholeskyIntegrals::aptei_bb(size_t p, size_t q, size_t r, size_t s) const {
     double vpqrsalphaC = 0.0, vpqrsalphaE = 0.0;
-    vpqrsalphaC = C_DDOT(nthree_, &(ThreeIntegral_->pointer()[p * aptei_idx_ + r][0]), 1,
-                         &(ThreeIntegral_->pointer()[q * aptei_idx_ + s][0]), 1);
-    vpqrsalphaE = C_DDOT(nthree_, &(ThreeIntegral_->pointer()[p * aptei_idx_ + s][0]), 1,
-                         &(ThreeIntegral_->pointer()[q * aptei_idx_ + r][0]), 1);
+    vpqrsalphaC = C_DDOT(nthree_, &(three_rows()[p * aptei_idx_ + r][0]), 1,
+                         &(three_rows()[q * aptei_idx_ + s][0]), 1);
+    vpqrsalphaE = C_DDOT(nthree_, &(three_rows()[p * aptei_idx_ + s][0]), 1,
+                         &(three_rows()[q * aptei_idx_ + r][0]), 1);
 
     return (vpqrsalphaC - vpqrsalphaE);
 }
@@ -102,43 +110,32 @@ ambit::Tensor CholeskyIntegrals::aptei_aa_block(const std::vector<size_t>& p,
                                                 const std::vector<size_t>& q,
                                                 const std::vector<size_t>& r,
                                                 const std::vector<size_t>& s) {
-    ambit::Tensor ReturnTensor =
-        ambit::Tensor::build(tensor_type_, "Return", {p.size(), q.size(), r.size(), s.size()});
-    ReturnTensor.iterate([&](const std::vector<size_t>& i, double& value) {
-        value = aptei_aa(p[i[0]], q[i[1]], r[i[2]], s[i[3]]);
-    });
-    return ReturnTensor;
+    return three_index_aptei_block(three_rows(), p, q, r, s, true);
 }
 
 ambit::Tensor CholeskyIntegrals::aptei_ab_block(const std::vector<size_t>& p,
                                                 const std::vector<size_t>& q,
                                                 const std::vector<size_t>& r,
                                                 const std::vector<size_t>& s) {
-    ambit::Tensor ReturnTensor =
-        ambit::Tensor::build(tensor_type_, "Return", {p.size(), q.size(), r.size(), s.size()});
-    ReturnTensor.iterate([&](const std::vector<size_t>& i, double& value) {
-        value = aptei_ab(p[i[0]], q[i[1]], r[i[2]], s[i[3]]);
-    });
-    return ReturnTensor;
+    return three_index_aptei_block(three_rows(), p, q, r, s, false);
 }
 
 ambit::Tensor CholeskyIntegrals::aptei_bb_block(const std::vector<size_t>& p,
                                                 const std::vector<size_t>& q,
                                                 const std::vector<size_t>& r,
                                                 const std::vector<size_t>& s) {
-    ambit::Tensor ReturnTensor =
-        ambit::Tensor::build(tensor_type_, "Return", {p.size(), q.size(), r.size(), s.size()});
-    ReturnTensor.iterate([&](const std::vector<size_t>& i, double& value) {
-        value = aptei_bb(p[i[0]], q[i[1]], r[i[2]], s[i[3]]);
-    });
-    return ReturnTensor;
+    return three_index_aptei_block(three_rows(), p, q, r, s, true);
 }
 
 double CholeskyIntegrals::three_integral(size_t A, size_t p, size_t q) const {
-    return ThreeIntegral_->get(p * aptei_idx_ + q, A);
+    return three_rows()[p * aptei_idx_ + q][A];
 }
 
-double** CholeskyIntegrals::three_integral_pointer() { return ThreeIntegral_->pointer(); }
+double** CholeskyIntegrals::three_integral_pointer() { return three_rows(); }
+
+double** CholeskyIntegrals::three_rows() const {
+    return shared_ints_ ? const_cast<double**>(shared_rows_.data()) : ThreeIntegral_->pointer();
+}
 
 ambit::Tensor CholeskyIntegrals::three_integral_block(const std::vector<size_t>& A,
                                                       const std::vector<size_t>& p,
@@ -259,35 +256,63 @@ void CholeskyIntegrals::gather_integrals() {
 }
 
 void CholeskyIntegrals::transform_integrals() {
-    TensorType tensor_type = CoreTensor;
+    // When requested, transform directly to the correlated MOs. The frozen-core operator is built
+    // with a JK object, so the frozen orbitals never enter the three-index integrals.
+    correlated_only_ = options_->get_bool("CHOLESKY_CORRELATED_ONLY") and (ncmo_ < nmo_);
+    const size_t nout = correlated_only_ ? ncmo_ : nmo_;
 
+    // C(m,p) for the target MOs, stored contiguously
     auto Ca_ao = Ca_AO();
+    std::vector<double> C(nso_ * nout);
+    for (size_t m = 0; m < nso_; ++m) {
+        for (size_t p = 0; p < nout; ++p) {
+            C[m * nout + p] = Ca_ao->get(m, correlated_only_ ? cmotomo_[p] : p);
+        }
+    }
 
-    auto ThreeIntegral_ao = ambit::Tensor::build(tensor_type, "ThreeIndex", {nthree_, nso_, nso_});
-    auto Cpq_tensor = ambit::Tensor::build(tensor_type, "C_sorted", {nso_, nmo_});
-    auto ThreeIntegral = ambit::Tensor::build(tensor_type, "ThreeIndex", {nthree_, nmo_, nmo_});
-
-    Cpq_tensor.iterate(
-        [&](const std::vector<size_t>& i, double& value) { value = Ca_ao->get(i[0], i[1]); });
-    ThreeIntegral_ao.iterate([&](const std::vector<size_t>& i, double& value) {
-        value = L_ao_->get(i[0], i[1] * nso_ + i[2]);
-    });
-    auto ThreeInt = std::make_shared<psi::Matrix>("Lmo", nmo_ * nmo_, nthree_);
-    ThreeIntegral_ = ThreeInt;
-
-    ThreeIntegral("L,p,q") = ThreeIntegral_ao("L,m,n") * Cpq_tensor("m,p") * Cpq_tensor("n,q");
+    ThreeIntegral_ = std::make_shared<psi::Matrix>("Lmo", nout * nout, nthree_);
+    double** Lmo = ThreeIntegral_->pointer();
+    double** Lao = L_ao_->pointer();
+
+    // Transform the vectors in batches. Each thread transforms one vector at a time,
+    // (L|pq) = sum_mn C(m,p) (L|mn) C(n,q), into a batch buffer that is then copied to the
+    // columns of ThreeIntegral_ one row at a time.
+    const size_t nthread = omp_get_max_threads();
+    const size_t batch_size = std::min(nthree_, std::max<size_t>(nthread, 16));
+    const size_t npq = nout * nout;
+    std::vector<double> batch(batch_size * npq);
+    std::vector<std::vector<double>> half(nthread, std::vector<double>(nso_ * nout));
+
+    for (size_t L_begin = 0; L_begin < nthree_; L_begin += batch_size) {
+        const size_t nL = std::min(batch_size, nthree_ - L_begin);
+#pragma omp parallel for schedule(dynamic)
+        for (size_t L = 0; L < nL; ++L) {
+            auto& tmp = half[omp_get_thread_num()];
+            C_DGEMM('N', 'N', nso_, nout, nso_, 1.0, Lao[L_begin + L], nso_, C.data(), nout, 0.0,
+                    tmp.data(), nout);
+            C_DGEMM('T', 'N', nout, nout, nso_, 1.0, C.data(), nout, tmp.data(), nout, 0.0,
+                    batch.data() + L * npq, nout);
+        }
+#pragma omp parallel for
+        for (size_t pq = 0; pq < npq; ++pq) {
+            for (size_t L = 0; L < nL; ++L) {
+                Lmo[pq][L_begin + L] = batch[L * npq + pq];
+            }
+        }
+    }
 
-    ThreeIntegral.iterate([&](const std::vector<size_t>& i, double& value) {
-        ThreeIntegral_->set(i[1] * nmo_ + i[2], i[0], value);
-    });
+    // The AO vectors are not needed anymore
+    L_ao_.reset();
 }
 
 void CholeskyIntegrals::resort_integrals_after_freezing() {
     if (print_ > 1) {
         outfile->Printf("\n  Resorting integrals after freezing core.");
     }
-    // Resort the three-index integrals
-    resort_three(ThreeIntegral_, cmotomo_);
+    // Resort the three-index integrals (not needed if they were built for the correlated MOs)
+    if (not correlated_only_) {
+        resort_three(ThreeIntegral_, cmotomo_);
+    }
 }
 
 void CholeskyIntegrals::resort_three(std::shared_ptr<psi::Matrix>& threeint,
@@ -314,5 +339,26 @@ void CholeskyIntegrals::resort_three(std::shared_ptr<psi::Matrix>& threeint,
     threeint->copy(temp_threeint);
 }
 
+bool CholeskyIntegrals::rotate_two_electron_integrals(const std::vector<double>& U) {
+    auto U_corr = rotation_block(U, cmotomo_);
+    if (U_corr.empty()) {
+        return false;
+    }
+    rotate_three_index(ThreeIntegral_->pointer()[0], ncmo_, nthree_, U_corr);
+    return true;
+}
+
+std::string CholeskyIntegrals::shared_integrals_label() const {
+    return "CD " + std::to_string(options_->get_double("CHOLESKY_TOLERANCE"));
+}
+
+void CholeskyIntegrals::shared_integrals_changed() {
+    // the shared copy replaces the private one
+    if (shared_ints_) {
+        nthree_ = shared_ints_->ncol();
+        ThreeIntegral_.reset();
+    }
+}
+
 size_t CholeskyIntegrals::nthree() const { return nthree_; }
 } // namespace forte
@@ -78,10 +78,14 @@ class CholeskyIntegrals : public Psi4Integrals {
     std::shared_ptr<psi::Matrix> ThreeIntegral_;
     std::shared_ptr<psi::Matrix> L_ao_;
     size_t nthree_ = 0;
+    /// Were the integrals transformed only for the correlated MOs?
+    bool correlated_only_ = false;
 
     // ==> Class private functions <==
 
     double three_integral(size_t A, size_t p, size_t q) const;
+    /// Pointers to the rows of the private or the shared three-index integrals
+    double** three_rows() const;
     void resort_three(std::shared_ptr<psi::Matrix>& threeint, std::vector<size_t>& map);
     void transform_integrals();
 
@@ -89,6 +93,9 @@ class CholeskyIntegrals : public Psi4Integrals {
 
     void gather_integrals() override;
     void resort_integrals_after_freezing() override;
+    bool rotate_two_electron_integrals(const std::vector<double>& U) override;
+    std::string shared_integrals_label() const override;
+    void shared_integrals_changed() override;
 };
 
 } // namespace forte
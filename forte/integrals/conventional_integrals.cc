@@ -26,6 +26,7 @@
  * @END LICENSE
  */
 
+#include <algorithm>
 #include <cmath>
 
 #include "psi4/psi4-dec.h"
@@ -36,6 +37,7 @@
 #include "psi4/libpsio/psio.hpp"
 #include "psi4/libtrans/integraltransform.h"
 
+#include "base_classes/forte_options.h"
 #include "base_classes/mo_space_info.h"
 
 #include "helpers/blockedtensorfactory.h"
@@ -55,7 +57,9 @@ ConventionalIntegrals::ConventionalIntegrals(std::shared_ptr<ForteOptions> optio
                                              std::shared_ptr<psi::Wavefunction> ref_wfn,
                                              std::shared_ptr<MOSpaceInfo> mo_space_info,
                                              IntegralSpinRestriction restricted)
-    : Psi4Integrals(options, scf_info, ref_wfn, mo_space_info, Conventional, restricted) {}
+    : Psi4Integrals(options, scf_info, ref_wfn, mo_space_info, Conventional, restricted) {
+    active_only_ = options->get_bool("CONVENTIONAL_ACTIVE_ONLY");
+}
 
 void ConventionalIntegrals::initialize() {
     Psi4Integrals::base_initialize_psi4();
@@ -69,11 +73,12 @@ void ConventionalIntegrals::initialize() {
     }
 }
 
-std::shared_ptr<psi::IntegralTransform> ConventionalIntegrals::transform_integrals() {
+std::shared_ptr<psi::IntegralTransform>
+ConventionalIntegrals::transform_integrals(std::shared_ptr<psi::MOSpace> space) {
 
-    // For now, we'll just transform for closed shells and generate all integrals
+    // For now, we'll just transform for closed shells
     std::vector<std::shared_ptr<MOSpace>> spaces;
-    spaces.push_back(MOSpace::all);
+    spaces.push_back(space);
 
     std::shared_ptr<psi::IntegralTransform> integral_transform;
 
@@ -97,7 +102,7 @@ std::shared_ptr<psi::IntegralTransform> ConventionalIntegrals::transform_integra
     // Keep the SO integrals on disk in case we want to retransform them
     integral_transform->set_keep_iwl_so_ints(true);
     local_timer int_timer;
-    integral_transform->transform_tei(MOSpace::all, MOSpace::all, MOSpace::all, MOSpace::all);
+    integral_transform->transform_tei(space, space, space, space);
 
     dpd_set_default(integral_transform->get_dpd_id());
     if (print_ > 1) {
@@ -107,14 +112,20 @@ std::shared_ptr<psi::IntegralTransform> ConventionalIntegrals::transform_integra
 }
 
 double ConventionalIntegrals::aptei_aa(size_t p, size_t q, size_t r, size_t s) const {
+    if (active_only_)
+        return aphys_tei_aa_[active_aptei_index(p, q, r, s)];
     return aphys_tei_aa_[aptei_index(p, q, r, s)];
 }
 
 double ConventionalIntegrals::aptei_ab(size_t p, size_t q, size_t r, size_t s) const {
+    if (active_only_)
+        return aphys_tei_ab_[active_aptei_index(p, q, r, s)];
     return aphys_tei_ab_[aptei_index(p, q, r, s)];
 }
 
 double ConventionalIntegrals::aptei_bb(size_t p, size_t q, size_t r, size_t s) const {
+    if (active_only_)
+        return aphys_tei_bb_[active_aptei_index(p, q, r, s)];
     return aphys_tei_bb_[aptei_index(p, q, r, s)];
 }
 
@@ -155,13 +166,21 @@ ambit::Tensor ConventionalIntegrals::aptei_bb_block(const std::vector<size_t>& p
 }
 
 void ConventionalIntegrals::gather_integrals() {
+    if (active_only_) {
+        gather_active_integrals();
+    } else {
+        gather_all_integrals();
+    }
+}
+
+void ConventionalIntegrals::gather_all_integrals() {
     if (print_) {
         outfile->Printf("\n  Computing Conventional Integrals");
     }
     local_timer timer;
     MintsHelper mints = MintsHelper(wfn_->basisset());
     mints.integrals();
-    auto integral_transform = transform_integrals();
+    auto integral_transform = transform_integrals(MOSpace::all);
 
     if (print_ > 1) {
         outfile->Printf("\n  Reading the two-electron integrals from disk");
@@ -228,16 +247,141 @@ void ConventionalIntegrals::gather_integrals() {
     }
 }
 
+void ConventionalIntegrals::gather_active_integrals() {
+    if (print_) {
+        outfile->Printf("\n  Computing Conventional Integrals (active space only)");
+    }
+    local_timer timer;
+    MintsHelper mints = MintsHelper(wfn_->basisset());
+    mints.integrals();
+
+    // The active orbitals in Pitzer order. The IntegralTransform labels the orbitals of a space
+    // with their position in this list.
+    auto active_mos = mo_space_info_->absolute_mo("ACTIVE");
+    nactive_ = active_mos.size();
+    active_index_.assign(nmo_, nactive_);
+    std::vector<int> active_orbs;
+    for (size_t u = 0; u < nactive_; ++u) {
+        active_index_[active_mos[u]] = u;
+        active_orbs.push_back(static_cast<int>(active_mos[u]));
+    }
+    auto active_space = std::make_shared<MOSpace>('X', active_orbs, std::vector<int>());
+
+    // The half-transformed integrals are built and streamed through disk by IntegralTransform
+    auto integral_transform = transform_integrals(active_space);
+
+    size_t nact4 = nactive_ * nactive_ * nactive_ * nactive_;
+    if (print_ > 1) {
+        outfile->Printf("\n  Size of two-electron integrals: %10.6f GB",
+                        double(3 * 8 * nact4) / 1073741824.0);
+    }
+    int_mem_ = sizeof(double) * 3 * nact4 / 1073741824.0;
+
+    // (uv|xy) in chemist notation
+    std::vector<double> tei(nact4, 0.0);
+    dpdbuf4 K;
+    std::shared_ptr<PSIO> psio(_default_psio_lib_);
+    psio->open(PSIF_LIBTRANS_DPD, PSIO_OPEN_OLD);
+    global_dpd_->buf4_init(&K, PSIF_LIBTRANS_DPD, 0, ID("[X,X]"), ID("[X,X]"), ID("[X>=X]+"),
+                           ID("[X>=X]+"), 0, "MO Ints (XX|XX)");
+    for (int h = 0; h < nirrep_; ++h) {
+        global_dpd_->buf4_mat_irrep_init(&K, h);
+        global_dpd_->buf4_mat_irrep_rd(&K, h);
+        for (int pq = 0; pq < K.params->rowtot[h]; ++pq) {
+            size_t p = K.params->roworb[h][pq][0];
+            size_t q = K.params->roworb[h][pq][1];
+            for (int rs = 0; rs < K.params->coltot[h]; ++rs) {
+                size_t r = K.params->colorb[h][rs][0];
+                size_t s = K.params->colorb[h][rs][1];
+                tei[((p * nactive_ + q) * nactive_ + r) * nactive_ + s] = K.matrix[h][pq][rs];
+            }
+        }
+        global_dpd_->buf4_mat_irrep_close(&K, h);
+    }
+    global_dpd_->buf4_close(&K);
+    psio->close(PSIF_LIBTRANS_DPD, PSIO_OPEN_OLD);
+
+    aphys_tei_aa_.assign(nact4, 0.0);
+    aphys_tei_ab_.assign(nact4, 0.0);
+    aphys_tei_bb_.assign(nact4, 0.0);
+    const size_t n = nactive_;
+#pragma omp parallel for
+    for (size_t p = 0; p < n; ++p) {
+        for (size_t q = 0; q < n; ++q) {
+            for (size_t r = 0; r < n; ++r) {
+                for (size_t s = 0; s < n; ++s) {
+                    // <pq||rs> = (pr|qs) - (ps|qr)
+                    double direct = tei[((p * n + r) * n + q) * n + s];
+                    double exchange = tei[((p * n + s) * n + q) * n + r];
+                    size_t index = ((p * n + q) * n + r) * n + s;
+                    aphys_tei_aa_[index] = direct - exchange;
+                    aphys_tei_ab_[index] = direct;
+                    aphys_tei_bb_[index] = direct - exchange;
+                }
+            }
+        }
+    }
+    if (print_) {
+        print_timing("conventional integral transformation", timer.get());
+    }
+}
+
 void ConventionalIntegrals::resort_integrals_after_freezing() {
     if (print_ > 1) {
         outfile->Printf("\n  Resorting integrals after freezing core.");
     }
+    if (active_only_) {
+        // only the map from orbitals to active indices changes
+        std::vector<size_t> corr_active_index(ncmo_);
+        for (size_t p = 0; p < ncmo_; ++p) {
+            corr_active_index[p] = active_index_[cmotomo_[p]];
+        }
+        active_index_.swap(corr_active_index);
+        return;
+    }
     // Resort the four-index integrals
     resort_four(aphys_tei_aa_, cmotomo_);
     resort_four(aphys_tei_ab_, cmotomo_);
     resort_four(aphys_tei_bb_, cmotomo_);
 }
 
+bool ConventionalIntegrals::rotate_two_electron_integrals(const std::vector<double>& U) {
+    // The orbitals over which the integrals are stored
+    std::vector<size_t> mos;
+    if (active_only_) {
+        mos.resize(nactive_);
+        for (size_t p = 0; p < ncmo_; ++p) {
+            if (active_index_[p] < nactive_) {
+                mos[active_index_[p]] = cmotomo_[p];
+            }
+        }
+    } else {
+        mos = cmotomo_;
+    }
+    auto U_block = rotation_block(U, mos);
+    if (U_block.empty()) {
+        return false;
+    }
+
+    // Rotate <pq|rs> and rebuild the antisymmetrized integrals <pq||rs> = <pq|rs> - <pq|sr>
+    const size_t n = mos.size();
+    rotate_four_index(aphys_tei_ab_, n, U_block);
+#pragma omp parallel for
+    for (size_t p = 0; p < n; ++p) {
+        for (size_t q = 0; q < n; ++q) {
+            for (size_t r = 0; r < n; ++r) {
+                for (size_t s = 0; s < n; ++s) {
+                    size_t pqrs = ((p * n + q) * n + r) * n + s;
+                    size_t pqsr = ((p * n + q) * n + s) * n + r;
+                    aphys_tei_aa_[pqrs] = aphys_tei_ab_[pqrs] - aphys_tei_ab_[pqsr];
+                }
+            }
+        }
+    }
+    std::copy_n(aphys_tei_aa_.begin(), n * n * n * n, aphys_tei_bb_.begin());
+    return true;
+}
+
 void ConventionalIntegrals::resort_four(std::vector<double>& tei, std::vector<size_t>& map) {
     // Store the integrals in a temporary array
     size_t num_aptei_corr = nmo_ * nmo_ * nmo_ * nmo_;
@@ -29,11 +29,14 @@
 
 #pragma once
 
+#include <stdexcept>
+
 #include "psi4_integrals.h"
 
 namespace psi {
 class IntegralTransform;
-}
+class MOSpace;
+} // namespace psi
 
 namespace forte {
 
@@ -42,6 +45,8 @@ namespace forte {
  * integrals.
  *
  * This class assumes the two-electron integrals can be stored in memory.
+ * If the option CONVENTIONAL_ACTIVE_ONLY is set, only the integrals with all four indices in the
+ * active space are transformed and stored, and requesting any other integral is an error.
  */
 class ConventionalIntegrals : public Psi4Integrals {
   public:
@@ -69,15 +74,47 @@ class ConventionalIntegrals : public Psi4Integrals {
                                  const std::vector<size_t>& r,
                                  const std::vector<size_t>& s) override;
 
+    /// Only the active-space integrals are stored when CONVENTIONAL_ACTIVE_ONLY is true
+    bool active_integrals_only() const override { return active_only_; }
+
+  protected:
+    /// The active-space integrals are allocated when they are transformed
+    bool in_core_tei() const override { return not active_only_; }
+    /// Rotate the stored (all or active-only) four-index integrals
+    bool rotate_two_electron_integrals(const std::vector<double>& U) override;
+
   private:
     // ==> Class data <==
 
+    /// Store only the active-space integrals?
+    bool active_only_ = false;
+    /// The number of active orbitals
+    size_t nactive_ = 0;
+    /// Maps an orbital index to its position in the active space (nactive_ if not active)
+    std::vector<size_t> active_index_;
+
     // ==> Class private functions <==
 
-    /// Transform the integrals
-    std::shared_ptr<psi::IntegralTransform> transform_integrals();
+    /// Transform the integrals over the orbitals of a space
+    std::shared_ptr<psi::IntegralTransform>
+    transform_integrals(std::shared_ptr<psi::MOSpace> space);
+    /// Transform and store the integrals over all orbitals
+    void gather_all_integrals();
+    /// Transform and store only the integrals over the active orbitals
+    void gather_active_integrals();
     void resort_four(std::vector<double>& tei, std::vector<size_t>& map);
 
+    /// The address of an integral when only the active-space integrals are stored
+    size_t active_aptei_index(size_t p, size_t q, size_t r, size_t s) const {
+        size_t ap = active_index_[p], aq = active_index_[q];
+        size_t ar = active_index_[r], as = active_index_[s];
+        if ((ap == nactive_) or (aq == nactive_) or (ar == nactive_) or (as == nactive_)) {
+            throw std::runtime_error("ConventionalIntegrals: only the active-space integrals are "
+                                     "available (CONVENTIONAL_ACTIVE_ONLY = true)");
+        }
+        return ((ap * nactive_ + aq) * nactive_ + ar) * nactive_ + as;
+    }
+
     // ==> Class private virtual functions <==
     void gather_integrals() override;
     void resort_integrals_after_freezing() override;
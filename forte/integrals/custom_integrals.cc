@@ -28,6 +28,7 @@
 
 #include <cmath>
 #include <fstream>
+#include <numeric>
 
 // #include "psi4/libmints/mintshelper.h"
 #include "psi4/libmints/matrix.h"
@@ -72,15 +73,32 @@ CustomIntegrals::CustomIntegrals(std::shared_ptr<ForteOptions> options,
     set_nuclear_repulsion(scalar);
 }
 
+CustomIntegrals::CustomIntegrals(std::shared_ptr<ForteOptions> options,
+                                 std::shared_ptr<SCFInfo> scf_info,
+                                 std::shared_ptr<MOSpaceInfo> mo_space_info, double scalar,
+                                 const std::vector<double>& oei, std::vector<double> packed_tei)
+    : ForteIntegrals(options, scf_info, mo_space_info, Custom, IntegralSpinRestriction::Restricted),
+      original_full_one_electron_integrals_a_(oei), original_full_one_electron_integrals_b_(oei),
+      packed_(true), packed_tei_(std::move(packed_tei)) {
+    set_nuclear_repulsion(scalar);
+}
+
 void CustomIntegrals::initialize() {
     ForteIntegrals::common_initialize();
 
     // Store the original integrals
     full_one_electron_integrals_a_ = original_full_one_electron_integrals_a_;
     full_one_electron_integrals_b_ = original_full_one_electron_integrals_b_;
-    full_aphys_tei_aa_ = original_full_aphys_tei_aa_;
-    full_aphys_tei_ab_ = original_full_aphys_tei_ab_;
-    full_aphys_tei_bb_ = original_full_aphys_tei_bb_;
+    if (packed_) {
+        if (packed_tei_.size() != packed_tei_size(nmo_)) {
+            throw std::runtime_error("CustomIntegrals: the size of the packed two-electron "
+                                     "integrals is inconsistent with the number of orbitals");
+        }
+    } else {
+        full_aphys_tei_aa_ = original_full_aphys_tei_aa_;
+        full_aphys_tei_ab_ = original_full_aphys_tei_ab_;
+        full_aphys_tei_bb_ = original_full_aphys_tei_bb_;
+    }
 
     nsopi_ = nmopi_;
     nso_ = nmo_;
@@ -99,14 +117,26 @@ std::shared_ptr<psi::Matrix> CustomIntegrals::Ca_AO() const {
 }
 
 double CustomIntegrals::aptei_aa(size_t p, size_t q, size_t r, size_t s) const {
+    if (packed_) {
+        const size_t P = packed_map_[p], Q = packed_map_[q], R = packed_map_[r], S = packed_map_[s];
+        return packed_tei(P, R, Q, S) - packed_tei(P, S, Q, R);
+    }
     return aphys_tei_aa_[aptei_index(p, q, r, s)];
 }
 
 double CustomIntegrals::aptei_ab(size_t p, size_t q, size_t r, size_t s) const {
+    if (packed_) {
+        const size_t P = packed_map_[p], Q = packed_map_[q], R = packed_map_[r], S = packed_map_[s];
+        return packed_tei(P, R, Q, S);
+    }
     return aphys_tei_ab_[aptei_index(p, q, r, s)];
 }
 
 double CustomIntegrals::aptei_bb(size_t p, size_t q, size_t r, size_t s) const {
+    if (packed_) {
+        const size_t P = packed_map_[p], Q = packed_map_[q], R = packed_map_[r], S = packed_map_[s];
+        return packed_tei(P, R, Q, S) - packed_tei(P, S, Q, R);
+    }
     return aphys_tei_bb_[aptei_index(p, q, r, s)];
 }
 
@@ -156,6 +186,11 @@ void CustomIntegrals::gather_integrals() {
                 full_one_electron_integrals_b_[cmotomo_[p] * nmo_ + cmotomo_[q]];
         }
     }
+    if (packed_) {
+        packed_map_.resize(nmo_);
+        std::iota(packed_map_.begin(), packed_map_.end(), 0);
+        return;
+    }
     aphys_tei_aa_ = full_aphys_tei_aa_;
     aphys_tei_ab_ = full_aphys_tei_ab_;
     aphys_tei_bb_ = full_aphys_tei_bb_;
@@ -165,6 +200,11 @@ void CustomIntegrals::resort_integrals_after_freezing() {
     if (print_ > 1) {
         outfile->Printf("\n  Resorting integrals after freezing core.");
     }
+    if (packed_) {
+        // the packed integrals are addressed through the map of correlated orbitals
+        packed_map_ = cmotomo_;
+        return;
+    }
     // Resort the four-index integrals
     resort_four(aphys_tei_aa_, cmotomo_);
     resort_four(aphys_tei_ab_, cmotomo_);
@@ -279,10 +319,6 @@ CustomIntegrals::make_fock_inactive(psi::Dimension dim_start, psi::Dimension dim
     }
     auto nclosed = closed_indices.size();
 
-    auto nmo1 = nmo_;
-    auto nmo2 = nmo1 * nmo1;
-    auto nmo3 = nmo1 * nmo2;
-
     // compute inactive Fock
     for (int h = 0, offset = 0; h < nirrep_; ++h) {
         for (int p = 0; p < nmopi_[h]; ++p) {
@@ -298,12 +334,10 @@ CustomIntegrals::make_fock_inactive(psi::Dimension dim_start, psi::Dimension dim
                     auto ni = closed_indices[i];
 
                     // Fock alpha: F_{pq} = h_{pq} + \sum_{i} <pi||qi> + \sum_{I} <pI||qI>
-                    auto id_a = np * nmo3 + ni * nmo2 + nq * nmo1 + ni;
-                    va += full_aphys_tei_aa_[id_a] + full_aphys_tei_ab_[id_a];
+                    va += full_tei_aa(np, ni, nq, ni) + full_tei_ab(np, ni, nq, ni);
 
                     // Fock beta: F_{PQ} = h_{PQ} + \sum_{i} <Pi||Qi> + \sum_{I} <PI||QI>
-                    auto id_b = ni * nmo3 + np * nmo2 + ni * nmo1 + nq;
-                    vb += full_aphys_tei_bb_[id_b] + full_aphys_tei_ab_[id_b];
+                    vb += full_tei_bb(ni, np, ni, nq) + full_tei_ab(ni, np, ni, nq);
                 }
 
                 Fock_a->set(h, p, q, va);
@@ -325,9 +359,8 @@ CustomIntegrals::make_fock_inactive(psi::Dimension dim_start, psi::Dimension dim
             for (size_t j = 0; j < nclosed; ++j) {
                 auto nj = closed_indices[j];
 
-                auto idx = ni * nmo3 + nj * nmo2 + ni * nmo1 + nj;
-                e_closed += 0.5 * (full_aphys_tei_aa_[idx] + full_aphys_tei_bb_[idx]);
-                e_closed += full_aphys_tei_ab_[idx];
+                e_closed += 0.5 * (full_tei_aa(ni, nj, ni, nj) + full_tei_bb(ni, nj, ni, nj));
+                e_closed += full_tei_ab(ni, nj, ni, nj);
             }
         }
         offset1 += nmopi_[h1];
@@ -406,10 +439,6 @@ CustomIntegrals::make_fock_active_unrestricted(std::shared_ptr<psi::Matrix> g1a,
     }
     auto actv_sym_size = actv_indices_sym.size();
 
-    auto nmo1 = nmo_;
-    auto nmo2 = nmo1 * nmo1;
-    auto nmo3 = nmo1 * nmo2;
-
     // compute active Fock
     for (int h = 0, offset = 0; h < nirrep_; ++h) {
         for (int p = 0; p < nmopi_[h]; ++p) {
@@ -425,13 +454,11 @@ CustomIntegrals::make_fock_active_unrestricted(std::shared_ptr<psi::Matrix> g1a,
                     size_t hactv, u, v, nu, nv;
                     std::tie(hactv, u, v, nu, nv) = actv_indices_sym[i_sym];
 
-                    auto id_a = np * nmo3 + nu * nmo2 + nq * nmo1 + nv;
-                    va += full_aphys_tei_aa_[id_a] * g1a->get(hactv, u, v);
-                    va += full_aphys_tei_ab_[id_a] * g1b->get(hactv, u, v);
+                    va += full_tei_aa(np, nu, nq, nv) * g1a->get(hactv, u, v);
+                    va += full_tei_ab(np, nu, nq, nv) * g1b->get(hactv, u, v);
 
-                    auto id_b = nu * nmo3 + np * nmo2 + nv * nmo1 + nq;
-                    vb += full_aphys_tei_bb_[id_b] * g1b->get(hactv, u, v);
-                    vb += full_aphys_tei_ab_[id_b] * g1a->get(hactv, u, v);
+                    vb += full_tei_bb(nu, np, nv, nq) * g1b->get(hactv, u, v);
+                    vb += full_tei_ab(nu, np, nv, nq) * g1a->get(hactv, u, v);
                 }
 
                 Fock_a->set(h, p, q, va);
@@ -493,6 +520,10 @@ void CustomIntegrals::transform_one_electron_integrals() {
 }
 
 void CustomIntegrals::transform_two_electron_integrals() {
+    if (packed_) {
+        transform_packed_two_electron_integrals();
+        return;
+    }
     if (not save_original_tei_) {
         original_V_aa_ = ambit::Tensor::build(tensor_type_, "V_aa", {nmo_, nmo_, nmo_, nmo_});
         original_V_ab_ = ambit::Tensor::build(tensor_type_, "V_ab", {nmo_, nmo_, nmo_, nmo_});
@@ -536,6 +567,47 @@ void CustomIntegrals::transform_two_electron_integrals() {
     full_aphys_tei_bb_ = T.data();
 }
 
+void CustomIntegrals::transform_packed_two_electron_integrals() {
+    // the first time we transform, we keep a copy of the original integrals
+    if (original_packed_tei_.empty()) {
+        original_packed_tei_ = packed_tei_;
+    }
+
+    auto C = ambit::Tensor::build(tensor_type_, "C", {nmo_, nmo_});
+    auto& C_data = C.data();
+    for (int h = 0, offset = 0; h < nirrep_; ++h) {
+        for (int p = 0; p < nmopi_[h]; ++p) {
+            for (int q = 0; q < nmopi_[h]; ++q) {
+                C_data[(p + offset) * nmo_ + q + offset] = this->Ca()->get(h, p, q);
+            }
+        }
+        offset += nmopi_[h];
+    }
+
+    // the transformation is done on unpacked integrals, which are only kept during this step
+    auto V = ambit::Tensor::build(tensor_type_, "V", {nmo_, nmo_, nmo_, nmo_});
+    V.iterate([&](const std::vector<size_t>& i, double& value) {
+        value = original_packed_tei_[packed_tei_index(i[0], i[1], i[2], i[3])];
+    });
+    auto T = ambit::Tensor::build(tensor_type_, "temp", {nmo_, nmo_, nmo_, nmo_});
+    T("ijkl") = V("pqrs") * C("pi") * C("qj") * C("rk") * C("sl");
+
+    const auto& T_data = T.data();
+#pragma omp parallel for
+    for (size_t p = 0; p < nmo_; ++p) {
+        for (size_t q = 0; q <= p; ++q) {
+            for (size_t r = 0; r < nmo_; ++r) {
+                for (size_t s = 0; s <= r; ++s) {
+                    if (packed_pair_index(p, q) >= packed_pair_index(r, s)) {
+                        packed_tei_[packed_tei_index(p, q, r, s)] =
+                            T_data[((p * nmo_ + q) * nmo_ + r) * nmo_ + s];
+                    }
+                }
+            }
+        }
+    }
+}
+
 void CustomIntegrals::__update_orbitals(bool transform_ints) {
     ints_consistent_ = false;
     if (spin_restriction_ == IntegralSpinRestriction::Restricted) {
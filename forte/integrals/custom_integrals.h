@@ -30,6 +30,7 @@
 #pragma once
 
 #include "integrals.h"
+#include "fcidump.h"
 
 namespace forte {
 
@@ -54,6 +55,18 @@ class CustomIntegrals : public ForteIntegrals {
                     const std::vector<double>& oei_b, const std::vector<double>& tei_aa,
                     const std::vector<double>& tei_ab, const std::vector<double>& tei_bb);
 
+    /// Contructor of CustomIntegrals from packed spin-restricted integrals
+    /// @param options a pointer to ForteOptions
+    /// @param mo_space_info a pointer to Forte MOSpaceInfo
+    /// @param scalar the nuclear repulsion energy
+    /// @param oei the one-electron integrals in MO basis
+    /// @param packed_tei the two-electron integrals (pq|rs) in MO basis packed with eight-fold
+    /// permutational symmetry (see packed_tei_index). This is the only copy of the two-electron
+    /// integrals stored by this object.
+    CustomIntegrals(std::shared_ptr<ForteOptions> options, std::shared_ptr<SCFInfo> scf_info,
+                    std::shared_ptr<MOSpaceInfo> mo_space_info, double scalar,
+                    const std::vector<double>& oei, std::vector<double> packed_tei);
+
     /// Class initializer
     void initialize() override;
 
@@ -98,6 +111,9 @@ class CustomIntegrals : public ForteIntegrals {
 
     size_t nthree() const override { throw std::runtime_error("Wrong Integral type"); }
 
+  protected:
+    bool in_core_tei() const override { return not packed_; }
+
   private:
     // ==> Class private data <==
 
@@ -120,6 +136,15 @@ class CustomIntegrals : public ForteIntegrals {
     ambit::Tensor original_V_ab_;
     ambit::Tensor original_V_bb_;
 
+    /// Are the two-electron integrals stored in packed form?
+    bool packed_ = false;
+    /// The packed two-electron integrals (pq|rs) over all the orbitals
+    std::vector<double> packed_tei_;
+    /// A copy of the packed integrals in the original basis (made when the orbitals are rotated)
+    std::vector<double> original_packed_tei_;
+    /// Maps the indices used by aptei_* to orbital indices of packed_tei_
+    std::vector<size_t> packed_map_;
+
     // ==> Class private functions <==
 
     void resort_four(std::vector<double>& tei, std::vector<size_t>& map);
@@ -133,6 +158,28 @@ class CustomIntegrals : public ForteIntegrals {
 
     void transform_one_electron_integrals();
     void transform_two_electron_integrals();
+    void transform_packed_two_electron_integrals();
+
+    /// The integral (pq|rs) over all orbitals from the packed integrals
+    double packed_tei(size_t p, size_t q, size_t r, size_t s) const {
+        return packed_tei_[packed_tei_index(p, q, r, s)];
+    }
+    /// The antisymmetrized integrals <pq||rs> and <pq|rs> over all orbitals
+    double full_tei_aa(size_t p, size_t q, size_t r, size_t s) const {
+        if (packed_)
+            return packed_tei(p, r, q, s) - packed_tei(p, s, q, r);
+        return full_aphys_tei_aa_[((p * nmo_ + q) * nmo_ + r) * nmo_ + s];
+    }
+    double full_tei_ab(size_t p, size_t q, size_t r, size_t s) const {
+        if (packed_)
+            return packed_tei(p, r, q, s);
+        return full_aphys_tei_ab_[((p * nmo_ + q) * nmo_ + r) * nmo_ + s];
+    }
+    double full_tei_bb(size_t p, size_t q, size_t r, size_t s) const {
+        if (packed_)
+            return packed_tei(p, r, q, s) - packed_tei(p, s, q, r);
+        return full_aphys_tei_bb_[((p * nmo_ + q) * nmo_ + r) * nmo_ + s];
+    }
 };
 
 } // namespace forte
@@ -51,6 +51,7 @@
 #include "helpers/timer.h"
 #include "helpers/memory.h"
 
+#include "shared_integral_store.h"
 #include "df_integrals.h"
 
 using namespace ambit;
@@ -77,8 +78,7 @@ void DFIntegrals::initialize() {
 #endif
     if (my_proc == 0 and (not skip_build_)) {
         local_timer int_timer;
-        gather_integrals();
-        freeze_core_orbitals();
+        build_two_electron_integrals();
         print_timing("computing density-fitted integrals", int_timer.get());
     }
 }
@@ -86,18 +86,18 @@ void DFIntegrals::initialize() {
 double DFIntegrals::aptei_aa(size_t p, size_t q, size_t r, size_t s) const {
     double vpqrsalphaC = 0.0;
     double vpqrsalphaE = 0.0;
-    vpqrsalphaC = C_DDOT(nthree_, &(ThreeIntegral_->pointer()[p * aptei_idx_ + r][0]), 1,
-                         &(ThreeIntegral_->pointer()[q * aptei_idx_ + s][0]), 1);
-    vpqrsalphaE = C_DDOT(nthree_, &(ThreeIntegral_->pointer()[p * aptei_idx_ + s][0]), 1,
-                         &(ThreeIntegral_->pointer()[q * aptei_idx_ + r][0]), 1);
+    vpqrsalphaC = C_DDOT(nthree_, &(three_rows()[p * aptei_idx_ + r][0]), 1,
+                         &(three_rows()[q * aptei_idx_ + s][0]), 1);
+    vpqrsalphaE = C_DDOT(nthree_, &(three_rows()[p * aptei_idx_ + s][0]), 1,
+                         &(three_rows()[q * aptei_idx_ + r][0]), 1);
 
     return (vpqrsalphaC - vpqrsalphaE);
 }
 
 double DFIntegrals::aptei_ab(size_t p, size_t q, size_t r, size_t s) const {
     double vpqrsalphaC = 0.0;
-    vpqrsalphaC = C_DDOT(nthree_, &(ThreeIntegral_->pointer()[p * aptei_idx_ + r][0]), 1,
-                         &(ThreeIntegral_->pointer()[q * aptei_idx_ + s][0]), 1);
+    vpqrsalphaC = C_DDOT(nthree_, &(three_rows()[p * aptei_idx_ + r][0]), 1,
+                         &(three_rows()[q * aptei_idx_ + s][0]), 1);
 
     return (vpqrsalphaC);
 }
@@ -105,10 +105,10 @@ double DFIntegrals::aptei_ab(size_t p, size_t q, size_t r, size_t s) const {
 double DFIntegrals::aptei_bb(size_t p, size_t q, size_t r, size_t s) const {
     double vpqrsalphaC = 0.0;
     double vpqrsalphaE = 0.0;
-    vpqrsalphaC = C_DDOT(nthree_, &(ThreeIntegral_->pointer()[p * aptei_idx_ + r][0]), 1,
-                         &(ThreeIntegral_->pointer()[q * aptei_idx_ + s][0]), 1);
-    vpqrsalphaE = C_DDOT(nthree_, &(ThreeIntegral_->pointer()[p * aptei_idx_ + s][0]), 1,
-                         &(ThreeIntegral_->pointer()[q * aptei_idx_ + r][0]), 1);
+    vpqrsalphaC = C_DDOT(nthree_, &(three_rows()[p * aptei_idx_ + r][0]), 1,
+                         &(three_rows()[q * aptei_idx_ + s][0]), 1);
+    vpqrsalphaE = C_DDOT(nthree_, &(three_rows()[p * aptei_idx_ + s][0]), 1,
+                         &(three_rows()[q * aptei_idx_ + r][0]), 1);
 
     return (vpqrsalphaC - vpqrsalphaE);
 }
@@ -117,43 +117,32 @@ ambit::Tensor DFIntegrals::aptei_aa_block(const std::vector<size_t>& p,
                                           const std::vector<size_t>& q,
                                           const std::vector<size_t>& r,
                                           const std::vector<size_t>& s) {
-    ambit::Tensor ReturnTensor =
-        ambit::Tensor::build(tensor_type_, "Return", {p.size(), q.size(), r.size(), s.size()});
-    ReturnTensor.iterate([&](const std::vector<size_t>& i, double& value) {
-        value = aptei_aa(p[i[0]], q[i[1]], r[i[2]], s[i[3]]);
-    });
-    return ReturnTensor;
+    return three_index_aptei_block(three_rows(), p, q, r, s, true);
 }
 
 ambit::Tensor DFIntegrals::aptei_ab_block(const std::vector<size_t>& p,
                                           const std::vector<size_t>& q,
                                           const std::vector<size_t>& r,
                                           const std::vector<size_t>& s) {
-    ambit::Tensor ReturnTensor =
-        ambit::Tensor::build(tensor_type_, "Return", {p.size(), q.size(), r.size(), s.size()});
-    ReturnTensor.iterate([&](const std::vector<size_t>& i, double& value) {
-        value = aptei_ab(p[i[0]], q[i[1]], r[i[2]], s[i[3]]);
-    });
-    return ReturnTensor;
+    return three_index_aptei_block(three_rows(), p, q, r, s, false);
 }
 
 ambit::Tensor DFIntegrals::aptei_bb_block(const std::vector<size_t>& p,
                                           const std::vector<size_t>& q,
                                           const std::vector<size_t>& r,
                                           const std::vector<size_t>& s) {
-    ambit::Tensor ReturnTensor =
-        ambit::Tensor::build(tensor_type_, "Return", {p.size(), q.size(), r.size(), s.size()});
-    ReturnTensor.iterate([&](const std::vector<size_t>& i, double& value) {
-        value = aptei_bb(p[i[0]], q[i[1]], r[i[2]], s[i[3]]);
-    });
-    return ReturnTensor;
+    return three_index_aptei_block(three_rows(), p, q, r, s, true);
 }
 
 double DFIntegrals::three_integral(size_t A, size_t p, size_t q) const {
-    return ThreeIntegral_->get(p * aptei_idx_ + q, A);
+    return three_rows()[p * aptei_idx_ + q][A];
 }
 
-double** DFIntegrals::three_integral_pointer() { return ThreeIntegral_->pointer(); }
+double** DFIntegrals::three_integral_pointer() { return three_rows(); }
+
+double** DFIntegrals::three_rows() const {
+    return shared_ints_ ? const_cast<double**>(shared_rows_.data()) : ThreeIntegral_->pointer();
+}
 
 ambit::Tensor DFIntegrals::three_integral_block(const std::vector<size_t>& A,
                                                 const std::vector<size_t>& p,
@@ -289,6 +278,32 @@ void DFIntegrals::resort_integrals_after_freezing() {
     }
 }
 
+bool DFIntegrals::rotate_two_electron_integrals(const std::vector<double>& U) {
+    auto U_corr = rotation_block(U, cmotomo_);
+    if (U_corr.empty()) {
+        return false;
+    }
+    rotate_three_index(ThreeIntegral_->pointer()[0], ncmo_, nthree_, U_corr);
+    return true;
+}
+
+std::string DFIntegrals::shared_integrals_label() const {
+    return "DF " + wfn_->get_basisset("DF_BASIS_MP2")->name() + " " +
+           std::to_string(df_fitting_cutoff_);
+}
+
+size_t DFIntegrals::shared_integrals_nthree() const {
+    return wfn_->get_basisset("DF_BASIS_MP2")->nbf();
+}
+
+void DFIntegrals::shared_integrals_changed() {
+    // the shared copy replaces the private one
+    if (shared_ints_) {
+        nthree_ = shared_ints_->ncol();
+        ThreeIntegral_.reset();
+    }
+}
+
 size_t DFIntegrals::nthree() const { return nthree_; }
 
 } // namespace forte
@@ -84,12 +84,18 @@ class DFIntegrals : public Psi4Integrals {
     // ==> Class private functions <==
 
     double three_integral(size_t A, size_t p, size_t q) const;
+    /// Pointers to the rows of the private or the shared three-index integrals
+    double** three_rows() const;
     void resort_three(std::shared_ptr<psi::Matrix>& threeint, std::vector<size_t>& map);
 
     // ==> Class private virtual functions <==
 
     void gather_integrals() override;
     void resort_integrals_after_freezing() override;
+    bool rotate_two_electron_integrals(const std::vector<double>& U) override;
+    std::string shared_integrals_label() const override;
+    size_t shared_integrals_nthree() const override;
+    void shared_integrals_changed() override;
 };
 
 } // namespace forte
@@ -26,16 +26,23 @@
  * @END LICENSE
  */
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <memory>
 #include <numeric>
 
+#include <unistd.h>
+
 #include "psi4/libpsi4util/process.h"
 #include "psi4/libmints/basisset.h"
 #include "psi4/libmints/matrix.h"
 #include "psi4/libmints/vector.h"
 #include "psi4/libmints/wavefunction.h"
+#include "psi4/libpsio/psio.hpp"
 #include "psi4/libqt/qt.h"
 
+#include "base_classes/forte_options.h"
 #include "base_classes/mo_space_info.h"
 
 #ifdef HAVE_GA
@@ -50,6 +57,12 @@
 #include "helpers/timer.h"
 #include "diskdf_integrals.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp_in_parallel() 0
+#endif
+
 using namespace ambit;
 using namespace psi;
 
@@ -60,7 +73,15 @@ DISKDFIntegrals::DISKDFIntegrals(std::shared_ptr<ForteOptions> options,
                                  std::shared_ptr<psi::Wavefunction> ref_wfn,
                                  std::shared_ptr<MOSpaceInfo> mo_space_info,
                                  IntegralSpinRestriction restricted)
-    : Psi4Integrals(options, scf_info, ref_wfn, mo_space_info, DiskDF, restricted) {}
+    : Psi4Integrals(options, scf_info, ref_wfn, mo_space_info, DiskDF, restricted) {
+    prefetch_ = options_->get_bool("DISKDF_PREFETCH");
+}
+
+DISKDFIntegrals::~DISKDFIntegrals() {
+    for (auto& [key, block] : prefetched_) {
+        block.wait();
+    }
+}
 
 void DISKDFIntegrals::initialize() {
     Psi4Integrals::base_initialize_psi4();
@@ -80,6 +101,7 @@ void DISKDFIntegrals::initialize() {
 }
 
 double DISKDFIntegrals::aptei_aa(size_t p, size_t q, size_t r, size_t s) const {
+    std::lock_guard<std::mutex> lock(df_mutex_);
     size_t pn, qn, rn, sn;
 
     if (frzcpi_.sum() > 0 && ncmo_ == aptei_idx_) {
@@ -123,6 +145,7 @@ double DISKDFIntegrals::aptei_aa(size_t p, size_t q, size_t r, size_t s) const {
 }
 
 double DISKDFIntegrals::aptei_ab(size_t p, size_t q, size_t r, size_t s) const {
+    std::lock_guard<std::mutex> lock(df_mutex_);
     size_t pn, qn, rn, sn;
     if (frzcpi_.sum() > 0 && ncmo_ == aptei_idx_) {
         pn = cmotomo_[p];
@@ -154,6 +177,7 @@ double DISKDFIntegrals::aptei_ab(size_t p, size_t q, size_t r, size_t s) const {
 }
 
 double DISKDFIntegrals::aptei_bb(size_t p, size_t q, size_t r, size_t s) const {
+    std::lock_guard<std::mutex> lock(df_mutex_);
     size_t pn, qn, rn, sn;
 
     if (frzcpi_.sum() > 0 && ncmo_ == aptei_idx_) {
@@ -293,6 +317,59 @@ ambit::Tensor DISKDFIntegrals::three_integral_block(const std::vector<size_t>& Q
                                                     const std::vector<size_t>& p_vec,
                                                     const std::vector<size_t>& q_vec,
                                                     ThreeIntsBlockOrder order) {
+    // prefetched_ is not synchronized, see prefetch_three_integral_block
+    if (not prefetched_.empty() and omp_in_parallel()) {
+        throw std::runtime_error("DISKDFIntegrals: three_integral_block cannot be called from a "
+                                 "parallel region while blocks are prefetched");
+    }
+    BlockKey key{Q_vec, p_vec, q_vec, order};
+    auto it = std::find_if(prefetched_.begin(), prefetched_.end(),
+                           [&](const auto& entry) { return entry.first == key; });
+    if (it != prefetched_.end()) {
+        auto block = std::move(it->second);
+        prefetched_.erase(it);
+        return block.get();
+    }
+
+    std::lock_guard<std::mutex> lock(df_mutex_);
+    return read_three_integral_block(Q_vec, p_vec, q_vec, order);
+}
+
+void DISKDFIntegrals::prefetch_three_integral_block(const std::vector<size_t>& Q_vec,
+                                                    const std::vector<size_t>& p_vec,
+                                                    const std::vector<size_t>& q_vec,
+                                                    ThreeIntsBlockOrder order) {
+    if (not prefetch_) {
+        return;
+    }
+    if (omp_in_parallel()) {
+        throw std::runtime_error("DISKDFIntegrals: prefetch_three_integral_block cannot be called "
+                                 "from a parallel region");
+    }
+    BlockKey key{Q_vec, p_vec, q_vec, order};
+    for (const auto& entry : prefetched_) {
+        if (entry.first == key) {
+            return;
+        }
+    }
+
+    // drop the oldest request if too many blocks are kept in memory
+    if (prefetched_.size() == max_prefetched_blocks_) {
+        prefetched_.front().second.wait();
+        prefetched_.pop_front();
+    }
+
+    auto block = std::async(std::launch::async, [this, Q_vec, p_vec, q_vec, order]() {
+        std::lock_guard<std::mutex> lock(df_mutex_);
+        return read_three_integral_block(Q_vec, p_vec, q_vec, order);
+    });
+    prefetched_.emplace_back(std::move(key), std::move(block));
+}
+
+ambit::Tensor DISKDFIntegrals::read_three_integral_block(const std::vector<size_t>& Q_vec,
+                                                         const std::vector<size_t>& p_vec,
+                                                         const std::vector<size_t>& q_vec,
+                                                         ThreeIntsBlockOrder order) {
     std::string func_name = "DISKDFIntegrals::three_integral_block: ";
 
     auto Qsize = Q_vec.size();
@@ -359,6 +436,18 @@ ambit::Tensor DISKDFIntegrals::three_integral_block(const std::vector<size_t>& Q
 
     auto& out_data = out.data();
 
+    if (store_) {
+        std::vector<size_t> p_mo(psize), q_mo(qsize);
+        for (size_t p = 0; p < psize; ++p) {
+            p_mo[p] = cmotomo[p_vec[p]];
+        }
+        for (size_t q = 0; q < qsize; ++q) {
+            q_mo[q] = cmotomo[q_vec[q]];
+        }
+        store_->read(Q_range[0], Q_range[1], p_mo, q_mo, order == pqQ, out_data.data());
+        return out;
+    }
+
     if (p_contiguous and q_contiguous) {
         std::vector<size_t> p_range{cmotomo[p_vec[0]], cmotomo[p_vec[0]] + psize};
         std::vector<size_t> q_range{cmotomo[q_vec[0]], cmotomo[q_vec[0]] + qsize};
@@ -564,6 +653,27 @@ void DISKDFIntegrals::gather_integrals() {
     outfile->Printf("\n  Computing DF Integrals");
     df_->transform();
     print_timing("computing density-fitted integrals", timer.get());
+
+    if (options_->get_bool("DISKDF_BLOCKED_STORE")) {
+        build_blocked_store();
+    }
+}
+
+void DISKDFIntegrals::build_blocked_store() {
+    local_timer timer;
+    size_t tile_rows = std::max(options_->get_int("DISKDF_TILE_ROWS"), 1);
+    // several DiskDF objects can coexist in one process, so each one gets its own file
+    static std::atomic<size_t> instance_counter{0};
+    std::string filename = psi::PSIOManager::shared_object()->get_default_path() + "psi." +
+                           std::to_string(getpid()) + "." + std::to_string(instance_counter++) +
+                           ".forte.diskdf.bin";
+    store_ = std::make_unique<BlockedDFStore>(filename, nthree_, nmo_, tile_rows);
+    store_->write([&](size_t p_begin, size_t p_end, double* buffer) {
+        df_->fill_tensor("B", buffer, {0, nthree_}, {p_begin, p_end}, {0, nmo_});
+    });
+    outfile->Printf("\n  Blocked DF integrals written to %s (%zu tiles of %zu orbitals)",
+                    filename.c_str(), store_->ntiles(), store_->tile_rows());
+    print_timing("writing blocked density-fitted integrals", timer.get());
 }
 
 void DISKDFIntegrals::resort_integrals_after_freezing() {
@@ -579,6 +689,7 @@ void DISKDFIntegrals::resort_integrals_after_freezing() {
 ambit::Tensor DISKDFIntegrals::three_integral_block_two_index(const std::vector<size_t>& A,
                                                               size_t p,
                                                               const std::vector<size_t>& q) {
+    std::lock_guard<std::mutex> lock(df_mutex_);
 
     ambit::Tensor ReturnTensor = ambit::Tensor::build(tensor_type_, "Return", {A.size(), q.size()});
 
@@ -593,7 +704,17 @@ ambit::Tensor DISKDFIntegrals::three_integral_block_two_index(const std::vector<
         p_max = p_min + 1;
     }
 
-    if (nthree_ == A.size()) {
+    if (nthree_ == A.size() and store_) {
+        std::vector<size_t> q_mo(q.size());
+        for (size_t i = 0; i < q.size(); ++i) {
+            q_mo[i] = frozen_core ? cmotomo_[q[i]] : q[i];
+        }
+        std::vector<double> Aq(nthree_ * q.size());
+        store_->read(0, nthree_, {p_min}, q_mo, false, Aq.data());
+        ReturnTensor.iterate([&](const std::vector<size_t>& i, double& value) {
+            value = Aq[A[i[0]] * q.size() + i[1]];
+        });
+    } else if (nthree_ == A.size()) {
 
         std::vector<size_t> arange = {0, nthree_};
         std::vector<size_t> qrange = {0, nmo_};
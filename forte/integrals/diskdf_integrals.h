@@ -29,8 +29,13 @@
 
 #pragma once
 
+#include <deque>
+#include <future>
+#include <mutex>
+
 #include "psi4/lib3index/dfhelper.h"
 
+#include "blocked_df_store.h"
 #include "psi4_integrals.h"
 
 namespace forte {
@@ -47,6 +52,9 @@ class DISKDFIntegrals : public Psi4Integrals {
                     std::shared_ptr<psi::Wavefunction> ref_wfn,
                     std::shared_ptr<MOSpaceInfo> mo_space_info, IntegralSpinRestriction restricted);
 
+    /// Destructor (waits for the blocks that are being prefetched)
+    ~DISKDFIntegrals() override;
+
     void initialize() override;
     /// aptei_xy functions are slow.  try to use three_integral_block
 
@@ -74,6 +82,16 @@ class DISKDFIntegrals : public Psi4Integrals {
     ambit::Tensor three_integral_block(const std::vector<size_t>& A, const std::vector<size_t>& p,
                                        const std::vector<size_t>& q,
                                        ThreeIntsBlockOrder order = Qpq) override;
+    /// Start reading a block of the DFIntegrals in the background. The block is returned by the
+    /// next call to three_integral_block with the same arguments. The queue of prefetched blocks
+    /// is not synchronized: this function and three_integral_block must be called from one thread
+    /// only (outside of OpenMP parallel regions, otherwise an exception is thrown). Only the reads
+    /// run on background threads.
+    void prefetch_three_integral_block(const std::vector<size_t>& A, const std::vector<size_t>& p,
+                                       const std::vector<size_t>& q,
+                                       ThreeIntsBlockOrder order = Qpq) override;
+    /// Return the maximum number of blocks kept in memory by prefetch_three_integral_block
+    size_t max_prefetched_blocks() const override { return prefetch_ ? max_prefetched_blocks_ : 0; }
     /// return ambit tensor of size A by q
     ambit::Tensor three_integral_block_two_index(const std::vector<size_t>& A, size_t p,
                                                  const std::vector<size_t>& q) override;
@@ -88,6 +106,39 @@ class DISKDFIntegrals : public Psi4Integrals {
     std::shared_ptr<psi::Matrix> ThreeIntegral_;
     size_t nthree_ = 0;
 
+    /// The indices and ordering that identify a block of three-index integrals
+    struct BlockKey {
+        std::vector<size_t> A;
+        std::vector<size_t> p;
+        std::vector<size_t> q;
+        ThreeIntsBlockOrder order;
+        bool operator==(const BlockKey& other) const {
+            return order == other.order and A == other.A and p == other.p and q == other.q;
+        }
+    };
+
+    /// The integrals copied to a file blocked by orbital (nullptr if DFHelper is used directly)
+    std::unique_ptr<BlockedDFStore> store_;
+
+    /// Read blocks in the background when requested by prefetch_three_integral_block?
+    bool prefetch_ = true;
+    /// The maximum number of blocks that are prefetched at the same time
+    static constexpr size_t max_prefetched_blocks_ = 2;
+    /// The blocks being read in the background, from the oldest to the newest request. Accessed
+    /// only by the thread that calls three_integral_block and prefetch_three_integral_block
+    std::deque<std::pair<BlockKey, std::future<ambit::Tensor>>> prefetched_;
+    /// Serializes the access to DFHelper, which is not thread safe
+    mutable std::mutex df_mutex_;
+
+    /// Copy the integrals from the DFHelper file to the blocked store
+    void build_blocked_store();
+
+    /// Read a block of the DFIntegrals from disk (the caller must hold df_mutex_)
+    ambit::Tensor read_three_integral_block(const std::vector<size_t>& A,
+                                            const std::vector<size_t>& p,
+                                            const std::vector<size_t>& q,
+                                            ThreeIntsBlockOrder order);
+
     // ==> Class private virtual functions <==
 
     void gather_integrals() override;
@@ -0,0 +1,218 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#ifdef HAVE_MPI
+
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+
+#include "distributed_df_store.h"
+
+namespace forte {
+
+namespace {
+/// The maximum number of elements moved by a single MPI call
+constexpr size_t max_transfer_size = size_t(1) << 27;
+/// The maximum number of runs of contiguous elements read by a single MPI call
+constexpr size_t max_transfer_runs = size_t(1) << 16;
+} // namespace
+
+DistributedDFStore::DistributedDFStore(MPI_Comm comm, size_t naux, size_t nmo)
+    : naux_(naux), nmo_(nmo) {
+    MPI_Comm_dup(comm, &comm_);
+    MPI_Comm_rank(comm_, &rank_);
+    MPI_Comm_size(comm_, &nproc_);
+
+    slab_begin_.resize(nproc_ + 1);
+    for (int r = 0; r <= nproc_; ++r) {
+        slab_begin_[r] = naux_ * r / nproc_;
+    }
+
+    size_t nelements = (slab_begin_[rank_ + 1] - slab_begin_[rank_]) * nmo_ * nmo_;
+    MPI_Win_allocate(static_cast<MPI_Aint>(nelements * sizeof(double)), sizeof(double),
+                     MPI_INFO_NULL, comm_, &slab_, &win_);
+    // a shared lock on all the processes is held until the window is freed
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, win_);
+}
+
+DistributedDFStore::~DistributedDFStore() {
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (finalized) {
+        return;
+    }
+    MPI_Win_unlock_all(win_);
+    MPI_Win_free(&win_);
+    MPI_Comm_free(&comm_);
+}
+
+int DistributedDFStore::owner(size_t Q) const {
+    // the last process whose slab starts at or before Q (skips empty slabs)
+    auto it = std::upper_bound(slab_begin_.begin(), slab_begin_.end(), Q);
+    return static_cast<int>(it - slab_begin_.begin()) - 1;
+}
+
+void DistributedDFStore::write(
+    const std::function<void(size_t Q_begin, size_t Q_end, double* buffer)>& fill_slab, int root) {
+    const size_t plane_size = nmo_ * nmo_;
+    if (rank_ == root) {
+        size_t max_slab = 0;
+        for (int r = 0; r < nproc_; ++r) {
+            max_slab = std::max(max_slab, slab_begin_[r + 1] - slab_begin_[r]);
+        }
+        std::vector<double> buffer(nproc_ > 1 ? max_slab * plane_size : 0);
+        for (int r = 0; r < nproc_; ++r) {
+            const size_t Q_begin = slab_begin_[r];
+            const size_t Q_end = slab_begin_[r + 1];
+            if (Q_begin == Q_end) {
+                continue;
+            }
+            if (r == rank_) {
+                fill_slab(Q_begin, Q_end, slab_);
+                continue;
+            }
+            fill_slab(Q_begin, Q_end, buffer.data());
+            const size_t nelements = (Q_end - Q_begin) * plane_size;
+            for (size_t offset = 0; offset < nelements; offset += max_transfer_size) {
+                int count = static_cast<int>(std::min(max_transfer_size, nelements - offset));
+                MPI_Put(buffer.data() + offset, count, MPI_DOUBLE, r,
+                        static_cast<MPI_Aint>(offset), count, MPI_DOUBLE, win_);
+            }
+            // the buffer is reused for the next process
+            MPI_Win_flush(r, win_);
+        }
+    }
+    // make the data written by the root visible to the local loads of all processes
+    MPI_Win_sync(win_);
+    MPI_Barrier(comm_);
+    MPI_Win_sync(win_);
+}
+
+void DistributedDFStore::read(size_t Q_begin, size_t Q_end, const std::vector<size_t>& p,
+                              const std::vector<size_t>& q, bool pqQ, double* out) const {
+    if (Q_begin > Q_end or Q_end > naux_) {
+        throw std::runtime_error("DistributedDFStore: auxiliary indices out of range");
+    }
+    if (std::any_of(p.begin(), p.end(), [&](size_t i) { return i >= nmo_; }) or
+        std::any_of(q.begin(), q.end(), [&](size_t i) { return i >= nmo_; })) {
+        throw std::runtime_error("DistributedDFStore: orbital indices out of range");
+    }
+    const size_t nQ = Q_end - Q_begin;
+    const size_t npq = p.size() * q.size();
+    if (nQ == 0 or npq == 0) {
+        return;
+    }
+    if (npq > static_cast<size_t>(INT_MAX)) {
+        throw std::runtime_error("DistributedDFStore: block of orbital indices too large");
+    }
+
+    // the runs of contiguous elements of one (p, q) plane
+    std::vector<std::pair<size_t, size_t>> plane;
+    for (size_t pi : p) {
+        for (size_t qi : q) {
+            size_t offset = pi * nmo_ + qi;
+            if (not plane.empty() and plane.back().first + plane.back().second == offset) {
+                plane.back().second += 1;
+            } else {
+                plane.emplace_back(offset, 1);
+            }
+        }
+    }
+
+    // gather the block in the order Q, p, q
+    std::vector<double> buffer(pqQ ? nQ * npq : 0);
+    double* Qpq = pqQ ? buffer.data() : out;
+
+    const size_t plane_size = nmo_ * nmo_;
+    const size_t batch_planes = std::max<size_t>(
+        1, std::min(max_transfer_size / npq, max_transfer_runs / plane.size()));
+    std::vector<std::pair<size_t, size_t>> runs;
+    for (int r = owner(Q_begin); r < nproc_ and slab_begin_[r] < Q_end; ++r) {
+        const size_t Q_first = std::max(Q_begin, slab_begin_[r]);
+        const size_t Q_last = std::min(Q_end, slab_begin_[r + 1]);
+        for (size_t Q0 = Q_first; Q0 < Q_last; Q0 += batch_planes) {
+            const size_t Q1 = std::min(Q_last, Q0 + batch_planes);
+            // the runs of a batch of planes (merged when the planes are contiguous)
+            runs.clear();
+            for (size_t Q = Q0; Q < Q1; ++Q) {
+                const size_t base = (Q - slab_begin_[r]) * plane_size;
+                for (const auto& [offset, length] : plane) {
+                    const size_t start = base + offset;
+                    if (not runs.empty() and runs.back().first + runs.back().second == start) {
+                        runs.back().second += length;
+                    } else {
+                        runs.emplace_back(start, length);
+                    }
+                }
+            }
+            get(r, runs, Qpq + (Q0 - Q_begin) * npq);
+        }
+    }
+    MPI_Win_flush_local_all(win_);
+
+    if (pqQ) {
+        for (size_t Q = 0; Q < nQ; ++Q) {
+            for (size_t pq = 0; pq < npq; ++pq) {
+                out[pq * nQ + Q] = Qpq[Q * npq + pq];
+            }
+        }
+    }
+}
+
+void DistributedDFStore::get(int target, const std::vector<std::pair<size_t, size_t>>& runs,
+                             double* out) const {
+    if (target == rank_) {
+        for (const auto& [offset, length] : runs) {
+            out = std::copy_n(slab_ + offset, length, out);
+        }
+        return;
+    }
+
+    std::vector<int> lengths;
+    std::vector<MPI_Aint> displacements;
+    lengths.reserve(runs.size());
+    displacements.reserve(runs.size());
+    size_t count = 0;
+    for (const auto& [offset, length] : runs) {
+        lengths.push_back(static_cast<int>(length));
+        displacements.push_back(static_cast<MPI_Aint>(offset * sizeof(double)));
+        count += length;
+    }
+    MPI_Datatype target_type;
+    MPI_Type_create_hindexed(static_cast<int>(runs.size()), lengths.data(), displacements.data(),
+                             MPI_DOUBLE, &target_type);
+    MPI_Type_commit(&target_type);
+    MPI_Get(out, static_cast<int>(count), MPI_DOUBLE, target, 0, 1, target_type, win_);
+    // the type is released when the pending get completes
+    MPI_Type_free(&target_type);
+}
+
+} // namespace forte
+
+#endif // HAVE_MPI
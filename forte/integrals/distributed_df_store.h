@@ -0,0 +1,117 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#pragma once
+
+#ifdef HAVE_MPI
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+
+namespace forte {
+
+/**
+ * @brief The DistributedDFStore class
+ * Stores the three-index integrals B(Q|pq) distributed over the processes of an MPI communicator
+ * and reads them back with MPI-3 one-sided communication.
+ *
+ * The auxiliary index is split into contiguous slabs, one per process. Each process exposes its
+ * slab B(Q|pq) (stored in the order Q, p, q) through an MPI window that stays locked for the
+ * lifetime of the store, so any process can read any block of integrals without the
+ * participation of the processes that own it. Only the constructor, write, and the destructor
+ * are collective.
+ */
+class DistributedDFStore {
+  public:
+    /// @brief Create a store (collective)
+    /// @param comm the communicator of the processes that store the integrals
+    /// @param naux the number of auxiliary functions
+    /// @param nmo the number of orbitals
+    DistributedDFStore(MPI_Comm comm, size_t naux, size_t nmo);
+
+    /// Free the window (collective)
+    ~DistributedDFStore();
+
+    DistributedDFStore(const DistributedDFStore&) = delete;
+    DistributedDFStore& operator=(const DistributedDFStore&) = delete;
+
+    /// @brief Write the integrals (collective)
+    /// @param fill_slab a function that, given a range of auxiliary indices [Q_begin, Q_end),
+    ///        fills a buffer with B(Q|pq) stored in the order Q, p, q. It is called only on the
+    ///        root process, once for the slab of each process.
+    /// @param root the process that computes the integrals
+    void write(const std::function<void(size_t Q_begin, size_t Q_end, double* buffer)>& fill_slab,
+               int root = 0);
+
+    /// @brief Copy a block of integrals (not collective and not thread safe)
+    /// @param Q_begin the first auxiliary index
+    /// @param Q_end one past the last auxiliary index
+    /// @param p the orbital indices p
+    /// @param q the orbital indices q
+    /// @param pqQ if true the output is stored in the order p, q, Q, otherwise Q, p, q
+    /// @param out the output buffer ((Q_end - Q_begin) * p.size() * q.size() elements)
+    void read(size_t Q_begin, size_t Q_end, const std::vector<size_t>& p,
+              const std::vector<size_t>& q, bool pqQ, double* out) const;
+
+    /// @return the number of auxiliary functions
+    size_t naux() const { return naux_; }
+    /// @return the number of orbitals
+    size_t nmo() const { return nmo_; }
+    /// @return the rank of this process
+    int rank() const { return rank_; }
+    /// @return the number of processes
+    int nproc() const { return nproc_; }
+    /// @return the first auxiliary index stored by a process (slab_begin(nproc()) = naux())
+    size_t slab_begin(int rank) const { return slab_begin_[rank]; }
+    /// @return the process that stores the auxiliary index Q
+    int owner(size_t Q) const;
+
+  private:
+    /// A private copy of the communicator passed to the constructor
+    MPI_Comm comm_ = MPI_COMM_NULL;
+    int rank_ = 0;
+    int nproc_ = 1;
+    size_t naux_;
+    size_t nmo_;
+    /// The first auxiliary index of each process (nproc_ + 1 elements)
+    std::vector<size_t> slab_begin_;
+    /// The window that exposes the slabs
+    MPI_Win win_ = MPI_WIN_NULL;
+    /// The slab stored by this process
+    double* slab_ = nullptr;
+
+    /// Start copying runs (offset, length) of contiguous elements from the slab of a process
+    void get(int target, const std::vector<std::pair<size_t, size_t>>& runs, double* out) const;
+};
+
+} // namespace forte
+
+#endif // HAVE_MPI
@@ -0,0 +1,394 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp_get_max_threads() 1
+#endif
+
+#include "helpers/mapped_file.h"
+
+#include "fcidump.h"
+
+namespace forte {
+
+namespace {
+
+constexpr char fcidump_magic[8] = {'F', 'O', 'R', 'T', 'E', 'F', 'C', 'I'};
+constexpr uint32_t fcidump_version = 1;
+constexpr size_t fcidump_pntgrp_size = 8;
+
+struct FCIDUMPHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t has_epsilon;
+    uint64_t norb;
+    int32_t nelec;
+    int32_t ms2;
+    int32_t isym;
+    int32_t padding;
+    char pntgrp[fcidump_pntgrp_size];
+    double enuc;
+};
+
+bool is_blank(char c) { return c == ' ' or c == '\t' or c == '\r' or c == ','; }
+
+const char* skip_blanks(const char* ptr, const char* end) {
+    while (ptr < end and is_blank(*ptr))
+        ++ptr;
+    return ptr;
+}
+
+/// Parse a floating point number, accepting Fortran exponents (1.0D-01)
+const char* parse_double(const char* ptr, const char* end, double& value) {
+    ptr = skip_blanks(ptr, end);
+    if (ptr < end and *ptr == '+')
+        ++ptr;
+    auto [next, ec] = std::from_chars(ptr, end, value);
+    if (ec != std::errc()) {
+        throw std::runtime_error("read_fcidump: cannot parse an integral value");
+    }
+    if (next < end and (*next == 'D' or *next == 'd')) {
+        // copy the number replacing the Fortran exponent and parse it again
+        const char* num_end = next + 1;
+        while (num_end < end and not is_blank(*num_end) and *num_end != '\n')
+            ++num_end;
+        std::string number(ptr, num_end);
+        number[next - ptr] = 'e';
+        auto [e_next, e_ec] = std::from_chars(number.data(), number.data() + number.size(), value);
+        if (e_ec != std::errc() or e_next != number.data() + number.size()) {
+            throw std::runtime_error("read_fcidump: cannot parse an integral value");
+        }
+        next = num_end;
+    }
+    return next;
+}
+
+const char* parse_int(const char* ptr, const char* end, int& value) {
+    ptr = skip_blanks(ptr, end);
+    auto [next, ec] = std::from_chars(ptr, end, value);
+    if (ec != std::errc()) {
+        throw std::runtime_error("read_fcidump: cannot parse an integral index");
+    }
+    return next;
+}
+
+/// Parse the namelist header (the text between &FCI and &END)
+void parse_header(const std::string& header, FCIDUMP& fcidump) {
+    std::string key;
+    std::vector<std::string> tokens;
+    std::string token;
+    for (char c : header) {
+        if (is_blank(c) or c == '\n') {
+            if (not token.empty())
+                tokens.push_back(token);
+            token.clear();
+        } else {
+            token += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        }
+    }
+    if (not token.empty())
+        tokens.push_back(token);
+
+    for (const auto& t : tokens) {
+        if ((t[0] == '&') or (t[0] == '/'))
+            continue;
+        std::string value = t;
+        if (auto eq = t.find('='); eq != std::string::npos) {
+            key = t.substr(0, eq);
+            value = t.substr(eq + 1);
+        }
+        if (value.empty())
+            continue;
+        if (key == "NORB") {
+            fcidump.norb = std::stoul(value);
+        } else if (key == "NELEC") {
+            fcidump.nelec = std::stoi(value);
+        } else if (key == "MS2") {
+            fcidump.ms2 = std::stoi(value);
+        } else if (key == "ISYM") {
+            fcidump.isym = std::stoi(value);
+        } else if (key == "ORBSYM") {
+            fcidump.orbsym.push_back(std::stoi(value));
+        } else if (key == "PNTGRP") {
+            fcidump.pntgrp = value;
+        } else if (key == "UHF") {
+            if (value.find("TRUE") != std::string::npos or value == "T" or value == ".T.") {
+                throw std::runtime_error("read_fcidump: unrestricted (UHF) FCIDUMP files are not "
+                                         "supported by the native reader");
+            }
+        }
+    }
+    if (fcidump.norb == 0) {
+        throw std::runtime_error("read_fcidump: the header does not specify NORB");
+    }
+    if (fcidump.orbsym.empty()) {
+        fcidump.orbsym.assign(fcidump.norb, 1);
+    }
+    if (fcidump.orbsym.size() != fcidump.norb) {
+        throw std::runtime_error("read_fcidump: the size of ORBSYM is different from NORB");
+    }
+}
+
+/// Parse the integral lines in [begin, end), which must start at the beginning of a line
+void parse_integrals(const char* begin, const char* end, FCIDUMP& fcidump,
+                     std::vector<char>& has_epsilon, double& enuc) {
+    const size_t norb = fcidump.norb;
+    const char* ptr = begin;
+    while (ptr < end) {
+        const char* line_end = static_cast<const char*>(std::memchr(ptr, '\n', end - ptr));
+        if (line_end == nullptr)
+            line_end = end;
+        if (skip_blanks(ptr, line_end) != line_end) {
+            double value;
+            int idx[4];
+            const char* p = parse_double(ptr, line_end, value);
+            for (int k = 0; k < 4; ++k) {
+                p = parse_int(p, line_end, idx[k]);
+            }
+            for (int k = 0; k < 4; ++k) {
+                if ((idx[k] < 0) or (static_cast<size_t>(idx[k]) > norb)) {
+                    throw std::runtime_error("read_fcidump: orbital index out of range");
+                }
+            }
+            const size_t i = idx[0], j = idx[1], k = idx[2], l = idx[3];
+            if (k > 0) {
+                // (ij|kl) two-electron integral
+                fcidump.eri[packed_tei_index(i - 1, j - 1, k - 1, l - 1)] = value;
+            } else if (j > 0) {
+                // h_ij one-electron integral
+                fcidump.hcore[(i - 1) * norb + (j - 1)] = value;
+                fcidump.hcore[(j - 1) * norb + (i - 1)] = value;
+            } else if (i > 0) {
+                // orbital energy
+                fcidump.epsilon[i - 1] = value;
+                has_epsilon[i - 1] = 1;
+            } else {
+                enuc = value;
+            }
+        }
+        ptr = line_end + 1;
+    }
+}
+
+} // namespace
+
+bool is_fcidump_binary(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    char magic[sizeof(fcidump_magic)] = {};
+    file.read(magic, sizeof(magic));
+    return file and std::memcmp(magic, fcidump_magic, sizeof(magic)) == 0;
+}
+
+FCIDUMP read_fcidump(const std::string& filename) {
+    return is_fcidump_binary(filename) ? read_fcidump_binary(filename)
+                                       : read_fcidump_text(filename);
+}
+
+FCIDUMP read_fcidump_text(const std::string& filename) {
+    MappedFile file(filename, "read_fcidump");
+    const char* data = file.data();
+    const char* end = data + file.size();
+
+    // find the end of the namelist (a line containing &END or /)
+    const char* body = nullptr;
+    for (const char* line = data; line < end;) {
+        const char* line_end = static_cast<const char*>(std::memchr(line, '\n', end - line));
+        if (line_end == nullptr)
+            line_end = end;
+        std::string text(line, line_end);
+        std::transform(text.begin(), text.end(), text.begin(),
+                       [](unsigned char c) { return std::toupper(c); });
+        if ((text.find("&END") != std::string::npos) or (text.find('/') != std::string::npos)) {
+            body = std::min(line_end + 1, end);
+            break;
+        }
+        line = line_end + 1;
+    }
+    if (body == nullptr) {
+        throw std::runtime_error("read_fcidump: cannot find the end of the header in " + filename);
+    }
+
+    FCIDUMP fcidump;
+    parse_header(std::string(data, body), fcidump);
+    const size_t norb = fcidump.norb;
+    fcidump.hcore.assign(norb * norb, 0.0);
+    fcidump.epsilon.assign(norb, 0.0);
+    fcidump.eri.assign(packed_tei_size(norb), 0.0);
+
+    // split the body in chunks that start at the beginning of a line and parse them in parallel
+    const size_t nchunks = std::max<size_t>(1, omp_get_max_threads());
+    std::vector<const char*> bounds(nchunks + 1, end);
+    bounds[0] = body;
+    for (size_t c = 1; c < nchunks; ++c) {
+        const char* ptr = std::max(bounds[c - 1], body + (end - body) * c / nchunks);
+        const char* nl = static_cast<const char*>(std::memchr(ptr, '\n', end - ptr));
+        bounds[c] = nl == nullptr ? end : nl + 1;
+    }
+
+    std::vector<std::vector<char>> has_epsilon(nchunks, std::vector<char>(norb, 0));
+    std::vector<double> enuc(nchunks, 0.0);
+    std::vector<std::string> errors(nchunks);
+#pragma omp parallel for schedule(static, 1)
+    for (size_t c = 0; c < nchunks; ++c) {
+        try {
+            parse_integrals(bounds[c], bounds[c + 1], fcidump, has_epsilon[c], enuc[c]);
+        } catch (const std::exception& e) {
+            errors[c] = e.what();
+        }
+    }
+    for (const auto& error : errors) {
+        if (not error.empty())
+            throw std::runtime_error(error + " in " + filename);
+    }
+
+    for (size_t c = 0; c < nchunks; ++c) {
+        fcidump.enuc += enuc[c];
+    }
+    bool any_epsilon = false;
+    for (const auto& h : has_epsilon) {
+        any_epsilon = any_epsilon or std::any_of(h.begin(), h.end(), [](char x) { return x; });
+    }
+    if (not any_epsilon) {
+        fcidump.epsilon.clear();
+    }
+    return fcidump;
+}
+
+FCIDUMP read_fcidump_binary(const std::string& filename) {
+    MappedFile file(filename, "read_fcidump");
+    if (file.size() < sizeof(FCIDUMPHeader)) {
+        throw std::runtime_error("read_fcidump_binary: the file " + filename + " is too short");
+    }
+    FCIDUMPHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, fcidump_magic, sizeof(fcidump_magic)) != 0) {
+        throw std::runtime_error("read_fcidump_binary: " + filename +
+                                 " is not a binary FCIDUMP file");
+    }
+    if (header.version != fcidump_version) {
+        throw std::runtime_error("read_fcidump_binary: unsupported version of " + filename);
+    }
+
+    FCIDUMP fcidump;
+    fcidump.norb = header.norb;
+    fcidump.nelec = header.nelec;
+    fcidump.ms2 = header.ms2;
+    fcidump.isym = header.isym;
+    fcidump.pntgrp = std::string(header.pntgrp, strnlen(header.pntgrp, fcidump_pntgrp_size));
+    fcidump.enuc = header.enuc;
+
+    const size_t norb = fcidump.norb;
+    const size_t neps = header.has_epsilon ? norb : 0;
+    const size_t expected = sizeof(header) + norb * sizeof(int32_t) +
+                            (norb * norb + neps + packed_tei_size(norb)) * sizeof(double);
+    if (file.size() != expected) {
+        throw std::runtime_error("read_fcidump_binary: the file " + filename + " is truncated");
+    }
+
+    const char* ptr = file.data() + sizeof(header);
+    std::vector<int32_t> orbsym(norb);
+    std::memcpy(orbsym.data(), ptr, norb * sizeof(int32_t));
+    fcidump.orbsym.assign(orbsym.begin(), orbsym.end());
+    ptr += norb * sizeof(int32_t);
+
+    auto copy_doubles = [&ptr](std::vector<double>& v, size_t n) {
+        v.resize(n);
+        std::memcpy(v.data(), ptr, n * sizeof(double));
+        ptr += n * sizeof(double);
+    };
+    copy_doubles(fcidump.hcore, norb * norb);
+    copy_doubles(fcidump.epsilon, neps);
+
+    // copy the two-electron integrals in parallel blocks
+    const size_t ntei = packed_tei_size(norb);
+    fcidump.eri.resize(ntei);
+    const size_t block = 1 << 20;
+    const size_t nblocks = (ntei + block - 1) / block;
+    const char* eri_ptr = ptr;
+#pragma omp parallel for
+    for (size_t b = 0; b < nblocks; ++b) {
+        const size_t first = b * block;
+        const size_t n = std::min(block, ntei - first);
+        std::memcpy(fcidump.eri.data() + first, eri_ptr + first * sizeof(double),
+                    n * sizeof(double));
+    }
+    return fcidump;
+}
+
+void write_fcidump_binary(const std::string& filename, const FCIDUMP& fcidump) {
+    const size_t norb = fcidump.norb;
+    if ((fcidump.hcore.size() != norb * norb) or (fcidump.eri.size() != packed_tei_size(norb)) or
+        (fcidump.orbsym.size() != norb) or
+        (not fcidump.epsilon.empty() and fcidump.epsilon.size() != norb)) {
+        throw std::runtime_error("write_fcidump_binary: inconsistent FCIDUMP object");
+    }
+    if (fcidump.pntgrp.size() > fcidump_pntgrp_size) {
+        throw std::runtime_error("write_fcidump_binary: point group label is too long");
+    }
+
+    FCIDUMPHeader header = {};
+    std::memcpy(header.magic, fcidump_magic, sizeof(fcidump_magic));
+    header.version = fcidump_version;
+    header.has_epsilon = fcidump.epsilon.empty() ? 0 : 1;
+    header.norb = norb;
+    header.nelec = fcidump.nelec;
+    header.ms2 = fcidump.ms2;
+    header.isym = fcidump.isym;
+    std::memcpy(header.pntgrp, fcidump.pntgrp.data(), fcidump.pntgrp.size());
+    header.enuc = fcidump.enuc;
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (not file) {
+        throw std::runtime_error("write_fcidump_binary: cannot open " + filename);
+    }
+    std::vector<int32_t> orbsym(fcidump.orbsym.begin(), fcidump.orbsym.end());
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(orbsym.data()), norb * sizeof(int32_t));
+    file.write(reinterpret_cast<const char*>(fcidump.hcore.data()),
+               fcidump.hcore.size() * sizeof(double));
+    file.write(reinterpret_cast<const char*>(fcidump.epsilon.data()),
+               fcidump.epsilon.size() * sizeof(double));
+    file.write(reinterpret_cast<const char*>(fcidump.eri.data()),
+               fcidump.eri.size() * sizeof(double));
+    if (not file) {
+        throw std::runtime_error("write_fcidump_binary: error while writing " + filename);
+    }
+}
+
+} // namespace forte
@@ -0,0 +1,108 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace forte {
+
+/**
+ * Native readers of FCIDUMP files
+ *
+ * Two formats are supported:
+ *   - the text FCIDUMP format defined in Comp. Phys. Commun. 54 75 (1989), restricted to
+ *     spin-restricted (UHF=.FALSE.) files. Lines with four nonzero indices are two-electron
+ *     integrals (pq|rs) in chemists' notation, lines with two nonzero indices are one-electron
+ *     integrals, lines with one nonzero index are orbital energies, and the line with no indices
+ *     is the scalar energy. The integral lines are parsed in parallel.
+ *   - a binary format that stores the same information with the two-electron integrals packed
+ *     using their eight-fold permutational symmetry. The file consists of a fixed-size header
+ *     (magic string, version, number of orbitals, electrons, 2 * Ms, state symmetry, point group,
+ *     and scalar energy), followed by the orbital symmetries, the one-electron integrals, the
+ *     orbital energies (if any), and the packed two-electron integrals. Data is stored in the
+ *     native byte order and the file is read by mapping it in memory.
+ */
+
+/// The content of a FCIDUMP file
+struct FCIDUMP {
+    /// The number of orbitals
+    size_t norb = 0;
+    /// The number of electrons
+    int nelec = 0;
+    /// Twice the spin projection
+    int ms2 = 0;
+    /// The symmetry of the state (FCIDUMP convention, starting from 1)
+    int isym = 1;
+    /// The symmetry of each orbital (FCIDUMP convention, starting from 1)
+    std::vector<int> orbsym;
+    /// The point group (empty if not specified)
+    std::string pntgrp;
+    /// The nuclear repulsion plus frozen core energy
+    double enuc = 0.0;
+    /// The one-electron integrals h[p * norb + q]
+    std::vector<double> hcore;
+    /// The orbital energies (empty if not present in the file)
+    std::vector<double> epsilon;
+    /// The two-electron integrals (pq|rs) packed with packed_tei_index
+    std::vector<double> eri;
+};
+
+/// The index of the pair (p,q) with p >= q or q >= p in a lower-triangular packing
+inline size_t packed_pair_index(size_t p, size_t q) {
+    return p >= q ? p * (p + 1) / 2 + q : q * (q + 1) / 2 + p;
+}
+
+/// The index of the integral (pq|rs) in an array packed with eight-fold permutational symmetry
+inline size_t packed_tei_index(size_t p, size_t q, size_t r, size_t s) {
+    return packed_pair_index(packed_pair_index(p, q), packed_pair_index(r, s));
+}
+
+/// The number of elements in an array of packed two-electron integrals for n orbitals
+inline size_t packed_tei_size(size_t n) {
+    const size_t npair = n * (n + 1) / 2;
+    return npair * (npair + 1) / 2;
+}
+
+/// Read a FCIDUMP file in text or binary format (detected from the first bytes of the file)
+FCIDUMP read_fcidump(const std::string& filename);
+
+/// Read a FCIDUMP file in text format
+FCIDUMP read_fcidump_text(const std::string& filename);
+
+/// Read a FCIDUMP file in binary format
+FCIDUMP read_fcidump_binary(const std::string& filename);
+
+/// Write a FCIDUMP object to a file in binary format
+void write_fcidump_binary(const std::string& filename, const FCIDUMP& fcidump);
+
+/// Return true if a file is a binary FCIDUMP file
+bool is_fcidump_binary(const std::string& filename);
+
+} // namespace forte
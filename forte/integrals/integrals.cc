@@ -135,7 +135,7 @@ void ForteIntegrals::allocate() {
     one_electron_integrals_a_.assign(ncmo_ * ncmo_, 0.0);
     one_electron_integrals_b_.assign(ncmo_ * ncmo_, 0.0);
 
-    if ((integral_type_ == Conventional) or (integral_type_ == Custom)) {
+    if (in_core_tei()) {
         // Allocate the memory required to store the two-electron integrals
         aphys_tei_aa_.assign(num_aptei_, 0.0);
         aphys_tei_ab_.assign(num_aptei_, 0.0);
@@ -584,6 +584,39 @@ void ForteIntegrals::compute_frozen_one_body_operator() {
     _undefined_function("compute_frozen_one_body_operator");
 }
 
+std::vector<double>
+ForteIntegrals::aptei_aa_elements(const std::vector<std::array<size_t, 4>>& indices) const {
+    std::vector<double> out(indices.size());
+#pragma omp parallel for
+    for (size_t n = 0; n < indices.size(); ++n) {
+        const auto& [p, q, r, s] = indices[n];
+        out[n] = aptei_aa(p, q, r, s);
+    }
+    return out;
+}
+
+std::vector<double>
+ForteIntegrals::aptei_ab_elements(const std::vector<std::array<size_t, 4>>& indices) const {
+    std::vector<double> out(indices.size());
+#pragma omp parallel for
+    for (size_t n = 0; n < indices.size(); ++n) {
+        const auto& [p, q, r, s] = indices[n];
+        out[n] = aptei_ab(p, q, r, s);
+    }
+    return out;
+}
+
+std::vector<double>
+ForteIntegrals::aptei_bb_elements(const std::vector<std::array<size_t, 4>>& indices) const {
+    std::vector<double> out(indices.size());
+#pragma omp parallel for
+    for (size_t n = 0; n < indices.size(); ++n) {
+        const auto& [p, q, r, s] = indices[n];
+        out[n] = aptei_bb(p, q, r, s);
+    }
+    return out;
+}
+
 size_t ForteIntegrals::nthree() const {
     _undefined_function("nthree");
     return 0;
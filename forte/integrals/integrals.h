@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <vector>
 
 #include "psi4/libfock/jk.h"
@@ -196,6 +197,8 @@ class ForteIntegrals : public Observer, public std::enable_shared_from_this<Fort
 
     /// Set printing level
     void set_print(int print);
+    /// Return the printing level
+    int print_level() const { return print_; }
 
     /// Return the number of auxiliary functions
     virtual size_t nthree() const;
@@ -241,6 +244,15 @@ class ForteIntegrals : public Observer, public std::enable_shared_from_this<Fort
     /// The antisymmetrixed beta-beta two-electron integrals in physicist notation <pq||rs>
     virtual double aptei_bb(size_t p, size_t q, size_t r, size_t s) const = 0;
 
+    /// Compute a list of antisymmetrized alpha-alpha integrals <pq||rs> in parallel
+    /// @param indices the list of indices (p, q, r, s)
+    /// @return the integrals, in the same order as the indices
+    std::vector<double> aptei_aa_elements(const std::vector<std::array<size_t, 4>>& indices) const;
+    /// Compute a list of alpha-beta integrals <pq|rs> in parallel
+    std::vector<double> aptei_ab_elements(const std::vector<std::array<size_t, 4>>& indices) const;
+    /// Compute a list of antisymmetrized beta-beta integrals <pq||rs> in parallel
+    std::vector<double> aptei_bb_elements(const std::vector<std::array<size_t, 4>>& indices) const;
+
     /// @return a tensor with a block of the alpha one-electron integrals
     ambit::Tensor oei_a_block(const std::vector<size_t>& p, const std::vector<size_t>& q);
     /// @return a tensor with a block of the beta one-electron integrals
@@ -268,6 +280,22 @@ class ForteIntegrals : public Observer, public std::enable_shared_from_this<Fort
                                                const std::vector<size_t>&,
                                                ThreeIntsBlockOrder order = Qpq);
 
+    /// Announce that a block of three-index integrals will be requested soon. Classes that read
+    /// the integrals from disk can use this hint to load the block in the background, so that the
+    /// I/O overlaps with the work done before the block is requested. The default does nothing.
+    virtual void prefetch_three_integral_block(const std::vector<size_t>&,
+                                               const std::vector<size_t>&,
+                                               const std::vector<size_t>&,
+                                               ThreeIntsBlockOrder = Qpq) {}
+
+    /// Return the maximum number of blocks that prefetch_three_integral_block keeps in memory,
+    /// so that callers can include them in their memory budget. The default is zero.
+    virtual size_t max_prefetched_blocks() const { return 0; }
+
+    /// Are only the integrals with four active indices available? In this case the operators
+    /// that involve other orbitals must be built with make_fock_inactive. The default is false.
+    virtual bool active_integrals_only() const { return false; }
+
     /// This function is only used by DiskDF and it is used to go from a Apq->Aq tensor
     virtual ambit::Tensor three_integral_block_two_index(const std::vector<size_t>& A, size_t p,
                                                          const std::vector<size_t>&);
@@ -544,6 +572,12 @@ class ForteIntegrals : public Observer, public std::enable_shared_from_this<Fort
     bool test_orbital_spin_restriction(std::shared_ptr<psi::Matrix> A,
                                        std::shared_ptr<psi::Matrix> B) const;
 
+    /// Does this object store all the two-electron integrals in aphys_tei_aa/ab/bb?
+    /// If true, these arrays are allocated when the object is initialized.
+    virtual bool in_core_tei() const {
+        return (integral_type_ == Conventional) or (integral_type_ == Custom);
+    }
+
     /// An addressing function to for two-electron integrals
     /// @return the address of the integral <pq|rs> or <pq||rs>
     size_t aptei_index(size_t p, size_t q, size_t r, size_t s) const {
@@ -38,6 +38,7 @@
 #include "integrals/df_integrals.h"
 #include "integrals/diskdf_integrals.h"
 #include "integrals/conventional_integrals.h"
+#include "integrals/mpi_df_integrals.h"
 
 #include "make_integrals.h"
 
@@ -65,12 +66,20 @@ make_forte_integrals_from_psi4(std::shared_ptr<psi::Wavefunction> ref_wfn,
     } else if (int_type == "DISKDF") {
         ints = ForteIntegrals::create<DISKDFIntegrals>(options, scf_info, ref_wfn, mo_space_info,
                                                        IntegralSpinRestriction::Restricted);
+    } else if (int_type == "DISTDF") {
+#ifdef HAVE_MPI
+        ints = ForteIntegrals::create<MPIDFIntegrals>(options, scf_info, ref_wfn, mo_space_info,
+                                                      IntegralSpinRestriction::Restricted);
+#else
+        throw std::runtime_error("INT_TYPE=DISTDF requires Forte compiled with ENABLE_MPI");
+#endif
     } else if (int_type == "CONVENTIONAL") {
         ints = ForteIntegrals::create<ConventionalIntegrals>(
             options, scf_info, ref_wfn, mo_space_info, IntegralSpinRestriction::Restricted);
     } else {
         psi::outfile->Printf(
-            "\n Please check your int_type. Choices are CHOLESKY, DF, DISKDF, or CONVENTIONAL");
+            "\n Please check your int_type. Choices are CHOLESKY, DF, DISKDF, DISTDF, or "
+            "CONVENTIONAL");
         throw std::runtime_error("INT_TYPE is not correct.  Check options");
     }
 
@@ -93,4 +102,13 @@ std::shared_ptr<ForteIntegrals> make_custom_forte_integrals(
     return ints;
 }
 
+std::shared_ptr<ForteIntegrals> make_custom_forte_integrals_packed(
+    std::shared_ptr<ForteOptions> options, std::shared_ptr<SCFInfo> scf_info,
+    std::shared_ptr<MOSpaceInfo> mo_space_info, double scalar, const std::vector<double>& oei,
+    std::vector<double> packed_tei) {
+    auto ints = ForteIntegrals::create<CustomIntegrals>(options, scf_info, mo_space_info, scalar,
+                                                        oei, std::move(packed_tei));
+    return ints;
+}
+
 } // namespace forte
@@ -62,4 +62,18 @@ std::shared_ptr<ForteIntegrals> make_custom_forte_integrals(
     const std::vector<double>& oei_b, const std::vector<double>& tei_aa,
     const std::vector<double>& tei_ab, const std::vector<double>& tei_bb);
 
+/// @brief Make a ForteIntegrals object from spin-restricted integrals with packed two-electron
+/// integrals
+/// @param options A ForteOptions object
+/// @param scf_info A SCFInfo object
+/// @param mo_space_info A MOSpaceInfo object
+/// @param scalar The scalar term in the Hamiltonian
+/// @param oei A vector of one-electron integrals
+/// @param packed_tei A vector of two-electron integrals (pq|rs) packed with eight-fold
+/// permutational symmetry (see packed_tei_index)
+std::shared_ptr<ForteIntegrals> make_custom_forte_integrals_packed(
+    std::shared_ptr<ForteOptions> options, std::shared_ptr<SCFInfo> scf_info,
+    std::shared_ptr<MOSpaceInfo> mo_space_info, double scalar, const std::vector<double>& oei,
+    std::vector<double> packed_tei);
+
 } // namespace forte
@@ -0,0 +1,308 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#ifdef HAVE_MPI
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#include "psi4/libpsi4util/process.h"
+#include "psi4/libmints/basisset.h"
+#include "psi4/libmints/matrix.h"
+#include "psi4/libmints/wavefunction.h"
+#include "psi4/lib3index/dfhelper.h"
+
+#include "forte-def.h"
+#include "helpers/helpers.h"
+#include "helpers/printing.h"
+#include "helpers/timer.h"
+#include "helpers/memory.h"
+
+#include "mpi_df_integrals.h"
+
+using namespace ambit;
+using namespace psi;
+
+namespace forte {
+
+namespace {
+/// Check that this thread may read the distributed integrals. Reads from threads other than the
+/// main one require MPI_THREAD_SERIALIZED, which the MPI library may not provide.
+void check_mpi_thread_level() {
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    if (provided >= MPI_THREAD_SERIALIZED) {
+        return;
+    }
+    int is_main = 0;
+    MPI_Is_thread_main(&is_main);
+    if (not is_main) {
+        throw std::runtime_error("MPIDFIntegrals: the MPI library does not support calls from "
+                                 "threads other than the main one (MPI_THREAD_SERIALIZED). Read "
+                                 "the integrals outside of parallel regions or use one thread.");
+    }
+}
+} // namespace
+
+MPIDFIntegrals::MPIDFIntegrals(std::shared_ptr<ForteOptions> options,
+                               std::shared_ptr<SCFInfo> scf_info,
+                               std::shared_ptr<psi::Wavefunction> ref_wfn,
+                               std::shared_ptr<MOSpaceInfo> mo_space_info,
+                               IntegralSpinRestriction restricted)
+    : Psi4Integrals(options, scf_info, ref_wfn, mo_space_info, DistDF, restricted) {}
+
+void MPIDFIntegrals::initialize() {
+    Psi4Integrals::base_initialize_psi4();
+
+    print_info();
+
+    // all the processes take part in building the distributed integrals
+    if (not skip_build_) {
+        local_timer int_timer;
+        gather_integrals();
+        freeze_core_orbitals();
+        print_timing("distributed density-fitted integrals", int_timer.get());
+    }
+}
+
+std::vector<size_t> MPIDFIntegrals::store_indices(const std::vector<size_t>& p) const {
+    if (std::any_of(p.begin(), p.end(), [&](size_t i) { return i >= aptei_idx_; })) {
+        throw std::runtime_error("MPIDFIntegrals: MO indices out of range");
+    }
+    // the store holds all the orbitals, so after freezing the indices are mapped to the MOs
+    if (aptei_idx_ == nmo_) {
+        return p;
+    }
+    std::vector<size_t> p_mo(p.size());
+    for (size_t i = 0; i < p.size(); ++i) {
+        p_mo[i] = cmotomo_[p[i]];
+    }
+    return p_mo;
+}
+
+std::vector<double> MPIDFIntegrals::read_pq(size_t p, size_t q) const {
+    auto p_mo = store_indices({p, q});
+    std::vector<double> B(nthree_);
+    check_mpi_thread_level();
+    std::lock_guard<std::mutex> lock(store_mutex_);
+    store_->read(0, nthree_, {p_mo[0]}, {p_mo[1]}, false, B.data());
+    return B;
+}
+
+double MPIDFIntegrals::aptei_aa(size_t p, size_t q, size_t r, size_t s) const {
+    auto Bpr = read_pq(p, r);
+    auto Bqs = read_pq(q, s);
+    auto Bps = read_pq(p, s);
+    auto Bqr = read_pq(q, r);
+    return std::inner_product(Bpr.begin(), Bpr.end(), Bqs.begin(), 0.0) -
+           std::inner_product(Bps.begin(), Bps.end(), Bqr.begin(), 0.0);
+}
+
+double MPIDFIntegrals::aptei_ab(size_t p, size_t q, size_t r, size_t s) const {
+    auto Bpr = read_pq(p, r);
+    auto Bqs = read_pq(q, s);
+    return std::inner_product(Bpr.begin(), Bpr.end(), Bqs.begin(), 0.0);
+}
+
+double MPIDFIntegrals::aptei_bb(size_t p, size_t q, size_t r, size_t s) const {
+    return aptei_aa(p, q, r, s);
+}
+
+ambit::Tensor MPIDFIntegrals::aptei_aa_block(const std::vector<size_t>& p,
+                                             const std::vector<size_t>& q,
+                                             const std::vector<size_t>& r,
+                                             const std::vector<size_t>& s) {
+    return aptei_block(p, q, r, s, true);
+}
+
+ambit::Tensor MPIDFIntegrals::aptei_ab_block(const std::vector<size_t>& p,
+                                             const std::vector<size_t>& q,
+                                             const std::vector<size_t>& r,
+                                             const std::vector<size_t>& s) {
+    return aptei_block(p, q, r, s, false);
+}
+
+ambit::Tensor MPIDFIntegrals::aptei_bb_block(const std::vector<size_t>& p,
+                                             const std::vector<size_t>& q,
+                                             const std::vector<size_t>& r,
+                                             const std::vector<size_t>& s) {
+    return aptei_block(p, q, r, s, true);
+}
+
+ambit::Tensor MPIDFIntegrals::aptei_block(const std::vector<size_t>& p,
+                                          const std::vector<size_t>& q,
+                                          const std::vector<size_t>& r,
+                                          const std::vector<size_t>& s, bool antisymmetrize) {
+    std::vector<size_t> Avec(nthree_);
+    std::iota(Avec.begin(), Avec.end(), 0);
+
+    auto out = ambit::Tensor::build(tensor_type_, "out", {p.size(), q.size(), r.size(), s.size()});
+    auto Qpr = three_integral_block(Avec, p, r);
+    auto Qqs = three_integral_block(Avec, q, s);
+    out("p,q,r,s") = Qpr("A,p,r") * Qqs("A,q,s");
+    if (antisymmetrize) {
+        auto Qps = three_integral_block(Avec, p, s);
+        auto Qqr = three_integral_block(Avec, q, r);
+        out("p,q,r,s") -= Qps("A,p,s") * Qqr("A,q,r");
+    }
+    return out;
+}
+
+ambit::Tensor MPIDFIntegrals::three_integral_block(const std::vector<size_t>& A,
+                                                   const std::vector<size_t>& p,
+                                                   const std::vector<size_t>& q,
+                                                   ThreeIntsBlockOrder order) {
+    ambit::Tensor out;
+    if (order == pqQ) {
+        out = ambit::Tensor::build(tensor_type_, "Return", {p.size(), q.size(), A.size()});
+    } else {
+        out = ambit::Tensor::build(tensor_type_, "Return", {A.size(), p.size(), q.size()});
+    }
+    if (A.empty() or p.empty() or q.empty()) {
+        return out;
+    }
+
+    auto [A_min, A_max] = std::minmax_element(A.begin(), A.end());
+    if (*A_max >= nthree_) {
+        throw std::runtime_error("MPIDFIntegrals: auxiliary indices out of range");
+    }
+    auto p_mo = store_indices(p);
+    auto q_mo = store_indices(q);
+
+    bool A_contiguous = true;
+    for (size_t a = 1; a < A.size(); ++a) {
+        if (A[a] != A[0] + a) {
+            A_contiguous = false;
+            break;
+        }
+    }
+
+    check_mpi_thread_level();
+    std::lock_guard<std::mutex> lock(store_mutex_);
+    if (A_contiguous) {
+        store_->read(A[0], A[0] + A.size(), p_mo, q_mo, order == pqQ, out.data().data());
+        return out;
+    }
+
+    // read the range of auxiliary indices that contains A and select the ones requested
+    const size_t np = p.size();
+    const size_t nq = q.size();
+    std::vector<double> Qpq((*A_max - *A_min + 1) * np * nq);
+    store_->read(*A_min, *A_max + 1, p_mo, q_mo, false, Qpq.data());
+    if (order == pqQ) {
+        out.iterate([&](const std::vector<size_t>& i, double& value) {
+            value = Qpq[((A[i[2]] - *A_min) * np + i[0]) * nq + i[1]];
+        });
+    } else {
+        out.iterate([&](const std::vector<size_t>& i, double& value) {
+            value = Qpq[((A[i[0]] - *A_min) * np + i[1]) * nq + i[2]];
+        });
+    }
+    return out;
+}
+
+ambit::Tensor MPIDFIntegrals::three_integral_block_two_index(const std::vector<size_t>& A,
+                                                             size_t p,
+                                                             const std::vector<size_t>& q) {
+    auto Apq = three_integral_block(A, {p}, q);
+    auto Aq = ambit::Tensor::build(tensor_type_, "Return", {A.size(), q.size()});
+    Aq.data() = Apq.data();
+    return Aq;
+}
+
+double** MPIDFIntegrals::three_integral_pointer() {
+    throw std::runtime_error("MPIDFIntegrals: the integrals are distributed and cannot be "
+                             "accessed through a pointer");
+}
+
+size_t MPIDFIntegrals::nthree() const { return nthree_; }
+
+void MPIDFIntegrals::gather_integrals() {
+    std::shared_ptr<psi::BasisSet> primary = wfn_->basisset();
+    std::shared_ptr<psi::BasisSet> auxiliary = wfn_->get_basisset("DF_BASIS_MP2");
+    nthree_ = auxiliary->nbf();
+
+    // free the window of the previous integrals before allocating a new one
+    store_.reset();
+    store_ = std::make_unique<DistributedDFStore>(MPI_COMM_WORLD, nthree_, nmo_);
+
+    outfile->Printf("\n  Number of auxiliary basis functions:  %zu", nthree_);
+    auto mem_info = to_xb2<double>((store_->slab_begin(store_->rank() + 1) -
+                                    store_->slab_begin(store_->rank())) *
+                                   nmo_ * nmo_);
+    outfile->Printf("\n  Integrals distributed over %d processes (%.2f %s on this process)\n",
+                    store_->nproc(), mem_info.first, mem_info.second.c_str());
+
+    // the first process computes the integrals and sends a slab to each process
+    std::shared_ptr<psi::DFHelper> df;
+    if (store_->rank() == 0) {
+        df = std::make_shared<psi::DFHelper>(primary, auxiliary);
+        size_t mem_sys = psi::Process::environment.get_memory() * 0.9 / sizeof(double);
+        int64_t mem = mem_sys;
+        if (JK_status_ == JKStatus::initialized) {
+            mem = mem_sys - JK_->memory_estimate();
+            if (mem < 0) {
+                auto xb = to_xb(static_cast<size_t>(-mem), sizeof(double));
+                std::string msg = "Not enough memory! Need at least ";
+                msg += std::to_string(xb.first) + " " + xb.second.c_str() + " more.";
+                outfile->Printf("\n  %s", msg.c_str());
+                throw psi::PSIEXCEPTION(msg);
+            }
+        }
+        df->set_schwarz_cutoff(schwarz_cutoff_);
+        df->set_fitting_condition(df_fitting_cutoff_);
+        df->set_memory(static_cast<size_t>(mem));
+        df->set_MO_core(false);
+        df->set_nthreads(omp_get_max_threads());
+        df->set_print_lvl(1);
+        df->initialize();
+        df->print_header();
+        df->add_space("ALL", Ca_AO());
+        df->add_transformation("B", "ALL", "ALL", "Qpq");
+
+        local_timer timer;
+        outfile->Printf("\n  Computing DF Integrals");
+        df->transform();
+        print_timing("computing density-fitted integrals", timer.get());
+    }
+
+    local_timer timer;
+    store_->write([&](size_t Q_begin, size_t Q_end, double* buffer) {
+        df->fill_tensor("B", buffer, {Q_begin, Q_end}, {0, nmo_}, {0, nmo_});
+    });
+    print_timing("distributing density-fitted integrals", timer.get());
+}
+
+void MPIDFIntegrals::resort_integrals_after_freezing() {
+    // the store keeps all the orbitals and store_indices maps the correlated ones
+}
+
+} // namespace forte
+
+#endif // HAVE_MPI
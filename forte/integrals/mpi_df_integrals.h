@@ -0,0 +1,116 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#pragma once
+
+#ifdef HAVE_MPI
+
+#include <memory>
+#include <mutex>
+
+#include "distributed_df_store.h"
+#include "psi4_integrals.h"
+
+namespace forte {
+
+/**
+ * @brief The MPIDFIntegrals class stores the density-fitted integrals distributed over the MPI
+ * processes
+ *
+ * Each process stores a slab of auxiliary functions and any block of integrals is read with
+ * MPI-3 one-sided communication (see DistributedDFStore), so this class does not require Global
+ * Arrays. The integrals are computed on the first process and distributed slab by slab. All the
+ * processes must construct and initialize this object, but blocks of integrals may be requested
+ * by any process independently.
+ *
+ * Like DISKDFIntegrals, the aptei_xy functions are slow. Try to use three_integral_block.
+ */
+class MPIDFIntegrals : public Psi4Integrals {
+  public:
+    /// Contructor of MPIDFIntegrals
+    MPIDFIntegrals(std::shared_ptr<ForteOptions> options, std::shared_ptr<SCFInfo> scf_info,
+                   std::shared_ptr<psi::Wavefunction> ref_wfn,
+                   std::shared_ptr<MOSpaceInfo> mo_space_info, IntegralSpinRestriction restricted);
+
+    // See base class for documentation
+    void initialize() override;
+    double aptei_aa(size_t p, size_t q, size_t r, size_t s) const override;
+    double aptei_ab(size_t p, size_t q, size_t r, size_t s) const override;
+    double aptei_bb(size_t p, size_t q, size_t r, size_t s) const override;
+
+    ambit::Tensor aptei_aa_block(const std::vector<size_t>& p, const std::vector<size_t>& q,
+                                 const std::vector<size_t>& r,
+                                 const std::vector<size_t>& s) override;
+    ambit::Tensor aptei_ab_block(const std::vector<size_t>& p, const std::vector<size_t>& q,
+                                 const std::vector<size_t>& r,
+                                 const std::vector<size_t>& s) override;
+    ambit::Tensor aptei_bb_block(const std::vector<size_t>& p, const std::vector<size_t>& q,
+                                 const std::vector<size_t>& r,
+                                 const std::vector<size_t>& s) override;
+
+    /// Read a block of the DF integrals and return an Ambit tensor of size A by p by q
+    ambit::Tensor three_integral_block(const std::vector<size_t>& A, const std::vector<size_t>& p,
+                                       const std::vector<size_t>& q,
+                                       ThreeIntsBlockOrder order = Qpq) override;
+    /// Return an Ambit tensor of size A by q
+    ambit::Tensor three_integral_block_two_index(const std::vector<size_t>& A, size_t p,
+                                                 const std::vector<size_t>& q) override;
+    double** three_integral_pointer() override;
+
+    size_t nthree() const override;
+
+  private:
+    // ==> Class data <==
+
+    /// The distributed integrals B(Q|pq) for all the orbitals (including the frozen ones)
+    std::unique_ptr<DistributedDFStore> store_;
+    size_t nthree_ = 0;
+    /// Serializes the one-sided reads (MPI is initialized with MPI_THREAD_SERIALIZED). If the
+    /// library provides a lower thread level, reads from other threads than the main one throw
+    mutable std::mutex store_mutex_;
+
+    // ==> Class private functions <==
+
+    /// Map the correlated orbital indices to the indices used by the store
+    std::vector<size_t> store_indices(const std::vector<size_t>& p) const;
+    /// Read the integrals B(Q|pq) for all Q and a single p and q
+    std::vector<double> read_pq(size_t p, size_t q) const;
+    /// Compute a block of the (antisymmetrized) two-electron integrals
+    ambit::Tensor aptei_block(const std::vector<size_t>& p, const std::vector<size_t>& q,
+                              const std::vector<size_t>& r, const std::vector<size_t>& s,
+                              bool antisymmetrize);
+
+    // ==> Class private virtual functions <==
+
+    void gather_integrals() override;
+    void resort_integrals_after_freezing() override;
+};
+
+} // namespace forte
+
+#endif // HAVE_MPI
@@ -89,7 +89,8 @@ double THREE_DSRG_MRPT2::E_VT2_2_batch_core_ga() {
     /// Step 1:  Figure out the largest chunk of B_{me}^{Q} and B_{nf}^{Q} can
     /// be stored in core.
     /// In Parallel, make sure to limit memory per core.
-    int num_proc = MPI::COMM_WORLD.Get_size();
+    int num_proc = 1;
+    MPI_Comm_size(MPI_COMM_WORLD, &num_proc);
     outfile->Printf("\n\n====Blocking information==========\n");
     /// Memory keyword is global (compute per node memory here)
     size_t int_mem_int = 0;
@@ -567,8 +568,10 @@ double THREE_DSRG_MRPT2::E_VT2_2_batch_core_rep() {
     double Ealpha = 0.0;
     double Emixed = 0.0;
     double Ebeta = 0.0;
-    int num_proc = MPI::COMM_WORLD.Get_size();
-    int my_proc = MPI::COMM_WORLD.Get_rank();
+    int num_proc = 1;
+    MPI_Comm_size(MPI_COMM_WORLD, &num_proc);
+    int my_proc = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &my_proc);
     if (my_proc == 0)
         nthree_ = ints_->nthree();
     MPI_Bcast(&nthree_, 1, MPI_INT, 0, MPI_COMM_WORLD);
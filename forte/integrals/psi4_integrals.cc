@@ -26,6 +26,7 @@
  * @END LICENSE
  */
 #include <algorithm>
+#include <cmath>
 
 #include "psi4/psi4-dec.h"
 #include "psi4/libpsi4util/PsiOutStream.h"
@@ -39,6 +40,7 @@
 #include "psi4/libmints/molecule.h"
 #include "psi4/libmints/wavefunction.h"
 #include "psi4/libpsi4util/process.h"
+#include "psi4/libqt/qt.h"
 
 #include "base_classes/mo_space_info.h"
 #include "base_classes/forte_options.h"
@@ -46,6 +48,7 @@
 #include "helpers/printing.h"
 #include "helpers/timer.h"
 
+#include "shared_integral_store.h"
 #include "psi4_integrals.h"
 
 #ifdef HAVE_GA
@@ -338,7 +341,6 @@ void Psi4Integrals::__update_orbitals(bool transform_ints) {
     // 3. Re-transform the integrals
     if (transform_ints) {
         ints_consistent_ = true;
-        aptei_idx_ = nmo_;
         transform_one_electron_integrals();
         int my_proc = 0;
 #ifdef HAVE_GA
@@ -346,12 +348,232 @@ void Psi4Integrals::__update_orbitals(bool transform_ints) {
 #endif
         if (my_proc == 0) {
             local_timer int_timer;
-            outfile->Printf("\n  Integrals are about to be updated.");
-            gather_integrals();
-            freeze_core_orbitals();
+            if (update_integrals_incrementally()) {
+                outfile->Printf("\n  Integrals were updated by rotating the MO integrals.");
+            } else {
+                outfile->Printf("\n  Integrals are about to be updated.");
+                aptei_idx_ = nmo_;
+                build_two_electron_integrals();
+            }
             outfile->Printf("\n  Integrals update took %9.3f s.", int_timer.get());
+        } else {
+            aptei_idx_ = nmo_;
+        }
+    }
+}
+
+bool Psi4Integrals::update_integrals_incrementally() {
+    // the shared integrals are read-only
+    if (not options_->get_bool("INCREMENTAL_INTEGRALS") or (Ca_ints_ == nullptr) or
+        (spin_restriction_ != IntegralSpinRestriction::Restricted) or (shared_ints_ != nullptr)) {
+        return false;
+    }
+
+    // The rotation between the orbitals used to build the integrals and the new ones
+    // C_new = C_old U  =>  U = C_old^T S C_new
+    auto U_sym = psi::linalg::triplet(Ca_ints_, S_, _Ca(), true, false, false);
+
+    // Store U as a dense matrix in Pitzer order and find the largest element of U - 1
+    std::vector<double> U(nmo_ * nmo_, 0.0);
+    double max_dev = 0.0;
+    for (int h = 0, offset = 0; h < nirrep_; ++h) {
+        for (int p = 0; p < nmopi_[h]; ++p) {
+            for (int q = 0; q < nmopi_[h]; ++q) {
+                double u = U_sym->get(h, p, q);
+                U[(p + offset) * nmo_ + q + offset] = u;
+                max_dev = std::max(max_dev, std::fabs(p == q ? u - 1.0 : u));
+            }
+        }
+        offset += nmopi_[h];
+    }
+
+    double threshold = options_->get_double("INCREMENTAL_INTEGRALS_THRESHOLD");
+    if (print_ > 0) {
+        outfile->Printf("\n  Largest element of U - 1: %.3e (threshold = %.3e)", max_dev,
+                        threshold);
+    }
+    if (max_dev > threshold) {
+        return false;
+    }
+
+    // The integrals are stored over the correlated orbitals
+    if (aptei_idx_ != ncmo_ or not rotate_two_electron_integrals(U)) {
+        return false;
+    }
+    if (ncmo_ < nmo_) {
+        compute_frozen_one_body_operator();
+    }
+    Ca_ints_ = _Ca()->clone();
+    return true;
+}
+
+bool Psi4Integrals::rotate_two_electron_integrals(const std::vector<double>&) { return false; }
+
+void Psi4Integrals::build_two_electron_integrals() {
+    release_shared_integrals();
+    if (attach_shared_integrals()) {
+        return;
+    }
+    gather_integrals();
+    freeze_core_orbitals();
+    publish_shared_integrals();
+}
+
+std::string Psi4Integrals::shared_integrals_key() const {
+    SharedIntegralKey key;
+    key.add(shared_integrals_label());
+
+    // the basis set and the geometry
+    auto basis = wfn_->basisset();
+    key.add(basis->name());
+    key.add(static_cast<size_t>(basis->nbf())).add(static_cast<size_t>(basis->nshell()));
+    key.add(static_cast<size_t>(basis->nprimitive()));
+    auto molecule = wfn_->molecule();
+    for (int A = 0; A < molecule->natom(); ++A) {
+        key.add(molecule->Z(A)).add(molecule->x(A)).add(molecule->y(A)).add(molecule->z(A));
+    }
+
+    // the orbitals and the correlated space
+    for (int h = 0; h < nirrep_; ++h) {
+        key.add(static_cast<size_t>(nmopi_[h])).add(static_cast<size_t>(ncmopi_[h]));
+    }
+    for (auto p : cmotomo_) {
+        key.add(p);
+    }
+    auto C = Ca();
+    for (int h = 0; h < nirrep_; ++h) {
+        for (int mu = 0; mu < C->rowspi(h); ++mu) {
+            for (int p = 0; p < C->colspi(h); ++p) {
+                key.add(C->get(h, mu, p));
+            }
+        }
+    }
+    return key.str();
+}
+
+bool Psi4Integrals::attach_shared_integrals() {
+    if (not options_->get_bool("SHARED_INTEGRALS") or shared_integrals_label().empty()) {
+        return false;
+    }
+    auto key = shared_integrals_key();
+    auto store = SharedIntegralStore::attach(key, wfn_->basisset()->nbf(), ncmo_,
+                                             shared_integrals_nthree());
+    if (store == nullptr) {
+        return false;
+    }
+
+    use_shared_integrals(store);
+
+    // the shared integrals are stored over the correlated orbitals
+    if (ncmo_ < nmo_) {
+        compute_frozen_one_body_operator();
+    }
+    aptei_idx_ = ncmo_;
+    Ca_ints_ = _Ca()->clone();
+    outfile->Printf("\n  Using the integrals shared in memory segment %s", key.c_str());
+    return true;
+}
+
+void Psi4Integrals::publish_shared_integrals() {
+    if (not options_->get_bool("SHARED_INTEGRALS") or shared_integrals_label().empty()) {
+        return;
+    }
+    auto key = shared_integrals_key();
+    // another process may have published the same integrals in the meantime
+    auto store = SharedIntegralStore::publish(key, three_integral_pointer()[0],
+                                              wfn_->basisset()->nbf(), aptei_idx_, nthree());
+    if (store == nullptr) {
+        return;
+    }
+
+    use_shared_integrals(store);
+    outfile->Printf("\n  Published the integrals in memory segment %s", key.c_str());
+}
+
+void Psi4Integrals::use_shared_integrals(std::shared_ptr<SharedIntegralStore> store) {
+    shared_ints_ = store;
+    shared_rows_.resize(store->nrow());
+    for (size_t pq = 0; pq < store->nrow(); ++pq) {
+        shared_rows_[pq] = const_cast<double*>(store->data()) + pq * store->ncol();
+    }
+    shared_integrals_changed();
+}
+
+void Psi4Integrals::release_shared_integrals() {
+    if (shared_ints_ != nullptr) {
+        shared_ints_.reset();
+        shared_rows_.clear();
+        shared_integrals_changed();
+    }
+}
+
+std::vector<double> Psi4Integrals::rotation_block(const std::vector<double>& U,
+                                                  const std::vector<size_t>& mos) const {
+    const size_t n = mos.size();
+    std::vector<bool> in_block(nmo_, false);
+    for (auto p : mos) {
+        in_block[p] = true;
+    }
+
+    // The columns of U for these orbitals may not have components outside the block
+    for (auto q : mos) {
+        double norm = 0.0;
+        for (size_t r = 0; r < nmo_; ++r) {
+            if (not in_block[r]) {
+                norm += U[r * nmo_ + q] * U[r * nmo_ + q];
+            }
+        }
+        if (norm > 1.0e-20) {
+            return {};
+        }
+    }
+
+    std::vector<double> block(n * n);
+    for (size_t p = 0; p < n; ++p) {
+        for (size_t q = 0; q < n; ++q) {
+            block[p * n + q] = U[mos[p] * nmo_ + mos[q]];
         }
     }
+    return block;
+}
+
+void Psi4Integrals::rotate_three_index(double* B, size_t n, size_t nthree,
+                                       const std::vector<double>& U) {
+    if (n * nthree == 0)
+        return;
+    // 1. Rotate the first index: B'(p,sQ) = sum_r U(r,p) B(r,sQ)
+    std::vector<double> tmp(n * n * nthree);
+    C_DGEMM('T', 'N', n, n * nthree, n, 1.0, const_cast<double*>(U.data()), n, B, n * nthree,
+            0.0, tmp.data(), n * nthree);
+    // 2. Rotate the second index: B(pq|Q) = sum_s U(s,q) B'(ps|Q)
+#pragma omp parallel for
+    for (size_t p = 0; p < n; ++p) {
+        C_DGEMM('T', 'N', n, nthree, n, 1.0, const_cast<double*>(U.data()), n,
+                tmp.data() + p * n * nthree, nthree, 0.0, B + p * n * nthree, nthree);
+    }
+}
+
+void Psi4Integrals::rotate_four_index(std::vector<double>& T, size_t n,
+                                      const std::vector<double>& U) {
+    if (n == 0)
+        return;
+    const size_t n3 = n * n * n;
+    if (T.size() < n3 * n) {
+        throw std::runtime_error("Psi4Integrals: the four-index tensor holds fewer than n^4 "
+                                 "elements");
+    }
+    // Each step rotates the first index and moves it last: T'(qrs,p) = sum_x T(x,qrs) U(x,p),
+    // so after four steps all indices are rotated and back in their original order.
+    // The steps alternate between the leading n^4 elements of T and a scratch buffer, so T
+    // keeps its size (it may be larger than n^4) and the result ends up back in T
+    std::vector<double> tmp(n3 * n);
+    double* src = T.data();
+    double* dst = tmp.data();
+    for (int step = 0; step < 4; ++step) {
+        C_DGEMM('T', 'N', n3, n, n, 1.0, src, n3, const_cast<double*>(U.data()), n, 0.0, dst,
+                n);
+        std::swap(src, dst);
+    }
 }
 
 void Psi4Integrals::freeze_core_orbitals() {
@@ -361,6 +583,8 @@ void Psi4Integrals::freeze_core_orbitals() {
         resort_integrals_after_freezing();
         aptei_idx_ = ncmo_;
     }
+    // Remember the orbitals used to build the integrals
+    Ca_ints_ = _Ca()->clone();
     if (print_) {
         print_timing("freezing core and virtual orbitals", freeze_timer.get());
     }
@@ -423,6 +647,59 @@ void Psi4Integrals::rotate_mos() {
     wfn_->epsilon_b()->copy(eps_a_new);
 }
 
+ambit::Tensor Psi4Integrals::three_index_aptei_block(double** B, const std::vector<size_t>& p,
+                                                     const std::vector<size_t>& q,
+                                                     const std::vector<size_t>& r,
+                                                     const std::vector<size_t>& s,
+                                                     bool antisymmetrize) const {
+    const size_t np = p.size(), nq = q.size(), nr = r.size(), ns = s.size();
+    const size_t naux = nthree();
+    auto out = ambit::Tensor::build(tensor_type_, "Return", {np, nq, nr, ns});
+    auto& data = out.data();
+    if (np * nq * nr * ns * naux == 0)
+        return out;
+
+    // For each pair (p, q) the output slice <pq|rs> is a contiguous nr x ns matrix that is
+    // written by one DGEMM, (pr|qs) = sum_Q B(pr|Q) B(qs|Q), and for the antisymmetrized
+    // integrals updated by a second one, -(ps|qr). The rows B(pr|Q), B(qs|Q), B(ps|Q), B(qr|Q)
+    // are copied into a per-thread slice of one scratch buffer that is reused for all pairs.
+    const bool same_rs = r == s;
+    const size_t nrows = antisymmetrize and not same_rs ? 2 * (nr + ns) : nr + ns;
+    const size_t chunk = nrows * naux;
+    std::vector<double> scratch(chunk * omp_get_max_threads());
+
+    auto gather = [&](size_t x, const std::vector<size_t>& y, double* dst) {
+        for (size_t i = 0, maxi = y.size(); i < maxi; ++i) {
+            std::copy_n(B[x * aptei_idx_ + y[i]], naux, dst + i * naux);
+        }
+    };
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t pq = 0; pq < np * nq; ++pq) {
+        const size_t ip = pq / nq, iq = pq % nq;
+        double* Bpr = scratch.data() + omp_get_thread_num() * chunk;
+        double* Bqs = Bpr + nr * naux;
+        gather(p[ip], r, Bpr);
+        gather(q[iq], s, Bqs);
+        double* dst = data.data() + pq * nr * ns;
+        C_DGEMM('N', 'T', nr, ns, naux, 1.0, Bpr, naux, Bqs, naux, 0.0, dst, ns);
+        if (not antisymmetrize)
+            continue;
+        // <pq|sr> = (ps|qr). When r and s are the same list, B(qr|Q) = B(qs|Q) and
+        // B(ps|Q) = B(pr|Q), so no more rows are needed
+        double* Bqr = Bqs;
+        double* Bps = Bpr;
+        if (not same_rs) {
+            Bqr = Bqs + ns * naux;
+            Bps = Bqr + nr * naux;
+            gather(q[iq], r, Bqr);
+            gather(p[ip], s, Bps);
+        }
+        C_DGEMM('N', 'T', nr, ns, naux, -1.0, Bqr, naux, Bps, naux, 1.0, dst, ns);
+    }
+    return out;
+}
+
 std::shared_ptr<psi::Matrix> Psi4Integrals::Ca_AO() const { return Ca_SO2AO(Ca()); }
 
 void Psi4Integrals::build_multipole_ints_ao() {
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "psi4/libfock/jk.h"
@@ -53,6 +54,7 @@ namespace forte {
 class ForteOptions;
 class MOSpaceInfo;
 class SCFInfo;
+class SharedIntegralStore;
 
 /**
  * @brief Interface to integrals read from psi4
@@ -105,6 +107,9 @@ class Psi4Integrals : public ForteIntegrals {
     void compute_frozen_one_body_operator() override;
     void __update_orbitals(bool transform_ints = true) override;
     void rotate_mos() override;
+    /// Try to update the two-electron integrals by rotating the cached MO integrals.
+    /// Returns false if the integrals must be retransformed from the AO basis.
+    bool update_integrals_incrementally();
 
     /// Build AO dipole and quadrupole integrals
     void build_multipole_ints_ao() override;
@@ -118,10 +123,71 @@ class Psi4Integrals : public ForteIntegrals {
     enum class FockAOStatus { none, inactive, generalized };
     FockAOStatus fock_ao_level_ = FockAOStatus::none;
 
+    /// The alpha orbitals used to build the cached two-electron integrals
+    std::shared_ptr<psi::Matrix> Ca_ints_;
+
   protected:
     void base_initialize_psi4();
     void freeze_core_orbitals() override;
 
+    /// Build a block of two-electron integrals from three-index integrals B(pq|Q), stored as a
+    /// matrix with rows pq = p * aptei_idx_ + q. For each pair (p, q) the Coulomb part
+    /// <pq|rs> = (pr|qs) and, if needed, the exchange part <pq|sr> are accumulated directly into
+    /// the output with one DGEMM each.
+    /// @param B the three-index integrals
+    /// @param antisymmetrize if true return <pq||rs> = <pq|rs> - <pq|sr>, otherwise <pq|rs>
+    ambit::Tensor three_index_aptei_block(double** B, const std::vector<size_t>& p,
+                                         const std::vector<size_t>& q,
+                                         const std::vector<size_t>& r,
+                                         const std::vector<size_t>& s, bool antisymmetrize) const;
+
+    /// Apply an orbital rotation to the cached two-electron integrals
+    /// @param U the rotation C_new = C_old U stored as a dense nmo x nmo matrix in Pitzer order
+    /// @return false if these integrals cannot be rotated (the default)
+    virtual bool rotate_two_electron_integrals(const std::vector<double>& U);
+
+    /// Extract the block of U for the orbitals in mos (n x n)
+    /// @return an empty vector if U mixes these orbitals with the other ones
+    std::vector<double> rotation_block(const std::vector<double>& U,
+                                       const std::vector<size_t>& mos) const;
+
+    /// Rotate the three-index integrals B(pq|Q) stored as an (n * n) x nthree row-major matrix:
+    /// B(pq|Q) <- sum_rs U(r,p) U(s,q) B(rs|Q)
+    static void rotate_three_index(double* B, size_t n, size_t nthree,
+                                   const std::vector<double>& U);
+
+    /// Rotate all four indices of a tensor T(pqrs) stored as an n^4 row-major array in the
+    /// leading elements of T. The size of T is not changed
+    static void rotate_four_index(std::vector<double>& T, size_t n, const std::vector<double>& U);
+
+    /// Build the two-electron integrals and freeze the core orbitals. If SHARED_INTEGRALS is set,
+    /// first try to attach to identical integrals published by another process on this node,
+    /// otherwise compute them and publish them.
+    void build_two_electron_integrals();
+
+    /// Label that identifies the type of shareable integrals (empty if they cannot be shared)
+    virtual std::string shared_integrals_label() const { return {}; }
+    /// Number of auxiliary functions of the shareable integrals (zero if not known in advance)
+    virtual size_t shared_integrals_nthree() const { return 0; }
+    /// Called when the object starts or stops using shared integrals
+    virtual void shared_integrals_changed() {}
+
+    /// The key of the shared-memory segment: basis, geometry, orbitals, spaces, and label
+    std::string shared_integrals_key() const;
+    /// Try to attach to the three-index integrals published by another process
+    bool attach_shared_integrals();
+    /// Publish the three-index integrals and use the shared copy from now on
+    void publish_shared_integrals();
+    /// Use the integrals stored in a shared-memory segment
+    void use_shared_integrals(std::shared_ptr<SharedIntegralStore> store);
+    /// Stop using the shared integrals
+    void release_shared_integrals();
+
+    /// The three-index integrals shared with other processes (nullptr if not shared)
+    std::shared_ptr<SharedIntegralStore> shared_ints_;
+    /// Pointers to the rows of the shared three-index integrals
+    std::vector<double*> shared_rows_;
+
     /// The Wavefunction object
     std::shared_ptr<psi::Wavefunction> wfn_;
 
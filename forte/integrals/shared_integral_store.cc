@@ -0,0 +1,256 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "shared_integral_store.h"
+
+namespace forte {
+
+namespace {
+/// The header stored at the beginning of a segment (padded to 64 bytes to align the data)
+struct SharedIntegralHeader {
+    char magic[8];
+    uint64_t nbf;
+    uint64_t ncmo;
+    uint64_t nthree;
+    uint64_t pid;
+    uint64_t ready;
+    uint64_t padding[2];
+};
+static_assert(sizeof(SharedIntegralHeader) == 64);
+
+constexpr char shared_integral_magic[8] = {'F', 'O', 'R', 'T', 'E', 'S', 'H', 'M'};
+
+size_t segment_size(size_t ncmo, size_t nthree) {
+    return sizeof(SharedIntegralHeader) + ncmo * ncmo * nthree * sizeof(double);
+}
+
+/// Is the process that published a segment gone? A pid of zero means that the header is not
+/// written yet, and EPERM means that the process exists but belongs to another user.
+bool publisher_died(const SharedIntegralHeader* header) {
+    auto pid = static_cast<pid_t>(
+        std::atomic_ref<uint64_t>(const_cast<uint64_t&>(header->pid)).load(
+            std::memory_order_acquire));
+    return pid > 0 and kill(pid, 0) != 0 and errno == ESRCH;
+}
+
+/// Remove the name key only if it still refers to the segment with inode ino, so that a segment
+/// published again by another process under the same name is not removed
+void unlink_if_same(const std::string& key, ino_t ino) {
+    int fd = shm_open(key.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return;
+    }
+    struct stat st;
+    bool same = fstat(fd, &st) == 0 and st.st_ino == ino;
+    close(fd);
+    if (same) {
+        shm_unlink(key.c_str());
+    }
+}
+
+/// Check an existing segment and remove it if its publisher died before removing it
+/// @return true if the segment was removed
+bool remove_if_stale(const std::string& key) {
+    int fd = shm_open(key.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    bool stale = false;
+    if (fstat(fd, &st) == 0 and static_cast<size_t>(st.st_size) >= sizeof(SharedIntegralHeader)) {
+        void* addr = mmap(nullptr, sizeof(SharedIntegralHeader), PROT_READ, MAP_SHARED, fd, 0);
+        if (addr != MAP_FAILED) {
+            stale = publisher_died(static_cast<const SharedIntegralHeader*>(addr));
+            munmap(addr, sizeof(SharedIntegralHeader));
+        }
+    }
+    close(fd);
+    if (stale) {
+        unlink_if_same(key, st.st_ino);
+    }
+    return stale;
+}
+} // namespace
+
+SharedIntegralStore::SharedIntegralStore(const std::string& key, void* addr, size_t size,
+                                         ino_t ino, bool owner)
+    : key_(key), addr_(addr), size_(size), ino_(ino), owner_(owner) {
+    auto header = static_cast<const SharedIntegralHeader*>(addr_);
+    nbf_ = header->nbf;
+    nrow_ = header->ncmo * header->ncmo;
+    ncol_ = header->nthree;
+    data_ = reinterpret_cast<const double*>(static_cast<const char*>(addr_) +
+                                            sizeof(SharedIntegralHeader));
+}
+
+SharedIntegralStore::~SharedIntegralStore() {
+    munmap(addr_, size_);
+    if (owner_) {
+        unlink_if_same(key_, ino_);
+    }
+}
+
+std::shared_ptr<SharedIntegralStore> SharedIntegralStore::attach(const std::string& key,
+                                                                 size_t nbf, size_t ncmo,
+                                                                 size_t nthree) {
+    int fd = shm_open(key.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 or static_cast<size_t>(st.st_size) < sizeof(SharedIntegralHeader)) {
+        close(fd);
+        return nullptr;
+    }
+    size_t size = st.st_size;
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        return nullptr;
+    }
+
+    auto header = static_cast<SharedIntegralHeader*>(addr);
+    // a segment left behind by a process that died is removed, complete or not, so that the
+    // integrals are published again by a process that will clean up after itself
+    if (publisher_died(header)) {
+        munmap(addr, size);
+        unlink_if_same(key, st.st_ino);
+        return nullptr;
+    }
+
+    // check that the segment is complete and that it holds the integrals that were asked for,
+    // not those of another set of integrals with the same hash
+    bool ready = std::atomic_ref<uint64_t>(header->ready).load(std::memory_order_acquire) == 1;
+    bool valid = std::memcmp(header->magic, shared_integral_magic, 8) == 0 and
+                 header->nbf == nbf and header->ncmo == ncmo and
+                 (nthree == 0 or header->nthree == nthree) and
+                 segment_size(header->ncmo, header->nthree) == size;
+    if (not(ready and valid)) {
+        munmap(addr, size);
+        return nullptr;
+    }
+    return std::shared_ptr<SharedIntegralStore>(
+        new SharedIntegralStore(key, addr, size, st.st_ino, false));
+}
+
+std::shared_ptr<SharedIntegralStore> SharedIntegralStore::publish(const std::string& key,
+                                                                  const double* data, size_t nbf,
+                                                                  size_t ncmo, size_t nthree) {
+    int fd = shm_open(key.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0 and errno == EEXIST and remove_if_stale(key)) {
+        fd = shm_open(key.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    }
+    if (fd < 0) {
+        return nullptr;
+    }
+    size_t size = segment_size(ncmo, nthree);
+    struct stat st;
+    if (fstat(fd, &st) != 0 or ftruncate(fd, size) != 0) {
+        close(fd);
+        shm_unlink(key.c_str());
+        throw std::runtime_error("SharedIntegralStore: cannot allocate " + std::to_string(size) +
+                                 " bytes for " + key);
+    }
+    void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        shm_unlink(key.c_str());
+        throw std::runtime_error("SharedIntegralStore: cannot map " + key);
+    }
+
+    // record the publisher first, so that the segment can be removed if this process dies
+    auto header = static_cast<SharedIntegralHeader*>(addr);
+    std::atomic_ref<uint64_t>(header->pid).store(getpid(), std::memory_order_release);
+    std::memcpy(header->magic, shared_integral_magic, 8);
+    header->nbf = nbf;
+    header->ncmo = ncmo;
+    header->nthree = nthree;
+    if (ncmo * ncmo * nthree > 0) {
+        std::memcpy(static_cast<char*>(addr) + sizeof(SharedIntegralHeader), data,
+                    ncmo * ncmo * nthree * sizeof(double));
+    }
+    // mark the segment as complete and make it read-only for this process too
+    std::atomic_ref<uint64_t>(header->ready).store(1, std::memory_order_release);
+    if (mprotect(addr, size, PROT_READ) != 0) {
+        std::string error = std::strerror(errno);
+        munmap(addr, size);
+        shm_unlink(key.c_str());
+        throw std::runtime_error("SharedIntegralStore: cannot make " + key + " read-only (" +
+                                 error + ")");
+    }
+    return std::shared_ptr<SharedIntegralStore>(
+        new SharedIntegralStore(key, addr, size, st.st_ino, true));
+}
+
+void SharedIntegralKey::add_bytes(const void* bytes, size_t n) {
+    auto p = static_cast<const unsigned char*>(bytes);
+    for (size_t i = 0; i < n; ++i) {
+        hash_ ^= p[i];
+        hash_ *= 1099511628211ULL;
+    }
+}
+
+SharedIntegralKey& SharedIntegralKey::add(const std::string& s) {
+    add(s.size());
+    add_bytes(s.data(), s.size());
+    return *this;
+}
+
+SharedIntegralKey& SharedIntegralKey::add(size_t n) {
+    uint64_t value = n;
+    add_bytes(&value, sizeof(value));
+    return *this;
+}
+
+SharedIntegralKey& SharedIntegralKey::add(double x, double tolerance) {
+    int64_t value = std::llround(x / tolerance);
+    add_bytes(&value, sizeof(value));
+    return *this;
+}
+
+std::string SharedIntegralKey::str() const {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "/forte_ints_%016llx",
+                  static_cast<unsigned long long>(hash_));
+    return buffer;
+}
+
+} // namespace forte
@@ -0,0 +1,143 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <sys/types.h>
+
+namespace forte {
+
+/**
+ * @brief The SharedIntegralStore class
+ * A read-only matrix of three-index integrals B(pq|Q), with ncmo * ncmo rows and nthree columns,
+ * stored in a POSIX shared-memory segment, so that several processes running on the same node
+ * can use a single copy.
+ *
+ * The segment starts with a header that records the number of basis functions, correlated
+ * orbitals, and auxiliary functions, the pid of the publishing process, and a flag that the
+ * publisher sets once all the data has been written. A process first tries to attach to the
+ * segment with a given key and, if none is found, computes the integrals and publishes them.
+ * The dimensions are checked on attaching, so that a segment with a colliding key is not used.
+ * The publisher removes the segment name when it is destroyed; processes that are already
+ * attached keep their mapping until they release it. A segment left behind by a publisher that
+ * died (complete or not) is removed by the next process that tries to attach or publish.
+ */
+class SharedIntegralStore {
+  public:
+    /// @brief Attach to a segment published by another process
+    /// @param key the segment name (see SharedIntegralKey)
+    /// @param nbf the number of basis functions
+    /// @param ncmo the number of correlated orbitals
+    /// @param nthree the number of auxiliary functions (zero if not known in advance)
+    /// @return the store, or nullptr if the segment does not exist, is not complete, was left
+    ///         behind by a process that died, or does not have the dimensions requested
+    static std::shared_ptr<SharedIntegralStore> attach(const std::string& key, size_t nbf,
+                                                       size_t ncmo, size_t nthree = 0);
+
+    /// @brief Create a segment and copy a matrix into it
+    /// @param key the segment name (see SharedIntegralKey)
+    /// @param data the (ncmo * ncmo) x nthree matrix stored in row-major order
+    /// @param nbf the number of basis functions
+    /// @param ncmo the number of correlated orbitals
+    /// @param nthree the number of auxiliary functions
+    /// @return the store, or nullptr if a segment with this name exists and its publisher is
+    ///         still running
+    static std::shared_ptr<SharedIntegralStore> publish(const std::string& key, const double* data,
+                                                        size_t nbf, size_t ncmo, size_t nthree);
+
+    /// Unmap the segment and, if this process published it, remove its name
+    ~SharedIntegralStore();
+
+    SharedIntegralStore(const SharedIntegralStore&) = delete;
+    SharedIntegralStore& operator=(const SharedIntegralStore&) = delete;
+
+    /// @return a pointer to the matrix
+    const double* data() const { return data_; }
+    /// @return the number of basis functions
+    size_t nbf() const { return nbf_; }
+    /// @return the number of rows
+    size_t nrow() const { return nrow_; }
+    /// @return the number of columns
+    size_t ncol() const { return ncol_; }
+    /// @return the name of the segment
+    const std::string& key() const { return key_; }
+    /// @return true if this process published the segment
+    bool owner() const { return owner_; }
+
+  private:
+    SharedIntegralStore(const std::string& key, void* addr, size_t size, ino_t ino, bool owner);
+
+    /// The name of the segment
+    std::string key_;
+    /// The address of the mapped segment
+    void* addr_;
+    /// The size of the mapped segment in bytes
+    size_t size_;
+    /// The inode of the segment, used to avoid removing a segment published again with this name
+    ino_t ino_;
+    /// Did this process publish the segment?
+    bool owner_;
+    /// The matrix
+    const double* data_;
+    /// The number of basis functions
+    size_t nbf_;
+    /// The number of rows
+    size_t nrow_;
+    /// The number of columns
+    size_t ncol_;
+};
+
+/**
+ * @brief The SharedIntegralKey class
+ * Builds the name of a shared-memory segment from a 64-bit FNV-1a hash of the quantities that
+ * determine a set of integrals (basis set, geometry, orbitals, ...).
+ */
+class SharedIntegralKey {
+  public:
+    /// Add a string
+    SharedIntegralKey& add(const std::string& s);
+    /// Add an integer
+    SharedIntegralKey& add(size_t n);
+    /// Add a floating point number rounded to a multiple of tolerance
+    SharedIntegralKey& add(double x, double tolerance = 1.0e-10);
+
+    /// @return the segment name, "/forte_ints_<hash>"
+    std::string str() const;
+
+  private:
+    /// Add raw bytes to the hash
+    void add_bytes(const void* bytes, size_t n);
+
+    uint64_t hash_ = 14695981039346656037ULL;
+};
+
+} // namespace forte
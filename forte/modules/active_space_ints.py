@@ -24,5 +24,10 @@ class ActiveSpaceInts(Module):
     def _run(self, data: ForteData) -> ForteData:
         import forte
 
-        data.as_ints = forte.make_active_space_ints(data.mo_space_info, data.ints, self.active, self.core)
+        kwargs = {}
+        if data.options is not None:
+            kwargs["packed_tei"] = data.options.get_bool("PACKED_ACTIVE_TEI")
+            kwargs["factorized_tei"] = data.options.get_bool("FACTORIZED_ACTIVE_TEI")
+            kwargs["factorization_threshold"] = data.options.get_double("FACTORIZED_ACTIVE_TEI_THRESHOLD")
+        data.as_ints = forte.make_active_space_ints(data.mo_space_info, data.ints, self.active, self.core, **kwargs)
         return data
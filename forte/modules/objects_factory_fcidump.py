@@ -5,6 +5,7 @@ import psi4
 import forte
 
 from forte._forte import make_mo_space_info_from_map
+from forte.proc.fcidump import _irrep_map_inverse
 
 from forte.data import ForteData
 from .module import Module
@@ -14,6 +15,18 @@ from .helpers import make_mo_spaces_from_options
 
 
 def _make_ints_from_fcidump(fcidump, data: ForteData):
+    if "eri_packed" in fcidump:
+        # the native reader returns the two-electron integrals in packed form
+        data.ints = forte.make_custom_ints_packed(
+            data.options,
+            data.scf_info,
+            data.mo_space_info,
+            fcidump["enuc"],
+            fcidump["hcore"].flatten(),
+            fcidump["eri_packed"],
+        )
+        return data
+
     # transform two-electron integrals from chemist to physicist notation
     eri = fcidump["eri"]
     nmo = fcidump["norb"]
@@ -76,10 +89,32 @@ def _make_state_info_from_fcidump(fcidump, options):
     return forte.StateInfo(na, nb, multiplicity, twice_ms, irrep)
 
 
+def _packed_pair(p, q):
+    return p * (p + 1) // 2 + q if p >= q else q * (q + 1) // 2 + p
+
+
+def _eri_element(fcidump, p, q, r, s):
+    """Return the integral (pq|rs) from either the full or the packed two-electron integrals"""
+    if "eri_packed" in fcidump:
+        return fcidump["eri_packed"][_packed_pair(_packed_pair(p, q), _packed_pair(r, s))]
+    return fcidump["eri"][p, q, r, s]
+
+
+def _read_fcidump(filename):
+    """Read a FCIDUMP file (text or binary) with the native reader and convert the orbital
+    symmetries to the ordering used in psi4"""
+    fcidump = forte.read_fcidump(filename)
+    if "pntgrp" in fcidump:
+        irrep_map_inverse = _irrep_map_inverse(fcidump["pntgrp"])
+        fcidump["orbsym"] = [int(irrep_map_inverse[x]) for x in fcidump["orbsym"]]
+        fcidump["isym"] = int(irrep_map_inverse[fcidump["isym"]])
+    return fcidump
+
+
 def _prepare_forte_objects_from_fcidump(data, filename: str = None):
     options = data.options
     psi4.core.print_out(f"\n  Reading integral information from FCIDUMP file {filename}")
-    fcidump = forte.proc.fcidump_from_file(filename, convert_to_psi4=True)
+    fcidump = _read_fcidump(filename)
 
     irrep_size = {"c1": 1, "ci": 2, "c2": 2, "cs": 2, "d2": 4, "c2v": 4, "c2h": 4, "d2h": 8}
 
@@ -126,23 +161,22 @@ def _prepare_forte_objects_from_fcidump(data, filename: str = None):
         epsilon_a = psi4.core.Vector(nmo)
         epsilon_b = psi4.core.Vector(nmo)
         hcore = fcidump["hcore"]
-        eri = fcidump["eri"]
         nmo = fcidump["norb"]
         for i in range(nmo):
             val = hcore[i, i]
             for h in range(nirrep):
                 for j in range(nmopi_offset[h], nmopi_offset[h] + doccpi[h] + soccpi[h]):
-                    val += eri[i, i, j, j] - eri[i, j, i, j]
+                    val += _eri_element(fcidump, i, i, j, j) - _eri_element(fcidump, i, j, i, j)
                 for j in range(nmopi_offset[h], nmopi_offset[h] + doccpi[h]):
-                    val += eri[i, i, j, j]
+                    val += _eri_element(fcidump, i, i, j, j)
             epsilon_a.set(i, val)
 
             val = hcore[i, i]
             for h in range(nirrep):
                 for j in range(nmopi_offset[h], nmopi_offset[h] + doccpi[h] + soccpi[h]):
-                    val += eri[i, i, j, j]
+                    val += _eri_element(fcidump, i, i, j, j)
                 for j in range(nmopi_offset[h], nmopi_offset[h] + doccpi[h]):
-                    val += eri[i, i, j, j] - eri[i, j, i, j]
+                    val += _eri_element(fcidump, i, i, j, j) - _eri_element(fcidump, i, j, i, j)
             epsilon_b.set(i, val)
 
     Ca = psi4.core.Matrix("Ca", nmopi, nmopi)
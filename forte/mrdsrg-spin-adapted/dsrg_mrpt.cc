@@ -175,6 +175,7 @@ void DSRG_MRPT::startup() {
     if (foptions_->get_str("THREEPDC") != "ZERO") {
         L3_ = ambit::BlockedTensor::build(tensor_type_, "T3PDC", {"aaaaaa"});
     }
+    rdms_->set_cache_cumulants(foptions_->get_bool("DSRG_CACHE_CUMULANTS"));
     build_density();
 
     // prepare integrals
@@ -114,7 +114,8 @@ void SADSRG::startup() {
     // set memory variables
     check_init_memory();
 
-    // prepare density matrix and cumulants
+    // prepare density matrix and cumulants (cached, since some blocks are requested many times)
+    rdms_->set_cache_cumulants(foptions_->get_bool("DSRG_CACHE_CUMULANTS"));
     init_density();
 
     // initialize Fock matrix
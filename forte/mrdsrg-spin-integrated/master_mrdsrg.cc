@@ -65,7 +65,8 @@ void MASTER_DSRG::startup() {
     // initialize timer for commutator
     dsrg_time_ = DSRG_TIME();
 
-    // prepare density matrix and cumulants
+    // prepare density matrix and cumulants (cached, since some blocks are requested many times)
+    rdms_->set_cache_cumulants(foptions_->get_bool("DSRG_CACHE_CUMULANTS"));
     init_density();
 
     // initialize Fock matrix
@@ -92,8 +92,8 @@ THREE_DSRG_MRPT2::THREE_DSRG_MRPT2(std::shared_ptr<RDMs> rdms, std::shared_ptr<S
     int nproc = 1;
     int my_proc = 0;
 #ifdef HAVE_MPI
-    nproc = MPI::COMM_WORLD.Get_size();
-    my_proc = MPI::COMM_WORLD.Get_rank();
+    MPI_Comm_size(MPI_COMM_WORLD, &nproc);
+    MPI_Comm_rank(MPI_COMM_WORLD, &my_proc);
 #endif
 
     std::string title_thread = std::to_string(num_threads_) + " thread";
@@ -133,8 +133,7 @@ void THREE_DSRG_MRPT2::startup() {
     //    int nproc = 1;
     int my_proc = 0;
 #ifdef HAVE_MPI
-    nproc = MPI::COMM_WORLD.Get_size();
-    my_proc = MPI::COMM_WORLD.Get_rank();
+    MPI_Comm_rank(MPI_COMM_WORLD, &my_proc);
 #endif
 
     integral_type_ = ints_->integral_type();
@@ -1156,7 +1155,7 @@ double THREE_DSRG_MRPT2::E_VT2_2() {
     double E = 0.0;
     int my_proc = 0;
 #ifdef HAVE_MPI
-    my_proc = MPI::COMM_WORLD.Get_rank();
+    MPI_Comm_rank(MPI_COMM_WORLD, &my_proc);
 #endif
     ambit::BlockedTensor temp = BTF_->build(tensor_type_, "temp", {"aa", "AA"});
     local_timer timer;
@@ -2026,9 +2025,11 @@ double THREE_DSRG_MRPT2::E_VT2_2_batch_core() {
 #endif
 
     // Step 1:  Figure out the largest chunk of B_{me}^{Q} and B_{nf}^{Q} can be
-    // stored in core.
+    // stored in core. The blocks prefetched by read_block are held in memory together with
+    // the blocks being contracted, so each one counts as one more block.
     outfile->Printf("\n\n====Blocking information==========\n");
-    size_t int_mem_int = (nthree_ * ncore_ * nvirtual_) * sizeof(double);
+    size_t int_mem_int = (nthree_ * ncore_ * nvirtual_) * sizeof(double) *
+                         (1 + ints_->max_prefetched_blocks());
     size_t memory_input = psi::Process::environment.get_memory() * 0.75;
     size_t num_block = int_mem_int / memory_input < 1 ? 1 : int_mem_int / memory_input;
 
@@ -2074,31 +2075,38 @@ double THREE_DSRG_MRPT2::E_VT2_2_batch_core() {
         RDVec.push_back(ambit::Tensor::build(tensor_type_, "RDVec", {nvirtual_, nvirtual_}));
     }
 
+    // The core indices of each block (the last block also holds the remainder)
+    auto make_batch = [&](size_t block) {
+        size_t begin = block * block_size;
+        size_t end = block == num_block - 1 ? ncore_ : begin + block_size;
+        return std::vector<size_t>(core_mos_.begin() + begin, core_mos_.begin() + end);
+    };
+
+    // The blocks are read in the order m0, (m1, n0), (m2, n0, n1), ... and the block that
+    // follows the one being read is prefetched, so that reading it overlaps with the contractions
+    std::vector<size_t> read_order;
+    for (size_t m_blocks = 0; m_blocks < num_block; m_blocks++) {
+        read_order.push_back(m_blocks);
+        for (size_t n_blocks = 0; n_blocks < m_blocks; n_blocks++) {
+            read_order.push_back(n_blocks);
+        }
+    }
+    size_t nread = 0;
+    auto read_block = [&](size_t block) {
+        ambit::Tensor B = ints_->three_integral_block(aux_mos_, make_batch(block), virt_mos_);
+        if (++nread < read_order.size()) {
+            ints_->prefetch_three_integral_block(aux_mos_, make_batch(read_order[nread]),
+                                                 virt_mos_);
+        }
+        return B;
+    };
+
     // Step 2:  Loop over memory allowed blocks of m and n
     // Get batch sizes and create vectors of mblock length
     for (size_t m_blocks = 0; m_blocks < num_block; m_blocks++) {
-        std::vector<size_t> m_batch;
-        // If core_ goes into num_block equally, all blocks are equal
-        if (ncore_ % num_block == 0) {
-            // Fill the mbatch from block_begin to block_end
-            // This is done so I can pass a block to IntegralsAPI to read a
-            // chunk
-            m_batch.resize(block_size);
-            // copy used to get correct indices for B.
-            std::copy(core_mos_.begin() + (m_blocks * block_size),
-                      core_mos_.begin() + ((m_blocks + 1) * block_size), m_batch.begin());
-        } else {
-            // If last_block is shorter or long, fill the rest
-            size_t gimp_block_size =
-                m_blocks == (num_block - 1) ? block_size + ncore_ % num_block : block_size;
-            m_batch.resize(gimp_block_size);
-            // std::iota(m_batch.begin(), m_batch.end(), m_blocks * (core_ /
-            // num_block));
-            std::copy(core_mos_.begin() + (m_blocks)*block_size,
-                      core_mos_.begin() + (m_blocks)*block_size + gimp_block_size, m_batch.begin());
-        }
+        std::vector<size_t> m_batch = make_batch(m_blocks);
 
-        ambit::Tensor B = ints_->three_integral_block(aux_mos_, m_batch, virt_mos_);
+        ambit::Tensor B = read_block(m_blocks);
         ambit::Tensor BmQe =
             ambit::Tensor::build(tensor_type_, "BmQE", {m_batch.size(), nthree_, nvirtual_});
         BmQe("mQe") = B("Qme");
@@ -2119,29 +2127,13 @@ double THREE_DSRG_MRPT2::E_VT2_2_batch_core() {
         }
 
         for (size_t n_blocks = 0; n_blocks <= m_blocks; n_blocks++) {
-            std::vector<size_t> n_batch;
-            // If core_ goes into num_block equally, all blocks are equal
-            if (ncore_ % num_block == 0) {
-                // Fill the mbatch from block_begin to block_end
-                // This is done so I can pass a block to IntegralsAPI to read a chunk
-                n_batch.resize(block_size);
-                std::copy(core_mos_.begin() + n_blocks * block_size,
-                          core_mos_.begin() + ((n_blocks + 1) * block_size), n_batch.begin());
-            } else {
-                // If last_block is longer, block_size + remainder
-                size_t gimp_block_size =
-                    n_blocks == (num_block - 1) ? block_size + ncore_ % num_block : block_size;
-                n_batch.resize(gimp_block_size);
-                std::copy(core_mos_.begin() + (n_blocks)*block_size,
-                          core_mos_.begin() + (n_blocks * block_size) + gimp_block_size,
-                          n_batch.begin());
-            }
+            std::vector<size_t> n_batch = make_batch(n_blocks);
             ambit::Tensor BnQf =
                 ambit::Tensor::build(tensor_type_, "BnQf", {n_batch.size(), nthree_, nvirtual_});
             if (n_blocks == m_blocks) {
                 BnQf.copy(BmQe);
             } else {
-                ambit::Tensor B = ints_->three_integral_block(aux_mos_, n_batch, virt_mos_);
+                ambit::Tensor B = read_block(n_blocks);
                 BnQf("mQe") = B("Qme");
                 B.reset();
             }
@@ -2379,9 +2371,11 @@ double THREE_DSRG_MRPT2::E_VT2_2_batch_virtual() {
 #endif
 
     // Step 1:  Figure out the largest chunk of B_{me}^{Q} and B_{nf}^{Q} can be
-    // stored in core.
+    // stored in core. The blocks prefetched by read_block are held in memory together with
+    // the blocks being contracted, so each one counts as one more block.
     outfile->Printf("\n\n====Blocking information==========\n");
-    size_t int_mem_int = (nthree_ * ncore_ * nvirtual_) * sizeof(double);
+    size_t int_mem_int = (nthree_ * ncore_ * nvirtual_) * sizeof(double) *
+                         (1 + ints_->max_prefetched_blocks());
     size_t memory_input = psi::Process::environment.get_memory() * 0.75;
     size_t num_block = int_mem_int / memory_input < 1 ? 1 : int_mem_int / memory_input;
 
@@ -2427,31 +2421,38 @@ double THREE_DSRG_MRPT2::E_VT2_2_batch_virtual() {
         RDVec.push_back(ambit::Tensor::build(tensor_type_, "RDVec", {ncore_, ncore_}));
     }
 
-    // Step 2:  Loop over memory allowed blocks of m and n
-    // Get batch sizes and create vectors of mblock length
+    // The virtual indices of each block (the last block also holds the remainder)
+    auto make_batch = [&](size_t block) {
+        size_t begin = block * block_size;
+        size_t end = block == num_block - 1 ? nvirtual_ : begin + block_size;
+        return std::vector<size_t>(virt_mos_.begin() + begin, virt_mos_.begin() + end);
+    };
+
+    // The blocks are read in the order e0, (e1, f0), (e2, f0, f1), ... and the block that
+    // follows the one being read is prefetched, so that reading it overlaps with the contractions
+    std::vector<size_t> read_order;
     for (size_t e_blocks = 0; e_blocks < num_block; e_blocks++) {
-        std::vector<size_t> e_batch;
-        // If core_ goes into num_block equally, all blocks are equal
-        if (nvirtual_ % num_block == 0) {
-            // Fill the mbatch from block_begin to block_end
-            // This is done so I can pass a block to IntegralsAPI to read a
-            // chunk
-            e_batch.resize(block_size);
-            // copy used to get correct indices for B.
-            std::copy(virt_mos_.begin() + (e_blocks * block_size),
-                      virt_mos_.begin() + ((e_blocks + 1) * block_size), e_batch.begin());
-        } else {
-            // If last_block is shorter or long, fill the rest
-            size_t gimp_block_size =
-                e_blocks == (num_block - 1) ? block_size + nvirtual_ % num_block : block_size;
-            e_batch.resize(gimp_block_size);
-            // std::iota(m_batch.begin(), m_batch.end(), m_blocks * (core_ /
-            // num_block));
-            std::copy(virt_mos_.begin() + (e_blocks)*block_size,
-                      virt_mos_.begin() + (e_blocks)*block_size + gimp_block_size, e_batch.begin());
+        read_order.push_back(e_blocks);
+        for (size_t f_blocks = 0; f_blocks < e_blocks; f_blocks++) {
+            read_order.push_back(f_blocks);
         }
+    }
+    size_t nread = 0;
+    auto read_block = [&](size_t block) {
+        ambit::Tensor B = ints_->three_integral_block(aux_mos_, make_batch(block), core_mos_);
+        if (++nread < read_order.size()) {
+            ints_->prefetch_three_integral_block(aux_mos_, make_batch(read_order[nread]),
+                                                 core_mos_);
+        }
+        return B;
+    };
+
+    // Step 2:  Loop over memory allowed blocks of e and f
+    // Get batch sizes and create vectors of eblock length
+    for (size_t e_blocks = 0; e_blocks < num_block; e_blocks++) {
+        std::vector<size_t> e_batch = make_batch(e_blocks);
 
-        ambit::Tensor B = ints_->three_integral_block(aux_mos_, e_batch, core_mos_);
+        ambit::Tensor B = read_block(e_blocks);
         ambit::Tensor BeQm =
             ambit::Tensor::build(tensor_type_, "BmQE", {e_batch.size(), nthree_, ncore_});
         BeQm("eQm") = B("Qem");
@@ -2472,30 +2473,13 @@ double THREE_DSRG_MRPT2::E_VT2_2_batch_virtual() {
         }
 
         for (size_t f_blocks = 0; f_blocks <= e_blocks; f_blocks++) {
-            std::vector<size_t> f_batch;
-            // If core_ goes into num_block equally, all blocks are equal
-            if (nvirtual_ % num_block == 0) {
-                // Fill the mbatch from block_begin to block_end
-                // This is done so I can pass a block to IntegralsAPI to read a
-                // chunk
-                f_batch.resize(block_size);
-                std::copy(virt_mos_.begin() + f_blocks * block_size,
-                          virt_mos_.begin() + ((f_blocks + 1) * block_size), f_batch.begin());
-            } else {
-                // If last_block is longer, block_size + remainder
-                size_t gimp_block_size =
-                    f_blocks == (num_block - 1) ? block_size + nvirtual_ % num_block : block_size;
-                f_batch.resize(gimp_block_size);
-                std::copy(virt_mos_.begin() + (f_blocks)*block_size,
-                          virt_mos_.begin() + (f_blocks * block_size) + gimp_block_size,
-                          f_batch.begin());
-            }
+            std::vector<size_t> f_batch = make_batch(f_blocks);
             ambit::Tensor BfQn =
                 ambit::Tensor::build(tensor_type_, "BnQf", {f_batch.size(), nthree_, ncore_});
             if (f_blocks == e_blocks) {
                 BfQn.copy(BeQm);
             } else {
-                ambit::Tensor B = ints_->three_integral_block(aux_mos_, f_batch, core_mos_);
+                ambit::Tensor B = read_block(f_blocks);
                 BfQn("eQm") = B("Qem");
                 B.reset();
             }
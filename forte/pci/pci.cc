@@ -45,6 +45,7 @@
 #include "sparse_ci/determinant_functions.hpp"
 #include "pci.h"
 #include "pci_sigma.h"
+#include "pci_spectral_bounds.h"
 
 #define USE_HASH 1
 #define DO_STATS 0
@@ -300,6 +301,14 @@ void ProjectorCI::set_options(std::shared_ptr<ForteOptions> options) {
     stop_higher_new_low_ = options->get_bool("PCI_STOP_HIGHER_NEW_LOW");
     chebyshev_order_ = options->get_int("PCI_CHEBYSHEV_ORDER");
     krylov_order_ = options->get_int("PCI_KRYLOV_ORDER");
+    adaptive_bounds_ = options->get_bool("PCI_ADAPTIVE_BOUNDS");
+    adaptive_bounds_order_ = options->get_int("PCI_ADAPTIVE_BOUNDS_ORDER");
+    if (adaptive_bounds_ && adaptive_bounds_order_ < 2) {
+        psi::outfile->Printf("\n\n  Warning! Adaptive bounds order %d out of bound, "
+                             "automatically adjusted to 2.",
+                             adaptive_bounds_order_);
+        adaptive_bounds_order_ = 2;
+    }
 
     variational_estimate_ = options->get_bool("PCI_VAR_ESTIMATE");
     print_full_wavefunction_ = options->get_bool("PCI_PRINT_FULL_WAVEFUNCTION");
@@ -420,6 +429,7 @@ void ProjectorCI::print_info() {
         {"Generator type", generator_description_},
         {"Importance functional", functional_description_},
         {"Shift the energy", do_shift_ ? "YES" : "NO"},
+        {"Adaptive spectral bounds", adaptive_bounds_ ? "YES" : "NO"},
         {"Use intermediate normalization", use_inter_norm_ ? "YES" : "NO"},
         {"Fast variational estimate", fast_variational_estimate_ ? "YES" : "NO"},
         {"Result perturbation analysis", do_perturb_analysis_ ? "YES" : "NO"},
@@ -593,6 +603,7 @@ double ProjectorCI::estimate_high_energy() {
         }
     }
     lambda_h_ = lambda_h_G;
+    lambda_h_gershgorin_ = lambda_h_G;
     psi::outfile->Printf("\n\n  ==> Estimate highest excitation energy <==");
     psi::outfile->Printf("\n  Highest Excited determinant:");
     psi::outfile->Printf("\n  %s", str(high_det).c_str());
@@ -619,6 +630,24 @@ void ProjectorCI::compute_characteristic_function() {
     }
 }
 
+void ProjectorCI::refine_spectral_bounds(PCISigmaVector& sigma_vector) {
+    // Bound the top of the spectrum with a Lanczos run from a random vector. Unlike the Ritz
+    // values of a run started from the wave function, this bound holds (with probability at least
+    // 1 - 2e-6) even if the highest state has no overlap with the wave function. lambda_1_ is
+    // left unchanged since it is set by the energy shift.
+    auto apply_H = [&](std::vector<double>& b, std::vector<double>& sigma) {
+        sigma_vector.apply_hamiltonian(b, sigma);
+    };
+    const size_t num_builds = sigma_vector.get_sigma_build_count();
+    auto bounds = lanczos_spectral_bounds(sigma_vector.size(), adaptive_bounds_order_,
+                                          lambda_h_gershgorin_, apply_H,
+                                          static_cast<unsigned int>(num_bounds_refinements_));
+    lambda_h_ = bounds.upper;
+    num_bounds_refinements_ += 1;
+    bounds_space_size_ = sigma_vector.size();
+    num_bounds_sigma_builds_ += sigma_vector.get_sigma_build_count() - num_builds;
+}
+
 void ProjectorCI::print_characteristic_function() {
     psi::outfile->Printf("\n\n  ==> Characteristic Function <==");
     print_polynomial(cha_func_coefs_);
@@ -633,6 +662,10 @@ void ProjectorCI::pre_iter_preparation() {
     t_pci_.reset();
 
     lastLow = 0.0;
+    num_bounds_refinements_ = 0;
+    bounds_space_size_ = 0;
+    num_sigma_builds_ = 0;
+    num_bounds_sigma_builds_ = 0;
     previous_go_up = false;
 
     if (!std::numeric_limits<double>::has_quiet_NaN) {
@@ -812,6 +845,12 @@ void ProjectorCI::post_iter_process() {
                              "characteristic function may change every step.\n  "
                              "Characteristic function at last step:");
         print_characteristic_function();
+    } else if (adaptive_bounds_ && generator_ == WallChebyshevGenerator) {
+        psi::outfile->Printf("\n\n  Spectral bounds refined %d times from Lanczos estimates "
+                             "(%zu of %zu sigma builds).\n  "
+                             "Characteristic function at last step:",
+                             num_bounds_refinements_, num_bounds_sigma_builds_, num_sigma_builds_);
+        print_characteristic_function();
     }
 
     psi::outfile->Printf("\n\n  ==> Post-Iterations <==\n");
@@ -1049,6 +1088,16 @@ void ProjectorCI::propagate_wallCh(det_hashvec& dets_hashvec, std::vector<double
     auto C_psi = std::make_shared<psi::Vector>(sigma_vector.size()),
          sigma_psi = std::make_shared<psi::Vector>(sigma_vector.size());
     set_psi_Vector(C_psi, ref_C);
+    // A refinement costs PCI_ADAPTIVE_BOUNDS_ORDER sigma builds, so the bounds are refined once
+    // and then only when the determinant space has more than doubled, since the spectrum of the
+    // generator can only extend as new determinants are added
+    if (adaptive_bounds_ && approx_E_flag_ &&
+        (num_bounds_refinements_ == 0 or sigma_vector.size() > 2 * bounds_space_size_)) {
+        psi::timer_on("PCI:Bounds");
+        refine_spectral_bounds(sigma_vector);
+        compute_characteristic_function();
+        psi::timer_off("PCI:Bounds");
+    }
     sigma_vector.compute_sigma(sigma_psi, C_psi);
     sigma_psi->scale(-1.0);
     C = to_std_vector(sigma_psi);
@@ -1112,6 +1161,7 @@ void ProjectorCI::propagate_wallCh(det_hashvec& dets_hashvec, std::vector<double
         //        dets_C_hash.clear();
         normalize(C);
     }
+    num_sigma_builds_ += sigma_vector.get_sigma_build_count();
     //    dets = dets_hashvec.toVector();
 }
 
@@ -1268,6 +1318,14 @@ double ProjectorCI::estimate_var_energy_sparse(const det_hashvec& dets_hashvec,
         "\n  Variational energy estimated with %zu determinants to meet the max error %e",
         cut_index + 1, max_error);
 
+    // compute_couplings_half() overwrites the screened coupling tables used for spawning. Save
+    // them so that they can be reused in the following iterations
+    auto a_couplings = std::move(a_couplings_);
+    auto b_couplings = std::move(b_couplings_);
+    auto aa_couplings = std::move(aa_couplings_);
+    auto ab_couplings = std::move(ab_couplings_);
+    auto bb_couplings = std::move(bb_couplings_);
+
     psi::timer_on("PCI:Couplings");
     compute_couplings_half(dets_hashvec, cut_index + 1);
     psi::timer_off("PCI:Couplings");
@@ -1288,6 +1346,18 @@ double ProjectorCI::estimate_var_energy_sparse(const det_hashvec& dets_hashvec,
         variational_energy_estimator += energy[t];
     }
     variational_energy_estimator /= 1.0 - cume_ignore;
+
+    // restore the coupling tables used for spawning
+    a_couplings_ = std::move(a_couplings);
+    b_couplings_ = std::move(b_couplings);
+    aa_couplings_ = std::move(aa_couplings);
+    ab_couplings_ = std::move(ab_couplings);
+    bb_couplings_ = std::move(bb_couplings);
+    a_couplings_size_ = a_couplings_.size();
+    b_couplings_size_ = b_couplings_.size();
+    aa_couplings_size_ = aa_couplings_.size();
+    ab_couplings_size_ = ab_couplings_.size();
+    bb_couplings_size_ = bb_couplings_.size();
     return variational_energy_estimator + nuclear_repulsion_energy_ + as_ints_->scalar_energy();
 }
 
@@ -1684,15 +1754,6 @@ void ProjectorCI::compute_single_couplings(double single_coupling_threshold) {
 }
 
 void ProjectorCI::compute_double_couplings(double double_coupling_threshold) {
-    struct {
-        bool operator()(std::tuple<int, int, double> first,
-                        std::tuple<int, int, double> second) const {
-            double H1 = std::get<2>(first);
-            double H2 = std::get<2>(second);
-            return std::fabs(H1) > std::fabs(H2);
-        }
-    } CouplingCompare;
-
     struct {
         bool operator()(
             std::tuple<int, int, double, std::vector<std::tuple<int, int, double>>> first,
@@ -1708,26 +1769,14 @@ void ProjectorCI::compute_double_couplings(double double_coupling_threshold) {
     aa_couplings_.clear();
     for (size_t i = 0; i < nact_; ++i) {
         for (size_t j = i + 1; j < nact_; ++j) {
+            // the excitations are sorted by decreasing magnitude
             std::vector<std::tuple<int, int, double>> ij_couplings;
-            for (size_t a = 0; a < nact_; ++a) {
-                if (a == i or a == j)
-                    continue;
-                for (size_t b = a + 1; b < nact_; ++b) {
-                    if (b == i or b == j)
-                        continue;
-                    if ((mo_symmetry_[i] ^ mo_symmetry_[j] ^ mo_symmetry_[a] ^ mo_symmetry_[b]) ==
-                        0) {
-                        double Hijab = as_ints_->tei_aa(i, j, a, b);
-                        if (std::fabs(Hijab) >= double_coupling_threshold) {
-                            ij_couplings.push_back(std::make_tuple(a, b, Hijab));
-                        }
-                    }
-                }
+            for (const auto& [a, b, Hijab] :
+                 as_ints_->double_excitations_aa(i, j, double_coupling_threshold)) {
+                ij_couplings.emplace_back(a, b, Hijab);
             }
-            double max_ij_coupling = 0;
             if (ij_couplings.size() != 0) {
-                std::sort(ij_couplings.begin(), ij_couplings.end(), CouplingCompare);
-                max_ij_coupling = std::get<2>(ij_couplings[0]);
+                double max_ij_coupling = std::get<2>(ij_couplings[0]);
                 aa_couplings_.push_back(
                     std::make_tuple(i, j, std::fabs(max_ij_coupling), ij_couplings));
             }
@@ -1743,26 +1792,14 @@ void ProjectorCI::compute_double_couplings(double double_coupling_threshold) {
     ab_couplings_.clear();
     for (size_t i = 0; i < nact_; ++i) {
         for (size_t j = 0; j < nact_; ++j) {
+            // the excitations are sorted by decreasing magnitude
             std::vector<std::tuple<int, int, double>> ij_couplings;
-            for (size_t a = 0; a < nact_; ++a) {
-                if (a == i)
-                    continue;
-                for (size_t b = 0; b < nact_; ++b) {
-                    if (b == j)
-                        continue;
-                    if ((mo_symmetry_[i] ^ mo_symmetry_[j] ^ mo_symmetry_[a] ^ mo_symmetry_[b]) ==
-                        0) {
-                        double Hijab = as_ints_->tei_ab(i, j, a, b);
-                        if (std::fabs(Hijab) >= double_coupling_threshold) {
-                            ij_couplings.push_back(std::make_tuple(a, b, Hijab));
-                        }
-                    }
-                }
+            for (const auto& [a, b, Hijab] :
+                 as_ints_->double_excitations_ab(i, j, double_coupling_threshold)) {
+                ij_couplings.emplace_back(a, b, Hijab);
             }
-            double max_ij_coupling = 0;
             if (ij_couplings.size() != 0) {
-                std::sort(ij_couplings.begin(), ij_couplings.end(), CouplingCompare);
-                max_ij_coupling = std::get<2>(ij_couplings[0]);
+                double max_ij_coupling = std::get<2>(ij_couplings[0]);
                 ab_couplings_.push_back(
                     std::make_tuple(i, j, std::fabs(max_ij_coupling), ij_couplings));
             }
@@ -1780,26 +1817,14 @@ void ProjectorCI::compute_double_couplings(double double_coupling_threshold) {
     bb_couplings_.clear();
     for (size_t i = 0; i < nact_; ++i) {
         for (size_t j = i + 1; j < nact_; ++j) {
+            // the excitations are sorted by decreasing magnitude
             std::vector<std::tuple<int, int, double>> ij_couplings;
-            for (size_t a = 0; a < nact_; ++a) {
-                if (a == i or a == j)
-                    continue;
-                for (size_t b = a + 1; b < nact_; ++b) {
-                    if (b == i or b == j)
-                        continue;
-                    if ((mo_symmetry_[i] ^ mo_symmetry_[j] ^ mo_symmetry_[a] ^ mo_symmetry_[b]) ==
-                        0) {
-                        double Hijab = as_ints_->tei_bb(i, j, a, b);
-                        if (std::fabs(Hijab) >= double_coupling_threshold) {
-                            ij_couplings.push_back(std::make_tuple(a, b, Hijab));
-                        }
-                    }
-                }
+            for (const auto& [a, b, Hijab] :
+                 as_ints_->double_excitations_bb(i, j, double_coupling_threshold)) {
+                ij_couplings.emplace_back(a, b, Hijab);
             }
-            double max_ij_coupling = 0;
             if (ij_couplings.size() != 0) {
-                std::sort(ij_couplings.begin(), ij_couplings.end(), CouplingCompare);
-                max_ij_coupling = std::get<2>(ij_couplings[0]);
+                double max_ij_coupling = std::get<2>(ij_couplings[0]);
                 bb_couplings_.push_back(
                     std::make_tuple(i, j, std::fabs(max_ij_coupling), ij_couplings));
             }
@@ -49,6 +49,7 @@
 
 namespace forte {
 class SCFInfo;
+class PCISigmaVector;
 
 enum GeneratorType { WallChebyshevGenerator, DLGenerator };
 
@@ -251,6 +252,20 @@ class ProjectorCI : public SelectedCIMethod {
     double lambda_1_;
     /// Highest possible e-value
     double lambda_h_;
+    /// Highest possible e-value from the Gershgorin circle estimate
+    double lambda_h_gershgorin_;
+    /// Refine the spectral bounds from Lanczos estimates during propagation?
+    bool adaptive_bounds_;
+    /// Number of Lanczos steps used to refine the spectral bounds
+    int adaptive_bounds_order_;
+    /// Number of times the spectral bounds were refined
+    int num_bounds_refinements_ = 0;
+    /// Size of the determinant space at the last refinement of the spectral bounds
+    size_t bounds_space_size_ = 0;
+    /// Number of sigma builds (Hamiltonian applications) in the Wall-Chebyshev propagation
+    size_t num_sigma_builds_ = 0;
+    /// Number of sigma builds spent on refining the spectral bounds
+    size_t num_bounds_sigma_builds_ = 0;
     /// Characteristic function coefficients
     std::vector<double> cha_func_coefs_;
     /// Do result perturbation analysis
@@ -335,6 +350,9 @@ class ProjectorCI : public SelectedCIMethod {
     void convergence_analysis();
     /// Compute the characteristic function for projector
     void compute_characteristic_function();
+    /// Refine lambda_h_ with a randomly started Lanczos run on the current generator
+    /// @param sigma_vector The (screened) Hamiltonian applied during propagation
+    void refine_spectral_bounds(PCISigmaVector& sigma_vector);
     /// Print the characteristic function
     void print_characteristic_function();
 
@@ -114,14 +114,19 @@ void PCISigmaVector::compute_sigma(std::shared_ptr<psi::Vector> sigma,
                     [](double x) { return x == 0; })) {
         set_psi_Vector(sigma, first_sigma_vec_);
         first_sigma_vec_.clear();
+        ++sigma_build_count_;
     } else {
         std::vector<double> b_vec = to_std_vector(b);
-        orthogonalize(dets_, b_vec, bad_roots_);
-        set_psi_Vector(b, b_vec);
         std::vector<double> sigma_vec;
-        apply_tau_H_ref_C_symm(spawning_threshold_, dets_, ref_C_, b_vec, sigma_vec, ref_size_);
+        apply_hamiltonian(b_vec, sigma_vec);
+        set_psi_Vector(b, b_vec);
         set_psi_Vector(sigma, sigma_vec);
     }
+}
+
+void PCISigmaVector::apply_hamiltonian(std::vector<double>& b, std::vector<double>& sigma) {
+    orthogonalize(dets_, b, bad_roots_);
+    apply_tau_H_ref_C_symm(spawning_threshold_, dets_, ref_C_, b, sigma, ref_size_);
     ++sigma_build_count_;
 }
 
@@ -157,47 +162,42 @@ void PCISigmaVector::apply_tau_H_symm(double spawning_threshold, det_hashvec& re
                                       size_t& overlap_size) {
 
     size_t ref_size = ref_dets.size();
-    //    result_dets.clear();
     result_C.clear();
-    //    det_hashvec result_dets(ref_dets);
-    det_hashvec extra_dets;
-    std::vector<double> extra_C;
     result_C.resize(ref_size, DBL_MIN);
 
-    std::vector<std::vector<std::pair<Determinant, double>>> thread_det_C_vecs(num_threads_);
-    num_off_diag_elem_ = 0;
+    // Look up the coupling bounds before the parallel section so that the map is never accessed
+    // concurrently. Bounds that are not available (zero) are computed during spawning
+    max_couplings_.resize(ref_size);
+    std::vector<char> update_couplings(ref_size, false);
+    for (size_t I = 0; I < ref_size; ++I) {
+        auto it = dets_max_couplings_.find(ref_dets[I]);
+        max_couplings_[I] = it != dets_max_couplings_.end() ? it->second : std::make_pair(0.0, 0.0);
+        update_couplings[I] = max_couplings_[I].first == 0.0 or max_couplings_[I].second == 0.0;
+    }
 
-#pragma omp parallel for
+    // Spawn walkers. Contributions to determinants in the reference space are added directly to
+    // result_C, the other ones are accumulated in thread-local buffers
+    std::vector<PCISpawnBuffer> spawned(num_threads_);
+    size_t num_off_diag = 0;
+#pragma omp parallel for reduction(+ : num_off_diag)
     for (size_t I = 0; I < ref_size; ++I) {
-        std::pair<double, double> max_coupling;
-        size_t current_rank = omp_get_thread_num();
-#pragma omp critical(dets_coupling)
-        { max_coupling = dets_max_couplings_[ref_dets[I]]; }
-        if (max_coupling.first == 0.0 or max_coupling.second == 0.0) {
-            thread_det_C_vecs[current_rank].clear();
-            apply_tau_H_symm_det_dynamic_HBCI_2(spawning_threshold, ref_dets, ref_C, I, ref_C[I],
-                                                result_C, thread_det_C_vecs[current_rank],
-                                                max_coupling);
-#pragma omp critical(merge_extra)
-            {
-                merge(extra_dets, extra_C, thread_det_C_vecs[current_rank],
-                      std::function<double(double, double)>(std::plus<double>()), 0.0, false);
-            }
-#pragma omp critical(dets_coupling)
-            { dets_max_couplings_[ref_dets[I]] = max_coupling; }
-        } else {
-            thread_det_C_vecs[current_rank].clear();
-            apply_tau_H_symm_det_dynamic_HBCI_2(spawning_threshold, ref_dets, ref_C, I, ref_C[I],
-                                                result_C, thread_det_C_vecs[current_rank],
-                                                max_coupling);
-#pragma omp critical(merge_extra)
-            {
-                merge(extra_dets, extra_C, thread_det_C_vecs[current_rank],
-                      std::function<double(double, double)>(std::plus<double>()), 0.0, false);
-            }
+        apply_tau_H_symm_det_dynamic_HBCI_2(spawning_threshold, ref_dets, ref_C, I, ref_C[I],
+                                            result_C, spawned[omp_get_thread_num()],
+                                            max_couplings_[I], num_off_diag);
+    }
+    num_off_diag_elem_ = num_off_diag;
+
+    for (size_t I = 0; I < ref_size; ++I) {
+        if (update_couplings[I]) {
+            dets_max_couplings_[ref_dets[I]] = max_couplings_[I];
         }
     }
 
+    // Annihilate the walkers spawned outside the reference space
+    std::vector<Determinant> extra_dets;
+    std::vector<double> extra_C;
+    merge_spawn_buffers(spawned, extra_dets, extra_C);
+
     std::vector<size_t> removing_indices;
     for (size_t I = 0; I < ref_size; ++I) {
         if (result_C[I] == DBL_MIN) {
@@ -209,6 +209,7 @@ void PCISigmaVector::apply_tau_H_symm(double spawning_threshold, det_hashvec& re
     for (size_t I : removing_indices) {
         result_C.erase(result_C.begin() + I);
         ref_C.erase(ref_C.begin() + I);
+        max_couplings_.erase(max_couplings_.begin() + I);
     }
     overlap_size = ref_dets.size();
     ref_dets.merge(extra_dets);
@@ -224,9 +225,8 @@ void PCISigmaVector::apply_tau_H_symm(double spawning_threshold, det_hashvec& re
 
 void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
     double spawning_threshold, const det_hashvec& dets_hashvec, const std::vector<double>& pre_C,
-    size_t I, double CI, std::vector<double>& result_C,
-    std::vector<std::pair<Determinant, double>>& new_det_C_vec,
-    std::pair<double, double>& max_coupling) {
+    size_t I, double CI, std::vector<double>& result_C, PCISpawnBuffer& spawned,
+    std::pair<double, double>& max_coupling, size_t& num_off_diag) {
 
     const Determinant& detI = dets_hashvec[I];
     size_t pre_C_size = pre_C.size();
@@ -277,10 +277,9 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                             if (index > I) {
                                 if (index >= pre_C_size) {
                                     if (important_H_CI_CJ_(HJI, CI, 0.0, spawning_threshold)) {
-                                        new_det_C_vec.push_back(std::make_pair(detJ, HJI * CI));
+                                        spawned.add(detJ, HJI * CI);
                                         diagonal_flag = true;
-#pragma omp atomic
-                                        num_off_diag_elem_ += 2;
+                                        num_off_diag += 2;
                                     }
                                 } else if (important_H_CI_CJ_(HJI, CI, pre_C[index],
                                                               spawning_threshold)) {
@@ -288,8 +287,7 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                                     result_C[index] += HJI * CI;
                                     diagonal_flag = true;
                                     diagonal_contribution += HJI * pre_C[index];
-#pragma omp atomic
-                                    num_off_diag_elem_ += 2;
+                                    num_off_diag += 2;
                                 }
                             }
 
@@ -329,10 +327,9 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                             if (index > I) {
                                 if (index >= pre_C_size) {
                                     if (important_H_CI_CJ_(HJI, CI, 0.0, spawning_threshold)) {
-                                        new_det_C_vec.push_back(std::make_pair(detJ, HJI * CI));
+                                        spawned.add(detJ, HJI * CI);
                                         diagonal_flag = true;
-#pragma omp atomic
-                                        num_off_diag_elem_ += 2;
+                                        num_off_diag += 2;
                                     }
                                 } else if (important_H_CI_CJ_(HJI, CI, pre_C[index],
                                                               spawning_threshold)) {
@@ -340,8 +337,7 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                                     result_C[index] += HJI * CI;
                                     diagonal_flag = true;
                                     diagonal_contribution += HJI * pre_C[index];
-#pragma omp atomic
-                                    num_off_diag_elem_ += 2;
+                                    num_off_diag += 2;
                                 }
                             }
 
@@ -386,10 +382,9 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                             if (index > I) {
                                 if (index >= pre_C_size) {
                                     if (important_H_CI_CJ_(HJI, CI, 0.0, spawning_threshold)) {
-                                        new_det_C_vec.push_back(std::make_pair(detJ, HJI * CI));
+                                        spawned.add(detJ, HJI * CI);
                                         diagonal_flag = true;
-#pragma omp atomic
-                                        num_off_diag_elem_ += 2;
+                                        num_off_diag += 2;
                                     }
                                 } else if (important_H_CI_CJ_(HJI, CI, pre_C[index],
                                                               spawning_threshold)) {
@@ -397,8 +392,7 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                                     result_C[index] += HJI * CI;
                                     diagonal_flag = true;
                                     diagonal_contribution += HJI * pre_C[index];
-#pragma omp atomic
-                                    num_off_diag_elem_ += 2;
+                                    num_off_diag += 2;
                                 }
                             }
 
@@ -440,10 +434,9 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                             if (index > I) {
                                 if (index >= pre_C_size) {
                                     if (important_H_CI_CJ_(HJI, CI, 0.0, spawning_threshold)) {
-                                        new_det_C_vec.push_back(std::make_pair(detJ, HJI * CI));
+                                        spawned.add(detJ, HJI * CI);
                                         diagonal_flag = true;
-#pragma omp atomic
-                                        num_off_diag_elem_ += 2;
+                                        num_off_diag += 2;
                                     }
                                 } else if (important_H_CI_CJ_(HJI, CI, pre_C[index],
                                                               spawning_threshold)) {
@@ -451,8 +444,7 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                                     result_C[index] += HJI * CI;
                                     diagonal_flag = true;
                                     diagonal_contribution += HJI * pre_C[index];
-#pragma omp atomic
-                                    num_off_diag_elem_ += 2;
+                                    num_off_diag += 2;
                                 }
                             }
 
@@ -495,10 +487,9 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                         if (index > I) {
                             if (index >= pre_C_size) {
                                 if (important_H_CI_CJ_(HJI, CI, 0.0, spawning_threshold)) {
-                                    new_det_C_vec.push_back(std::make_pair(detJ, HJI * CI));
+                                    spawned.add(detJ, HJI * CI);
                                     diagonal_flag = true;
-#pragma omp atomic
-                                    num_off_diag_elem_ += 2;
+                                    num_off_diag += 2;
                                 }
                             } else if (important_H_CI_CJ_(HJI, CI, pre_C[index],
                                                           spawning_threshold)) {
@@ -506,8 +497,7 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                                 result_C[index] += HJI * CI;
                                 diagonal_flag = true;
                                 diagonal_contribution += HJI * pre_C[index];
-#pragma omp atomic
-                                num_off_diag_elem_ += 2;
+                                num_off_diag += 2;
                             }
                         }
 
@@ -546,10 +536,9 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                         if (index > I) {
                             if (index >= pre_C_size) {
                                 if (important_H_CI_CJ_(HJI, CI, 0.0, spawning_threshold)) {
-                                    new_det_C_vec.push_back(std::make_pair(detJ, HJI * CI));
+                                    spawned.add(detJ, HJI * CI);
                                     diagonal_flag = true;
-#pragma omp atomic
-                                    num_off_diag_elem_ += 2;
+                                    num_off_diag += 2;
                                 }
                             } else if (important_H_CI_CJ_(HJI, CI, pre_C[index],
                                                           spawning_threshold)) {
@@ -557,8 +546,7 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                                 result_C[index] += HJI * CI;
                                 diagonal_flag = true;
                                 diagonal_contribution += HJI * pre_C[index];
-#pragma omp atomic
-                                num_off_diag_elem_ += 2;
+                                num_off_diag += 2;
                             }
                         }
 
@@ -597,10 +585,9 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                         if (index > I) {
                             if (index >= pre_C_size) {
                                 if (important_H_CI_CJ_(HJI, CI, 0.0, spawning_threshold)) {
-                                    new_det_C_vec.push_back(std::make_pair(detJ, HJI * CI));
+                                    spawned.add(detJ, HJI * CI);
                                     diagonal_flag = true;
-#pragma omp atomic
-                                    num_off_diag_elem_ += 2;
+                                    num_off_diag += 2;
                                 }
                             } else if (important_H_CI_CJ_(HJI, CI, pre_C[index],
                                                           spawning_threshold)) {
@@ -608,8 +595,7 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                                 result_C[index] += HJI * CI;
                                 diagonal_flag = true;
                                 diagonal_contribution += HJI * pre_C[index];
-#pragma omp atomic
-                                num_off_diag_elem_ += 2;
+                                num_off_diag += 2;
                             }
                         }
 
@@ -652,10 +638,9 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                         if (index > I) {
                             if (index >= pre_C_size) {
                                 if (important_H_CI_CJ_(HJI, CI, 0.0, spawning_threshold)) {
-                                    new_det_C_vec.push_back(std::make_pair(detJ, HJI * CI));
+                                    spawned.add(detJ, HJI * CI);
                                     diagonal_flag = true;
-#pragma omp atomic
-                                    num_off_diag_elem_ += 2;
+                                    num_off_diag += 2;
                                 }
                             } else if (important_H_CI_CJ_(HJI, CI, pre_C[index],
                                                           spawning_threshold)) {
@@ -663,8 +648,7 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                                 result_C[index] += HJI * CI;
                                 diagonal_flag = true;
                                 diagonal_contribution += HJI * pre_C[index];
-#pragma omp atomic
-                                num_off_diag_elem_ += 2;
+                                num_off_diag += 2;
                             }
                         }
 
@@ -704,10 +688,9 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                         if (index > I) {
                             if (index >= pre_C_size) {
                                 if (important_H_CI_CJ_(HJI, CI, 0.0, spawning_threshold)) {
-                                    new_det_C_vec.push_back(std::make_pair(detJ, HJI * CI));
+                                    spawned.add(detJ, HJI * CI);
                                     diagonal_flag = true;
-#pragma omp atomic
-                                    num_off_diag_elem_ += 2;
+                                    num_off_diag += 2;
                                 }
                             } else if (important_H_CI_CJ_(HJI, CI, pre_C[index],
                                                           spawning_threshold)) {
@@ -715,8 +698,7 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                                 result_C[index] += HJI * CI;
                                 diagonal_flag = true;
                                 diagonal_contribution += HJI * pre_C[index];
-#pragma omp atomic
-                                num_off_diag_elem_ += 2;
+                                num_off_diag += 2;
                             }
                         }
 
@@ -756,10 +738,9 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                         if (index > I) {
                             if (index >= pre_C_size) {
                                 if (important_H_CI_CJ_(HJI, CI, 0.0, spawning_threshold)) {
-                                    new_det_C_vec.push_back(std::make_pair(detJ, HJI * CI));
+                                    spawned.add(detJ, HJI * CI);
                                     diagonal_flag = true;
-#pragma omp atomic
-                                    num_off_diag_elem_ += 2;
+                                    num_off_diag += 2;
                                 }
                             } else if (important_H_CI_CJ_(HJI, CI, pre_C[index],
                                                           spawning_threshold)) {
@@ -767,8 +748,7 @@ void PCISigmaVector::apply_tau_H_symm_det_dynamic_HBCI_2(
                                 result_C[index] += HJI * CI;
                                 diagonal_flag = true;
                                 diagonal_contribution += HJI * pre_C[index];
-#pragma omp atomic
-                                num_off_diag_elem_ += 2;
+                                num_off_diag += 2;
                             }
                         }
 
@@ -803,11 +783,9 @@ void PCISigmaVector::apply_tau_H_ref_C_symm(
 
 #pragma omp parallel for
     for (size_t I = 0; I < overlap_size; ++I) {
-        std::pair<double, double> max_coupling;
-        max_coupling = dets_max_couplings_[result_dets[I]];
         apply_tau_H_ref_C_symm_det_dynamic_HBCI_2(spawning_threshold, result_dets, pre_C, ref_C, I,
                                                   pre_C[I], ref_C[I], overlap_size, result_C,
-                                                  max_coupling);
+                                                  max_couplings_[I]);
     }
 
 #pragma omp parallel for
@@ -30,6 +30,7 @@
 #pragma once
 
 #include "sparse_ci/sigma_vector.h"
+#include "pci_spawning.h"
 
 namespace forte {
 
@@ -65,6 +66,10 @@ class PCISigmaVector : public SigmaVector {
                                  std::shared_ptr<psi::Vector> b);
     size_t get_num_off_diag();
     size_t get_sigma_build_count();
+    /// Apply the screened Hamiltonian to b (orthogonalized to the previous solutions in place).
+    /// Unlike compute_sigma, this does not use the cached first sigma vector. Every call is
+    /// counted as a sigma build
+    void apply_hamiltonian(std::vector<double>& b, std::vector<double>& sigma);
 
   private:
     det_hashvec& dets_;
@@ -95,6 +100,9 @@ class PCISigmaVector : public SigmaVector {
         &aa_couplings_, &ab_couplings_, &bb_couplings_;
     size_t aa_couplings_size_, ab_couplings_size_, bb_couplings_size_;
     const std::vector<std::pair<det_hashvec, std::vector<double>>>& bad_roots_;
+    /// The coupling bounds (f_max,v_max) of the determinants in the reference space. These are
+    /// looked up once in apply_tau_H_symm and reused by all the following sigma builds
+    std::vector<std::pair<double, double>> max_couplings_;
 
     std::vector<double> first_sigma_vec_;
     /// The diagonal elements
@@ -119,12 +127,13 @@ class PCISigmaVector : public SigmaVector {
     /// Apply symmetric approx tau H to a determinant using dynamic screening
     /// with selection according to a reference coefficient
     /// and with HBCI sorting scheme with singles screening
-    void
-    apply_tau_H_symm_det_dynamic_HBCI_2(double spawning_threshold, const det_hashvec& dets_hashvec,
-                                        const std::vector<double>& pre_C, size_t I, double CI,
-                                        std::vector<double>& result_C,
-                                        std::vector<std::pair<Determinant, double>>& new_det_C_vec,
-                                        std::pair<double, double>& max_coupling);
+    /// Walkers spawned outside of the reference space are accumulated in a thread-local buffer
+    void apply_tau_H_symm_det_dynamic_HBCI_2(double spawning_threshold,
+                                             const det_hashvec& dets_hashvec,
+                                             const std::vector<double>& pre_C, size_t I, double CI,
+                                             std::vector<double>& result_C, PCISpawnBuffer& spawned,
+                                             std::pair<double, double>& max_coupling,
+                                             size_t& num_off_diag);
     /// Apply symmetric approx tau H to a set of determinants with selection
     /// according to reference coefficients
     void apply_tau_H_ref_C_symm(double spawning_threshold, const det_hashvec& result_dets,
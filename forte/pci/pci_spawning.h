@@ -0,0 +1,180 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "sparse_ci/determinant.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace forte {
+
+/**
+ * @brief A thread-local accumulator for the walkers spawned in a PCI step
+ *
+ * Walkers spawned on the same determinant are summed (annihilated) as they are added. The
+ * determinants are found with an open-addressing table (linear probing) whose slots store the
+ * position of the determinant in the dense arrays dets()/values().
+ */
+class PCISpawnBuffer {
+  public:
+    PCISpawnBuffer() : slots_(min_capacity, 0), mask_(min_capacity - 1) {}
+
+    /// Add a walker with a given value to a determinant
+    void add(const Determinant& det, double value) {
+        size_t pos = Determinant::Hash()(det) & mask_;
+        while (slots_[pos] != 0) {
+            const size_t index = slots_[pos] - 1;
+            if (dets_[index] == det) {
+                values_[index] += value;
+                return;
+            }
+            pos = (pos + 1) & mask_;
+        }
+        slots_[pos] = dets_.size() + 1;
+        dets_.push_back(det);
+        values_.push_back(value);
+        // keep the load factor below 1/2
+        if (2 * dets_.size() > slots_.size()) {
+            grow();
+        }
+    }
+
+    /// The number of determinants stored
+    size_t size() const { return dets_.size(); }
+    /// The determinants in the order they were first spawned
+    const std::vector<Determinant>& dets() const { return dets_; }
+    /// The sum of the walkers spawned on each determinant
+    const std::vector<double>& values() const { return values_; }
+
+    /// Remove all the walkers and keep the allocated memory
+    void clear() {
+        std::fill(slots_.begin(), slots_.end(), 0);
+        dets_.clear();
+        values_.clear();
+    }
+
+  private:
+    static constexpr size_t min_capacity = 1024;
+    /// The slots of the hash table (0 = empty, otherwise the index of the determinant + 1)
+    std::vector<size_t> slots_;
+    /// mask used to compute the hash position (capacity - 1)
+    size_t mask_;
+    std::vector<Determinant> dets_;
+    std::vector<double> values_;
+
+    /// Double the size of the hash table
+    void grow() {
+        slots_.assign(2 * slots_.size(), 0);
+        mask_ = slots_.size() - 1;
+        for (size_t index = 0, maxI = dets_.size(); index < maxI; ++index) {
+            size_t pos = Determinant::Hash()(dets_[index]) & mask_;
+            while (slots_[pos] != 0) {
+                pos = (pos + 1) & mask_;
+            }
+            slots_[pos] = index + 1;
+        }
+    }
+};
+
+/// The partition of a determinant with a given hash, see merge_spawn_buffers()
+inline size_t spawn_partition(size_t hash, size_t npartitions) {
+    return ((static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> 32) % npartitions;
+}
+
+/**
+ * @brief Merge the walkers spawned by each thread
+ *
+ * The walkers are distributed to partitions according to the hash of the determinant, so that
+ * each partition can be annihilated independently in parallel. The result is deterministic for
+ * a given content of the buffers.
+ *
+ * The partition index is taken from the high bits of the hash scrambled by a multiplicative
+ * (Fibonacci) step. The partition tables index their slots with the low bits of the same hash,
+ * so using hash % npartitions would leave only every npartitions-th slot as a home position and
+ * produce long probe sequences (the hash of a 128-bit determinant has no bits above 2^31, so it
+ * cannot be shifted directly).
+ *
+ * @param buffers the thread-local buffers
+ * @param dets the merged determinants
+ * @param C the merged coefficients
+ */
+inline void merge_spawn_buffers(const std::vector<PCISpawnBuffer>& buffers,
+                                std::vector<Determinant>& dets, std::vector<double>& C) {
+    const size_t nbuffers = buffers.size();
+    const size_t npartitions = nbuffers;
+
+    // 1. Split the walkers of each buffer into partitions
+    std::vector<std::vector<std::vector<size_t>>> partition_index(
+        nbuffers, std::vector<std::vector<size_t>>(npartitions));
+#pragma omp parallel for schedule(static, 1)
+    for (size_t b = 0; b < nbuffers; ++b) {
+        const auto& buffer_dets = buffers[b].dets();
+        for (size_t index = 0, maxI = buffer_dets.size(); index < maxI; ++index) {
+            const size_t p = spawn_partition(Determinant::Hash()(buffer_dets[index]), npartitions);
+            partition_index[b][p].push_back(index);
+        }
+    }
+
+    // 2. Annihilate the walkers in each partition
+    std::vector<PCISpawnBuffer> partitions(npartitions);
+#pragma omp parallel for schedule(static, 1)
+    for (size_t p = 0; p < npartitions; ++p) {
+        for (size_t b = 0; b < nbuffers; ++b) {
+            const auto& buffer_dets = buffers[b].dets();
+            const auto& buffer_values = buffers[b].values();
+            for (size_t index : partition_index[b][p]) {
+                partitions[p].add(buffer_dets[index], buffer_values[index]);
+            }
+        }
+    }
+
+    // 3. Concatenate the partitions
+    std::vector<size_t> offset(npartitions + 1, 0);
+    for (size_t p = 0; p < npartitions; ++p) {
+        offset[p + 1] = offset[p] + partitions[p].size();
+    }
+    dets.resize(offset[npartitions]);
+    C.resize(offset[npartitions]);
+#pragma omp parallel for schedule(static, 1)
+    for (size_t p = 0; p < npartitions; ++p) {
+        std::copy(partitions[p].dets().begin(), partitions[p].dets().end(),
+                  dets.begin() + offset[p]);
+        std::copy(partitions[p].values().begin(), partitions[p].values().end(),
+                  C.begin() + offset[p]);
+    }
+}
+
+} // namespace forte
@@ -0,0 +1,216 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace forte {
+
+/// @brief An upper and a lower bound on the spectrum of a symmetric matrix
+struct SpectralBounds {
+    double lower;
+    double upper;
+};
+
+/**
+ * @brief The relative accuracy guaranteed for the extreme Ritz values of a Lanczos run
+ *
+ * For a positive semidefinite matrix of dimension n and a starting vector drawn uniformly from
+ * the unit sphere, k Lanczos steps give a Ritz value theta_max that satisfies
+ * theta_max >= (1 - eps) lambda_max with probability at least 1 - 1.648 sqrt(n) exp(-sqrt(eps)
+ * (2k - 1)) [J. Kuczynski and H. Wozniakowski, SIAM J. Matrix Anal. Appl. 13, 1094 (1992)].
+ *
+ * @param n the dimension of the matrix
+ * @param k the number of Lanczos steps
+ * @param failure_probability the largest accepted probability that the bound does not hold
+ * @return eps
+ */
+inline double lanczos_relative_error_bound(size_t n, size_t k, double failure_probability) {
+    const double sqrt_eps = std::log(1.648 * std::sqrt(static_cast<double>(n)) /
+                                     failure_probability) /
+                            static_cast<double>(2 * k - 1);
+    return sqrt_eps * sqrt_eps;
+}
+
+/**
+ * @brief The lowest and highest eigenvalues of a symmetric tridiagonal matrix
+ *
+ * The eigenvalues are located by bisection on the Sturm sequence count, which does not require
+ * a dense eigensolver.
+ *
+ * @param alpha the diagonal elements
+ * @param beta the off-diagonal elements (beta[j] couples the elements j and j + 1)
+ */
+inline std::pair<double, double> tridiagonal_extreme_eigenvalues(const std::vector<double>& alpha,
+                                                                 const std::vector<double>& beta) {
+    const size_t n = alpha.size();
+    // all the eigenvalues lie within the Gershgorin disks of the tridiagonal matrix
+    double low = alpha[0];
+    double high = alpha[0];
+    for (size_t j = 0; j < n; ++j) {
+        const double radius = (j > 0 ? std::fabs(beta[j - 1]) : 0.0) +
+                              (j + 1 < n ? std::fabs(beta[j]) : 0.0);
+        low = std::min(low, alpha[j] - radius);
+        high = std::max(high, alpha[j] + radius);
+    }
+
+    // the number of eigenvalues smaller than x
+    auto count_below = [&](double x) {
+        size_t count = 0;
+        double d = 1.0;
+        for (size_t j = 0; j < n; ++j) {
+            const double b2 = j > 0 ? beta[j - 1] * beta[j - 1] : 0.0;
+            d = alpha[j] - x - b2 / d;
+            if (d == 0.0) {
+                d = -1.0e-300;
+            }
+            if (d < 0.0) {
+                ++count;
+            }
+        }
+        return count;
+    };
+
+    // find the eigenvalue of rank r (0 = lowest)
+    auto bisect = [&](size_t r) {
+        double a = low;
+        double b = high;
+        for (int iter = 0; iter < 200 and b - a > 1.0e-14 * std::max(1.0, std::fabs(b)); ++iter) {
+            const double mid = 0.5 * (a + b);
+            if (count_below(mid) > r) {
+                b = mid;
+            } else {
+                a = mid;
+            }
+        }
+        return 0.5 * (a + b);
+    };
+    return {bisect(0), bisect(n - 1)};
+}
+
+/**
+ * @brief Bound the spectrum of a symmetric matrix with a randomly started Lanczos run
+ *
+ * The bounds hold with probability at least 1 - 2 failure_probability, provided that
+ * upper_bound is an upper bound on the spectrum. The Kuczynski-Wozniakowski estimate is applied
+ * twice: first to upper_bound - H, which gives a lower bound on the spectrum of H, and then to
+ * H shifted by this lower bound, which gives the upper bound. If the number of steps is too small
+ * to make the estimate useful, upper_bound is returned and no lower bound is given.
+ *
+ * @param size the dimension of the matrix
+ * @param nsteps the maximum number of Lanczos steps
+ * @param upper_bound a known upper bound on the spectrum (e.g. from the Gershgorin theorem)
+ * @param apply_H a function that computes sigma = H b (b may be modified)
+ * @param seed the seed of the random starting vector
+ * @param failure_probability the largest accepted probability that each bound does not hold
+ * @return the lower and the upper bound (the latter never exceeds upper_bound)
+ */
+inline SpectralBounds lanczos_spectral_bounds(
+    size_t size, size_t nsteps, double upper_bound,
+    const std::function<void(std::vector<double>&, std::vector<double>&)>& apply_H,
+    unsigned int seed, double failure_probability = 1.0e-6) {
+    auto dot = [size](const std::vector<double>& x, const std::vector<double>& y) {
+        double result = 0.0;
+        for (size_t I = 0; I < size; ++I) {
+            result += x[I] * y[I];
+        }
+        return result;
+    };
+
+    // a starting vector uniformly distributed on the unit sphere
+    std::mt19937 gen(seed);
+    std::normal_distribution<double> gaussian(0.0, 1.0);
+    std::vector<double> v(size);
+    for (auto& x : v) {
+        x = gaussian(gen);
+    }
+
+    std::vector<std::vector<double>> V;
+    std::vector<double> alpha, beta;
+    std::vector<double> w(size);
+    bool invariant = false;
+    for (size_t j = 0; j < std::min(nsteps, size); ++j) {
+        const double norm = std::sqrt(dot(v, v));
+        if (j > 0) {
+            beta.push_back(norm);
+        }
+        if (norm < 1.0e-10) {
+            // the Krylov space is invariant, the Ritz values are exact eigenvalues of H
+            invariant = true;
+            break;
+        }
+        for (auto& x : v) {
+            x /= norm;
+        }
+        V.push_back(v);
+        apply_H(v, w);
+        alpha.push_back(dot(V.back(), w));
+        // full reorthogonalization against the Lanczos basis (twice is enough)
+        for (int pass = 0; pass < 2; ++pass) {
+            for (const auto& u : V) {
+                const double overlap = dot(u, w);
+                for (size_t I = 0; I < size; ++I) {
+                    w[I] -= overlap * u[I];
+                }
+            }
+        }
+        v.swap(w);
+    }
+    beta.resize(alpha.size() > 0 ? alpha.size() - 1 : 0);
+    if (alpha.empty()) {
+        return {std::numeric_limits<double>::lowest(), upper_bound};
+    }
+    auto [theta_min, theta_max] = tridiagonal_extreme_eigenvalues(alpha, beta);
+    if (invariant or alpha.size() == size) {
+        // a random vector has components along all the eigenvectors, so an invariant Krylov
+        // space (or the full space) contains all the distinct eigenvalues
+        return {theta_min, std::min(upper_bound, theta_max)};
+    }
+
+    const double eps = lanczos_relative_error_bound(size, alpha.size(), failure_probability);
+    if (eps >= 1.0) {
+        // too few steps to bound the spectrum
+        return {std::numeric_limits<double>::lowest(), upper_bound};
+    }
+    // upper_bound - H is positive semidefinite, so its largest eigenvalue upper_bound - lambda_min
+    // is at most (upper_bound - theta_min) / (1 - eps)
+    const double lower = upper_bound - (upper_bound - theta_min) / (1.0 - eps);
+    // H - lower is positive semidefinite, so lambda_max - lower <= (theta_max - lower) / (1 - eps)
+    const double upper = lower + (theta_max - lower) / (1.0 - eps);
+    return {lower, std::min(upper_bound, upper)};
+}
+
+} // namespace forte
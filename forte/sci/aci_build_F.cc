@@ -69,6 +69,7 @@ void AdaptiveCI::get_excited_determinants_sr(SharedMatrix evecs, std::shared_ptr
         const auto [start_idx, end_idx] = thread_range(max_P, num_thread, tid);
 
         det_hash<double> V_hash_t;
+        std::vector<double> singles;
         for (size_t P = start_idx; P < end_idx; ++P) {
             local_timer single;
             const Determinant& det(P_dets[P]);
@@ -86,12 +87,13 @@ void AdaptiveCI::get_excited_determinants_sr(SharedMatrix evecs, std::shared_ptr
             Determinant new_det(det);
             //            outfile->Printf("\n  %s", str(det, nact_).c_str());
             // Generate alpha excitations
+            as_ints_->slater_rules_single_alpha_batch(aocc, bocc, singles);
             for (size_t i = 0; i < noalpha; ++i) {
                 size_t ii = aocc[i];
                 for (size_t a = 0; a < nvalpha; ++a) {
                     size_t aa = avir[a];
                     if ((mo_symmetry_[ii] ^ mo_symmetry_[aa]) == 0) {
-                        double HIJ = as_ints_->slater_rules_single_alpha(det, ii, aa) * Cp;
+                        double HIJ = det.slater_sign_aa(ii, aa) * singles[i * nact_ + aa] * Cp;
                         if (std::abs(HIJ) >= screen_thresh_) {
                             new_det = det;
                             new_det.set_alfa_bit(ii, false);
@@ -102,12 +104,13 @@ void AdaptiveCI::get_excited_determinants_sr(SharedMatrix evecs, std::shared_ptr
                 }
             }
             // Generate beta excitations
+            as_ints_->slater_rules_single_beta_batch(aocc, bocc, singles);
             for (size_t i = 0; i < nobeta; ++i) {
                 size_t ii = bocc[i];
                 for (size_t a = 0; a < nvbeta; ++a) {
                     size_t aa = bvir[a];
                     if ((mo_symmetry_[ii] ^ mo_symmetry_[aa]) == 0) {
-                        double HIJ = as_ints_->slater_rules_single_beta(det, ii, aa) * Cp;
+                        double HIJ = det.slater_sign_bb(ii, aa) * singles[i * nact_ + aa] * Cp;
                         if (std::abs(HIJ) >= screen_thresh_) {
                             new_det = det;
                             new_det.set_beta_bit(ii, false);
@@ -122,6 +125,8 @@ void AdaptiveCI::get_excited_determinants_sr(SharedMatrix evecs, std::shared_ptr
                 size_t ii = aocc[i];
                 for (size_t j = i + 1; j < noalpha; ++j) {
                     size_t jj = aocc[j];
+                    if (std::fabs(Cp) * as_ints_->max_double_coupling_aa(ii, jj) < screen_thresh_)
+                        continue;
                     for (size_t a = 0; a < nvalpha; ++a) {
                         size_t aa = avir[a];
                         for (size_t b = a + 1; b < nvalpha; ++b) {
@@ -144,6 +149,8 @@ void AdaptiveCI::get_excited_determinants_sr(SharedMatrix evecs, std::shared_ptr
                 size_t ii = aocc[i];
                 for (size_t j = 0; j < nobeta; ++j) {
                     size_t jj = bocc[j];
+                    if (std::fabs(Cp) * as_ints_->max_double_coupling_ab(ii, jj) < screen_thresh_)
+                        continue;
                     for (size_t a = 0; a < nvalpha; ++a) {
                         size_t aa = avir[a];
                         for (size_t b = 0; b < nvbeta; ++b) {
@@ -166,6 +173,8 @@ void AdaptiveCI::get_excited_determinants_sr(SharedMatrix evecs, std::shared_ptr
                 size_t ii = bocc[i];
                 for (size_t j = i + 1; j < nobeta; ++j) {
                     size_t jj = bocc[j];
+                    if (std::fabs(Cp) * as_ints_->max_double_coupling_bb(ii, jj) < screen_thresh_)
+                        continue;
                     for (size_t a = 0; a < nvbeta; ++a) {
                         size_t aa = bvir[a];
                         for (size_t b = a + 1; b < nvbeta; ++b) {
@@ -267,6 +276,8 @@ void AdaptiveCI::get_excited_determinants_avg(
             // Generate alpha excitations
             for (size_t i = 0; i < noalpha; ++i) {
                 size_t ii = aocc[i];
+                if (evecs_P_row_norm * as_ints_->max_single_coupling_a(ii) < screen_thresh_)
+                    continue;
                 for (size_t a = 0; a < nvalpha; ++a) {
                     size_t aa = avir[a];
                     if ((mo_symmetry_[ii] ^ mo_symmetry_[aa]) == 0) {
@@ -294,6 +305,8 @@ void AdaptiveCI::get_excited_determinants_avg(
             // Generate beta excitations
             for (size_t i = 0; i < nobeta; ++i) {
                 size_t ii = bocc[i];
+                if (evecs_P_row_norm * as_ints_->max_single_coupling_b(ii) < screen_thresh_)
+                    continue;
                 for (size_t a = 0; a < nvbeta; ++a) {
                     size_t aa = bvir[a];
                     if ((mo_symmetry_[ii] ^ mo_symmetry_[aa]) == 0) {
@@ -322,6 +335,9 @@ void AdaptiveCI::get_excited_determinants_avg(
                 size_t ii = aocc[i];
                 for (size_t j = i + 1; j < noalpha; ++j) {
                     size_t jj = aocc[j];
+                    if (evecs_P_row_norm * as_ints_->max_double_coupling_aa(ii, jj) <
+                        screen_thresh_)
+                        continue;
                     for (size_t a = 0; a < nvalpha; ++a) {
                         size_t aa = avir[a];
                         for (size_t b = a + 1; b < nvalpha; ++b) {
@@ -358,6 +374,9 @@ void AdaptiveCI::get_excited_determinants_avg(
                 size_t ii = aocc[i];
                 for (size_t j = 0; j < nobeta; ++j) {
                     size_t jj = bocc[j];
+                    if (evecs_P_row_norm * as_ints_->max_double_coupling_ab(ii, jj) <
+                        screen_thresh_)
+                        continue;
                     for (size_t a = 0; a < nvalpha; ++a) {
                         size_t aa = avir[a];
                         for (size_t b = 0; b < nvbeta; ++b) {
@@ -393,6 +412,9 @@ void AdaptiveCI::get_excited_determinants_avg(
                 size_t ii = bocc[i];
                 for (size_t j = i + 1; j < nobeta; ++j) {
                     size_t jj = bocc[j];
+                    if (evecs_P_row_norm * as_ints_->max_double_coupling_bb(ii, jj) <
+                        screen_thresh_)
+                        continue;
                     for (size_t a = 0; a < nvbeta; ++a) {
                         size_t aa = bvir[a];
                         for (size_t b = a + 1; b < nvbeta; ++b) {
@@ -505,6 +527,8 @@ void AdaptiveCI::get_excited_determinants_core(
             // Generate alpha excitations
             for (size_t i = 0; i < noalpha; ++i) {
                 size_t ii = aocc[i];
+                if (evecs_P_row_norm * as_ints_->max_single_coupling_a(ii) < screen_thresh_)
+                    continue;
                 for (size_t a = 0; a < nvalpha; ++a) {
                     size_t aa = avir[a];
                     if (((mo_symmetry_[ii] ^ mo_symmetry_[aa]) == 0) and
@@ -532,6 +556,8 @@ void AdaptiveCI::get_excited_determinants_core(
             // Generate beta excitations
             for (size_t i = 0; i < nobeta; ++i) {
                 size_t ii = bocc[i];
+                if (evecs_P_row_norm * as_ints_->max_single_coupling_b(ii) < screen_thresh_)
+                    continue;
                 for (size_t a = 0; a < nvbeta; ++a) {
                     size_t aa = bvir[a];
                     if (((mo_symmetry_[ii] ^ mo_symmetry_[aa]) == 0) and
@@ -561,6 +587,9 @@ void AdaptiveCI::get_excited_determinants_core(
                 size_t ii = aocc[i];
                 for (size_t j = i + 1; j < noalpha; ++j) {
                     size_t jj = aocc[j];
+                    if (evecs_P_row_norm * as_ints_->max_double_coupling_aa(ii, jj) <
+                        screen_thresh_)
+                        continue;
                     for (size_t a = 0; a < nvalpha; ++a) {
                         size_t aa = avir[a];
                         for (size_t b = a + 1; b < nvalpha; ++b) {
@@ -598,6 +627,9 @@ void AdaptiveCI::get_excited_determinants_core(
                 size_t ii = aocc[i];
                 for (size_t j = 0; j < nobeta; ++j) {
                     size_t jj = bocc[j];
+                    if (evecs_P_row_norm * as_ints_->max_double_coupling_ab(ii, jj) <
+                        screen_thresh_)
+                        continue;
                     for (size_t a = 0; a < nvalpha; ++a) {
                         size_t aa = avir[a];
                         for (size_t b = 0; b < nvbeta; ++b) {
@@ -634,6 +666,9 @@ void AdaptiveCI::get_excited_determinants_core(
                 size_t ii = bocc[i];
                 for (size_t j = i + 1; j < nobeta; ++j) {
                     size_t jj = bocc[j];
+                    if (evecs_P_row_norm * as_ints_->max_double_coupling_bb(ii, jj) <
+                        screen_thresh_)
+                        continue;
                     for (size_t a = 0; a < nvbeta; ++a) {
                         size_t aa = bvir[a];
                         for (size_t b = a + 1; b < nvbeta; ++b) {
@@ -1004,6 +1039,8 @@ det_hash<double> AdaptiveCI::get_bin_F_space(int bin, int nbin, double /*E0*/, S
                 const auto& nvalpha_h = nvalpha[h];
 
                 for (auto& ii : noalpha_h) {
+                    if (std::fabs(c_I) * as_ints_->max_single_coupling_a(ii) < screen_thresh_)
+                        continue;
                     new_det.set_alfa_bit(ii, false);
                     for (auto& aa : nvalpha_h) {
                         new_det.set_alfa_bit(aa, true);
@@ -1024,6 +1061,8 @@ det_hash<double> AdaptiveCI::get_bin_F_space(int bin, int nbin, double /*E0*/, S
                 const auto& nobeta_h = nobeta[h];
                 const auto& nvbeta_h = nvbeta[h];
                 for (auto& ii : nobeta_h) {
+                    if (std::fabs(c_I) * as_ints_->max_single_coupling_b(ii) < screen_thresh_)
+                        continue;
                     new_det.set_beta_bit(ii, false);
                     for (auto& aa : nvbeta_h) {
                         new_det.set_beta_bit(aa, true);
@@ -1065,6 +1104,9 @@ det_hash<double> AdaptiveCI::get_bin_F_space(int bin, int nbin, double /*E0*/, S
                             new_det.set_alfa_bit(ii, false);
                             for (size_t j = (p == q ? i + 1 : 0); j < max_j; ++j) {
                                 size_t jj = noalpha_q[j];
+                                if (std::fabs(c_I) * as_ints_->max_double_coupling_aa(ii, jj) <
+                                    screen_thresh_)
+                                    continue;
                                 new_det.set_alfa_bit(jj, false);
                                 for (size_t a = 0; a < max_a; ++a) {
                                     size_t aa = nvalpha_r[a];
@@ -1108,6 +1150,9 @@ det_hash<double> AdaptiveCI::get_bin_F_space(int bin, int nbin, double /*E0*/, S
                             new_det.set_beta_bit(ii, false);
                             for (size_t j = (p == q ? i + 1 : 0); j < max_j; ++j) {
                                 size_t jj = nobeta_q[j];
+                                if (std::fabs(c_I) * as_ints_->max_double_coupling_bb(ii, jj) <
+                                    screen_thresh_)
+                                    continue;
                                 new_det.set_beta_bit(jj, false);
                                 for (size_t a = 0; a < max_a; ++a) {
                                     size_t aa = nvbeta_r[a];
@@ -1153,6 +1198,9 @@ det_hash<double> AdaptiveCI::get_bin_F_space(int bin, int nbin, double /*E0*/, S
                             for (auto& aa : nvalpha_r) {
                                 new_det.set_alfa_bit(aa, true);
                                 for (auto& jj : nobeta_q) {
+                                    if (std::fabs(c_I) * as_ints_->max_double_coupling_ab(ii, jj) <
+                                        screen_thresh_)
+                                        continue;
                                     new_det.set_beta_bit(jj, false);
                                     for (auto& bb : nvbeta_s) {
                                         new_det.set_beta_bit(bb, true);
@@ -1293,6 +1341,8 @@ AdaptiveCI::get_bin_F_space_vecsort(int bin, int nbin, SharedMatrix evecs,
                 const auto& nvalpha_h = nvalpha[h];
 
                 for (auto& ii : noalpha_h) {
+                    if (std::fabs(c_I) * as_ints_->max_single_coupling_a(ii) < screen_thresh_)
+                        continue;
                     new_det.set_alfa_bit(ii, false);
                     for (auto& aa : nvalpha_h) {
                         new_det.set_alfa_bit(aa, true);
@@ -1311,6 +1361,8 @@ AdaptiveCI::get_bin_F_space_vecsort(int bin, int nbin, SharedMatrix evecs,
                 const auto& nobeta_h = nobeta[h];
                 const auto& nvbeta_h = nvbeta[h];
                 for (auto& ii : nobeta_h) {
+                    if (std::fabs(c_I) * as_ints_->max_single_coupling_b(ii) < screen_thresh_)
+                        continue;
                     new_det.set_beta_bit(ii, false);
                     for (auto& aa : nvbeta_h) {
                         new_det.set_beta_bit(aa, true);
@@ -1350,6 +1402,9 @@ AdaptiveCI::get_bin_F_space_vecsort(int bin, int nbin, SharedMatrix evecs,
                             new_det.set_alfa_bit(ii, false);
                             for (size_t j = (p == q ? i + 1 : 0); j < max_j; ++j) {
                                 size_t jj = noalpha_q[j];
+                                if (std::fabs(c_I) * as_ints_->max_double_coupling_aa(ii, jj) <
+                                    screen_thresh_)
+                                    continue;
                                 new_det.set_alfa_bit(jj, false);
                                 for (size_t a = 0; a < max_a; ++a) {
                                     size_t aa = nvalpha_r[a];
@@ -1390,6 +1445,9 @@ AdaptiveCI::get_bin_F_space_vecsort(int bin, int nbin, SharedMatrix evecs,
                             new_det.set_beta_bit(ii, false);
                             for (size_t j = (p == q ? i + 1 : 0); j < max_j; ++j) {
                                 size_t jj = nobeta_q[j];
+                                if (std::fabs(c_I) * as_ints_->max_double_coupling_bb(ii, jj) <
+                                    screen_thresh_)
+                                    continue;
                                 new_det.set_beta_bit(jj, false);
                                 for (size_t a = 0; a < max_a; ++a) {
                                     size_t aa = nvbeta_r[a];
@@ -1433,6 +1491,9 @@ AdaptiveCI::get_bin_F_space_vecsort(int bin, int nbin, SharedMatrix evecs,
                             for (auto& aa : nvalpha_r) {
                                 new_det.set_alfa_bit(aa, true);
                                 for (auto& jj : nobeta_q) {
+                                    if (std::fabs(c_I) * as_ints_->max_double_coupling_ab(ii, jj) <
+                                        screen_thresh_)
+                                        continue;
                                     new_det.set_beta_bit(jj, false);
                                     for (auto& bb : nvbeta_s) {
                                         new_det.set_beta_bit(bb, true);
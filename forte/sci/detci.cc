@@ -19,6 +19,7 @@
 #include "helpers/printing.h"
 #include "helpers/string_algorithms.h"
 #include "sparse_ci/ci_reference.h"
+#include "sparse_ci/wave_function_checkpoint.h"
 #include "detci.h"
 
 using namespace psi;
@@ -317,6 +318,11 @@ void DETCI::print_ci_wfn() {
 
 void DETCI::dump_wave_function(const std::string& filename) {
     timer t_dump("Dump DETCI WFN");
+    if (binary_wfn_) {
+        write_wave_function_checkpoint(filename, "DETCI", state_.str(), nactv_, p_space_, *evecs_,
+                                       compress_wfn_);
+        return;
+    }
     std::ofstream file(filename);
     file << "# DETCI: " << state_.str() << '\n';
     file << p_space_.size() << " " << nroot_ << '\n';
@@ -334,6 +340,9 @@ void DETCI::dump_wave_function(const std::string& filename) {
 std::tuple<size_t, std::vector<Determinant>, std::shared_ptr<psi::Matrix>>
 DETCI::read_wave_function(const std::string& filename) {
     timer t_read("Read DETCI WFN");
+    if (is_wave_function_checkpoint(filename)) {
+        return read_wave_function_checkpoint(filename, "DETCI");
+    }
     std::string line;
     std::ifstream file(filename);
 
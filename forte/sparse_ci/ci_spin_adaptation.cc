@@ -198,10 +198,12 @@ void SpinAdapter::prepare_couplings(const std::vector<Determinant>& dets) {
     local_timer t2;
     ncsf_ = 0;
     ncoupling_ = 0;
+    conf_to_csf_bounds_.assign(1, 0);
     for (const auto& conf : confs_) {
         if (conf.count_socc() >= twoS_) {
             conf_to_csfs(conf, det_hash);
         }
+        conf_to_csf_bounds_.push_back(ncsf_);
     }
     psi::outfile->Printf("    Timing for finding the CSFs:           %10.4f\n", t2.get());
 
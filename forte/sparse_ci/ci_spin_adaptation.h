@@ -182,6 +182,15 @@ class SpinAdapter {
     /// @brief Return an iterable object for the CSFs
     CSFIterable csf(size_t n) const { return CSFIterable(*this, n); }
 
+    /// @brief Return the number of configurations
+    size_t nconf() const { return confs_.size(); }
+    /// @brief Return the n-th configuration
+    const Configuration& conf(size_t n) const { return confs_[n]; }
+    /// @brief Return the range [first, last) of the CSFs generated from the n-th configuration
+    std::pair<size_t, size_t> conf_csfs(size_t n) const {
+        return {conf_to_csf_bounds_[n], conf_to_csf_bounds_[n + 1]};
+    }
+
   private:
     /// @brief Twice the spin quantum number (2S)
     int twoS_ = 0;
@@ -201,6 +210,8 @@ class SpinAdapter {
     std::vector<std::pair<size_t, double>> csf_to_det_coeff_;
     /// @brief A vector used to store the configurations
     std::vector<Configuration> confs_;
+    /// @brief A vector with the index of the first CSF of each configuration
+    std::vector<size_t> conf_to_csf_bounds_;
 
     /// @bried A vector with the number of CSFs with a given number of unpaired electrons (N)
     std::vector<size_t> N_ncsf_;
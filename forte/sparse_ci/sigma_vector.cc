@@ -26,6 +26,8 @@
  * @END LICENSE
  */
 
+#include "psi4/libmints/vector.h"
+
 #include "helpers/string_algorithms.h"
 #include "integrals/active_space_integrals.h"
 #include "sigma_vector_dynamic.h"
@@ -34,6 +36,18 @@
 
 namespace forte {
 
+void SigmaVector::compute_sigma_block(size_t nvec, std::span<double> b, std::span<double> sigma) {
+    auto b_vec = std::make_shared<psi::Vector>("b", size_);
+    auto sigma_vec = std::make_shared<psi::Vector>("sigma", size_);
+    for (size_t k = 0; k < nvec; k++) {
+        auto b_k = b.subspan(k * size_, size_);
+        std::copy(b_k.begin(), b_k.end(), b_vec->pointer());
+        compute_sigma(sigma_vec, b_vec);
+        std::copy(sigma_vec->pointer(), sigma_vec->pointer() + size_,
+                  sigma.begin() + k * size_);
+    }
+}
+
 SigmaVectorType string_to_sigma_vector_type(std::string type) {
     //    to_upper_string(type);
     if (type == "FULL") {
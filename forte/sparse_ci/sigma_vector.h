@@ -29,6 +29,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <string>
 
 #include "sparse_ci/determinant_hashvector.h"
@@ -67,6 +68,9 @@ class SigmaVector {
 
     virtual void compute_sigma(std::shared_ptr<psi::Vector> sigma,
                                std::shared_ptr<psi::Vector> b) = 0;
+    /// Compute the sigma vectors for a block of nvec vectors stored contiguously by row in b.
+    /// The default implementation calls compute_sigma() once for each vector
+    virtual void compute_sigma_block(size_t nvec, std::span<double> b, std::span<double> sigma);
     virtual void get_diagonal(psi::Vector& diag) = 0;
     virtual void
     add_bad_roots(std::vector<std::vector<std::pair<size_t, double>>>& /*bad_states*/) {}
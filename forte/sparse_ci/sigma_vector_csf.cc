@@ -0,0 +1,311 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "psi4/psi4-dec.h"
+#include "psi4/libpsi4util/PsiOutStream.h"
+
+#include "helpers/timer.h"
+#include "integrals/active_space_integrals.h"
+#include "sparse_ci/ci_spin_adaptation.h"
+#include "sparse_ci/sigma_vector_csf.h"
+
+namespace forte {
+
+namespace {
+/// Return the occupation (0, 1, or 2) of orbital p in a configuration
+int occupation(const Configuration& conf, int p) {
+    return conf.is_docc(p) ? 2 : (conf.is_socc(p) ? 1 : 0);
+}
+
+/// Add to a set all the configurations obtained from conf by moving one electron from any
+/// occupied orbital p to any other orbital q that is not doubly occupied
+void add_single_excitations(const Configuration& conf, int norb,
+                            std::unordered_set<Configuration, Configuration::Hash>& excited) {
+    for (int p = 0; p < norb; ++p) {
+        const int np = occupation(conf, p);
+        if (np == 0)
+            continue;
+        for (int q = 0; q < norb; ++q) {
+            const int nq = occupation(conf, q);
+            if (q == p or nq == 2)
+                continue;
+            Configuration new_conf(conf);
+            new_conf.set_occ(p, np - 1);
+            new_conf.set_occ(q, nq + 1);
+            excited.insert(new_conf);
+        }
+    }
+}
+
+/// Generate all the configurations connected to conf by at most a double excitation
+void add_connected_configurations(
+    const Configuration& conf, int norb,
+    std::unordered_set<Configuration, Configuration::Hash>& singles,
+    std::unordered_set<Configuration, Configuration::Hash>& connected) {
+    singles.clear();
+    connected.clear();
+    add_single_excitations(conf, norb, singles);
+    for (const auto& single : singles) {
+        connected.insert(single);
+        add_single_excitations(single, norb, connected);
+    }
+    connected.insert(conf);
+}
+
+/// Return a map from each configuration of a spin adapter to its index
+std::unordered_map<Configuration, size_t, Configuration::Hash>
+make_conf_index(const SpinAdapter& spin_adapter) {
+    std::unordered_map<Configuration, size_t, Configuration::Hash> conf_index;
+    for (size_t n = 0, nconf = spin_adapter.nconf(); n < nconf; ++n) {
+        conf_index[spin_adapter.conf(n)] = n;
+    }
+    return conf_index;
+}
+} // namespace
+
+SigmaVectorCSF::SigmaVectorCSF(const std::vector<Determinant>& dets,
+                               std::shared_ptr<SpinAdapter> spin_adapter,
+                               std::shared_ptr<ActiveSpaceIntegrals> as_ints)
+    : ncsf_(spin_adapter->ncsf()) {
+    build_hamiltonian(dets, *spin_adapter, *as_ints);
+}
+
+size_t SigmaVectorCSF::estimate_memory(const SpinAdapter& spin_adapter, int norb) {
+    const size_t nconf = spin_adapter.nconf();
+    const auto conf_index = make_conf_index(spin_adapter);
+
+    // count the elements of the upper triangle (I <= J) of the Hamiltonian
+    size_t num_upper = 0;
+#pragma omp parallel reduction(+ : num_upper)
+    {
+        std::unordered_set<Configuration, Configuration::Hash> singles, connected;
+#pragma omp for schedule(dynamic)
+        for (size_t I = 0; I < nconf; ++I) {
+            const auto [first_I, last_I] = spin_adapter.conf_csfs(I);
+            if (first_I == last_I)
+                continue;
+            add_connected_configurations(spin_adapter.conf(I), norb, singles, connected);
+            for (const auto& conf : connected) {
+                const auto it = conf_index.find(conf);
+                if (it == conf_index.end() or it->second < I)
+                    continue;
+                const auto [first_J, last_J] = spin_adapter.conf_csfs(it->second);
+                const size_t ncsf_I = last_I - first_I;
+                const size_t ncsf_J = last_J - first_J;
+                num_upper += (it->second == I) ? ncsf_I * (ncsf_I + 1) / 2 : ncsf_I * ncsf_J;
+            }
+        }
+    }
+    // the full matrix is stored by rows (value and column index) plus the diagonal and offsets
+    const size_t ncsf = spin_adapter.ncsf();
+    const size_t num_elements = 2 * num_upper;
+    return (num_elements * (sizeof(double) + sizeof(size_t)) + ncsf * sizeof(double) +
+            (ncsf + 1) * sizeof(size_t)) /
+           sizeof(double);
+}
+
+void SigmaVectorCSF::build_hamiltonian(const std::vector<Determinant>& dets,
+                                       const SpinAdapter& spin_adapter,
+                                       const ActiveSpaceIntegrals& as_ints) {
+    local_timer t;
+    const int norb = as_ints.nmo();
+    const size_t nconf = spin_adapter.nconf();
+
+    const auto conf_index = make_conf_index(spin_adapter);
+
+    // the upper triangle of the Hamiltonian (I <= J) stored as (I, J, H_IJ) for each configuration
+    std::vector<std::vector<std::tuple<size_t, size_t, double>>> conf_elements(nconf);
+
+#pragma omp parallel
+    {
+        std::unordered_set<Configuration, Configuration::Hash> singles, connected;
+        std::vector<size_t> dets_I, dets_J;
+        std::vector<double> coeff_I, coeff_J, H_det, H_half;
+
+#pragma omp for schedule(dynamic)
+        for (size_t I = 0; I < nconf; ++I) {
+            const auto [first_I, last_I] = spin_adapter.conf_csfs(I);
+            if (first_I == last_I)
+                continue;
+
+            // collect the determinants of configuration I and the CSF coefficients
+            auto expand = [&](size_t first, size_t last, std::vector<size_t>& conf_dets,
+                              std::vector<double>& coeff) {
+                conf_dets.clear();
+                for (size_t i = first; i < last; ++i) {
+                    for (const auto& [det_idx, c] : spin_adapter.csf(i)) {
+                        if (std::find(conf_dets.begin(), conf_dets.end(), det_idx) ==
+                            conf_dets.end())
+                            conf_dets.push_back(det_idx);
+                    }
+                }
+                coeff.assign((last - first) * conf_dets.size(), 0.0);
+                for (size_t i = first; i < last; ++i) {
+                    for (const auto& [det_idx, c] : spin_adapter.csf(i)) {
+                        const size_t a =
+                            std::find(conf_dets.begin(), conf_dets.end(), det_idx) -
+                            conf_dets.begin();
+                        coeff[(i - first) * conf_dets.size() + a] = c;
+                    }
+                }
+            };
+            expand(first_I, last_I, dets_I, coeff_I);
+
+            // generate the configurations connected by single and double excitations
+            add_connected_configurations(spin_adapter.conf(I), norb, singles, connected);
+
+            for (const auto& conf : connected) {
+                const auto it = conf_index.find(conf);
+                if (it == conf_index.end() or it->second < I)
+                    continue;
+                const size_t J = it->second;
+                const auto [first_J, last_J] = spin_adapter.conf_csfs(J);
+                if (first_J == last_J)
+                    continue;
+                expand(first_J, last_J, dets_J, coeff_J);
+
+                // the Hamiltonian in the basis of the determinants of I and J
+                const size_t nI = dets_I.size();
+                const size_t nJ = dets_J.size();
+                H_det.resize(nI * nJ);
+                for (size_t a = 0; a < nI; ++a) {
+                    for (size_t b = 0; b < nJ; ++b) {
+                        H_det[a * nJ + b] = as_ints.slater_rules(dets[dets_I[a]], dets[dets_J[b]]);
+                    }
+                }
+
+                // transform to the CSF basis: H_ij = sum_ab c_ia H_ab c_jb
+                const size_t ncsf_I = last_I - first_I;
+                const size_t ncsf_J = last_J - first_J;
+                H_half.assign(ncsf_I * nJ, 0.0);
+                for (size_t i = 0; i < ncsf_I; ++i) {
+                    for (size_t a = 0; a < nI; ++a) {
+                        const double c = coeff_I[i * nI + a];
+                        if (c == 0.0)
+                            continue;
+                        for (size_t b = 0; b < nJ; ++b) {
+                            H_half[i * nJ + b] += c * H_det[a * nJ + b];
+                        }
+                    }
+                }
+                for (size_t i = 0; i < ncsf_I; ++i) {
+                    // only the upper triangle of the diagonal block is stored
+                    for (size_t j = (I == J ? i : 0); j < ncsf_J; ++j) {
+                        double value = 0.0;
+                        for (size_t b = 0; b < nJ; ++b) {
+                            value += H_half[i * nJ + b] * coeff_J[j * nJ + b];
+                        }
+                        if (std::fabs(value) > 1.0e-14 or (I == J and i == j))
+                            conf_elements[I].emplace_back(first_I + i, first_J + j, value);
+                    }
+                }
+            }
+        }
+    }
+
+    // store the full matrix by rows
+    diag_.assign(ncsf_, 0.0);
+    std::vector<size_t> row_count(ncsf_, 0);
+    for (const auto& elements : conf_elements) {
+        for (const auto& [i, j, value] : elements) {
+            row_count[i]++;
+            if (i != j)
+                row_count[j]++;
+        }
+    }
+    row_offsets_.assign(ncsf_ + 1, 0);
+    for (size_t i = 0; i < ncsf_; ++i) {
+        row_offsets_[i + 1] = row_offsets_[i] + row_count[i];
+    }
+    cols_.resize(row_offsets_[ncsf_]);
+    values_.resize(row_offsets_[ncsf_]);
+    std::vector<size_t> pos(row_offsets_.begin(), row_offsets_.end() - 1);
+    for (auto& elements : conf_elements) {
+        for (const auto& [i, j, value] : elements) {
+            cols_[pos[i]] = j;
+            values_[pos[i]++] = value;
+            if (i != j) {
+                cols_[pos[j]] = i;
+                values_[pos[j]++] = value;
+            } else {
+                diag_[i] = value;
+            }
+        }
+        std::vector<std::tuple<size_t, size_t, double>>().swap(elements);
+    }
+
+    psi::outfile->Printf("\n\n  ==> CSF Hamiltonian <==\n\n");
+    psi::outfile->Printf("    Number of configurations:              %10zu\n", nconf);
+    psi::outfile->Printf("    Number of CSFs:                        %10zu\n", ncsf_);
+    psi::outfile->Printf("    Number of nonzero elements:            %10zu\n", values_.size());
+    psi::outfile->Printf("    Memory for the Hamiltonian (MB):       %10.2f\n",
+                         static_cast<double>(values_.size() * (sizeof(double) + sizeof(size_t)) +
+                                             row_offsets_.size() * sizeof(size_t)) /
+                             (1024.0 * 1024.0));
+    psi::outfile->Printf("    Timing for building the Hamiltonian:   %10.4f\n", t.get());
+}
+
+void SigmaVectorCSF::compute_sigma_block(size_t nvec, std::span<const double> b,
+                                         std::span<double> sigma) {
+    timer timer_sigma("Build sigma block (CSF)");
+
+    // Store the vectors interleaved (b_t[J * nvec + k] = b_k[J]) so that the nvec elements that
+    // multiply each matrix element are contiguous in memory
+    std::vector<double> b_t(ncsf_ * nvec);
+    for (size_t k = 0; k < nvec; ++k) {
+        for (size_t J = 0; J < ncsf_; ++J) {
+            b_t[J * nvec + k] = b[k * ncsf_ + J];
+        }
+    }
+
+#pragma omp parallel
+    {
+        std::vector<double> sigma_I(nvec);
+#pragma omp for schedule(dynamic, 64)
+        for (size_t I = 0; I < ncsf_; ++I) {
+            std::fill(sigma_I.begin(), sigma_I.end(), 0.0);
+            for (size_t e = row_offsets_[I], end = row_offsets_[I + 1]; e < end; ++e) {
+                const double H_IJ = values_[e];
+                const double* b_J = b_t.data() + cols_[e] * nvec;
+                for (size_t k = 0; k < nvec; ++k) {
+                    sigma_I[k] += H_IJ * b_J[k];
+                }
+            }
+            for (size_t k = 0; k < nvec; ++k) {
+                sigma[k * ncsf_ + I] = sigma_I[k];
+            }
+        }
+    }
+}
+
+} // namespace forte
@@ -0,0 +1,107 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#pragma once
+
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "sparse_ci/determinant.h"
+
+namespace forte {
+
+class ActiveSpaceIntegrals;
+class SpinAdapter;
+
+/**
+ * @brief The SigmaVectorCSF class
+ * Computes the sigma vector directly in the basis of configuration state functions (CSFs).
+ *
+ * The Hamiltonian is built one pair of configurations at a time. For each configuration, the
+ * configurations connected to it by single and double (spatial orbital) excitations are generated
+ * and the block of matrix elements between their CSFs is obtained by contracting the
+ * determinant-basis block with the spin couplings stored in the SpinAdapter object. The
+ * resulting sparse matrix is stored by rows, so that the vectors handled by the eigensolver have
+ * the dimension of the CSF basis and no transformation to the determinant basis is required.
+ * Storing the matrix costs 16 bytes per nonzero element, so this is meant for CSF spaces whose
+ * Hamiltonian fits in memory. Use estimate_memory() to check this before building the matrix.
+ * Like the determinant-basis sigma vectors, the matrix does not include the nuclear repulsion and
+ * scalar energies.
+ */
+class SigmaVectorCSF {
+  public:
+    /// @brief Construct the CSF-basis Hamiltonian
+    /// @param dets the determinants (in the order used by the spin adapter)
+    /// @param spin_adapter a spin adapter object for which prepare_couplings() was called
+    /// @param as_ints the active space integrals
+    SigmaVectorCSF(const std::vector<Determinant>& dets, std::shared_ptr<SpinAdapter> spin_adapter,
+                   std::shared_ptr<ActiveSpaceIntegrals> as_ints);
+
+    /// @brief Return an upper bound to the memory (in doubles) needed to store the Hamiltonian
+    /// @param spin_adapter a spin adapter object for which prepare_couplings() was called
+    /// @param norb the number of orbitals
+    ///
+    /// The bound assumes that all the matrix elements between the CSFs of two configurations
+    /// connected by at most a double excitation are nonzero. It costs a fraction of the build,
+    /// since no matrix elements are computed.
+    static size_t estimate_memory(const SpinAdapter& spin_adapter, int norb);
+
+    /// @brief Return the number of CSFs
+    size_t size() const { return ncsf_; }
+
+    /// @brief Return the number of nonzero matrix elements stored
+    size_t num_elements() const { return values_.size(); }
+
+    /// @brief Return the diagonal of the Hamiltonian in the CSF basis
+    const std::vector<double>& diagonal() const { return diag_; }
+
+    /// @brief Compute the sigma vectors for a block of nvec vectors stored contiguously by row
+    /// @param nvec the number of vectors
+    /// @param b the vectors in the CSF basis (b[k * size() + I])
+    /// @param sigma the sigma vectors in the CSF basis (sigma[k * size() + I])
+    void compute_sigma_block(size_t nvec, std::span<const double> b, std::span<double> sigma);
+
+  private:
+    /// The number of CSFs
+    size_t ncsf_ = 0;
+    /// The diagonal of the Hamiltonian
+    std::vector<double> diag_;
+    /// The index of the first element of each row
+    std::vector<size_t> row_offsets_;
+    /// The column index of each element
+    std::vector<size_t> cols_;
+    /// The value of each element
+    std::vector<double> values_;
+
+    /// Build the Hamiltonian in the CSF basis
+    void build_hamiltonian(const std::vector<Determinant>& dets, const SpinAdapter& spin_adapter,
+                           const ActiveSpaceIntegrals& as_ints);
+};
+
+} // namespace forte
@@ -84,12 +84,6 @@ void SigmaVectorSparseList::compute_sigma(std::shared_ptr<psi::Vector> sigma,
                                           std::shared_ptr<psi::Vector> b) {
     timer timer_sigma("Build sigma");
 
-    auto a_list_ = op_->a_list_;
-    auto b_list_ = op_->b_list_;
-    auto aa_list_ = op_->aa_list_;
-    auto ab_list_ = op_->ab_list_;
-    auto bb_list_ = op_->bb_list_;
-
     sigma->zero();
 
     double* sigma_p = sigma->pointer();
@@ -118,6 +112,56 @@ void SigmaVectorSparseList::compute_sigma(std::shared_ptr<psi::Vector> sigma,
         }
     }
 
+    // a single vector is trivially interleaved
+    add_sigma_interleaved(1, b_p, sigma_p);
+}
+
+void SigmaVectorSparseList::compute_sigma_block(size_t nvec, std::span<double> b,
+                                                std::span<double> sigma) {
+    timer timer_sigma("Build sigma block");
+
+    // Store the vectors interleaved (b_t[I * nvec + k] = b_k[I]) so that the nvec elements that
+    // multiply each matrix element are contiguous in memory
+    std::vector<double> b_t(size_ * nvec);
+    for (size_t k = 0; k < nvec; ++k) {
+        for (size_t I = 0; I < size_; ++I) {
+            b_t[I * nvec + k] = b[k * size_ + I];
+        }
+    }
+
+    // Project out the bad states from each vector
+    for (const auto& bad_state : bad_states_) {
+        std::vector<double> overlap(nvec, 0.0);
+        for (const auto& [I, CI] : bad_state) {
+            for (size_t k = 0; k < nvec; ++k) {
+                overlap[k] += CI * b_t[I * nvec + k];
+            }
+        }
+        for (const auto& [I, CI] : bad_state) {
+            for (size_t k = 0; k < nvec; ++k) {
+                b_t[I * nvec + k] -= CI * overlap[k];
+            }
+        }
+    }
+
+    std::vector<double> sigma_t(size_ * nvec, 0.0);
+    add_sigma_interleaved(nvec, b_t.data(), sigma_t.data());
+
+    // Store the result back by row
+    for (size_t k = 0; k < nvec; ++k) {
+        for (size_t I = 0; I < size_; ++I) {
+            sigma[k * size_ + I] = sigma_t[I * nvec + k];
+        }
+    }
+}
+
+void SigmaVectorSparseList::add_sigma_interleaved(size_t nvec, const double* b, double* sigma) {
+    const auto& a_list = op_->a_list_;
+    const auto& b_list = op_->b_list_;
+    const auto& aa_list = op_->aa_list_;
+    const auto& ab_list = op_->ab_list_;
+    const auto& bb_list = op_->bb_list_;
+
     auto& dets = space_.wfn_hash();
 
 #pragma omp parallel
@@ -126,27 +170,31 @@ void SigmaVectorSparseList::compute_sigma(std::shared_ptr<psi::Vector> sigma,
         size_t tid = omp_get_thread_num();
 
         // Each thread gets local copy of sigma
-        std::vector<double> sigma_t(size_);
-
-        size_t bin_size = size_ / num_thread;
-        bin_size += (tid < (size_ % num_thread)) ? 1 : 0;
-        size_t start_idx =
-            (tid < (size_ % num_thread))
-                ? tid * bin_size
-                : (size_ % num_thread) * (bin_size + 1) + (tid - (size_ % num_thread)) * bin_size;
-        size_t end_idx = start_idx + bin_size;
+        std::vector<double> sigma_thread(size_ * nvec, 0.0);
+
+        // add the contribution of H_IJ to sigma_I and sigma_J for all the vectors
+        auto add_coupling = [&](size_t I, size_t J, double HIJ) {
+            double* sigma_I = &sigma_thread[I * nvec];
+            double* sigma_J = &sigma_thread[J * nvec];
+            const double* b_I = &b[I * nvec];
+            const double* b_J = &b[J * nvec];
+            for (size_t k = 0; k < nvec; ++k) {
+                sigma_I[k] += HIJ * b_J[k];
+                sigma_J[k] += HIJ * b_I[k];
+            }
+        };
 
-#pragma omp critical
-        for (size_t J = start_idx; J < end_idx; ++J) {
-            sigma_p[J] += diag_[J] * b_p[J]; // Make DDOT
+#pragma omp for
+        for (size_t J = 0; J < size_; ++J) {
+            for (size_t k = 0; k < nvec; ++k) {
+                sigma_thread[J * nvec + k] += diag_[J] * b[J * nvec + k];
+            }
         }
 
         // a singles
-        size_t end_a_idx = a_list_.size();
-        size_t start_a_idx = 0;
-        for (size_t K = start_a_idx, max_K = end_a_idx; K < max_K; ++K) {
+        for (size_t K = 0, max_K = a_list.size(); K < max_K; ++K) {
             if ((K % num_thread) == tid) {
-                const std::vector<std::pair<size_t, short>>& c_dets = a_list_[K];
+                const auto& c_dets = a_list[K];
                 size_t max_det = c_dets.size();
                 for (size_t det = 0; det < max_det; ++det) {
                     auto& detJ = c_dets[det];
@@ -157,13 +205,11 @@ void SigmaVectorSparseList::compute_sigma(std::shared_ptr<psi::Vector> sigma,
                         auto& detI = c_dets[det2];
                         const size_t q = std::abs(detI.second) - 1;
                         if (p != q) {
-                            const size_t I = detI.first;
                             double sign_q = detI.second > 0.0 ? 1.0 : -1.0;
                             const double HIJ =
                                 fci_ints_->slater_rules_single_alpha_abs(dets[J], p, q) * sign_p *
                                 sign_q;
-                            sigma_t[I] += HIJ * b_p[J];
-                            sigma_t[J] += HIJ * b_p[I];
+                            add_coupling(detI.first, J, HIJ);
                         }
                     }
                 }
@@ -171,12 +217,9 @@ void SigmaVectorSparseList::compute_sigma(std::shared_ptr<psi::Vector> sigma,
         }
 
         // b singles
-        size_t end_b_idx = b_list_.size();
-        size_t start_b_idx = 0;
-        for (size_t K = start_b_idx, max_K = end_b_idx; K < max_K; ++K) {
-            // aa singles
+        for (size_t K = 0, max_K = b_list.size(); K < max_K; ++K) {
             if ((K % num_thread) == tid) {
-                const std::vector<std::pair<size_t, short>>& c_dets = b_list_[K];
+                const auto& c_dets = b_list[K];
                 size_t max_det = c_dets.size();
                 for (size_t det = 0; det < max_det; ++det) {
                     auto& detJ = c_dets[det];
@@ -187,13 +230,11 @@ void SigmaVectorSparseList::compute_sigma(std::shared_ptr<psi::Vector> sigma,
                         auto& detI = c_dets[det2];
                         const size_t q = std::abs(detI.second) - 1;
                         if (p != q) {
-                            const size_t I = detI.first;
                             double sign_q = detI.second > 0.0 ? 1.0 : -1.0;
                             const double HIJ =
                                 fci_ints_->slater_rules_single_beta_abs(dets[J], p, q) * sign_p *
                                 sign_q;
-                            sigma_t[I] += HIJ * b_p[J];
-                            sigma_t[J] += HIJ * b_p[I];
+                            add_coupling(detI.first, J, HIJ);
                         }
                     }
                 }
@@ -201,17 +242,9 @@ void SigmaVectorSparseList::compute_sigma(std::shared_ptr<psi::Vector> sigma,
         }
 
         // AA doubles
-        size_t aa_size = aa_list_.size();
-        //      size_t bin_aa_size = aa_size / num_thread;
-        //      bin_aa_size += (tid < (aa_size % num_thread)) ? 1 : 0;
-        //      size_t start_aa_idx = (tid < (aa_size % num_thread))
-        //                             ? tid * bin_aa_size
-        //                             : (aa_size % num_thread) * (bin_aa_size + 1) +
-        //                                   (tid - (aa_size % num_thread)) * bin_aa_size;
-        //      size_t end_aa_idx = start_aa_idx + bin_aa_size;
-        for (size_t K = 0, max_K = aa_size; K < max_K; ++K) {
+        for (size_t K = 0, max_K = aa_list.size(); K < max_K; ++K) {
             if ((K % num_thread) == tid) {
-                const std::vector<std::tuple<size_t, short, short>>& c_dets = aa_list_[K];
+                const auto& c_dets = aa_list[K];
                 size_t max_det = c_dets.size();
                 for (size_t det = 0; det < max_det; ++det) {
                     auto& detJ = c_dets[det];
@@ -224,11 +257,9 @@ void SigmaVectorSparseList::compute_sigma(std::shared_ptr<psi::Vector> sigma,
                         short r = std::abs(std::get<1>(detI)) - 1;
                         short s = std::get<2>(detI);
                         if ((p != r) and (q != s) and (p != s) and (q != r)) {
-                            size_t I = std::get<0>(detI);
                             double sign_q = std::get<1>(detI) > 0.0 ? 1.0 : -1.0;
                             double HIJ = sign_p * sign_q * fci_ints_->tei_aa(p, q, r, s);
-                            sigma_t[I] += HIJ * b_p[J];
-                            sigma_t[J] += HIJ * b_p[I];
+                            add_coupling(std::get<0>(detI), J, HIJ);
                         }
                     }
                 }
@@ -236,9 +267,9 @@ void SigmaVectorSparseList::compute_sigma(std::shared_ptr<psi::Vector> sigma,
         }
 
         // BB doubles
-        for (size_t K = 0, max_K = bb_list_.size(); K < max_K; ++K) {
+        for (size_t K = 0, max_K = bb_list.size(); K < max_K; ++K) {
             if ((K % num_thread) == tid) {
-                const std::vector<std::tuple<size_t, short, short>>& c_dets = bb_list_[K];
+                const auto& c_dets = bb_list[K];
                 size_t max_det = c_dets.size();
                 for (size_t det = 0; det < max_det; ++det) {
                     auto& detJ = c_dets[det];
@@ -251,22 +282,22 @@ void SigmaVectorSparseList::compute_sigma(std::shared_ptr<psi::Vector> sigma,
                         short r = std::abs(std::get<1>(detI)) - 1;
                         short s = std::get<2>(detI);
                         if ((p != r) and (q != s) and (p != s) and (q != r)) {
-                            size_t I = std::get<0>(detI);
                             double sign_q = std::get<1>(detI) > 0.0 ? 1.0 : -1.0;
                             double HIJ = sign_p * sign_q * fci_ints_->tei_bb(p, q, r, s);
-                            sigma_t[I] += HIJ * b_p[J];
-                            sigma_t[J] += HIJ * b_p[I];
+                            add_coupling(std::get<0>(detI), J, HIJ);
                         }
                     }
                 }
             }
         }
-        for (size_t K = 0, max_K = ab_list_.size(); K < max_K; ++K) {
+
+        // AB doubles
+        for (size_t K = 0, max_K = ab_list.size(); K < max_K; ++K) {
             if ((K % num_thread) == tid) {
-                const std::vector<std::tuple<size_t, short, short>>& c_dets = ab_list_[K];
+                const auto& c_dets = ab_list[K];
                 size_t max_det = c_dets.size();
                 for (size_t det = 0; det < max_det; ++det) {
-                    auto detJ = c_dets[det];
+                    auto& detJ = c_dets[det];
                     size_t J = std::get<0>(detJ);
                     short p = std::abs(std::get<1>(detJ)) - 1;
                     short q = std::get<2>(detJ);
@@ -276,11 +307,9 @@ void SigmaVectorSparseList::compute_sigma(std::shared_ptr<psi::Vector> sigma,
                         short r = std::abs(std::get<1>(detI)) - 1;
                         short s = std::get<2>(detI);
                         if ((p != r) and (q != s)) {
-                            size_t I = std::get<0>(detI);
                             double sign_q = std::get<1>(detI) > 0.0 ? 1.0 : -1.0;
                             double HIJ = sign_p * sign_q * fci_ints_->tei_ab(p, q, r, s);
-                            sigma_t[I] += HIJ * b_p[J];
-                            sigma_t[J] += HIJ * b_p[I];
+                            add_coupling(std::get<0>(detI), J, HIJ);
                         }
                     }
                 }
@@ -288,9 +317,8 @@ void SigmaVectorSparseList::compute_sigma(std::shared_ptr<psi::Vector> sigma,
         }
 
 #pragma omp critical
-        for (size_t I = 0; I < size_; ++I) {
-            // #pragma omp atomic update
-            sigma_p[I] += sigma_t[I];
+        for (size_t n = 0, max_n = size_ * nvec; n < max_n; ++n) {
+            sigma[n] += sigma_thread[n];
         }
     }
 }
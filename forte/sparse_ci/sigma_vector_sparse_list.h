@@ -46,6 +46,9 @@ class SigmaVectorSparseList : public SigmaVector {
                           std::shared_ptr<ActiveSpaceIntegrals> fci_ints);
 
     void compute_sigma(std::shared_ptr<psi::Vector> sigma, std::shared_ptr<psi::Vector> b) override;
+    /// Compute the sigma vectors for a block of vectors. Each matrix element is computed once
+    /// and applied to all the vectors in the block
+    void compute_sigma_block(size_t nvec, std::span<double> b, std::span<double> sigma) override;
     void get_diagonal(psi::Vector& diag) override;
     void add_bad_roots(std::vector<std::vector<std::pair<size_t, double>>>& bad_states_) override;
     double compute_spin(const std::vector<double>& c) override;
@@ -81,6 +84,10 @@ class SigmaVectorSparseList : public SigmaVector {
     /// Substitutions lists
     std::shared_ptr<DeterminantSubstitutionLists> op_;
 
+    /// Add H b to sigma for nvec vectors stored interleaved (b[I * nvec + k] = b_k[I]). This is
+    /// the loop shared by compute_sigma (nvec = 1) and compute_sigma_block
+    void add_sigma_interleaved(size_t nvec, const double* b, double* sigma);
+
     /// Compute the contribution to sigma due to 1-body operator
     /// sigma_{I} <- factor * sum_{pq} h_{pq} sum_{J} b_{J} <I|p^+ q|J>
     /// h_{pq} = h1[p * nactv + q]
@@ -37,6 +37,7 @@
 
 #include "base_classes/forte_options.h"
 
+#include "helpers/eigen_solver.h"
 #include "helpers/davidson_liu_solver.h"
 #include "helpers/timer.h"
 #include "helpers/printing.h"
@@ -44,6 +45,7 @@
 #include "helpers/determinant_helpers.h"
 
 #include "ci_spin_adaptation.h"
+#include "sigma_vector_csf.h"
 #include "sigma_vector_dynamic.h"
 #include "determinant_functions.hpp"
 #include "sparse_initial_guess.h"
@@ -78,6 +80,12 @@ void SparseCISolver::set_collapse_per_root(int value) { collapse_per_root_ = val
 
 void SparseCISolver::set_subspace_per_root(int value) { subspace_per_root_ = value; }
 
+void SparseCISolver::set_eigen_solver(const std::string& value) { eigen_solver_ = value; }
+
+void SparseCISolver::set_sigma_block_size(int value) { sigma_block_size_ = value; }
+
+void SparseCISolver::set_mixed_precision(bool value) { mixed_precision_ = value; }
+
 void SparseCISolver::set_spin_project_full(bool value) { spin_project_full_ = value; }
 
 void SparseCISolver::set_spin_adapt(bool value) { spin_adapt_ = value; }
@@ -88,6 +96,10 @@ void SparseCISolver::set_spin_adapt_full_preconditioner(bool value) {
     spin_adapt_full_preconditioner_ = value;
 }
 
+void SparseCISolver::set_spin_adapt_csf_sigma(bool value) { spin_adapt_csf_sigma_ = value; }
+
+void SparseCISolver::set_sigma_max_memory(size_t value) { sigma_max_memory_ = value; }
+
 void SparseCISolver::set_force_diag(bool value) { force_diag_ = value; }
 
 void SparseCISolver::add_bad_states(std::vector<std::vector<std::pair<size_t, double>>>& roots) {
@@ -109,7 +121,10 @@ void SparseCISolver::set_options(std::shared_ptr<ForteOptions> options) {
     set_ndets_per_guess_state(options->get_int("DL_DETS_PER_GUESS"));
     set_collapse_per_root(options->get_int("DL_COLLAPSE_PER_ROOT"));
     set_subspace_per_root(options->get_int("DL_SUBSPACE_PER_ROOT"));
+    set_eigen_solver(options->get_str("CI_EIGENSOLVER"));
     set_maxiter_davidson(options->get_int("DL_MAXITER"));
+    set_sigma_block_size(options->get_int("DL_SIGMA_BLOCK_SIZE"));
+    set_mixed_precision(options->get_bool("DL_MIXED_PRECISION"));
 
     set_spin_project(options->get_bool("SCI_PROJECT_OUT_SPIN_CONTAMINANTS"));
     set_spin_project_full(options->get_bool("SCI_PROJECT_OUT_SPIN_CONTAMINANTS"));
@@ -118,6 +133,8 @@ void SparseCISolver::set_options(std::shared_ptr<ForteOptions> options) {
 
     set_spin_adapt(options->get_bool("CI_SPIN_ADAPT"));
     set_spin_adapt_full_preconditioner(options->get_bool("CI_SPIN_ADAPT_FULL_PRECONDITIONER"));
+    set_spin_adapt_csf_sigma(options->get_bool("CI_SPIN_ADAPT_CSF_SIGMA"));
+    set_sigma_max_memory(options->get_int("SIGMA_VECTOR_MAX_MEMORY"));
 }
 
 void SparseCISolver::set_initial_guess(
@@ -486,14 +503,30 @@ bool SparseCISolver::davidson_liu_solver(const DeterminantHashVec& space,
         spin_adapter_->prepare_couplings(dets_);
     }
 
+    // Optionally build the Hamiltonian in the CSF basis if it fits in memory
+    std::shared_ptr<SigmaVectorCSF> csf_sigma_vector;
+    if (spin_adapt_ and spin_adapt_csf_sigma_) {
+        const auto nmo = sigma_vector->as_ints()->nmo();
+        const size_t csf_memory = SigmaVectorCSF::estimate_memory(*spin_adapter_, nmo);
+        if (csf_memory <= sigma_max_memory_) {
+            csf_sigma_vector =
+                std::make_shared<SigmaVectorCSF>(dets_, spin_adapter_, sigma_vector->as_ints());
+        } else {
+            outfile->Printf("\n\n  The CSF Hamiltonian would need up to %zu doubles "
+                            "(SIGMA_VECTOR_MAX_MEMORY = %zu).\n  The sigma vectors will be "
+                            "computed in the determinant basis.",
+                            csf_memory, sigma_max_memory_);
+        }
+    }
+
     // Compute the size of the determinant space and the basis used by the Davidson solver
     size_t fci_size = sigma_vector->size();
     size_t basis_size = spin_adapt_ ? spin_adapter_->ncsf() : fci_size;
 
     // if the DL solver is not allocated or if the basis size changed create a new one
     if ((dl_solver_ == nullptr) or (dl_solver_->size() != basis_size)) {
-        dl_solver_ = std::make_shared<DavidsonLiuSolver>(basis_size, nroot, collapse_per_root_,
-                                                         subspace_per_root_);
+        dl_solver_ = make_eigen_solver(string_to_eigen_solver_type(eigen_solver_), basis_size,
+                                       nroot, collapse_per_root_, subspace_per_root_);
         dl_solver_->set_e_convergence(e_convergence_);
         dl_solver_->set_r_convergence(r_convergence_);
         dl_solver_->set_print_level(print_);
@@ -501,6 +534,10 @@ bool SparseCISolver::davidson_liu_solver(const DeterminantHashVec& space,
     } else {
         dl_solver_->reset();
     }
+    dl_solver_->set_sigma_block_size(sigma_block_size_);
+    if (auto dl_solver = std::dynamic_pointer_cast<DavidsonLiuSolver>(dl_solver_)) {
+        dl_solver->set_mixed_precision(mixed_precision_);
+    }
 
     // allocate vectors
     auto b = std::make_shared<psi::Vector>("b", fci_size);
@@ -519,7 +556,16 @@ bool SparseCISolver::davidson_liu_solver(const DeterminantHashVec& space,
 
     // Form the diagonal of the Hamiltonian and the initial guess
     if (spin_adapt_) {
-        auto Hdiag_vec = form_Hdiag_csf(sigma_vector->as_ints(), spin_adapter_);
+        std::shared_ptr<psi::Vector> Hdiag_vec;
+        if (csf_sigma_vector) {
+            // the exact diagonal is available from the CSF Hamiltonian
+            Hdiag_vec = std::make_shared<psi::Vector>(basis_size);
+            for (size_t I = 0; I < basis_size; ++I) {
+                Hdiag_vec->set(I, csf_sigma_vector->diagonal()[I]);
+            }
+        } else {
+            Hdiag_vec = form_Hdiag_csf(sigma_vector->as_ints(), spin_adapter_);
+        }
         dl_solver_->add_h_diag(Hdiag_vec);
         auto guesses = initial_guess_csf(Hdiag_vec, num_guess_states, multiplicity);
         dl_solver_->add_guesses(guesses);
@@ -532,30 +578,49 @@ bool SparseCISolver::davidson_liu_solver(const DeterminantHashVec& space,
         dl_solver_->add_project_out_vectors(bad_roots);
     }
 
-    // Setup the sigma builder
-    auto sigma_builder = [this, &b_basis, &b, &sigma, &sigma_basis,
-                          &sigma_vector](std::span<double> b_span, std::span<double> sigma_span) {
-        // copy the b vector
-        size_t basis_size = b_span.size();
-        for (size_t I = 0; I < basis_size; ++I) {
-            b_basis->set(I, b_span[I]);
+    // Setup the block sigma builder. The determinant-basis vectors of the whole block are passed
+    // to the sigma vector object at once, so that algorithms that support it can reuse the
+    // matrix elements for all the vectors in the block
+    std::vector<double> b_block_det, sigma_block_det;
+    auto sigma_builder = [this, &b_basis, &b, &sigma, &sigma_basis, &b_block_det, &sigma_block_det,
+                          &sigma_vector, &csf_sigma_vector,
+                          fci_size](size_t nvec, std::span<double> b_span,
+                                    std::span<double> sigma_span) {
+        if (not spin_adapt_) {
+            // Compute sigma in the determinant basis
+            sigma_vector->compute_sigma_block(nvec, b_span, sigma_span);
+            return;
         }
-        if (spin_adapt_) {
-            // Compute sigma in the CSF basis and convert it to the determinant basis
+        if (csf_sigma_vector) {
+            // Compute sigma directly in the CSF basis
+            csf_sigma_vector->compute_sigma_block(nvec, b_span, sigma_span);
+            return;
+        }
+        // Convert the block from the CSF basis to the determinant basis
+        size_t basis_size = b_span.size() / nvec;
+        b_block_det.resize(nvec * fci_size);
+        sigma_block_det.resize(nvec * fci_size);
+        for (size_t k = 0; k < nvec; ++k) {
+            for (size_t I = 0; I < basis_size; ++I) {
+                b_basis->set(I, b_span[k * basis_size + I]);
+            }
             spin_adapter_->csf_C_to_det_C(b_basis, b);
-            sigma_vector->compute_sigma(sigma, b);
-            spin_adapter_->det_C_to_csf_C(sigma, sigma_basis);
-        } else {
-            // Compute sigma in the determinant basis
-            sigma_vector->compute_sigma(sigma_basis, b_basis);
+            std::copy(b->pointer(), b->pointer() + fci_size, b_block_det.begin() + k * fci_size);
         }
-        for (size_t I = 0; I < basis_size; ++I) {
-            sigma_span[I] = sigma_basis->get(I);
+        sigma_vector->compute_sigma_block(nvec, b_block_det, sigma_block_det);
+        // Convert sigma back to the CSF basis
+        for (size_t k = 0; k < nvec; ++k) {
+            std::copy(sigma_block_det.begin() + k * fci_size,
+                      sigma_block_det.begin() + (k + 1) * fci_size, sigma->pointer());
+            spin_adapter_->det_C_to_csf_C(sigma, sigma_basis);
+            for (size_t I = 0; I < basis_size; ++I) {
+                sigma_span[k * basis_size + I] = sigma_basis->get(I);
+            }
         }
     };
 
     // Run the Davidson-Liu solver
-    dl_solver_->add_sigma_builder(sigma_builder);
+    dl_solver_->add_block_sigma_builder(sigma_builder);
     auto converged = dl_solver_->solve();
     if (not converged) {
         throw std::runtime_error(
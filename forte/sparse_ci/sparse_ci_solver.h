@@ -42,7 +42,7 @@ namespace forte {
 class SigmaVector;
 class ActiveSpaceIntegrals;
 class SpinAdapter;
-class DavidsonLiuSolver;
+class EigenSolver;
 class ForteOptions;
 
 /**
@@ -106,6 +106,12 @@ class SparseCISolver {
     /// Spin adapt the wave function using a full preconditioner?
     void set_spin_adapt_full_preconditioner(bool value);
 
+    /// Build the sigma vectors directly in the CSF basis when spin adapting?
+    void set_spin_adapt_csf_sigma(bool value);
+
+    /// Set the maximum memory (in doubles) used to store the Hamiltonian in the CSF basis
+    void set_sigma_max_memory(size_t value);
+
     /// Enable/disable root projection
     void set_root_project(bool value);
 
@@ -127,6 +133,15 @@ class SparseCISolver {
     /// Set the maximum subspace size for each root
     void set_subspace_per_root(int value);
 
+    /// Set the eigensolver used to diagonalize the Hamiltonian ("DL", "LOBPCG", or "LANCZOS")
+    void set_eigen_solver(const std::string& value);
+
+    /// Set the maximum number of vectors passed to the sigma builder in one call (0 = no limit)
+    void set_sigma_block_size(int value);
+
+    /// Store the Davidson-Liu subspace in single precision?
+    void set_mixed_precision(bool value);
+
     /// Set the options
     void set_options(std::shared_ptr<ForteOptions> options);
 
@@ -193,8 +208,8 @@ class SparseCISolver {
     std::vector<double> spin_;
     /// A object that handles spin adaptation
     std::shared_ptr<SpinAdapter> spin_adapter_;
-    /// The Davidson-Liu-Solver object
-    std::shared_ptr<DavidsonLiuSolver> dl_solver_;
+    /// The eigensolver object (Davidson-Liu, LOBPCG, or Lanczos)
+    std::shared_ptr<EigenSolver> dl_solver_;
     /// Use a OMP parallel algorithm?
     bool parallel_ = false;
     /// Print details?
@@ -210,6 +225,11 @@ class SparseCISolver {
     /// Use the full preconditioner for spin adaptation?
     /// When set to false, it uses an approximate diagonal preconditioner
     bool spin_adapt_full_preconditioner_ = false;
+    /// Build the sigma vectors directly in the CSF basis (see SigmaVectorCSF)?
+    bool spin_adapt_csf_sigma_ = false;
+    /// The maximum memory (in doubles) used to store the Hamiltonian in the CSF basis. If the
+    /// estimated memory is larger, the sigma vectors are computed in the determinant basis
+    size_t sigma_max_memory_ = 67108864;
     /// Project solutions onto given root?
     bool root_project_ = false;
     /// The energy convergence threshold
@@ -224,8 +244,14 @@ class SparseCISolver {
     size_t collapse_per_root_ = 2;
     /// Number of max subspace vectors per roots
     size_t subspace_per_root_ = 4;
+    /// The eigensolver used to diagonalize the Hamiltonian
+    std::string eigen_solver_ = "DL";
     /// Maximum number of iterations in the Davidson-Liu algorithm
     int maxiter_davidson_ = 100;
+    /// Maximum number of vectors passed to the sigma builder in one call (0 = no limit)
+    size_t sigma_block_size_ = 0;
+    /// Store the Davidson-Liu subspace in single precision?
+    bool mixed_precision_ = false;
     /// Options for forcing diagonalization method
     bool force_diag_ = false;
     /// Additional roots to project out
@@ -63,6 +63,8 @@ void SparseHamiltonian::compute_new_couplings(const std::vector<Determinant>& ne
     auto symm = as_ints_->active_mo_symmetry();
 
     Determinant new_det;
+    // the single-excitation matrix elements of a determinant
+    std::vector<double> singles;
 
     // contribution to the diagonal elements
     double E_0 = as_ints_->nuclear_repulsion_energy() + as_ints_->scalar_energy();
@@ -87,10 +89,12 @@ void SparseHamiltonian::compute_new_couplings(const std::vector<Determinant>& ne
         size_t nvbeta = bvir.size();
 
         // aa singles
-        for (size_t i : aocc) {
+        as_ints_->slater_rules_single_alpha_batch(aocc, bocc, singles);
+        for (size_t ii = 0; ii < noalpha; ++ii) {
+            size_t i = aocc[ii];
             for (size_t a : avir) {
                 if ((symm[i] ^ symm[a]) == 0) {
-                    double DHIJ = as_ints_->slater_rules_single_alpha(det, i, a);
+                    double DHIJ = det.slater_sign_aa(i, a) * singles[ii * nmo + a];
                     if (std::abs(DHIJ) >= screen_thresh) {
                         new_det = det;
                         new_det.set_alfa_bit(i, false);
@@ -102,10 +106,12 @@ void SparseHamiltonian::compute_new_couplings(const std::vector<Determinant>& ne
             }
         }
         // bb singles
-        for (size_t i : bocc) {
+        as_ints_->slater_rules_single_beta_batch(aocc, bocc, singles);
+        for (size_t ii = 0; ii < nobeta; ++ii) {
+            size_t i = bocc[ii];
             for (size_t a : bvir) {
                 if ((symm[i] ^ symm[a]) == 0) {
-                    double DHIJ = as_ints_->slater_rules_single_beta(det, i, a);
+                    double DHIJ = det.slater_sign_bb(i, a) * singles[ii * nmo + a];
                     if (std::abs(DHIJ) >= screen_thresh) {
                         new_det = det;
                         new_det.set_beta_bit(i, false);
@@ -121,6 +127,8 @@ void SparseHamiltonian::compute_new_couplings(const std::vector<Determinant>& ne
             size_t i = aocc[ii];
             for (size_t jj = ii + 1; jj < noalpha; ++jj) {
                 size_t j = aocc[jj];
+                if (as_ints_->max_double_coupling_aa(i, j) < screen_thresh)
+                    continue;
                 for (size_t aa = 0; aa < nvalpha; ++aa) {
                     size_t a = avir[aa];
                     for (size_t bb = aa + 1; bb < nvalpha; ++bb) {
@@ -141,6 +149,8 @@ void SparseHamiltonian::compute_new_couplings(const std::vector<Determinant>& ne
         // Generate ab excitations
         for (size_t i : aocc) {
             for (size_t j : bocc) {
+                if (as_ints_->max_double_coupling_ab(i, j) < screen_thresh)
+                    continue;
                 for (size_t a : avir) {
                     for (size_t b : bvir) {
                         if ((symm[i] ^ symm[j] ^ symm[a] ^ symm[b]) == 0) {
@@ -161,6 +171,8 @@ void SparseHamiltonian::compute_new_couplings(const std::vector<Determinant>& ne
             size_t i = bocc[ii];
             for (size_t jj = ii + 1; jj < nobeta; ++jj) {
                 size_t j = bocc[jj];
+                if (as_ints_->max_double_coupling_bb(i, j) < screen_thresh)
+                    continue;
                 for (size_t aa = 0; aa < nvbeta; ++aa) {
                     size_t a = bvir[aa];
                     for (size_t bb = aa + 1; bb < nvbeta; ++bb) {
@@ -231,6 +243,8 @@ SparseState SparseHamiltonian::compute_on_the_fly(const SparseState& state, doub
     auto symm = as_ints_->active_mo_symmetry();
 
     Determinant new_det;
+    // the single-excitation matrix elements of a determinant
+    std::vector<double> singles;
 
     for (const auto& [det, c] : state) {
         std::vector<int> aocc = det.get_alfa_occ(nmo);
@@ -247,10 +261,12 @@ SparseState SparseHamiltonian::compute_on_the_fly(const SparseState& state, doub
 
         sigma[det] += (E_0 + as_ints_->slater_rules(det, det)) * c;
         // aa singles
-        for (size_t i : aocc) {
+        as_ints_->slater_rules_single_alpha_batch(aocc, bocc, singles);
+        for (size_t ii = 0; ii < noalpha; ++ii) {
+            size_t i = aocc[ii];
             for (size_t a : avir) {
                 if ((symm[i] ^ symm[a]) == 0) {
-                    double DHIJ = as_ints_->slater_rules_single_alpha(det, i, a);
+                    double DHIJ = det.slater_sign_aa(i, a) * singles[ii * nmo + a];
                     if (std::abs(DHIJ * c) >= screen_thresh) {
                         new_det = det;
                         new_det.set_alfa_bit(i, false);
@@ -261,10 +277,12 @@ SparseState SparseHamiltonian::compute_on_the_fly(const SparseState& state, doub
             }
         }
         // bb singles
-        for (size_t i : bocc) {
+        as_ints_->slater_rules_single_beta_batch(aocc, bocc, singles);
+        for (size_t ii = 0; ii < nobeta; ++ii) {
+            size_t i = bocc[ii];
             for (size_t a : bvir) {
                 if ((symm[i] ^ symm[a]) == 0) {
-                    double DHIJ = as_ints_->slater_rules_single_beta(det, i, a);
+                    double DHIJ = det.slater_sign_bb(i, a) * singles[ii * nmo + a];
                     if (std::abs(DHIJ * c) >= screen_thresh) {
                         new_det = det;
                         new_det.set_beta_bit(i, false);
@@ -279,6 +297,8 @@ SparseState SparseHamiltonian::compute_on_the_fly(const SparseState& state, doub
             size_t i = aocc[ii];
             for (size_t jj = ii + 1; jj < noalpha; ++jj) {
                 size_t j = aocc[jj];
+                if (as_ints_->max_double_coupling_aa(i, j) * std::abs(c) < screen_thresh)
+                    continue;
                 for (size_t aa = 0; aa < nvalpha; ++aa) {
                     size_t a = avir[aa];
                     for (size_t bb = aa + 1; bb < nvalpha; ++bb) {
@@ -298,6 +318,8 @@ SparseState SparseHamiltonian::compute_on_the_fly(const SparseState& state, doub
         // Generate ab excitations
         for (size_t i : aocc) {
             for (size_t j : bocc) {
+                if (as_ints_->max_double_coupling_ab(i, j) * std::abs(c) < screen_thresh)
+                    continue;
                 for (size_t a : avir) {
                     for (size_t b : bvir) {
                         if ((symm[i] ^ symm[j] ^ symm[a] ^ symm[b]) == 0) {
@@ -317,6 +339,8 @@ SparseState SparseHamiltonian::compute_on_the_fly(const SparseState& state, doub
             size_t i = bocc[ii];
             for (size_t jj = ii + 1; jj < nobeta; ++jj) {
                 size_t j = bocc[jj];
+                if (as_ints_->max_double_coupling_bb(i, j) * std::abs(c) < screen_thresh)
+                    continue;
                 for (size_t aa = 0; aa < nvbeta; ++aa) {
                     size_t a = bvir[aa];
                     for (size_t bb = aa + 1; bb < nvbeta; ++bb) {
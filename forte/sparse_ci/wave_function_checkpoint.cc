@@ -0,0 +1,324 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp_get_max_threads() 1
+#endif
+
+#include "psi4/libmints/matrix.h"
+
+#include "helpers/mapped_file.h"
+#include "sparse_ci/determinant_hashvector.h"
+#include "sparse_ci/wave_function_checkpoint.h"
+
+namespace forte {
+
+namespace {
+
+constexpr char checkpoint_magic[8] = {'F', 'O', 'R', 'T', 'E', 'W', 'F', 'N'};
+constexpr uint32_t checkpoint_version = 1;
+constexpr uint32_t checkpoint_compressed = 1;
+constexpr size_t checkpoint_chunk_size = 65536;
+constexpr size_t checkpoint_method_size = 16;
+
+struct CheckpointHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    char method[checkpoint_method_size];
+    uint64_t norbs;
+    uint64_t ndets;
+    uint64_t nroots;
+    uint64_t nwords;
+    uint64_t chunk_size;
+    uint64_t state_size;
+    uint64_t table_offset;
+};
+
+struct CheckpointChunk {
+    uint64_t offset;
+    uint64_t stored_size;
+    uint64_t raw_size;
+};
+
+/// Pack the determinants and coefficients of one chunk and compress the result if requested
+std::vector<char> pack_chunk(const DeterminantHashVec& dets, const psi::Matrix& evecs,
+                             size_t first, size_t last, bool compress) {
+    const size_t n = last - first;
+    const size_t nroots = evecs.coldim();
+    std::vector<char> raw(n * (Determinant::nwords_ * sizeof(uint64_t) + nroots * sizeof(double)));
+
+    char* ptr = raw.data();
+    for (size_t I = first; I < last; ++I) {
+        const auto& det = dets.get_det(I);
+        for (size_t k = 0; k < Determinant::nwords_; ++k) {
+            const uint64_t word = det.get_word(k);
+            std::memcpy(ptr, &word, sizeof(uint64_t));
+            ptr += sizeof(uint64_t);
+        }
+    }
+    for (size_t r = 0; r < nroots; ++r) {
+        for (size_t I = first; I < last; ++I) {
+            const double c = evecs.get(I, r);
+            std::memcpy(ptr, &c, sizeof(double));
+            ptr += sizeof(double);
+        }
+    }
+
+#ifdef HAVE_ZLIB
+    if (compress) {
+        uLongf stored_size = compressBound(raw.size());
+        std::vector<char> stored(stored_size);
+        if (compress2(reinterpret_cast<Bytef*>(stored.data()), &stored_size,
+                      reinterpret_cast<const Bytef*>(raw.data()), raw.size(),
+                      Z_BEST_SPEED) != Z_OK) {
+            throw std::runtime_error("write_wave_function_checkpoint: compression failed");
+        }
+        stored.resize(stored_size);
+        return stored;
+    }
+#else
+    (void)compress;
+#endif
+    return raw;
+}
+
+} // namespace
+
+void write_wave_function_checkpoint(const std::string& filename, const std::string& method,
+                                    const std::string& state, size_t norbs,
+                                    const DeterminantHashVec& dets, const psi::Matrix& evecs,
+                                    bool compress) {
+#ifndef HAVE_ZLIB
+    compress = false;
+#endif
+    const size_t ndets = dets.size();
+    const size_t nroots = evecs.coldim();
+    if (static_cast<size_t>(evecs.rowdim()) != ndets) {
+        throw std::runtime_error("write_wave_function_checkpoint: the number of rows of the CI "
+                                 "coefficients does not match the number of determinants");
+    }
+    if (method.size() > checkpoint_method_size) {
+        throw std::runtime_error("write_wave_function_checkpoint: method label too long");
+    }
+
+    CheckpointHeader header{};
+    std::memcpy(header.magic, checkpoint_magic, sizeof(checkpoint_magic));
+    header.version = checkpoint_version;
+    header.flags = compress ? checkpoint_compressed : 0;
+    std::memcpy(header.method, method.data(), method.size());
+    header.norbs = norbs;
+    header.ndets = ndets;
+    header.nroots = nroots;
+    header.nwords = Determinant::nwords_;
+    header.chunk_size = checkpoint_chunk_size;
+    header.state_size = state.size();
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (not file.is_open()) {
+        throw std::runtime_error("write_wave_function_checkpoint: cannot open " + filename);
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(CheckpointHeader));
+    file.write(state.data(), state.size());
+
+    // pack one batch of chunks in parallel and write it before moving to the next batch, so that
+    // at most one batch of packed data is kept in memory
+    const size_t nchunks = (ndets + checkpoint_chunk_size - 1) / checkpoint_chunk_size;
+    const size_t batch_size = static_cast<size_t>(omp_get_max_threads());
+    std::vector<CheckpointChunk> table(nchunks);
+    std::vector<std::vector<char>> batch(batch_size);
+    for (size_t batch_start = 0; batch_start < nchunks; batch_start += batch_size) {
+        const size_t batch_end = std::min(batch_start + batch_size, nchunks);
+#pragma omp parallel for schedule(dynamic)
+        for (size_t c = batch_start; c < batch_end; ++c) {
+            const size_t first = c * checkpoint_chunk_size;
+            const size_t last = std::min(first + checkpoint_chunk_size, ndets);
+            batch[c - batch_start] = pack_chunk(dets, evecs, first, last, compress);
+        }
+        for (size_t c = batch_start; c < batch_end; ++c) {
+            const auto& stored = batch[c - batch_start];
+            const size_t n = std::min(checkpoint_chunk_size, ndets - c * checkpoint_chunk_size);
+            table[c].offset = static_cast<uint64_t>(file.tellp());
+            table[c].stored_size = stored.size();
+            table[c].raw_size =
+                n * (Determinant::nwords_ * sizeof(uint64_t) + nroots * sizeof(double));
+            file.write(stored.data(), stored.size());
+        }
+    }
+
+    header.table_offset = static_cast<uint64_t>(file.tellp());
+    file.write(reinterpret_cast<const char*>(table.data()), nchunks * sizeof(CheckpointChunk));
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(CheckpointHeader));
+    file.close();
+    if (file.fail()) {
+        throw std::runtime_error("write_wave_function_checkpoint: failed to write " + filename);
+    }
+}
+
+std::tuple<size_t, std::vector<Determinant>, std::shared_ptr<psi::Matrix>>
+read_wave_function_checkpoint(const std::string& filename, const std::string& method) {
+    MappedFile file(filename, "read_wave_function_checkpoint");
+    const char* data = file.data();
+
+    CheckpointHeader header;
+    if (file.size() < sizeof(CheckpointHeader)) {
+        throw std::runtime_error("read_wave_function_checkpoint: " + filename +
+                                 " is not a wave function checkpoint");
+    }
+    std::memcpy(&header, data, sizeof(CheckpointHeader));
+    if (std::memcmp(header.magic, checkpoint_magic, sizeof(checkpoint_magic)) != 0) {
+        throw std::runtime_error("read_wave_function_checkpoint: " + filename +
+                                 " is not a wave function checkpoint");
+    }
+    if (header.version != checkpoint_version) {
+        throw std::runtime_error("read_wave_function_checkpoint: unsupported version " +
+                                 std::to_string(header.version) + " in " + filename);
+    }
+    const std::string file_method(header.method,
+                                  strnlen(header.method, checkpoint_method_size));
+    if (file_method != method) {
+        throw std::runtime_error("read_wave_function_checkpoint: " + filename +
+                                 " was generated by " + file_method + ", not " + method);
+    }
+    if (header.norbs > Determinant::norb()) {
+        throw std::runtime_error("read_wave_function_checkpoint: " + filename + " stores " +
+                                 std::to_string(header.norbs) +
+                                 " orbitals, more than the determinant size (" +
+                                 std::to_string(Determinant::norb()) + ")");
+    }
+#ifndef HAVE_ZLIB
+    if (header.flags & checkpoint_compressed) {
+        throw std::runtime_error("read_wave_function_checkpoint: " + filename +
+                                 " is compressed but forte was compiled without zlib");
+    }
+#endif
+
+    const size_t ndets = header.ndets;
+    const size_t nroots = header.nroots;
+    const size_t nwords = header.nwords;
+    const size_t chunk_size = header.chunk_size;
+    const size_t nchunks = chunk_size > 0 ? (ndets + chunk_size - 1) / chunk_size : 0;
+    if (header.table_offset + nchunks * sizeof(CheckpointChunk) > file.size() or
+        (ndets > 0 and chunk_size == 0) or nwords % 2 != 0) {
+        throw std::runtime_error("read_wave_function_checkpoint: " + filename + " is corrupted");
+    }
+    std::vector<CheckpointChunk> table(nchunks);
+    std::memcpy(table.data(), data + header.table_offset, nchunks * sizeof(CheckpointChunk));
+
+    // the file may have been written with a different determinant size: the alpha and beta
+    // strings are copied separately and only the words that hold the active orbitals are used
+    const size_t nwords_half = nwords / 2;
+    const size_t ncopy = std::min(nwords_half, Determinant::nwords_half);
+
+    std::vector<Determinant> dets(ndets);
+    auto evecs = std::make_shared<psi::Matrix>("evecs " + filename, ndets, nroots);
+
+    bool corrupted = false;
+#pragma omp parallel
+    {
+        std::vector<char> buffer;
+#pragma omp for schedule(dynamic)
+        for (size_t c = 0; c < nchunks; ++c) {
+            const size_t first = c * chunk_size;
+            const size_t n = std::min(chunk_size, ndets - first);
+            const auto& chunk = table[c];
+            if (chunk.offset + chunk.stored_size > file.size() or
+                chunk.raw_size != n * (nwords * sizeof(uint64_t) + nroots * sizeof(double))) {
+#pragma omp atomic write
+                corrupted = true;
+                continue;
+            }
+
+            const char* raw = data + chunk.offset;
+#ifdef HAVE_ZLIB
+            if (header.flags & checkpoint_compressed) {
+                buffer.resize(chunk.raw_size);
+                uLongf raw_size = chunk.raw_size;
+                if (uncompress(reinterpret_cast<Bytef*>(buffer.data()), &raw_size,
+                               reinterpret_cast<const Bytef*>(raw),
+                               chunk.stored_size) != Z_OK or
+                    raw_size != chunk.raw_size) {
+#pragma omp atomic write
+                    corrupted = true;
+                    continue;
+                }
+                raw = buffer.data();
+            }
+#endif
+            for (size_t I = 0; I < n; ++I) {
+                auto& det = dets[first + I];
+                const char* words = raw + I * nwords * sizeof(uint64_t);
+                for (size_t k = 0; k < ncopy; ++k) {
+                    uint64_t a, b;
+                    std::memcpy(&a, words + k * sizeof(uint64_t), sizeof(uint64_t));
+                    std::memcpy(&b, words + (nwords_half + k) * sizeof(uint64_t),
+                                sizeof(uint64_t));
+                    det.set_word(k, a);
+                    det.set_word(Determinant::nwords_half + k, b);
+                }
+            }
+            const char* coeffs = raw + n * nwords * sizeof(uint64_t);
+            for (size_t r = 0; r < nroots; ++r) {
+                for (size_t I = 0; I < n; ++I) {
+                    double value;
+                    std::memcpy(&value, coeffs + (r * n + I) * sizeof(double), sizeof(double));
+                    evecs->set(first + I, r, value);
+                }
+            }
+        }
+    }
+    if (corrupted) {
+        throw std::runtime_error("read_wave_function_checkpoint: " + filename + " is corrupted");
+    }
+
+    return {header.norbs, dets, evecs};
+}
+
+bool is_wave_function_checkpoint(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    char magic[sizeof(checkpoint_magic)];
+    if (not file.read(magic, sizeof(magic))) {
+        return false;
+    }
+    return std::memcmp(magic, checkpoint_magic, sizeof(checkpoint_magic)) == 0;
+}
+
+} // namespace forte
@@ -0,0 +1,86 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Forte: an open-source plugin to Psi4 (https://github.com/psi4/psi4)
+ * that implements a variety of quantum chemistry methods for strongly
+ * correlated electrons.
+ *
+ * Copyright (c) 2012-2024 by its authors (see COPYING, COPYING.LESSER, AUTHORS).
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ *
+ * @END LICENSE
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "sparse_ci/determinant.h"
+
+namespace psi {
+class Matrix;
+}
+
+namespace forte {
+
+class DeterminantHashVec;
+
+/**
+ * Binary checkpoint files for CI wave functions
+ *
+ * A checkpoint file stores the determinants and the CI coefficients of a set of roots. The layout
+ * of the file is:
+ *   - a fixed-size header (magic string, version, method label, number of orbitals, determinants,
+ *     roots, and words per determinant, chunk size, and flags) followed by the state label
+ *   - the data chunks; each chunk stores the raw words of up to chunk_size determinants followed
+ *     by the coefficients of these determinants for each root (one column after the other)
+ *   - a table with the offset, stored size, and uncompressed size of each chunk
+ * When compression is requested (and forte is compiled with zlib) each chunk is compressed
+ * independently, so that chunks can be written and read in parallel. Files are read by mapping
+ * them in memory. Data is stored in the native byte order.
+ */
+
+/// @brief Write a CI wave function to a binary checkpoint file
+/// @param filename the file name
+/// @param method a label identifying the method that generated the wave function (e.g. "DETCI")
+/// @param state a string describing the electronic state
+/// @param norbs the number of active orbitals
+/// @param dets the determinants
+/// @param evecs the CI coefficients (ndets x nroots)
+/// @param compress compress the data chunks (ignored if forte is compiled without zlib)
+void write_wave_function_checkpoint(const std::string& filename, const std::string& method,
+                                    const std::string& state, size_t norbs,
+                                    const DeterminantHashVec& dets, const psi::Matrix& evecs,
+                                    bool compress);
+
+/// @brief Read a CI wave function from a binary checkpoint file
+/// @param filename the file name
+/// @param method the label of the method that is expected to have generated the file
+/// @return a tuple (number of active orbitals, determinants, CI coefficients)
+std::tuple<size_t, std::vector<Determinant>, std::shared_ptr<psi::Matrix>>
+read_wave_function_checkpoint(const std::string& filename, const std::string& method);
+
+/// @brief Check if a file is a binary wave function checkpoint
+/// @param filename the file name
+/// @return true if the file starts with the checkpoint magic string
+bool is_wave_function_checkpoint(const std::string& filename);
+
+} // namespace forte
@@ -0,0 +1,82 @@
+#include <random>
+#include <thread>
+
+#include "hayai/hayai.hpp"
+
+#include "forte/sparse_ci/determinant.h"
+#include "forte/helpers/hash_vector.h"
+#include "forte/helpers/concurrent_hash_vector.h"
+
+using namespace forte;
+
+namespace {
+/// Generate n random determinants (with repetitions) with four alpha and four beta electrons
+std::vector<Determinant> make_random_dets(size_t n) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<size_t> orb(0, 31);
+    std::vector<Determinant> dets(n);
+    for (auto& d : dets) {
+        for (size_t k = 0; k < 4; k++) {
+            d.set_alfa_bit(orb(gen), true);
+            d.set_beta_bit(orb(gen), true);
+        }
+    }
+    return dets;
+}
+
+const std::vector<Determinant> bench_dets = make_random_dets(200000);
+
+/// Add the determinants to a ConcurrentHashVector using nthreads threads
+void concurrent_add(size_t nthreads) {
+    ConcurrentHashVector<Determinant, Determinant::Hash> hv;
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < nthreads; t++) {
+        threads.emplace_back([&, t]() {
+            for (size_t i = t; i < bench_dets.size(); i += nthreads) {
+                hv.add(bench_dets[i]);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+} // namespace
+
+BENCHMARK(HashVector, add, 5, 1) {
+    HashVector<Determinant, Determinant::Hash> hv;
+    for (const auto& d : bench_dets) {
+        hv.add(d);
+    }
+}
+
+BENCHMARK_P(ConcurrentHashVector, add, 5, 1, (std::size_t nthreads)) { concurrent_add(nthreads); }
+
+BENCHMARK_P_INSTANCE(ConcurrentHashVector, add, (1));
+BENCHMARK_P_INSTANCE(ConcurrentHashVector, add, (2));
+BENCHMARK_P_INSTANCE(ConcurrentHashVector, add, (4));
+BENCHMARK_P_INSTANCE(ConcurrentHashVector, add, (8));
+
+/// The current approach: thread-local HashVectors merged serially
+BENCHMARK_P(HashVector, thread_local_merge, 5, 1, (std::size_t nthreads)) {
+    std::vector<HashVector<Determinant, Determinant::Hash>> local(nthreads);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < nthreads; t++) {
+        threads.emplace_back([&, t]() {
+            for (size_t i = t; i < bench_dets.size(); i += nthreads) {
+                local[t].add(bench_dets[i]);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    HashVector<Determinant, Determinant::Hash> hv;
+    for (const auto& l : local) {
+        hv.merge(l);
+    }
+}
+
+BENCHMARK_P_INSTANCE(HashVector, thread_local_merge, (2));
+BENCHMARK_P_INSTANCE(HashVector, thread_local_merge, (4));
+BENCHMARK_P_INSTANCE(HashVector, thread_local_merge, (8));
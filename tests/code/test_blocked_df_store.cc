@@ -0,0 +1,56 @@
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "catch_amalgamated.hpp"
+
+#include "forte/integrals/blocked_df_store.h"
+
+using namespace forte;
+
+namespace {
+/// A reference value for the integral B(Q|pq)
+double reference(size_t Q, size_t p, size_t q) { return 1.0e4 * Q + 1.0e2 * p + q + 0.5; }
+} // namespace
+
+TEST_CASE("Blocked DF store", "[BlockedDFStore]") {
+    const size_t naux = 7;
+    const size_t nmo = 9;
+    const std::string filename = "forte_test_blocked_df_store." + std::to_string(getpid());
+
+    for (size_t tile_rows : {1, 2, 4, 9, 20}) {
+        BlockedDFStore store(filename, naux, nmo, tile_rows);
+        store.write([&](size_t p_begin, size_t p_end, double* buffer) {
+            for (size_t Q = 0; Q < naux; ++Q) {
+                for (size_t p = p_begin; p < p_end; ++p) {
+                    for (size_t q = 0; q < nmo; ++q) {
+                        *buffer++ = reference(Q, p, q);
+                    }
+                }
+            }
+        });
+        REQUIRE(store.ntiles() == (nmo + store.tile_rows() - 1) / store.tile_rows());
+
+        const size_t Q_begin = 2, Q_end = 6, nQ = Q_end - Q_begin;
+        for (const auto& p : std::vector<std::vector<size_t>>{{0}, {3, 4, 5}, {8, 1, 6}}) {
+            for (const auto& q : std::vector<std::vector<size_t>>{{2, 3, 4}, {7, 0}}) {
+                std::vector<double> Qpq(nQ * p.size() * q.size());
+                std::vector<double> pqQ(Qpq.size());
+                store.read(Q_begin, Q_end, p, q, false, Qpq.data());
+                store.read(Q_begin, Q_end, p, q, true, pqQ.data());
+                for (size_t iQ = 0; iQ < nQ; ++iQ) {
+                    for (size_t ip = 0; ip < p.size(); ++ip) {
+                        for (size_t iq = 0; iq < q.size(); ++iq) {
+                            double ref = reference(Q_begin + iQ, p[ip], q[iq]);
+                            REQUIRE(Qpq[(iQ * p.size() + ip) * q.size() + iq] == ref);
+                            REQUIRE(pqQ[(ip * q.size() + iq) * nQ + iQ] == ref);
+                        }
+                    }
+                }
+            }
+        }
+        REQUIRE_THROWS(store.read(0, naux + 1, {0}, {0}, false, nullptr));
+    }
+    REQUIRE(access(filename.c_str(), F_OK) != 0);
+}
@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <thread>
+
+#include "catch_amalgamated.hpp"
+
+#include "forte/sparse_ci/determinant.h"
+#include "forte/helpers/concurrent_hash_vector.h"
+
+using namespace forte;
+
+namespace {
+/// Generate n distinct random determinants with four alpha and four beta electrons
+std::vector<Determinant> make_random_dets(size_t n, unsigned int seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<size_t> orb(0, 31);
+    HashVector<Determinant, Determinant::Hash> dets;
+    while (dets.size() < n) {
+        Determinant d;
+        for (size_t k = 0; k < 4; k++) {
+            d.set_alfa_bit(orb(gen), true);
+            d.set_beta_bit(orb(gen), true);
+        }
+        dets.add(d);
+    }
+    return dets.toVector();
+}
+} // namespace
+
+TEST_CASE("ConcurrentHashVector serial", "[ConcurrentHashVector]") {
+    ConcurrentHashVector<uint64_t> hv;
+    REQUIRE(hv.size() == 0);
+    REQUIRE(hv.find(7) == hv.npos);
+
+    // indices follow the insertion order and duplicates are not added
+    for (uint64_t k = 0; k < 5000; k++) {
+        REQUIRE(hv.add(3 * k) == k);
+    }
+    for (uint64_t k = 0; k < 5000; k++) {
+        auto [index, inserted] = hv.insert(3 * k);
+        REQUIRE(index == k);
+        REQUIRE(not inserted);
+    }
+    REQUIRE(hv.size() == 5000);
+    REQUIRE(hv.load_factor() <= hv.max_load_factor());
+    for (uint64_t k = 0; k < 5000; k++) {
+        REQUIRE(hv.find(3 * k) == k);
+        REQUIRE(hv[k] == 3 * k);
+        REQUIRE(hv.find(3 * k + 1) == hv.npos);
+    }
+
+    // conversion to HashVector preserves the indices
+    auto hv2 = hv.toHashVector();
+    REQUIRE(hv2.size() == 5000);
+    for (uint64_t k = 0; k < 5000; k++) {
+        REQUIRE(hv2.find(3 * k) == k);
+    }
+
+    hv.clear();
+    REQUIRE(hv.size() == 0);
+    REQUIRE(hv.find(0) == hv.npos);
+    REQUIRE(hv.add(42) == 0);
+}
+
+TEST_CASE("ConcurrentHashVector concurrent add", "[ConcurrentHashVector]") {
+    const size_t ndets = 20000;
+    const size_t nthreads = 8;
+    auto dets = make_random_dets(ndets, 1234);
+
+    // every thread adds all the determinants in a different order, starting from an empty table
+    // so that the table grows while other threads are inserting
+    ConcurrentHashVector<Determinant, Determinant::Hash> hv;
+    std::vector<std::vector<size_t>> indices(nthreads, std::vector<size_t>(ndets));
+    // Catch2 assertions are not thread safe, so the threads only record failures
+    std::atomic<bool> found_consistent{true};
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < nthreads; t++) {
+        threads.emplace_back([&, t]() {
+            std::vector<size_t> order(ndets);
+            std::iota(order.begin(), order.end(), 0);
+            std::shuffle(order.begin(), order.end(), std::mt19937(t));
+            for (auto i : order) {
+                indices[t][i] = hv.add(dets[i]);
+                if (hv.find(dets[i]) != indices[t][i]) {
+                    found_consistent = false;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(found_consistent);
+
+    // every determinant is stored once and all threads see the same index
+    REQUIRE(hv.size() == ndets);
+    for (size_t i = 0; i < ndets; i++) {
+        for (size_t t = 1; t < nthreads; t++) {
+            REQUIRE(indices[t][i] == indices[0][i]);
+        }
+        REQUIRE(hv[indices[0][i]] == dets[i]);
+        REQUIRE(hv.find(dets[i]) == indices[0][i]);
+    }
+}
+
+TEST_CASE("ConcurrentHashVector merge", "[ConcurrentHashVector]") {
+    auto dets = make_random_dets(10000, 5678);
+    std::vector<Determinant> first(dets.begin(), dets.begin() + 6000);
+    std::vector<Determinant> second(dets.begin() + 4000, dets.end());
+
+    ConcurrentHashVector<Determinant, Determinant::Hash> hv;
+    auto index_first = hv.merge(first);
+    REQUIRE(hv.size() == 6000);
+    auto index_second = hv.merge(HashVector<Determinant, Determinant::Hash>(second));
+    REQUIRE(hv.size() == 10000);
+
+    for (size_t i = 0; i < first.size(); i++) {
+        REQUIRE(hv[index_first[i]] == first[i]);
+    }
+    for (size_t i = 0; i < second.size(); i++) {
+        REQUIRE(hv[index_second[i]] == second[i]);
+    }
+    // the overlapping determinants keep the index assigned by the first merge
+    for (size_t i = 4000; i < 6000; i++) {
+        REQUIRE(index_second[i - 4000] == index_first[i]);
+    }
+}
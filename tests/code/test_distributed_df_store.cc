@@ -0,0 +1,92 @@
+#include <vector>
+
+#include <mpi.h>
+
+#include "catch_amalgamated.hpp"
+
+#include "forte/integrals/distributed_df_store.h"
+
+// Run with several processes, e.g.: mpirun -np 4 ./forte_mpi_tests
+
+using namespace forte;
+
+namespace {
+/// A reference value for the integral B(Q|pq)
+double reference(size_t Q, size_t p, size_t q) { return 1.0e4 * Q + 1.0e2 * p + q + 0.5; }
+
+/// Write the reference integrals from a given root process
+void write_reference(DistributedDFStore& store, int root) {
+    const size_t nmo = store.nmo();
+    store.write(
+        [&](size_t Q_begin, size_t Q_end, double* buffer) {
+            for (size_t Q = Q_begin; Q < Q_end; ++Q) {
+                for (size_t p = 0; p < nmo; ++p) {
+                    for (size_t q = 0; q < nmo; ++q) {
+                        *buffer++ = reference(Q, p, q);
+                    }
+                }
+            }
+        },
+        root);
+}
+} // namespace
+
+TEST_CASE("Distributed DF store slabs", "[DistributedDFStore]") {
+    for (size_t naux : {1, 2, 5, 23}) {
+        DistributedDFStore store(MPI_COMM_WORLD, naux, 3);
+        REQUIRE(store.slab_begin(0) == 0);
+        REQUIRE(store.slab_begin(store.nproc()) == naux);
+        for (size_t Q = 0; Q < naux; ++Q) {
+            int r = store.owner(Q);
+            REQUIRE(store.slab_begin(r) <= Q);
+            REQUIRE(Q < store.slab_begin(r + 1));
+        }
+    }
+}
+
+TEST_CASE("Distributed DF store", "[DistributedDFStore]") {
+    const size_t nmo = 9;
+    for (size_t naux : {3, 17}) {
+        DistributedDFStore store(MPI_COMM_WORLD, naux, nmo);
+        // write from the last process to test a root different from zero
+        write_reference(store, store.nproc() - 1);
+
+        std::vector<size_t> all(nmo);
+        for (size_t p = 0; p < nmo; ++p) {
+            all[p] = p;
+        }
+        // every process reads blocks that span the slabs of several processes
+        for (auto [Q_begin, Q_end] : std::vector<std::pair<size_t, size_t>>{
+                 {0, naux}, {1, naux - 1}, {naux / 2, naux / 2 + 1}, {2, 2}}) {
+            const size_t nQ = Q_end - Q_begin;
+            for (const auto& p : std::vector<std::vector<size_t>>{{0}, {3, 4, 5}, {8, 1, 6}, all}) {
+                for (const auto& q : std::vector<std::vector<size_t>>{{2, 3, 4}, {7, 0}, all}) {
+                    std::vector<double> Qpq(nQ * p.size() * q.size());
+                    std::vector<double> pqQ(Qpq.size());
+                    store.read(Q_begin, Q_end, p, q, false, Qpq.data());
+                    store.read(Q_begin, Q_end, p, q, true, pqQ.data());
+                    for (size_t Q = 0; Q < nQ; ++Q) {
+                        for (size_t i = 0; i < p.size(); ++i) {
+                            for (size_t j = 0; j < q.size(); ++j) {
+                                double ref = reference(Q_begin + Q, p[i], q[j]);
+                                REQUIRE(Qpq[(Q * p.size() + i) * q.size() + j] == ref);
+                                REQUIRE(pqQ[(i * q.size() + j) * nQ + Q] == ref);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        std::vector<double> out(1);
+        REQUIRE_THROWS(store.read(0, naux + 1, {0}, {0}, false, out.data()));
+        REQUIRE_THROWS(store.read(0, 1, {nmo}, {0}, false, out.data()));
+    }
+}
+
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+    int result = Catch::Session().run(argc, argv);
+    MPI_Finalize();
+    return result;
+}
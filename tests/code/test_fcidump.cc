@@ -0,0 +1,82 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <unistd.h>
+
+#include "catch_amalgamated.hpp"
+
+#include "forte/integrals/fcidump.h"
+
+using namespace forte;
+
+namespace {
+/// A reference value for the integral (pq|rs), invariant to the eight permutations
+double reference(size_t p, size_t q, size_t r, size_t s) {
+    size_t pq = packed_pair_index(p, q);
+    size_t rs = packed_pair_index(r, s);
+    return 0.01 * packed_pair_index(pq, rs) + 0.125;
+}
+} // namespace
+
+TEST_CASE("FCIDUMP reader", "[FCIDUMP]") {
+    const size_t norb = 5;
+    const std::string filename = "forte_test_fcidump." + std::to_string(getpid());
+    const std::string binary_filename = filename + ".bin";
+
+    {
+        std::ofstream file(filename);
+        file << "&FCI NORB=" << norb << ",NELEC=4,MS2=0,\n";
+        file << "  ORBSYM=1,1,2,3,1,\n  ISYM=1,\n  PNTGRP=C2V,\n&END\n";
+        for (size_t p = 0; p < norb; ++p) {
+            for (size_t q = 0; q <= p; ++q) {
+                for (size_t r = 0; r < norb; ++r) {
+                    for (size_t s = 0; s <= r; ++s) {
+                        if (packed_pair_index(p, q) >= packed_pair_index(r, s)) {
+                            file << "  " << reference(p, q, r, s) << " " << p + 1 << " " << q + 1
+                                 << " " << r + 1 << " " << s + 1 << "\n";
+                        }
+                    }
+                }
+            }
+        }
+        for (size_t p = 0; p < norb; ++p) {
+            for (size_t q = 0; q <= p; ++q) {
+                file << "  " << -1.0 - p - 0.1 * q << " " << p + 1 << " " << q + 1 << " 0 0\n";
+            }
+        }
+        // use a Fortran exponent for the scalar energy
+        file << "  1.5D+00 0 0 0 0\n";
+    }
+
+    auto text = read_fcidump(filename);
+    write_fcidump_binary(binary_filename, text);
+    REQUIRE_FALSE(is_fcidump_binary(filename));
+    REQUIRE(is_fcidump_binary(binary_filename));
+    auto binary = read_fcidump(binary_filename);
+
+    for (const auto* fcidump : {&text, &binary}) {
+        REQUIRE(fcidump->norb == norb);
+        REQUIRE(fcidump->nelec == 4);
+        REQUIRE(fcidump->ms2 == 0);
+        REQUIRE(fcidump->isym == 1);
+        REQUIRE(fcidump->pntgrp == "C2V");
+        REQUIRE(fcidump->orbsym == std::vector<int>{1, 1, 2, 3, 1});
+        REQUIRE(fcidump->epsilon.empty());
+        REQUIRE(fcidump->enuc == Catch::Approx(1.5));
+        for (size_t p = 0; p < norb; ++p) {
+            for (size_t q = 0; q < norb; ++q) {
+                const size_t i = std::max(p, q), j = std::min(p, q);
+                REQUIRE(fcidump->hcore[p * norb + q] == Catch::Approx(-1.0 - i - 0.1 * j));
+                for (size_t r = 0; r < norb; ++r) {
+                    for (size_t s = 0; s < norb; ++s) {
+                        REQUIRE(fcidump->eri[packed_tei_index(p, q, r, s)] ==
+                                Catch::Approx(reference(p, q, r, s)));
+                    }
+                }
+            }
+        }
+    }
+    std::remove(filename.c_str());
+    std::remove(binary_filename.c_str());
+}
@@ -0,0 +1,137 @@
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "catch_amalgamated.hpp"
+
+#include "forte/base_classes/packed_rdm_tensor.h"
+
+using namespace forte;
+
+namespace {
+/// Fill the unique elements of a packed tensor with random numbers
+void fill_random(PackedRDMTensor& T, unsigned int seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (auto& x : T.data()) {
+        x = dist(gen);
+    }
+}
+
+/// Convert a flat dense index into a multi-index
+std::vector<size_t> multi_index(size_t i, size_t n, size_t rank) {
+    std::vector<size_t> idx(rank);
+    for (size_t r = rank; r > 0; --r) {
+        idx[r - 1] = i % n;
+        i /= n;
+    }
+    return idx;
+}
+
+/// Convert a multi-index into a flat dense index
+size_t flat_index(const std::vector<size_t>& idx, size_t n) {
+    size_t i = 0;
+    for (auto p : idx) {
+        i = i * n + p;
+    }
+    return i;
+}
+} // namespace
+
+TEST_CASE("Antisymmetric packing", "[PackedRDMTensor]") {
+    const size_t n = 5;
+    for (const auto& groups : std::vector<std::vector<size_t>>{
+             {2, 2}, {3, 3}, {2, 1, 2, 1}, {1, 2, 1, 2}, {1, 1}}) {
+        auto T = PackedRDMTensor::antisymmetric(n, groups);
+        fill_random(T, 7);
+
+        std::vector<double> dense(T.dense_size());
+        T.unpack(dense.data());
+
+        for (size_t i = 0; i < dense.size(); ++i) {
+            auto idx = multi_index(i, n, T.rank());
+            REQUIRE(T.get(idx.data()) == dense[i]);
+            // transpositions within a group change the sign, repeated indices give zero
+            for (size_t g = 0, first = 0; g < groups.size(); first += groups[g], ++g) {
+                for (size_t j = first + 1; j < first + groups[g]; ++j) {
+                    auto swapped = idx;
+                    std::swap(swapped[j - 1], swapped[j]);
+                    REQUIRE(dense[flat_index(swapped, n)] == -dense[i]);
+                    if (idx[j - 1] == idx[j]) {
+                        REQUIRE(dense[i] == 0.0);
+                    }
+                }
+            }
+        }
+
+        // the canonical indices address the stored elements
+        std::vector<size_t> idx(T.rank());
+        for (size_t I = 0; I < T.size(); ++I) {
+            T.canonical_indices(I, idx.data());
+            REQUIRE(dense[flat_index(idx, n)] == T.data()[I]);
+        }
+
+        auto T2 = PackedRDMTensor::antisymmetric(n, groups);
+        T2.pack(dense.data());
+        REQUIRE(T2.data() == T.data());
+    }
+
+    REQUIRE(PackedRDMTensor::antisymmetric(n, {2, 2}).size() == 100);
+    REQUIRE(PackedRDMTensor::antisymmetric(n, {3, 3}).size() == 100);
+    REQUIRE(PackedRDMTensor::antisymmetric(n, {2, 1, 2, 1}).size() == 2500);
+}
+
+TEST_CASE("Pair-symmetric packing", "[PackedRDMTensor]") {
+    const size_t n = 4;
+    for (size_t k : {1, 2, 3}) {
+        auto T = PackedRDMTensor::pair_symmetric(n, k);
+        fill_random(T, 11);
+
+        std::vector<double> dense(T.dense_size());
+        T.unpack(dense.data());
+
+        for (size_t i = 0; i < dense.size(); ++i) {
+            auto idx = multi_index(i, n, T.rank());
+            REQUIRE(T.get(idx.data()) == dense[i]);
+            // swapping two (upper, lower) pairs leaves the element unchanged
+            for (size_t j = 1; j < k; ++j) {
+                auto swapped = idx;
+                std::swap(swapped[j - 1], swapped[j]);
+                std::swap(swapped[k + j - 1], swapped[k + j]);
+                REQUIRE(dense[flat_index(swapped, n)] == dense[i]);
+            }
+        }
+
+        std::vector<size_t> idx(T.rank());
+        for (size_t I = 0; I < T.size(); ++I) {
+            T.canonical_indices(I, idx.data());
+            REQUIRE(dense[flat_index(idx, n)] == T.data()[I]);
+        }
+
+        auto T2 = PackedRDMTensor::pair_symmetric(n, k);
+        T2.pack(dense.data());
+        REQUIRE(T2.data() == T.data());
+    }
+
+    REQUIRE(PackedRDMTensor::pair_symmetric(n, 2).size() == 136);
+    REQUIRE(PackedRDMTensor::pair_symmetric(n, 3).size() == 816);
+}
+
+TEST_CASE("Packed tensor arithmetic and I/O", "[PackedRDMTensor]") {
+    auto T = PackedRDMTensor::antisymmetric(6, {2, 1, 2, 1});
+    fill_random(T, 3);
+    auto X = T;
+    X.scale(2.0);
+    X.axpy(-1.0, T);
+    REQUIRE(X.data() == T.data());
+    REQUIRE_THROWS(X.axpy(1.0, PackedRDMTensor::antisymmetric(6, {3, 3})));
+
+    const std::string filename = "test_packed_rdm_tensor.bin";
+    T.save(filename);
+    auto L = PackedRDMTensor::load(filename);
+    std::remove(filename.c_str());
+    REQUIRE(L.packing() == T.packing());
+    REQUIRE(L.groups() == T.groups());
+    REQUIRE(L.data() == T.data());
+    REQUIRE_THROWS(PackedRDMTensor::load(filename));
+}
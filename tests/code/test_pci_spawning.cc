@@ -0,0 +1,107 @@
+#include <map>
+#include <random>
+#include <thread>
+
+#include "catch_amalgamated.hpp"
+
+#include "forte/sparse_ci/determinant.h"
+#include "forte/pci/pci_spawning.h"
+
+using namespace forte;
+
+namespace {
+/// Generate a random determinant with four alpha and four beta electrons in 24 orbitals
+Determinant make_random_det(std::mt19937& gen) {
+    std::uniform_int_distribution<size_t> orb(0, 23);
+    Determinant d;
+    for (size_t k = 0; k < 4; k++) {
+        d.set_alfa_bit(orb(gen), true);
+        d.set_beta_bit(orb(gen), true);
+    }
+    return d;
+}
+} // namespace
+
+TEST_CASE("PCISpawnBuffer serial", "[PCISpawning]") {
+    std::mt19937 gen(1234);
+    PCISpawnBuffer buffer;
+    std::map<Determinant, double> reference;
+    // enough walkers to force the table to grow several times
+    for (size_t n = 0; n < 20000; n++) {
+        auto d = make_random_det(gen);
+        const double value = 0.25 * static_cast<double>(n % 7) - 0.5;
+        buffer.add(d, value);
+        reference[d] += value;
+    }
+    REQUIRE(buffer.size() == reference.size());
+    for (size_t i = 0; i < buffer.size(); i++) {
+        REQUIRE(buffer.values()[i] == reference[buffer.dets()[i]]);
+    }
+    buffer.clear();
+    REQUIRE(buffer.size() == 0);
+}
+
+TEST_CASE("PCISpawnBuffer threaded spawn and merge", "[PCISpawning]") {
+    const size_t nthreads = 8;
+    const size_t nspawn = 20000;
+
+    // each thread spawns walkers on a random set of determinants that overlaps with the others
+    std::vector<PCISpawnBuffer> buffers(nthreads);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < nthreads; t++) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 gen(t);
+            for (size_t n = 0; n < nspawn; n++) {
+                buffers[t].add(make_random_det(gen), 0.25 * static_cast<double>(n % 5) - 0.5);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // serial reference, generated with the same random sequences
+    std::map<Determinant, double> reference;
+    for (size_t t = 0; t < nthreads; t++) {
+        std::mt19937 gen(t);
+        for (size_t n = 0; n < nspawn; n++) {
+            reference[make_random_det(gen)] += 0.25 * static_cast<double>(n % 5) - 0.5;
+        }
+    }
+
+    std::vector<Determinant> dets;
+    std::vector<double> C;
+    merge_spawn_buffers(buffers, dets, C);
+
+    // every determinant appears once with the sum of the walkers spawned on it
+    REQUIRE(dets.size() == reference.size());
+    REQUIRE(C.size() == reference.size());
+    std::map<Determinant, double> merged;
+    for (size_t i = 0; i < dets.size(); i++) {
+        REQUIRE(merged.count(dets[i]) == 0);
+        merged[dets[i]] = C[i];
+    }
+    for (const auto& [d, value] : reference) {
+        REQUIRE(merged.count(d) == 1);
+        REQUIRE(merged[d] == Catch::Approx(value).margin(1.0e-12));
+    }
+
+    // the merge is deterministic
+    std::vector<Determinant> dets2;
+    std::vector<double> C2;
+    merge_spawn_buffers(buffers, dets2, C2);
+    REQUIRE(dets2 == dets);
+    REQUIRE(C2 == C);
+}
+
+TEST_CASE("PCI spawn partitions", "[PCISpawning]") {
+    // hashes that share the low bits are still spread over all the partitions
+    const size_t npartitions = 8;
+    std::vector<size_t> count(npartitions, 0);
+    for (size_t k = 0; k < 8000; k++) {
+        count[spawn_partition(k * npartitions, npartitions)]++;
+    }
+    for (size_t p = 0; p < npartitions; p++) {
+        REQUIRE(count[p] > 500);
+    }
+}
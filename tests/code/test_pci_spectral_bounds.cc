@@ -0,0 +1,188 @@
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "catch_amalgamated.hpp"
+
+#include "forte/pci/pci_spectral_bounds.h"
+
+using namespace forte;
+
+namespace {
+/// A dense symmetric test matrix. The last state has a high energy and is coupled very weakly to
+/// the others, so it has almost no overlap with the reference (the first state) and with the
+/// Krylov space generated from it.
+std::vector<std::vector<double>> make_matrix(size_t n) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> coupling(-0.2, 0.2);
+    std::vector<std::vector<double>> H(n, std::vector<double>(n, 0.0));
+    for (size_t i = 0; i + 1 < n; ++i) {
+        H[i][i] = -1.0 + 0.01 * static_cast<double>(i);
+        for (size_t j = 0; j < i; ++j) {
+            H[i][j] = H[j][i] = coupling(gen);
+        }
+    }
+    H[n - 1][n - 1] = 6.0;
+    for (size_t j = 0; j + 1 < n; ++j) {
+        H[n - 1][j] = H[j][n - 1] = 1.0e-9;
+    }
+    return H;
+}
+
+void apply(const std::vector<std::vector<double>>& H, const std::vector<double>& b,
+           std::vector<double>& sigma) {
+    const size_t n = H.size();
+    for (size_t i = 0; i < n; ++i) {
+        sigma[i] = 0.0;
+        for (size_t j = 0; j < n; ++j) {
+            sigma[i] += H[i][j] * b[j];
+        }
+    }
+}
+
+/// Gershgorin upper bound on the spectrum
+double gershgorin_upper_bound(const std::vector<std::vector<double>>& H) {
+    double bound = H[0][0];
+    for (size_t i = 0; i < H.size(); ++i) {
+        double radius = 0.0;
+        for (size_t j = 0; j < H.size(); ++j) {
+            radius += (i != j) ? std::fabs(H[i][j]) : 0.0;
+        }
+        bound = std::max(bound, H[i][i] + radius);
+    }
+    return bound;
+}
+
+/// The extreme eigenvalues of a dense symmetric matrix from a long Lanczos run
+std::pair<double, double> exact_extreme_eigenvalues(const std::vector<std::vector<double>>& H) {
+    auto bounds = lanczos_spectral_bounds(
+        H.size(), H.size(), 1.0e6,
+        [&](std::vector<double>& b, std::vector<double>& sigma) { apply(H, b, sigma); }, 7);
+    return {bounds.lower, bounds.upper};
+}
+} // namespace
+
+TEST_CASE("Tridiagonal extreme eigenvalues", "[PCISpectralBounds]") {
+    // the eigenvalues of tridiag(-1, 2, -1) are 2 - 2 cos(k pi / (n + 1)), k = 1, ..., n
+    const size_t n = 50;
+    std::vector<double> alpha(n, 2.0);
+    std::vector<double> beta(n - 1, -1.0);
+    auto [low, high] = tridiagonal_extreme_eigenvalues(alpha, beta);
+    const double pi = std::acos(-1.0);
+    REQUIRE(low == Catch::Approx(2.0 - 2.0 * std::cos(pi / (n + 1))).margin(1.0e-12));
+    REQUIRE(high == Catch::Approx(2.0 - 2.0 * std::cos(n * pi / (n + 1))).margin(1.0e-12));
+}
+
+TEST_CASE("Lanczos spectral bounds with a hidden top state", "[PCISpectralBounds]") {
+    const size_t n = 200;
+    auto H = make_matrix(n);
+    auto apply_H = [&](std::vector<double>& b, std::vector<double>& sigma) { apply(H, b, sigma); };
+    const double gershgorin = gershgorin_upper_bound(H);
+    auto [lambda_min, lambda_max] = exact_extreme_eigenvalues(H);
+    REQUIRE(lambda_max == Catch::Approx(6.0).margin(1.0e-6));
+
+    // a Lanczos run started from the reference does not see the top state
+    std::vector<double> v(n, 0.0), w(n);
+    v[0] = 1.0;
+    apply(H, v, w);
+    REQUIRE(w[0] < lambda_max - 5.0);
+
+    // the randomly started bounds enclose the spectrum for every seed and improve on Gershgorin
+    for (unsigned int seed = 0; seed < 20; ++seed) {
+        auto bounds = lanczos_spectral_bounds(n, 40, gershgorin, apply_H, seed);
+        REQUIRE(bounds.upper >= lambda_max);
+        REQUIRE(bounds.upper <= gershgorin);
+        REQUIRE(bounds.lower <= lambda_min);
+    }
+    auto bounds = lanczos_spectral_bounds(n, 40, gershgorin, apply_H, 0);
+    REQUIRE(bounds.upper < gershgorin);
+
+    // too few steps: the Gershgorin bound is kept
+    auto short_bounds = lanczos_spectral_bounds(n, 2, gershgorin, apply_H, 0);
+    REQUIRE(short_bounds.upper == gershgorin);
+}
+
+TEST_CASE("Projector iterations with Lanczos spectral bounds", "[PCISpectralBounds]") {
+    // the first-order projector 1 - tau (H - lambda_1) with tau = 2 / (lambda_h - lambda_1)
+    // converges to the ground state only if lambda_h bounds the spectrum from above, otherwise
+    // the top state (here with a tiny overlap with the reference) is amplified
+    const size_t n = 200;
+    auto H = make_matrix(n);
+    auto apply_H = [&](std::vector<double>& b, std::vector<double>& sigma) { apply(H, b, sigma); };
+    auto [lambda_min, lambda_max] = exact_extreme_eigenvalues(H);
+    auto bounds = lanczos_spectral_bounds(n, 40, gershgorin_upper_bound(H), apply_H, 3);
+
+    std::vector<double> C(n, 0.0), sigma(n);
+    C[0] = 1.0;
+    const double lambda_1 = H[0][0];
+    const double tau = 2.0 / (bounds.upper - lambda_1);
+    double energy = 0.0;
+    for (size_t iter = 0; iter < 5000; ++iter) {
+        apply(H, C, sigma);
+        double norm = 0.0;
+        energy = 0.0;
+        for (size_t I = 0; I < n; ++I) {
+            energy += C[I] * sigma[I];
+            C[I] -= tau * (sigma[I] - lambda_1 * C[I]);
+            norm += C[I] * C[I];
+        }
+        norm = std::sqrt(norm);
+        for (auto& c : C) {
+            c /= norm;
+        }
+    }
+    REQUIRE(energy == Catch::Approx(lambda_min).margin(1.0e-8));
+    REQUIRE(std::fabs(C[n - 1]) < 1.0e-6);
+}
+
+TEST_CASE("Refined spectral bounds reduce the number of sigma builds", "[PCISpectralBounds]") {
+    // count every application of H, including the Lanczos steps of one bound refinement, and
+    // check that the projector converges with fewer of them than with the Gershgorin bound
+    const size_t n = 200;
+    auto H = make_matrix(n);
+    size_t num_sigma_builds = 0;
+    auto apply_H = [&](std::vector<double>& b, std::vector<double>& sigma) {
+        apply(H, b, sigma);
+        num_sigma_builds += 1;
+    };
+    auto [lambda_min, lambda_max] = exact_extreme_eigenvalues(H);
+
+    // run the first-order projector until the energy is converged and return the sigma builds
+    auto project = [&](double lambda_h) {
+        std::vector<double> C(n, 0.0), sigma(n);
+        C[0] = 1.0;
+        const double lambda_1 = H[0][0];
+        const double tau = 2.0 / (lambda_h - lambda_1);
+        double energy = 0.0;
+        for (size_t iter = 0; iter < 100000; ++iter) {
+            apply_H(C, sigma);
+            double norm = 0.0;
+            energy = 0.0;
+            for (size_t I = 0; I < n; ++I) {
+                energy += C[I] * sigma[I];
+                C[I] -= tau * (sigma[I] - lambda_1 * C[I]);
+                norm += C[I] * C[I];
+            }
+            if (std::fabs(energy - lambda_min) < 1.0e-8) {
+                break;
+            }
+            norm = std::sqrt(norm);
+            for (auto& c : C) {
+                c /= norm;
+            }
+        }
+        REQUIRE(energy == Catch::Approx(lambda_min).margin(1.0e-8));
+    };
+
+    num_sigma_builds = 0;
+    project(gershgorin_upper_bound(H));
+    const size_t gershgorin_builds = num_sigma_builds;
+
+    num_sigma_builds = 0;
+    auto bounds = lanczos_spectral_bounds(n, 40, gershgorin_upper_bound(H), apply_H, 0);
+    REQUIRE(num_sigma_builds == 40);
+    project(bounds.upper);
+    const size_t refined_builds = num_sigma_builds;
+
+    REQUIRE(refined_builds < gershgorin_builds);
+}
@@ -0,0 +1,94 @@
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "catch_amalgamated.hpp"
+
+#include "forte/integrals/shared_integral_store.h"
+
+using namespace forte;
+
+TEST_CASE("Shared integral key", "[SharedIntegralStore]") {
+    auto key = [](double x) {
+        return SharedIntegralKey().add("DF").add(size_t(24)).add(x).str();
+    };
+    REQUIRE(key(0.5) == key(0.5 + 1.0e-13));
+    REQUIRE(key(0.5) != key(0.5 + 1.0e-8));
+    REQUIRE(key(0.5).rfind("/forte_ints_", 0) == 0);
+}
+
+TEST_CASE("Shared integral store", "[SharedIntegralStore]") {
+    const size_t nbf = 4;
+    const size_t ncmo = 3;
+    const size_t nthree = 5;
+    std::vector<double> B(ncmo * ncmo * nthree);
+    for (size_t i = 0; i < B.size(); ++i) {
+        B[i] = 0.25 * i - 3.0;
+    }
+    const auto key = SharedIntegralKey().add("test").add(size_t(getpid())).str();
+
+    REQUIRE(SharedIntegralStore::attach(key, nbf, ncmo) == nullptr);
+    {
+        auto published = SharedIntegralStore::publish(key, B.data(), nbf, ncmo, nthree);
+        REQUIRE(published != nullptr);
+        REQUIRE(published->owner());
+        // a second process cannot publish the same segment
+        REQUIRE(SharedIntegralStore::publish(key, B.data(), nbf, ncmo, nthree) == nullptr);
+
+        // a segment with the same key but different dimensions is not used
+        REQUIRE(SharedIntegralStore::attach(key, nbf + 1, ncmo) == nullptr);
+        REQUIRE(SharedIntegralStore::attach(key, nbf, ncmo + 1) == nullptr);
+        REQUIRE(SharedIntegralStore::attach(key, nbf, ncmo, nthree + 1) == nullptr);
+
+        auto attached = SharedIntegralStore::attach(key, nbf, ncmo, nthree);
+        REQUIRE(attached != nullptr);
+        REQUIRE(not attached->owner());
+        REQUIRE(attached->nbf() == nbf);
+        REQUIRE(attached->nrow() == ncmo * ncmo);
+        REQUIRE(attached->ncol() == nthree);
+        for (size_t i = 0; i < B.size(); ++i) {
+            REQUIRE(attached->data()[i] == B[i]);
+        }
+    }
+    // the publisher removes the segment
+    REQUIRE(SharedIntegralStore::attach(key, nbf, ncmo) == nullptr);
+}
+
+TEST_CASE("Shared integral store left behind", "[SharedIntegralStore]") {
+    const size_t nbf = 2;
+    const size_t ncmo = 2;
+    const size_t nthree = 3;
+    std::vector<double> B(ncmo * ncmo * nthree, 1.0);
+    const auto key = SharedIntegralKey().add("stale").add(size_t(getpid())).str();
+
+    // a child process publishes the integrals and exits without removing the segment
+    auto publish_and_die = [&]() {
+        pid_t child = fork();
+        REQUIRE(child >= 0);
+        if (child == 0) {
+            auto published = SharedIntegralStore::publish(key, B.data(), nbf, ncmo, nthree);
+            _exit(published != nullptr ? 0 : 1);
+        }
+        int status = 0;
+        REQUIRE(waitpid(child, &status, 0) == child);
+        REQUIRE(WIFEXITED(status));
+        REQUIRE(WEXITSTATUS(status) == 0);
+    };
+
+    // the orphaned segment is not used, and it is removed
+    publish_and_die();
+    REQUIRE(SharedIntegralStore::attach(key, nbf, ncmo, nthree) == nullptr);
+    {
+        auto published = SharedIntegralStore::publish(key, B.data(), nbf, ncmo, nthree);
+        REQUIRE(published != nullptr);
+        REQUIRE(SharedIntegralStore::attach(key, nbf, ncmo, nthree) != nullptr);
+    }
+
+    // the orphaned segment is replaced when publishing
+    publish_and_die();
+    auto published = SharedIntegralStore::publish(key, B.data(), nbf, ncmo, nthree);
+    REQUIRE(published != nullptr);
+    REQUIRE(published->owner());
+}
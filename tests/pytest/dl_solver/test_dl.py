@@ -9,7 +9,7 @@ import pytest
 # - passing different number of guesses
 # - passing different number of project out vectors
 
-def solve_dl(size, nroot):
+def solve_dl(size, nroot, mixed_precision=False, sigma_block_size=0):
     """Test the Davidson-Liu solver with a matrix of size x size"""
     # create a numpy array of size x size
     matrix = np.zeros((size, size))
@@ -24,6 +24,8 @@ def solve_dl(size, nroot):
     
     # create a solver object and use the Davidson-Liu solver to compute the eigenvalues
     solver = forte.DavidsonLiuSolver(size, nroot)
+    solver.set_mixed_precision(mixed_precision)
+    solver.set_sigma_block_size(sigma_block_size)
     h_diag = psi4.core.Vector("h_diag",size)
     for i in range(size):
         h_diag.set(i,matrix[i][i])
@@ -89,6 +91,18 @@ def test_dl_4():
         for nroot in range(1,size + 1):
             solve_dl(size, nroot)
 
+def test_dl_mixed_precision():
+    """Test the Davidson-Liu solver with the subspace stored in single precision"""
+    for nroot in range(1,6):
+        solve_dl(10, nroot, mixed_precision=True)
+        solve_dl(100, nroot, mixed_precision=True)
+        solve_dl(100, nroot, mixed_precision=True, sigma_block_size=2)
+
+def test_dl_sigma_block_size():
+    """Test the Davidson-Liu solver passing blocks of vectors of different size to the sigma builder"""
+    for sigma_block_size in range(0,4):
+        solve_dl(100, 3, sigma_block_size=sigma_block_size)
+
 def test_dl_no_guess():
     """Test the Davidson-Liu solver with no guesses. Random guesses will be generated"""
     size = 4
@@ -186,6 +200,8 @@ if __name__ == '__main__':
     test_dl_2()
     test_dl_3()
     test_dl_4()
+    test_dl_mixed_precision()
+    test_dl_sigma_block_size()
     test_dl_no_guess()
     test_project_out()
     test_dl_restart_1()
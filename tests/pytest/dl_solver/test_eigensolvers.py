@@ -0,0 +1,113 @@
+import time
+
+import forte
+import psi4
+import numpy as np
+import pytest
+
+# Compare the Davidson-Liu, LOBPCG, and thick-restart Lanczos solvers
+# - all solvers must reproduce the exact eigenvalues
+# - the benchmark prints the number of iterations, sigma vectors, and the wall time of each solver
+
+SOLVERS = ["DL", "LOBPCG", "LANCZOS"]
+
+
+def make_matrix(size):
+    """Build a diagonally dominant test matrix"""
+    matrix = np.zeros((size, size))
+    for i in range(size):
+        matrix[i][i] = -1.0 + i * 0.1
+        for j in range(i):
+            matrix[i][j] = 0.05 / (1.0 + abs(i - j))
+            matrix[j][i] = matrix[i][j]
+    return matrix
+
+
+def solve(solver_type, matrix, nroot, guesses=True):
+    size = matrix.shape[0]
+    solver = forte.make_eigen_solver(solver_type, size, nroot)
+    solver.set_maxiter(1000)
+    h_diag = psi4.core.Vector("h_diag", size)
+    for i in range(size):
+        h_diag.set(i, matrix[i][i])
+    solver.add_h_diag(h_diag)
+    if guesses:
+        solver.add_guesses([[(i, 1.0)] for i in range(nroot)])
+    solver.add_test_sigma_builder(matrix.tolist())
+    start = time.perf_counter()
+    converged = solver.solve()
+    elapsed = time.perf_counter() - start
+    return solver, converged, elapsed
+
+
+@pytest.mark.parametrize("solver_type", SOLVERS)
+@pytest.mark.parametrize("size,nroot", [(1, 1), (4, 1), (4, 3), (30, 1), (30, 3), (200, 3)])
+def test_eigensolvers(solver_type, size, nroot):
+    """Test that all eigensolvers reproduce the exact eigenvalues"""
+    matrix = make_matrix(size)
+    evals, _ = np.linalg.eigh(matrix)
+    solver, converged, _ = solve(solver_type, matrix, nroot)
+    assert converged
+    computed_evals = [solver.eigenvalues().get(i) for i in range(nroot)]
+    assert np.allclose(computed_evals, evals[:nroot])
+
+
+@pytest.mark.parametrize("solver_type", SOLVERS)
+def test_eigensolvers_random_guess(solver_type):
+    """Test that all eigensolvers converge when no guess is provided"""
+    matrix = make_matrix(30)
+    evals, _ = np.linalg.eigh(matrix)
+    solver, converged, _ = solve(solver_type, matrix, 2, guesses=False)
+    assert converged
+    computed_evals = [solver.eigenvalues().get(i) for i in range(2)]
+    assert np.allclose(computed_evals, evals[:2])
+
+
+@pytest.mark.parametrize("nroot", [2, 3, 4])
+def test_lanczos_degenerate_roots(nroot):
+    """Test that the Lanczos solver resolves degenerate roots and agrees with Davidson-Liu"""
+    # two copies of the same matrix rotated by a random orthogonal transformation, so that every
+    # eigenvalue is doubly degenerate and the degenerate pairs are not aligned with the guesses
+    size = 30
+    matrix = np.kron(np.eye(2), make_matrix(size // 2))
+    rng = np.random.default_rng(7)
+    q, _ = np.linalg.qr(rng.standard_normal((size, size)))
+    matrix = q.T @ matrix @ q
+    evals, _ = np.linalg.eigh(matrix)
+    dl_solver, dl_converged, _ = solve("DL", matrix, nroot)
+    lanczos_solver, lanczos_converged, _ = solve("LANCZOS", matrix, nroot)
+    assert dl_converged
+    assert lanczos_converged
+    dl_evals = [dl_solver.eigenvalues().get(i) for i in range(nroot)]
+    lanczos_evals = [lanczos_solver.eigenvalues().get(i) for i in range(nroot)]
+    assert np.allclose(lanczos_evals, dl_evals)
+    assert np.allclose(lanczos_evals, evals[:nroot])
+
+
+def test_make_eigen_solver():
+    """Test the eigensolver factory"""
+    assert forte.make_eigen_solver("DL", 10, 1).name() == "DavidsonLiuSolver"
+    assert forte.make_eigen_solver("LOBPCG", 10, 1).name() == "LOBPCGSolver"
+    assert forte.make_eigen_solver("LANCZOS", 10, 1).name() == "LanczosSolver"
+    with pytest.raises(RuntimeError):
+        forte.make_eigen_solver("JACOBI", 10, 1)
+
+
+def test_eigensolvers_benchmark():
+    """Compare the cost of the eigensolvers on the same problem"""
+    size = 400
+    nroot = 3
+    matrix = make_matrix(size)
+    evals, _ = np.linalg.eigh(matrix)
+    print(f"\n  {'Solver':<20} {'Iterations':>10} {'Sigma vectors':>14} {'Time (s)':>10}")
+    for solver_type in SOLVERS:
+        solver, converged, elapsed = solve(solver_type, matrix, nroot)
+        assert converged
+        assert np.allclose([solver.eigenvalues().get(i) for i in range(nroot)], evals[:nroot])
+        print(
+            f"  {solver.name():<20} {solver.iterations():>10} {solver.num_sigma_vectors():>14} {elapsed:>10.4f}"
+        )
+
+
+if __name__ == "__main__":
+    test_eigensolvers_benchmark()
@@ -0,0 +1,60 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import numpy as np
+import psi4
+import pytest
+import forte
+
+# Compare the integrals distributed over the MPI processes (INT_TYPE = DISTDF) with the DF ones.
+# Forte must be compiled with ENABLE_MPI. To test several processes run, for example:
+#   mpirun -np 4 python -m pytest test_distdf_integrals.py
+
+
+def make_data(int_type):
+    psi4.core.clean()
+    forte.clean_options()
+    molecule = psi4.geometry(
+        """
+    0 1
+    O
+    H 1 1.0
+    H 1 1.0 2 104.5
+    symmetry c1
+    """
+    )
+    return forte.modules.ObjectsUtilPsi4(
+        molecule=molecule,
+        basis="cc-pvdz",
+        mo_spaces={"FROZEN_DOCC": [1], "RESTRICTED_DOCC": [4], "ACTIVE": [0]},
+        options={"INT_TYPE": int_type, "SCF_TYPE": "DF", "E_CONVERGENCE": 1e-12, "D_CONVERGENCE": 1e-8},
+    ).run()
+
+
+def get_integrals(ints):
+    mos = list(range(ints.ncmo()))
+    occ = [0, 1, 2, 3]
+    return (
+        ints.frozen_core_energy(),
+        np.array(ints.tei_ab_block(mos, mos, mos, mos)),
+        np.array(ints.tei_aa_block(occ, mos, [5, 2, 7], mos)),
+    )
+
+
+def test_distdf_integrals():
+    """Test that the distributed DF integrals match the DF integrals"""
+    try:
+        distdf = get_integrals(make_data("DISTDF").ints)
+    except RuntimeError as e:
+        if "ENABLE_MPI" in str(e):
+            pytest.skip("Forte was compiled without MPI")
+        raise
+    df = get_integrals(make_data("DF").ints)
+
+    assert distdf[0] == pytest.approx(df[0], abs=1.0e-10)
+    for x, y in zip(distdf[1:], df[1:]):
+        assert np.max(np.abs(x - y)) < 1.0e-10
+
+
+if __name__ == "__main__":
+    test_distdf_integrals()
@@ -0,0 +1,82 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import math
+
+import numpy as np
+import psi4
+import pytest
+import forte
+
+# Rotate the orbitals by a small angle and compare the integrals updated incrementally
+# (by applying the rotation to the cached MO integrals) with those retransformed from scratch
+
+
+def make_data(int_type):
+    psi4.core.clean()
+    forte.clean_options()
+    molecule = psi4.geometry(
+        """
+    0 1
+    O
+    H 1 1.0
+    H 1 1.0 2 104.5
+    symmetry c1
+    """
+    )
+    return forte.modules.ObjectsUtilPsi4(
+        molecule=molecule,
+        basis="cc-pvdz",
+        mo_spaces={"FROZEN_DOCC": [1], "RESTRICTED_DOCC": [4], "ACTIVE": [0]},
+        options={"INT_TYPE": int_type, "E_CONVERGENCE": 1e-12, "D_CONVERGENCE": 1e-8},
+    ).run()
+
+
+def get_integrals(ints):
+    mos = list(range(ints.ncmo()))
+    return (
+        ints.frozen_core_energy(),
+        np.array(ints.oei_a_block(mos, mos)),
+        np.array(ints.tei_ab_block(mos, mos, mos, mos)),
+        np.array(ints.tei_aa_block(mos, mos, mos, mos)),
+    )
+
+
+@pytest.mark.parametrize("int_type", ["CONVENTIONAL", "DF", "CHOLESKY"])
+def test_incremental_integrals(int_type):
+    """Test that the incrementally rotated integrals match the retransformed ones"""
+    data = make_data(int_type)
+    nmopi = data.scf_info.nmopi()
+
+    # mix the HOMO with a virtual orbital (the frozen orbital is not rotated)
+    theta = 0.05
+    U = psi4.core.Matrix("U", nmopi, nmopi)
+    U.identity()
+    U.set(0, 4, 4, math.cos(theta))
+    U.set(0, 4, 6, -math.sin(theta))
+    U.set(0, 6, 4, math.sin(theta))
+    U.set(0, 6, 6, math.cos(theta))
+
+    I = psi4.core.Matrix("I", nmopi, nmopi)
+    I.identity()
+
+    # alternate incremental updates with full retransformations; the retransformation must
+    # still find the integral storage intact after an incremental update
+    for cycle in range(2):
+        data.options.set_bool("INCREMENTAL_INTEGRALS", True)
+        data.scf_info.rotate_orbitals(U, U, True)
+        incremental = get_integrals(data.ints)
+
+        # retransform the integrals with the same orbitals
+        data.options.set_bool("INCREMENTAL_INTEGRALS", False)
+        data.scf_info.rotate_orbitals(I, I, True)
+        full = get_integrals(data.ints)
+
+        assert incremental[0] == pytest.approx(full[0], abs=1.0e-10)
+        for inc, ref in zip(incremental[1:], full[1:]):
+            assert np.max(np.abs(inc - ref)) < 1.0e-10
+
+
+if __name__ == "__main__":
+    for int_type in ["CONVENTIONAL", "DF", "CHOLESKY"]:
+        test_incremental_integrals(int_type)
@@ -0,0 +1,76 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import psi4
+import forte
+
+# Check the screening metadata of ActiveSpaceIntegrals against the integrals
+
+
+def make_as_ints():
+    psi4.core.clean()
+    forte.clean_options()
+    molecule = psi4.geometry(
+        """
+     O
+     H 1 1.0
+     H 1 1.0 2 104.5
+    """
+    )
+    data = forte.modules.ObjectsUtilPsi4(molecule=molecule, basis="6-31g").run()
+    return data.as_ints
+
+
+def test_screening_tables():
+    """Test that the screening bounds and lists are consistent with the integrals"""
+    as_ints = make_as_ints()
+    nmo = as_ints.nmo()
+    sym = as_ints.mo_symmetry()
+    tei = {"aa": as_ints.tei_aa, "ab": as_ints.tei_ab, "bb": as_ints.tei_bb}
+    max_tei = {"aa": as_ints.max_tei_aa, "ab": as_ints.max_tei_ab, "bb": as_ints.max_tei_bb}
+
+    for p in range(nmo):
+        for q in range(nmo):
+            for spin in ["aa", "ab", "bb"]:
+                ref = max(abs(tei[spin](p, q, r, s)) for r in range(nmo) for s in range(nmo))
+                assert abs(max_tei[spin](p, q) - ref) < 1.0e-12
+
+    for i in range(nmo):
+        for a in range(nmo):
+            if a == i or sym[i] != sym[a]:
+                continue
+            ref = abs(as_ints.oei_a(i, a))
+            ref += sum(abs(as_ints.tei_aa(i, p, a, p)) + abs(as_ints.tei_ab(i, p, a, p)) for p in range(nmo))
+            assert abs(as_ints.single_coupling_bound_a(i, a) - ref) < 1.0e-12
+            assert as_ints.max_single_coupling_a(i) >= ref - 1.0e-12
+
+    for i in range(nmo):
+        for j in range(nmo):
+            excitations = as_ints.double_excitations("ab", i, j)
+            values = [abs(v) for _, _, v in excitations]
+            assert values == sorted(values, reverse=True)
+            for a, b, v in excitations:
+                assert a != i and b != j
+                assert abs(v - as_ints.tei_ab(i, j, a, b)) < 1.0e-12
+            # every symmetry-allowed excitation above the threshold is listed
+            count = sum(
+                1
+                for a in range(nmo)
+                for b in range(nmo)
+                if a != i and b != j and sym[i] ^ sym[j] ^ sym[a] ^ sym[b] == 0 and abs(as_ints.tei_ab(i, j, a, b)) >= 1.0e-12
+            )
+            assert count == len(excitations)
+            if excitations:
+                assert abs(as_ints.max_double_coupling_ab(i, j) - values[0]) < 1.0e-12
+            if i < j:
+                for a, b, v in as_ints.double_excitations("aa", i, j):
+                    assert a < b and a not in (i, j) and b not in (i, j)
+                    assert abs(v - as_ints.tei_aa(i, j, a, b)) < 1.0e-12
+                    # the bound holds for both orderings of the pair (ACI and SparseHamiltonian
+                    # use it to skip pairs with i > j too)
+                    assert abs(v) <= as_ints.max_double_coupling_aa(i, j) + 1.0e-12
+                assert as_ints.max_double_coupling_aa(i, j) == as_ints.max_double_coupling_aa(j, i)
+
+
+if __name__ == "__main__":
+    test_screening_tables()
@@ -0,0 +1,117 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import random
+import time
+
+import psi4
+import forte
+
+# Compare the batched matrix element kernels of ActiveSpaceIntegrals with the scalar ones
+# - the batched single excitations and energies must reproduce the scalar results
+# - benchmark_slater_rules_batch() prints the number of matrix elements evaluated per second by
+#   each kernel. It is not part of the test suite; run this file directly to call it.
+
+
+def make_as_ints():
+    psi4.core.clean()
+    forte.clean_options()
+    molecule = psi4.geometry(
+        """
+     O
+     H 1 1.0
+     H 1 1.0 2 104.5
+    """
+    )
+    data = forte.modules.ObjectsUtilPsi4(molecule=molecule, basis="6-31g").run()
+    return data.as_ints
+
+
+def random_dets(nmo, na, nb, ndets, seed=7):
+    rng = random.Random(seed)
+    dets = []
+    for _ in range(ndets):
+        det = forte.Determinant()
+        for i in rng.sample(range(nmo), na):
+            det.create_alfa_bit(i)
+        for i in rng.sample(range(nmo), nb):
+            det.create_beta_bit(i)
+        dets.append(det)
+    return dets
+
+
+def excitation_sign(occ, i, a):
+    """The sign of a^+_a a_i: -1 to the number of occupied orbitals between i and a"""
+    lo, hi = min(i, a), max(i, a)
+    return -1.0 if sum(1 for p in occ if lo < p < hi) % 2 else 1.0
+
+
+def test_slater_rules_batch():
+    """Test that the batched kernels reproduce the scalar ones"""
+    as_ints = make_as_ints()
+    nmo = as_ints.nmo()
+    dets = random_dets(nmo, 5, 4, 20)
+
+    energies = as_ints.energies(dets)
+    error = max(abs(e - as_ints.energy(det)) for e, det in zip(energies, dets))
+    assert error < 1.0e-12
+
+    for det in dets:
+        aocc = det.get_alfa_occ(nmo)
+        bocc = det.get_beta_occ(nmo)
+        avir = det.get_alfa_vir(nmo)
+        bvir = det.get_beta_vir(nmo)
+        singles_a = as_ints.slater_rules_single_alpha_batch(aocc, bocc)
+        singles_b = as_ints.slater_rules_single_beta_batch(aocc, bocc)
+        # the batched elements do not include the sign of the excitation, which is applied here
+        for k, i in enumerate(aocc):
+            for a in avir:
+                ref = as_ints.slater_rules_single_alpha(det, i, a)
+                sign = excitation_sign(aocc, i, a)
+                assert abs(sign * singles_a[k * nmo + a] - ref) < 1.0e-12
+        for k, i in enumerate(bocc):
+            for a in bvir:
+                ref = as_ints.slater_rules_single_beta(det, i, a)
+                sign = excitation_sign(bocc, i, a)
+                assert abs(sign * singles_b[k * nmo + a] - ref) < 1.0e-12
+
+
+def benchmark_slater_rules_batch():
+    """Compare the number of single-excitation elements evaluated per second"""
+    as_ints = make_as_ints()
+    nmo = as_ints.nmo()
+    dets = random_dets(nmo, 5, 5, 200)
+    occs = [(det.get_alfa_occ(nmo), det.get_alfa_vir(nmo), det.get_beta_occ(nmo)) for det in dets]
+    nelements = sum(len(aocc) * len(avir) for aocc, avir, _ in occs)
+
+    start = time.perf_counter()
+    for det, (aocc, avir, _) in zip(dets, occs):
+        for i in aocc:
+            for a in avir:
+                as_ints.slater_rules_single_alpha(det, i, a)
+    scalar_time = time.perf_counter() - start
+
+    start = time.perf_counter()
+    for aocc, _, bocc in occs:
+        as_ints.slater_rules_single_alpha_batch(aocc, bocc)
+    batch_time = time.perf_counter() - start
+
+    start = time.perf_counter()
+    for det in dets:
+        as_ints.energy(det)
+    energy_time = time.perf_counter() - start
+
+    start = time.perf_counter()
+    as_ints.energies(dets)
+    energies_time = time.perf_counter() - start
+
+    print(f"\n  {'Kernel':<34} {'Elements':>10} {'Elements/s':>14}")
+    print(f"  {'slater_rules_single_alpha':<34} {nelements:>10} {nelements / scalar_time:>14.3e}")
+    print(f"  {'slater_rules_single_alpha_batch':<34} {nelements:>10} {nelements / batch_time:>14.3e}")
+    print(f"  {'energy':<34} {len(dets):>10} {len(dets) / energy_time:>14.3e}")
+    print(f"  {'energies':<34} {len(dets):>10} {len(dets) / energies_time:>14.3e}")
+
+
+if __name__ == "__main__":
+    test_slater_rules_batch()
+    benchmark_slater_rules_batch()